@@ -30,6 +30,7 @@ extern bool mat_mul(void);
 extern bool norm_sq(void);
 extern bool tangent(void);
 extern bool base2ad(void);
+extern bool batch(void);
 extern bool reciprocal(void);
 extern bool dynamic(void);
 extern bool forward(void);
@@ -52,6 +53,7 @@ int main(void)
     Run( norm_sq, "norm_sq" );
     Run( tangent, "tangent" );
     Run( base2ad, "base2ad" );
+    Run( batch,               "batch"          );
     Run( reciprocal, "reciprocal" );
     Run( dynamic,             "dynamic"        );
     Run( forward,             "forward"        );
@@ -0,0 +1,280 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_three_batch.cpp$$
+$spell
+$$
+
+$section Atomic Functions Batches of Calls: Example and Test$$
+
+$head Purpose$$
+This example demonstrates evaluating many calls to an
+$cref atomic_three$$ function using one call to
+$cref/forward_batch/atomic_three_batch/$$ and
+$cref/reverse_batch/atomic_three_batch/$$.
+
+$head Function$$
+For this example, the atomic function
+$latex g : \B{R}^2 \rightarrow \B{R}^2$$ is defined by
+$latex \[
+g(x) = \left( \begin{array}{c}
+    x_0 * x_1 \\
+    x_0 * x_0
+\end{array} \right)
+\] $$
+
+$nospell
+
+$head Start Class Definition$$
+$srccode%cpp% */
+# include <cppad/cppad.hpp>
+namespace {          // isolate items below to this file
+using CppAD::vector; // abbreviate as vector
+//
+class atomic_batch : public CppAD::atomic_three<double> {
+/* %$$
+$head Constructor$$
+$srccode%cpp% */
+private:
+    // maximum number of calls in a batch
+    size_t max_call_;
+public:
+    // number of calls to forward_batch and reverse_batch
+    size_t n_forward_batch, n_reverse_batch;
+    // maximum value of n_call during the calls to forward_batch
+    size_t max_forward_call;
+    //
+    atomic_batch(const std::string& name, size_t max_call) :
+    CppAD::atomic_three<double>(name) ,
+    max_call_(max_call)               ,
+    n_forward_batch(0)                ,
+    n_reverse_batch(0)                ,
+    max_forward_call(0)
+    { }
+private:
+/* %$$
+$head for_type$$
+$srccode%cpp% */
+    virtual bool for_type(
+        const vector<double>&               parameter_x ,
+        const vector<CppAD::ad_type_enum>&  type_x      ,
+        vector<CppAD::ad_type_enum>&        type_y      )
+    {   assert( parameter_x.size() == type_x.size() );
+        bool ok = type_x.size() == 2; // n
+        ok     &= type_y.size() == 2; // m
+        if( ! ok )
+            return false;
+        type_y[0] = std::max(type_x[0], type_x[1]);
+        type_y[1] = type_x[0];
+        return true;
+    }
+/* %$$
+$head forward$$
+$srccode%cpp% */
+    virtual bool forward(
+        const vector<double>&               parameter_x ,
+        const vector<CppAD::ad_type_enum>&  type_x      ,
+        size_t                              need_y      ,
+        size_t                              order_low   ,
+        size_t                              order_up    ,
+        const vector<double>&               taylor_x    ,
+        vector<double>&                     taylor_y    )
+    {   if( order_up != 0 )
+            return false;
+        taylor_y[0] = taylor_x[0] * taylor_x[1];
+        taylor_y[1] = taylor_x[0] * taylor_x[0];
+        return true;
+    }
+/* %$$
+$head reverse$$
+$srccode%cpp% */
+    virtual bool reverse(
+        const vector<double>&               parameter_x ,
+        const vector<CppAD::ad_type_enum>&  type_x      ,
+        size_t                              order_up    ,
+        const vector<double>&               taylor_x    ,
+        const vector<double>&               taylor_y    ,
+        vector<double>&                     partial_x   ,
+        const vector<double>&               partial_y   )
+    {   if( order_up != 0 )
+            return false;
+        partial_x[0] = partial_y[0] * taylor_x[1]
+                     + partial_y[1] * 2.0 * taylor_x[0];
+        partial_x[1] = partial_y[0] * taylor_x[0];
+        return true;
+    }
+/* %$$
+$head batch_size$$
+$srccode%cpp% */
+    virtual size_t batch_size(void)
+    {   return max_call_; }
+/* %$$
+$head forward_batch$$
+$srccode%cpp% */
+    virtual bool forward_batch(
+        size_t                              n_call      ,
+        const vector<double>&               parameter_x ,
+        const vector<CppAD::ad_type_enum>&  type_x      ,
+        const vector<double>&               taylor_x    ,
+        vector<double>&                     taylor_y    )
+    {   ++n_forward_batch;
+        max_forward_call = std::max(max_forward_call, n_call);
+        // component j of x for call c is taylor_x[j * n_call + c]
+        const double* x0 = taylor_x.data();
+        const double* x1 = x0 + n_call;
+        double*       y0 = taylor_y.data();
+        double*       y1 = y0 + n_call;
+        for(size_t c = 0; c < n_call; ++c)
+        {   y0[c] = x0[c] * x1[c];
+            y1[c] = x0[c] * x0[c];
+        }
+        return true;
+    }
+/* %$$
+$head reverse_batch$$
+$srccode%cpp% */
+    virtual bool reverse_batch(
+        size_t                              n_call      ,
+        const vector<double>&               parameter_x ,
+        const vector<CppAD::ad_type_enum>&  type_x      ,
+        const vector<double>&               taylor_x    ,
+        const vector<double>&               taylor_y    ,
+        vector<double>&                     partial_x   ,
+        const vector<double>&               partial_y   )
+    {   ++n_reverse_batch;
+        const double* x0  = taylor_x.data();
+        const double* x1  = x0 + n_call;
+        const double* py0 = partial_y.data();
+        const double* py1 = py0 + n_call;
+        double*       px0 = partial_x.data();
+        double*       px1 = px0 + n_call;
+        for(size_t c = 0; c < n_call; ++c)
+        {   px0[c] = py0[c] * x1[c] + py1[c] * 2.0 * x0[c];
+            px1[c] = py0[c] * x0[c];
+        }
+        return true;
+    }
+}; // End of atomic_batch class
+}  // End empty namespace
+
+/* %$$
+$head Use Atomic Function$$
+$srccode%cpp% */
+bool batch(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps = 10. * CppAD::numeric_limits<double>::epsilon();
+    //
+    // afun_batch uses batches of at most 4 calls, afun_one does not
+    atomic_batch afun_batch("atomic_batch", 4);
+    atomic_batch afun_one("atomic_one", 0);
+    //
+    // Create the function f(x)
+    size_t n = 6;
+    vector< AD<double> > ax(n), au(2), av(2), ar(2 * n), ay(1);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1) / double(n);
+    CppAD::Independent(ax);
+    //
+    // The second argument to the first call is a parameter.
+    // The calls for k = 0, ..., n-1 do not depend on each other and
+    // their results are not used until after the last of these calls.
+    AD<double> asum = 0.0;
+    for(size_t k = 0; k < n; ++k)
+    {   au[0] = ax[k];
+        if( k == 0 )
+            au[1] = 2.0;
+        else
+            au[1] = ax[k-1];
+        afun_batch(au, av);
+        ar[2 * k]     = av[0];
+        ar[2 * k + 1] = av[1];
+    }
+    for(size_t i = 0; i < 2 * n; ++i)
+        asum += ar[i];
+    // This call depends on the previous calls, so they are evaluated
+    // before its arguments are used.
+    au[0] = asum;
+    au[1] = ax[0];
+    afun_batch(au, av);
+    ay[0] = av[0];
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // Same function using afun_one
+    CppAD::Independent(ax);
+    asum = 0.0;
+    for(size_t k = 0; k < n; ++k)
+    {   au[0] = ax[k];
+        if( k == 0 )
+            au[1] = 2.0;
+        else
+            au[1] = ax[k-1];
+        afun_one(au, av);
+        ar[2 * k]     = av[0];
+        ar[2 * k + 1] = av[1];
+    }
+    for(size_t i = 0; i < 2 * n; ++i)
+        asum += ar[i];
+    au[0] = asum;
+    au[1] = ax[0];
+    afun_one(au, av);
+    ay[0] = av[0];
+    CppAD::ADFun<double> g(ax, ay);
+    //
+    // zero order forward
+    vector<double> x(n), yf(1), yg(1);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = double(j + 2);
+    afun_batch.n_forward_batch  = 0;
+    afun_batch.max_forward_call = 0;
+    yf = f.Forward(0, x);
+    yg = g.Forward(0, x);
+    ok &= NearEqual(yf[0], yg[0], eps, eps);
+    //
+    // the six independent calls use two batches (4 + 2),
+    // the dependent call is a batch with one call
+    ok &= afun_batch.n_forward_batch  == 3;
+    ok &= afun_batch.max_forward_call == 4;
+    ok &= afun_one.n_forward_batch    == 0;
+    //
+    // check the value
+    double sum = 0.0;
+    for(size_t k = 0; k < n; ++k)
+    {   double u1 = 2.0;
+        if( k > 0 )
+            u1 = x[k-1];
+        sum += x[k] * u1 + x[k] * x[k];
+    }
+    ok &= NearEqual(yf[0], sum * x[0], eps, eps);
+    //
+    // first order reverse
+    vector<double> w(1), dwf(n), dwg(n);
+    w[0] = 1.0;
+    afun_batch.n_reverse_batch = 0;
+    dwf = f.Reverse(1, w);
+    dwg = g.Reverse(1, w);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual(dwf[j], dwg[j], eps, eps);
+    ok &= afun_batch.n_reverse_batch == 3;
+    ok &= afun_one.n_reverse_batch   == 0;
+    //
+    // check the partial w.r.t. x[n-1] which is only used by the call k = n-1
+    double check = (x[n-2] + 2.0 * x[n-1]) * x[0];
+    ok &= NearEqual(dwf[n-1], check, eps, eps);
+    //
+    return ok;
+}
+/* %$$
+$$ $comment end nospell$$
+$end
+*/
@@ -0,0 +1,174 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin binary_tape.cpp$$
+$spell
+$$
+
+$section Save and Load Using a Binary Format: Example and Test$$
+
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+# include <sstream>
+# include <cstring>
+bool binary_tape(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // independent dynamic parameter vector
+    size_t np = 1;
+    CppAD::vector< AD<double> > ap(np);
+    ap[0] = 2.0;
+
+    // independent variable vector
+    size_t n = 2;
+    CppAD::vector< AD<double> > ax(n);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+    Independent(ax, ap);
+
+    // range space vector
+    size_t m = 3;
+    CppAD::vector< AD<double> > ay(m);
+    ay[0] = ap[0] * exp(ax[0]) * sin(ax[1]);
+    ay[1] = CondExpLt(ax[0], ax[1], ax[0] / ax[1], ax[1] / ax[0]);
+    ay[2] = 2.0 * ap[0];
+
+    // create f : x -> y
+    CppAD::ADFun<double> f(ax, ay);
+
+    // write f using the binary format (this could be a std::ofstream
+    // opened with std::ios::binary)
+    std::stringstream stream;
+    f.to_binary(stream);
+
+    // read the operation sequence into g
+    CppAD::ADFun<double> g;
+    g.from_binary(stream);
+    ok &= g.Domain()   == n;
+    ok &= g.Range()    == m;
+    ok &= g.size_var() == f.size_var();
+    ok &= g.size_op()  == f.size_op();
+    ok &= g.size_par() == f.size_par();
+
+    // zero order forward mode for f and g
+    CppAD::vector<double> x(n), yf(m), yg(m);
+    x[0] = 1.5;
+    x[1] = 0.5;
+    yf   = f.Forward(0, x);
+    yg   = g.Forward(0, x);
+    for(size_t i = 0; i < m; ++i)
+        ok &= yf[i] == yg[i];
+    ok &= NearEqual(yg[1], x[1] / x[0], eps99, eps99);
+
+    // first order reverse mode for f and g
+    CppAD::vector<double> w(m), dwf(n), dwg(n);
+    w[0] = 1.0;
+    w[1] = 2.0;
+    w[2] = 3.0;
+    dwf  = f.Reverse(1, w);
+    dwg  = g.Reverse(1, w);
+    for(size_t j = 0; j < n; ++j)
+        ok &= dwf[j] == dwg[j];
+
+    // the dynamic parameter can be changed in g
+    CppAD::vector<double> p(np);
+    p[0] = 3.0;
+    g.new_dynamic(p);
+    yg     = g.Forward(0, x);
+    double check = p[0] * std::exp(x[0]) * std::sin(x[1]);
+    ok    &= NearEqual(yg[0], check, eps99, eps99);
+    ok    &= NearEqual(yg[2], 2.0 * p[0], eps99, eps99);
+
+    return ok;
+}
+
+// END C++
+
+// Check that a truncated or corrupt stream is reported using the
+// ErrorHandler (not part of the documentation for this example).
+namespace {
+    void binary_tape_handler(
+        bool known, int line, const char* file, const char* exp,
+        const char* msg )
+    {   // error handler must not return, so throw an exception
+        throw std::string(msg);
+    }
+    // result of from_binary for the contents of a stream
+    std::string binary_tape_read(const std::string& contents)
+    {   std::stringstream stream(contents);
+        CppAD::ADFun<double> g;
+        CppAD::ErrorHandler info(binary_tape_handler);
+        std::string msg = "";
+        try
+        {   g.from_binary(stream); }
+        catch(const std::string& m)
+        {   msg = m; }
+        return msg;
+    }
+}
+bool binary_tape_corrupt(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    // f(x) = x[0] * x[1]
+    size_t n = 2;
+    CppAD::vector< AD<double> > ax(n), ay(1);
+    ax[0] = 1.0;
+    ax[1] = 2.0;
+    Independent(ax);
+    ay[0] = ax[0] * ax[1];
+    CppAD::ADFun<double> f(ax, ay);
+    std::stringstream stream;
+    f.to_binary(stream);
+    std::string contents = stream.str();
+    std::string error    = "from_binary: error reading the binary tape";
+    //
+    // the original stream can be read
+    ok &= binary_tape_read(contents) == "";
+    //
+    // truncated stream
+    ok &= binary_tape_read( contents.substr(0, contents.size() / 2) ) == error;
+    //
+    // replace the size of the function name, which follows the magic
+    // string, version, and sizes, by a very large value
+    size_t offset = std::strlen("CppAD binary tape") + 1 + 5;
+    size_t huge   = std::numeric_limits<size_t>::max() / 2;
+    std::string corrupt = contents;
+    corrupt.replace(
+        offset, sizeof(size_t),
+        reinterpret_cast<const char*>(&huge), sizeof(size_t)
+    );
+    ok &= binary_tape_read(corrupt) == error;
+    //
+    // replace the size of ind_taddr_, which follows the name,
+    // has_been_optimized_, and num_var_tape_, by a very large value
+    size_t name_size;
+    std::memcpy(&name_size, contents.data() + offset, sizeof(size_t));
+    offset += sizeof(size_t) + name_size + sizeof(bool) + sizeof(size_t);
+    corrupt = contents;
+    corrupt.replace(
+        offset, sizeof(size_t),
+        reinterpret_cast<const char*>(&huge), sizeof(size_t)
+    );
+    ok &= binary_tape_read(corrupt) == error;
+    //
+    return ok;
+}
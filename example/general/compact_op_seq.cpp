@@ -0,0 +1,130 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin compact_op_seq.cpp$$
+$spell
+$$
+
+$section Compact Storage of an Operation Sequence: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool compact_op_seq(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // independent variable vector
+    size_t n = 2;
+    CppAD::vector< AD<double> > ax(n);
+    ax[0] = 0.5;
+    ax[1] = 1.5;
+    Independent(ax);
+
+    // a VecAD vector
+    CppAD::VecAD<double> av(2);
+    av[ AD<double>(0) ] = ax[0];
+    av[ AD<double>(1) ] = ax[1];
+
+    // range space vector
+    size_t m = 3;
+    CppAD::vector< AD<double> > ay(m);
+    ay[0] = ax[0] + ax[1] + 2.0 * ax[0] * exp( ax[1] );
+    for(size_t k = 0; k < 200; ++k)
+        ay[0] = sin( ay[0] ) + ax[1];
+    ay[1] = CondExpLt(ax[0], ax[1], ax[0] / ax[1], ax[1] * ax[0]);
+    ay[2] = av[ ax[0] - ax[0] + 1.0 ] * ax[0];
+
+    // create f : x -> y and optimize it (the optimized operation sequence
+    // contains cumulative summation operators)
+    CppAD::ADFun<double> f(ax, ay);
+    f.optimize();
+
+    // g is a copy of f that does not use the compact encoding
+    CppAD::ADFun<double> g;
+    g = f;
+    ok &= ! g.compact_op_seq();
+
+    // use the compact encoding for f
+    size_t size_before = f.size_op_seq();
+    f.compact_op_seq(true);
+    ok &= f.compact_op_seq();
+    ok &= f.size_op_seq() < size_before;
+
+    // the number of operators and arguments does not change
+    ok &= f.size_op()     == g.size_op();
+    ok &= f.size_op_arg() == g.size_op_arg();
+
+    // zero and first order forward
+    CppAD::vector<double> x(n), dx(n), yf(m), yg(m);
+    x[0]  = 0.3;
+    x[1]  = 0.7;
+    dx[0] = 1.0;
+    dx[1] = 2.0;
+    yf    = f.Forward(0, x);
+    yg    = g.Forward(0, x);
+    for(size_t i = 0; i < m; ++i)
+        ok &= yf[i] == yg[i];
+    ok   &= NearEqual(yf[1], x[0] / x[1], eps99, eps99);
+    ok   &= NearEqual(yf[2], x[1] * x[0], eps99, eps99);
+    yf    = f.Forward(1, dx);
+    yg    = g.Forward(1, dx);
+    for(size_t i = 0; i < m; ++i)
+        ok &= yf[i] == yg[i];
+
+    // second order reverse
+    CppAD::vector<double> w(m), dwf(2 * n), dwg(2 * n);
+    w[0] = 1.0;
+    w[1] = 2.0;
+    w[2] = 3.0;
+    dwf  = f.Reverse(2, w);
+    dwg  = g.Reverse(2, w);
+    for(size_t j = 0; j < 2 * n; ++j)
+        ok &= dwf[j] == dwg[j];
+
+    // Jacobian sparsity pattern
+    CppAD::vectorBool r(n * n), sf(m * n), sg(m * n);
+    for(size_t j = 0; j < n; ++j)
+        for(size_t k = 0; k < n; ++k)
+            r[ j * n + k ] = j == k;
+    sf = f.ForSparseJac(n, r);
+    sg = g.ForSparseJac(n, r);
+    for(size_t k = 0; k < m * n; ++k)
+        ok &= sf[k] == sg[k];
+
+    // a copy of f also uses the compact encoding
+    CppAD::ADFun<double> h;
+    h = f;
+    ok &= h.compact_op_seq();
+    yf  = h.Forward(0, x);
+    yg  = g.Forward(0, x);
+    for(size_t i = 0; i < m; ++i)
+        ok &= yf[i] == yg[i];
+
+    // return to the normal encoding
+    f.compact_op_seq(false);
+    ok &= ! f.compact_op_seq();
+    ok &= f.size_op_seq() == size_before;
+    yf  = f.Forward(0, x);
+    for(size_t i = 0; i < m; ++i)
+        ok &= yf[i] == yg[i];
+
+    return ok;
+}
+
+// END C++
@@ -0,0 +1,86 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin forward_batch.cpp$$
+$spell
+$$
+
+$section Zero Order Forward for a Batch of Points: Example and Test$$
+
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool forward_batch(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // independent variable vector
+    size_t n = 2;
+    CppAD::vector< AD<double> > ax(n);
+    ax[0] = 0.5;
+    ax[1] = 2.0;
+    Independent(ax);
+
+    // range space vector
+    size_t m = 2;
+    CppAD::vector< AD<double> > ay(m);
+    ay[0] = exp(ax[0]) * sin(ax[1]);
+    ay[1] = CondExpLt(ax[0], ax[1], ax[0] / ax[1], pow(ax[0], ax[1]));
+
+    // create function object f : x -> y
+    CppAD::ADFun<double> f(ax, ay);
+
+    // values of x at K points, x[j * K + k] is x_j at the k-th point
+    size_t K = 5;
+    CppAD::vector<double> x(n * K);
+    for(size_t k = 0; k < K; ++k)
+    {   x[0 * K + k] = 0.5 + double(k);
+        x[1 * K + k] = 3.0 - double(k);
+    }
+
+    // evaluate f at all the points, y[i * K + k] is y_i at the k-th point
+    CppAD::vector<double> y = f.forward_batch(K, x);
+
+    // check the values
+    ok &= y.size() == m * K;
+    for(size_t k = 0; k < K; ++k)
+    {   double x0    = x[0 * K + k];
+        double x1    = x[1 * K + k];
+        double check = std::exp(x0) * std::sin(x1);
+        ok &= NearEqual(y[0 * K + k], check, eps99, eps99);
+        if( x0 < x1 )
+            check = x0 / x1;
+        else
+            check = std::pow(x0, x1);
+        ok &= NearEqual(y[1 * K + k], check, eps99, eps99);
+    }
+
+    // the Taylor coefficients stored in f are not affected
+    ok &= f.size_order() == 1;
+    CppAD::vector<double> w(m), dw(n);
+    w[0] = 1.0;
+    w[1] = 0.0;
+    dw   = f.Reverse(1, w);
+    double check = std::exp(0.5) * std::sin(2.0);
+    ok &= NearEqual(dw[0], check, eps99, eps99);
+
+    return ok;
+}
+
+// END C++
@@ -0,0 +1,95 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin forward_direct.cpp$$
+$spell
+$$
+
+$section Direct Dispatch Zero Order Forward: Example and Test$$
+
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool forward_direct(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // independent variable vector
+    CppAD::vector< AD<double> > ax(2);
+    ax[0] = 0.5;
+    ax[1] = 2.0;
+    Independent(ax);
+
+    // a function that uses many different operators
+    CppAD::vector< AD<double> > ay(3);
+    AD<double> asum = ax[0] + ax[1] + 1.0;
+    ay[0] = exp(ax[0]) * sin(ax[1]) / asum;
+    ay[1] = CondExpLt(ax[0], ax[1], sqrt(ax[1]), pow(ax[0], ax[1]));
+    ay[2] = 3.0;
+
+    // create function object f : x -> y
+    CppAD::ADFun<double> f(ax, ay);
+
+    // default value for this option
+    ok &= f.forward_direct() == false;
+
+    // turn on direct dispatch
+    f.forward_direct(true);
+    ok &= f.forward_direct() == true;
+
+    // evaluate f(x) for some different values of x
+    CppAD::vector<double> x(2), y(3);
+    for(size_t k = 0; k < 3; ++k)
+    {   x[0] = 0.5 + double(k);
+        x[1] = 2.0 - double(k) / 2.0;
+        y    = f.Forward(0, x);
+        //
+        double sum   = x[0] + x[1] + 1.0;
+        double check = std::exp(x[0]) * std::sin(x[1]) / sum;
+        ok &= NearEqual(y[0], check, eps99, eps99);
+        if( x[0] < x[1] )
+            check = std::sqrt(x[1]);
+        else
+            check = std::pow(x[0], x[1]);
+        ok &= NearEqual(y[1], check, eps99, eps99);
+        ok &= y[2] == 3.0;
+    }
+
+    // derivatives computed after a direct zero order forward
+    CppAD::vector<double> w(3), dw(2);
+    w[0] = 1.0;
+    w[1] = 0.0;
+    w[2] = 0.0;
+    dw   = f.Reverse(1, w);
+    double sum   = x[0] + x[1] + 1.0;
+    double check = std::exp(x[0]) * std::sin(x[1]) / sum
+                 - std::exp(x[0]) * std::sin(x[1]) / (sum * sum);
+    ok &= NearEqual(dw[0], check, eps99, eps99);
+
+    // this option is not affected by optimize
+    f.optimize();
+    ok &= f.forward_direct() == true;
+    y = f.Forward(0, x);
+    check = std::exp(x[0]) * std::sin(x[1]) / sum;
+    ok &= NearEqual(y[0], check, eps99, eps99);
+
+    return ok;
+}
+
+// END C++
@@ -111,9 +111,12 @@ extern bool atanh(void);
 extern bool azmul(void);
 extern bool base2ad(void);
 extern bool base_require(void);
+extern bool binary_tape(void);
+extern bool binary_tape_corrupt(void);
 extern bool capacity_order(void);
 extern bool change_param(void);
 extern bool check_for_nan(void);
+extern bool compact_op_seq(void);
 extern bool compare_change(void);
 extern bool complex_poly(void);
 extern bool con_dyn_var(void);
@@ -124,11 +127,14 @@ extern bool erfc(void);
 extern bool exp(void);
 extern bool expm1(void);
 extern bool fabs(void);
+extern bool forward_batch(void);
 extern bool forward_dir(void);
+extern bool forward_direct(void);
 extern bool forward_order(void);
 extern bool fun_assign(void);
 extern bool interp_onetape(void);
 extern bool interp_retape(void);
+extern bool jit(void);
 extern bool log(void);
 extern bool log10(void);
 extern bool log1p(void);
@@ -144,14 +150,19 @@ extern bool opt_val_hes(void);
 extern bool pow(void);
 extern bool pow_int(void);
 extern bool print_for(void);
+extern bool record_option(void);
 extern bool rev_checkpoint(void);
+extern bool reverse_budget(void);
 extern bool reverse_one(void);
+extern bool reverse_repeat(void);
 extern bool reverse_three(void);
 extern bool reverse_two(void);
 extern bool rosen_34(void);
 extern bool runge_45(void);
 extern bool seq_property(void);
+extern bool share_op_seq(void);
 extern bool sign(void);
+extern bool tape_cache(void);
 extern bool taylor_ode(void);
 extern bool vec_ad(void);
 // END_SORT_THIS_LINE_MINUS_1
@@ -230,8 +241,11 @@ int main(void)
     Run( azmul,             "azmul"            );
     Run( base2ad,           "base2ad"          );
     Run( base_require,      "base_require"     );
+    Run( binary_tape,       "binary_tape"      );
+    Run( binary_tape_corrupt, "binary_tape_corrupt" );
     Run( capacity_order,    "capacity_order"   );
     Run( change_param,      "change_param"     );
+    Run( compact_op_seq,    "compact_op_seq"   );
     Run( compare_change,    "compare_change"   );
     Run( complex_poly,      "complex_poly"     );
     Run( con_dyn_var,       "con_dyn_var"      );
@@ -240,11 +254,14 @@ int main(void)
     Run( exp,               "exp"              );
     Run( expm1,             "expm1"            );
     Run( fabs,              "fabs"             );
+    Run( forward_batch,     "forward_batch"    );
     Run( forward_dir,       "forward_dir"      );
+    Run( forward_direct,    "forward_direct"   );
     Run( forward_order,     "forward_order"    );
     Run( fun_assign,        "fun_assign"       );
     Run( interp_onetape,    "interp_onetape"   );
     Run( interp_retape,     "interp_retape"    );
+    Run( jit,               "jit"              );
     Run( log,               "log"              );
     Run( log10,             "log10"            );
     Run( log1p,             "log1p"            );
@@ -257,14 +274,19 @@ int main(void)
     Run( opt_val_hes,       "opt_val_hes"      );
     Run( pow,               "pow"              );
     Run( pow_int,           "pow_int"          );
+    Run( record_option,     "record_option"    );
     Run( rev_checkpoint,    "rev_checkpoint"   );
+    Run( reverse_budget,    "reverse_budget"   );
     Run( reverse_one,       "reverse_one"      );
+    Run( reverse_repeat,    "reverse_repeat"   );
     Run( reverse_three,     "reverse_three"    );
     Run( reverse_two,       "reverse_two"      );
     Run( rosen_34,          "rosen_34"         );
     Run( runge_45,        "runge_45"       );
     Run( seq_property,      "seq_property"     );
+    Run( share_op_seq,      "share_op_seq"     );
     Run( sign,              "sign"             );
+    Run( tape_cache,        "tape_cache"       );
     Run( taylor_ode,        "ode_taylor"       );
     Run( vec_ad,            "vec_ad"           );
     // END_SORT_THIS_LINE_MINUS_1
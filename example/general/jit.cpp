@@ -0,0 +1,112 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin jit.cpp$$
+$spell
+    jit
+    cmake
+    msg
+$$
+
+$section Compile an Operation Sequence: Example and Test$$
+
+$head Requirements$$
+This example passes even if the compiled code is not used; see
+$cref/requirements/jit/Requirements/$$.
+The CppAD $code cmake$$ scripts define
+$cref/CPPAD_USE_JIT/jit/CPPAD_USE_JIT/$$ when compiling this example.
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool jit(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // independent variable vector
+    CppAD::vector< AD<double> > ax(2);
+    ax[0] = 0.5;
+    ax[1] = 2.0;
+    Independent(ax);
+
+    // a function that uses many different operators
+    CppAD::vector< AD<double> > ay(2);
+    AD<double> asum = ax[0] + ax[1] + 1.0;
+    ay[0] = exp(ax[0]) * sin(ax[1]) / asum;
+    ay[1] = CondExpLt(ax[0], ax[1], sqrt(ax[1]), ax[0] * ax[1]);
+
+    // create function object f : x -> y
+    CppAD::ADFun<double> f(ax, ay);
+
+    // default value for this option
+    ok &= f.jit() == false;
+
+    // turn on compiling the operation sequence
+    f.jit(true);
+    ok &= f.jit() == true;
+
+    // evaluate f(x) and its derivative for some different values of x
+    CppAD::vector<double> x(2), y(2), w(2), dw(2);
+    for(size_t k = 0; k < 3; ++k)
+    {   x[0] = 0.5 + double(k);
+        x[1] = 2.0 - double(k) / 2.0;
+        y    = f.Forward(0, x);
+        //
+        double sum   = x[0] + x[1] + 1.0;
+        double check = std::exp(x[0]) * std::sin(x[1]) / sum;
+        ok &= NearEqual(y[0], check, eps99, eps99);
+        if( x[0] < x[1] )
+            check = std::sqrt(x[1]);
+        else
+            check = x[0] * x[1];
+        ok &= NearEqual(y[1], check, eps99, eps99);
+        //
+        // derivative of y[0] + y[1]
+        w[0] = 1.0;
+        w[1] = 1.0;
+        dw   = f.Reverse(1, w);
+        check  = std::exp(x[0]) * std::sin(x[1]) / sum;
+        check -= std::exp(x[0]) * std::sin(x[1]) / (sum * sum);
+        if( x[0] >= x[1] )
+            check += x[1];
+        ok &= NearEqual(dw[0], check, eps99, eps99);
+        check  = std::exp(x[0]) * std::cos(x[1]) / sum;
+        check -= std::exp(x[0]) * std::sin(x[1]) / (sum * sum);
+        if( x[0] < x[1] )
+            check += 0.5 / std::sqrt(x[1]);
+        else
+            check += x[0];
+        ok &= NearEqual(dw[1], check, eps99, eps99);
+    }
+
+    // the reason that the compiled code is not being used (if it is not)
+    std::string msg = f.jit_msg();
+    ok &= msg == "" || msg.substr(0, 5) == "jit: ";
+
+    // this option is not affected by optimize
+    f.optimize();
+    ok &= f.jit() == true;
+    y = f.Forward(0, x);
+    double sum   = x[0] + x[1] + 1.0;
+    double check = std::exp(x[0]) * std::sin(x[1]) / sum;
+    ok &= NearEqual(y[0], check, eps99, eps99);
+
+    return ok;
+}
+
+// END C++
@@ -112,6 +112,20 @@ bool new_dynamic(void)
     ok   &= f.size_order() == 2;
     check = (dynamic[2] + x[1])*(dynamic[0] + 2.0 + x[0] + dynamic[1] + x[0]);
     ok  &= NearEqual(dy[0] , check, eps, eps);
+
+    // only change dynamic[0]; this only recomputes the dynamic parameters
+    // that depend on dynamic[0]; i.e., dynamic[0] + 2.0
+    CPPAD_TESTVECTOR(size_t) changed(1);
+    changed[0] = 0;
+    dynamic[0] = 5.0;
+    f.new_dynamic(dynamic, changed);
+    ok  &= f.size_order() == 0;
+    //
+    y    = f.Forward(0, x);
+    check  = dynamic[0] + 2.0 + x[0];
+    check *= dynamic[1] + x[0];
+    check *= dynamic[2] + x[1];
+    ok  &= NearEqual(y[0] , check, eps, eps);
     //
     return ok;
 }
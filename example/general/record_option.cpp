@@ -0,0 +1,92 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin record_option.cpp$$
+$spell
+$$
+
+$section Recording Options: Example and Test$$
+
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+
+# include <cppad/cppad.hpp>
+
+namespace {
+    // record f(x) = sum_k c_k * x[0] where each c_k is used twice
+    void record(
+        const std::string& method, size_t num_con, CppAD::ADFun<double>& f
+    )
+    {   using CppAD::AD;
+        CPPAD_TESTVECTOR(AD<double>) ax(1), ay(1);
+        ax[0] = 1.0;
+        CppAD::Independent(ax);
+        //
+        // expected number of operators and parameters
+        size_t num_op  = 2 * (2 * num_con) + 3;
+        size_t num_par = 2 * num_con + 1;
+        AD<double>::record_reserve(num_op, num_par);
+        AD<double>::record_par_hash(method);
+        //
+        ay[0] = 0.0;
+        for(size_t pass = 0; pass < 2; ++pass)
+        {   for(size_t k = 0; k < num_con; ++k)
+            {   double c = double(k + 1) / 7.5;
+                ay[0]   += c * ax[0];
+            }
+        }
+        f.Dependent(ax, ay);
+    }
+}
+
+bool record_option(void)
+{   bool ok = true;
+    double eps = 10. * CppAD::numeric_limits<double>::epsilon();
+    //
+    size_t num_con = 100;
+    CPPAD_TESTVECTOR(double) x(1), y(1);
+    x[0] = 3.0;
+    //
+    // check value of f(x)
+    double check = 0.0;
+    for(size_t k = 0; k < num_con; ++k)
+        check += 2.0 * double(k + 1) / 7.5 * x[0];
+    //
+    // no_hash_table: each use of a constant is a separate parameter
+    // (the nan at index zero is also a parameter)
+    CppAD::ADFun<double> f;
+    record("no_hash_table", num_con, f);
+    ok &= f.size_par() == 2 * num_con + 1;
+    y   = f.Forward(0, x);
+    ok &= CppAD::NearEqual(y[0], check, eps, eps);
+    //
+    // grow_hash_table: each constant is only in the recording once
+    record("grow_hash_table", num_con, f);
+    ok &= f.size_par() == num_con + 1;
+    y   = f.Forward(0, x);
+    ok &= CppAD::NearEqual(y[0], check, eps, eps);
+    //
+    // fixed_hash_table: the default method
+    // (some of the duplicate constants may not be found)
+    record("fixed_hash_table", num_con, f);
+    ok &= f.size_par() <= 2 * num_con + 1;
+    y   = f.Forward(0, x);
+    ok &= CppAD::NearEqual(y[0], check, eps, eps);
+    //
+    return ok;
+}
+// END C++
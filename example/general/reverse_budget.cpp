@@ -0,0 +1,118 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin reverse_budget.cpp$$
+$spell
+    inuse
+$$
+
+$section Reverse Mode Using a Memory Budget: Example and Test$$
+
+$head Memory$$
+The discrete function $code record_inuse$$ is evaluated during
+the forward sweeps. It records the maximum value of
+$cref/thread_alloc::inuse/ta_inuse/$$ during the computation.
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+namespace {
+    // maximum value of inuse during calls to record_inuse
+    size_t max_inuse_ = 0;
+    //
+    // discrete function that records memory use (its value is zero)
+    double record_inuse(const double& x)
+    {   size_t thread = CppAD::thread_alloc::thread_num();
+        size_t inuse  = CppAD::thread_alloc::inuse(thread);
+        max_inuse_    = std::max(max_inuse_, inuse);
+        return 0.0;
+    }
+    CPPAD_DISCRETE_FUNCTION(double, record_inuse)
+}
+
+bool reverse_budget(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    using CppAD::thread_alloc;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    size_t thread = thread_alloc::thread_num();
+
+    // independent variable vector
+    size_t n = 2;
+    CppAD::vector< AD<double> > ax(n);
+    ax[0] = 0.5;
+    ax[1] = 0.7;
+    Independent(ax);
+
+    // a long chain of operations
+    size_t N = 2000;
+    AD<double> ay_k = ax[0];
+    for(size_t k = 0; k < N; ++k)
+    {   AD<double> az = sin(ay_k) * ax[1] + 0.5 * ax[0];
+        ay_k = CondExpLt(az, ax[0], az, ax[0] * az) + record_inuse(az);
+    }
+
+    // range space vector
+    size_t m = 2;
+    CppAD::vector< AD<double> > ay(m);
+    ay[0] = ay_k;
+    ay[1] = ax[0] * ay_k;
+
+    // create f : x -> y and free the memory used for its Taylor coefficients
+    CppAD::ADFun<double> f(ax, ay);
+    f.capacity_order(0);
+
+    // argument and weight vectors
+    CppAD::vector<double> x(n), w(m), dw(n), check(n);
+    x[0] = 0.3;
+    x[1] = 0.9;
+    w[0] = 1.0;
+    w[1] = 2.0;
+
+    // number of bytes used by Forward(0, x) and Reverse(1, w)
+    size_t full_bytes = 2 * f.size_var() * sizeof(double);
+
+    // memory budget for reverse_budget
+    size_t max_bytes = 20000;
+    ok &= 4 * max_bytes < full_bytes;
+
+    // compute the derivative using the memory budget
+    size_t inuse = thread_alloc::inuse(thread);
+    max_inuse_   = inuse;
+    dw           = f.reverse_budget(max_bytes, x, w);
+    ok          &= max_inuse_ - inuse <= max_bytes;
+
+    // no Taylor coefficients were stored in f
+    ok &= f.size_order() == 0;
+
+    // compute the derivative using Forward and Reverse
+    f.Forward(0, x);
+    check = f.Reverse(1, w);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual(dw[j], check[j], eps99, eps99);
+
+    // optimized operation sequence (includes cumulative summations)
+    f.optimize();
+    dw = f.reverse_budget(max_bytes, x, w);
+    for(size_t j = 0; j < n; ++j)
+        ok &= NearEqual(dw[j], check[j], eps99, eps99);
+
+    return ok;
+}
+
+// END C++
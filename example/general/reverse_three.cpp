@@ -144,3 +144,82 @@ bool reverse_three(void)
     return ok;
 }
 // END C++
+
+// Check the memory that Reverse keeps between calls
+// (not part of the documentation for this example).
+bool reverse_repeat(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::thread_alloc;
+    typedef std::vector<double> d_vector; // does not use thread_alloc
+    size_t thread = thread_alloc::thread_num();
+    //
+    // f(x) = x[0] * x[1] * exp( x[2] )
+    size_t n = 3;
+    CppAD::vector< AD<double> > ax(n), ay(1);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    ay[0] = ax[0] * ax[1] * exp( ax[2] );
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // memory in use when f has no Taylor coefficients
+    f.capacity_order(0);
+    size_t inuse_base = thread_alloc::inuse(thread);
+    //
+    // Taylor coefficients of order zero, one, and two
+    d_vector x(n), dx(n), ddx(n);
+    for(size_t j = 0; j < n; ++j)
+    {   x[j]   = 0.5 * double(j + 1);
+        dx[j]  = 1.0;
+        ddx[j] = double(j);
+    }
+    f.Forward(0, x);
+    f.Forward(1, dx);
+    f.Forward(2, ddx);
+    //
+    // memory used by a copy of f before Reverse is called
+    size_t inuse_copy;
+    {   CppAD::ADFun<double> g;
+        size_t inuse_before = thread_alloc::inuse(thread);
+        g = f;
+        inuse_copy = thread_alloc::inuse(thread) - inuse_before;
+    }
+    //
+    // call Reverse with different orders; use a copy that does not have
+    // the memory kept by Reverse to check each result
+    size_t q_list[] = { 3, 1, 2, 1, 3, 2 };
+    size_t inuse_reverse = 0;
+    for(size_t ell = 0; ell < 6; ++ell)
+    {   size_t   q = q_list[ell];
+        d_vector w(q), dw(n * q), check(n * q);
+        for(size_t k = 0; k < q; ++k)
+            w[k] = 1.0 / double(k + 1);
+        {   CppAD::ADFun<double> g;
+            g     = f;
+            check = g.Reverse(q, w);
+        }
+        dw = f.Reverse(q, w);
+        for(size_t i = 0; i < n * q; ++i)
+            ok &= dw[i] == check[i];
+        //
+        // after the first call, the memory does not change
+        if( ell == 0 )
+            inuse_reverse = thread_alloc::inuse(thread);
+        else
+            ok &= thread_alloc::inuse(thread) == inuse_reverse;
+    }
+    //
+    // the memory kept by Reverse is not copied by assignment
+    {   CppAD::ADFun<double> g;
+        size_t inuse_before = thread_alloc::inuse(thread);
+        g = f;
+        ok &= thread_alloc::inuse(thread) - inuse_before == inuse_copy;
+    }
+    //
+    // the memory kept by Reverse is freed by capacity_order(0)
+    f.capacity_order(0);
+    ok &= thread_alloc::inuse(thread) == inuse_base;
+    //
+    return ok;
+}
@@ -0,0 +1,94 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin share_op_seq.cpp$$
+$spell
+    op
+    seq
+$$
+
+$section Share an Operation Sequence: Example and Test$$
+
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool share_op_seq(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // independent dynamic parameter vector
+    size_t np = 1;
+    CppAD::vector< AD<double> > ap(np);
+    ap[0] = 2.0;
+
+    // independent variable vector
+    size_t n = 1;
+    CppAD::vector< AD<double> > ax(n);
+    ax[0] = 3.0;
+    Independent(ax, ap);
+
+    // range space vector
+    size_t m = 1;
+    CppAD::vector< AD<double> > ay(m);
+    ay[0] = ap[0] * exp(ax[0]);
+
+    // create f : x -> y
+    CppAD::ADFun<double> f(ax, ay);
+
+    // g uses the same operation sequence as f (it is not copied)
+    CppAD::ADFun<double> g;
+    g.share_op_seq(f);
+    ok &= g.Domain() == n;
+    ok &= g.Range()  == m;
+    ok &= g.size_var() == f.size_var();
+    ok &= g.size_order() == 0;
+
+    // f and g have separate dynamic parameter values
+    CppAD::vector<double> p(np);
+    p[0] = 5.0;
+    g.new_dynamic(p);
+
+    // f and g have separate Taylor coefficients
+    CppAD::vector<double> x(n), y(m), dx(n), dy(m);
+    x[0]  = 1.0;
+    dx[0] = 1.0;
+    y     = f.Forward(0, x);
+    ok   &= NearEqual(y[0], 2.0 * std::exp(1.0), eps99, eps99);
+    x[0]  = 0.5;
+    y     = g.Forward(0, x);
+    ok   &= NearEqual(y[0], 5.0 * std::exp(0.5), eps99, eps99);
+    dy    = f.Forward(1, dx);
+    ok   &= NearEqual(dy[0], 2.0 * std::exp(1.0), eps99, eps99);
+    dy    = g.Forward(1, dx);
+    ok   &= NearEqual(dy[0], 5.0 * std::exp(0.5), eps99, eps99);
+
+    // a new operation sequence for f does not change g
+    Independent(ax);
+    ay[0] = sin(ax[0]);
+    f.Dependent(ax, ay);
+    x[0]  = 0.5;
+    y     = f.Forward(0, x);
+    ok   &= NearEqual(y[0], std::sin(0.5), eps99, eps99);
+    y     = g.Forward(0, x);
+    ok   &= NearEqual(y[0], 5.0 * std::exp(0.5), eps99, eps99);
+
+    return ok;
+}
+
+// END C++
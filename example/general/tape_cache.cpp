@@ -0,0 +1,101 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin tape_cache.cpp$$
+$spell
+    Cpp
+$$
+
+$section Cache of Recordings Keyed by Comparison Results: Example and Test$$
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+namespace {
+    typedef CPPAD_TESTVECTOR(double)               d_vector;
+    typedef CPPAD_TESTVECTOR( CppAD::AD<double> )  a_vector;
+
+    // records f(x) = |x_0| * x_1 using an if statement
+    class record_fun {
+    public:
+        void operator()(CppAD::ADFun<double>& g, const d_vector& x)
+        {   a_vector ax(2), ay(1);
+            ax[0] = x[0];
+            ax[1] = x[1];
+            CppAD::Independent(ax);
+            if( ax[0] < 0.0 )
+                ay[0] = - ax[0] * ax[1];
+            else
+                ay[0] = ax[0] * ax[1];
+            g.Dependent(ax, ay);
+        }
+    };
+}
+
+bool tape_cache(void)
+{   bool ok = true;
+    using CppAD::NearEqual;
+    double eps = 10. * std::numeric_limits<double>::epsilon();
+    //
+    // cache with at most two recordings
+    size_t max_tape = 2;
+    CppAD::tape_cache<double> cache(max_tape);
+    record_fun record;
+    //
+    d_vector x(2), y(1), dw(2), w(1);
+    w[0] = 1.0;
+    //
+    // first call records the x_0 >= 0 branch
+    x[0] = 2.0;
+    x[1] = 3.0;
+    CppAD::ADFun<double>* f = &cache.forward(record, x, y);
+    ok &= NearEqual(y[0], x[0] * x[1], eps, eps);
+    ok &= cache.n_miss() == 1 && cache.n_hit() == 0;
+    //
+    // same branch, so no new recording
+    x[0] = 4.0;
+    f = &cache.forward(record, x, y);
+    ok &= NearEqual(y[0], x[0] * x[1], eps, eps);
+    ok &= cache.n_miss() == 1 && cache.n_hit() == 1;
+    //
+    // the x_0 < 0 branch requires a new recording
+    x[0] = -1.0;
+    f = &cache.forward(record, x, y);
+    ok &= NearEqual(y[0], - x[0] * x[1], eps, eps);
+    ok &= cache.n_miss() == 2 && cache.n_hit() == 1;
+    ok &= cache.size() == 2;
+    //
+    // the zero order Taylor coefficients in f correspond to x
+    dw = f->Reverse(1, w);
+    ok &= NearEqual(dw[0], - x[1], eps, eps);
+    ok &= NearEqual(dw[1], - x[0], eps, eps);
+    //
+    // both branches are now in the cache
+    for(size_t k = 0; k < 4; ++k)
+    {   x[0] = double(k) - 1.5;
+        f = &cache.forward(record, x, y);
+        ok &= NearEqual(y[0], std::fabs(x[0]) * x[1], eps, eps);
+    }
+    ok &= cache.n_miss() == 2 && cache.n_hit() == 5;
+    //
+    // clear the cache
+    cache.clear();
+    ok &= cache.size() == 0 && cache.n_hit() == 0 && cache.n_miss() == 0;
+    //
+    return ok;
+}
+// END C++
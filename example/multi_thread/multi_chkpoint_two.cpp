@@ -133,6 +133,12 @@ namespace {
     // We cannot be in parallel mode when this object is created or deleted.
     // We use a pointer so that there is no left over memory in thread zero.
     CppAD::chkpoint_two<double>* a_square_root_ = CPPAD_NULL;
+    //
+    // seconds for the first call to multi_chkpoint_two_run and
+    // bytes of memory per thread used by a_square_root_ to evaluate g(x),
+    // set by multi_chkpoint_two_time
+    double first_time_   = 0.0;
+    size_t thread_bytes_ = 0;
 
     // structure with information for one thread
     typedef struct {
@@ -531,6 +537,27 @@ $codei%
 $head num_solve$$
 This specifies the number of square roots that will be solved for.
 
+$head First Call$$
+The first call to $cref multi_chkpoint_two_run$$ is timed separately
+and not included in $icode time_out$$.
+It includes the time for each thread to set up
+its evaluation of the checkpoint function.
+The memory that the checkpoint function uses, for each thread,
+to evaluate $latex g(x)$$ is also measured.
+Both of these values are returned by
+$codei%
+    multi_chkpoint_two_first(%first_time%, %thread_bytes%)
+%$$
+which has prototype
+$codei%
+    void multi_chkpoint_two_first(double& %first_time%, size_t& %thread_bytes%)
+%$$
+The input values of its arguments do not matter.
+Upon return, $icode first_time$$ is the number of wall clock seconds
+for the first call to $code multi_chkpoint_two_run$$ and
+$icode thread_bytes$$ is the number of bytes of memory
+(per thread) for the most recent call to $code multi_chkpoint_two_time$$.
+
 $head ok$$
 The return value has prototype
 $codei%
@@ -561,6 +588,14 @@ namespace {
         return;
     }
     //
+    // memory currently in use by all the threads
+    size_t inuse_all(void)
+    {   size_t sum = 0;
+        for(size_t thread = 0; thread < CPPAD_MAX_NUM_THREADS; ++thread)
+            sum += thread_alloc::inuse(thread);
+        return sum;
+    }
+    //
     void test_repeat(size_t repeat)
     {   size_t i;
         for(i = 0; i < repeat; i++)
@@ -568,7 +603,11 @@ namespace {
         return;
     }
 }
-// This is the only routine that is accessible outside of this file
+// These are the only routines that are accessible outside of this file
+void multi_chkpoint_two_first(double& first_time, size_t& thread_bytes)
+{   first_time   = first_time_;
+    thread_bytes = thread_bytes_;
+}
 bool multi_chkpoint_two_time(
     double& time_out, double test_time, size_t num_threads, size_t num_solve
 )
@@ -585,6 +624,7 @@ bool multi_chkpoint_two_time(
         y_squared_[i_solve] = double(i_solve) + 2.0;
 
     // create a_square_root_ in sequential mode
+    size_t start_inuse = inuse_all();
     {   // create corresponding ADFun inside block so it gets destroyed
         // and does not have thread_alloc memory inuse at the end
         vector<a_double> au(2), ay(1);
@@ -604,6 +644,8 @@ bool multi_chkpoint_two_time(
             internal_bool, use_hes_sparsity, use_base2ad, use_in_parallel
         );
     }
+    // memory used by a_square_root_ before it is called
+    size_t create_inuse = inuse_all() - start_inuse;
 
     // create team of threads
     ok &= thread_alloc::in_parallel() == false;
@@ -615,6 +657,11 @@ bool multi_chkpoint_two_time(
     {   ok &= 1 == thread_alloc::num_threads();
     }
 
+    // time the first call
+    double start_time = CppAD::elapsed_seconds();
+    test_once();
+    first_time_ = CppAD::elapsed_seconds() - start_time;
+
     // run the test case and set the time return value
     time_out = CppAD::time_test(test_repeat, test_time);
 
@@ -624,7 +671,13 @@ bool multi_chkpoint_two_time(
     ok &= thread_alloc::in_parallel() == false;
 
     // must delete a_square_root_ in sequential mode
+    size_t delete_inuse = inuse_all();
     delete a_square_root_;
+    delete_inuse -= inuse_all();
+    //
+    // memory used by a_square_root_ to evaluate g(x) for each thread
+    thread_bytes_  = delete_inuse - create_inuse;
+    thread_bytes_ /= std::max(num_threads, size_t(1));
 
     // correctness check
     ok &= square_root_.size() == num_solve;
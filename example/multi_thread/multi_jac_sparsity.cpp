@@ -0,0 +1,534 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin multi_jac_sparsity_common$$
+$spell
+    jac
+$$
+
+$section Multi-Threaded Jacobian Sparsity Common Information$$
+
+$head Purpose$$
+This source code defines the function that we are computing the
+Jacobian sparsity pattern for and the common variables that are used by
+the $codei%multi_jac_sparsity_%name%$$ functions.
+
+$head Function$$
+For $icode%i% = 0 , %...% , %n%-1%$$,
+$latex \[
+    f_i (x) = \exp( x_i ) \sum_{\ell=0}^{b-1} x_{(i + \ell) \bmod n}
+\] $$
+where $icode n$$ is the $cref/size/multi_jac_sparsity_time/size/$$
+and $icode b$$ is the band width.
+The Jacobian of $latex f$$ has $icode b$$ non-zero entries in each row.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN COMMON C++%// END COMMON C++%
+1%$$
+
+$end
+*/
+// BEGIN COMMON C++
+// includes used by all source code in multi_jac_sparsity.cpp file
+# include <cppad/cppad.hpp>
+# include "multi_jac_sparsity.hpp"
+# include "team_thread.hpp"
+//
+namespace {
+    using CppAD::thread_alloc; // fast multi-threading memory allocator
+    using CppAD::vector;       // uses thread_alloc
+    //
+    typedef CppAD::AD<double>                    a_double;
+    typedef vector<size_t>                       s_vector;
+    typedef CppAD::sparse_rc<s_vector>           sparse_rc;
+    //
+    // band width for the function
+    const size_t band_ = 16;
+    //
+    // the function we are computing the Jacobian sparsity pattern for
+    template <class Vector>
+    void band_fun(const Vector& x, Vector& y)
+    {   size_t n = x.size();
+        for(size_t i = 0; i < n; i++)
+        {   typename Vector::value_type sum = 0.0;
+            for(size_t ell = 0; ell < band_; ell++)
+                sum += x[ (i + ell) % n ];
+            y[i] = exp( x[i] ) * sum;
+        }
+    }
+    //
+    // Number of threads, set by multi_jac_sparsity_time
+    // (zero means one thread with no multi-threading setup)
+    size_t num_threads_ = 0;
+    //
+    // Information that is shared by all the threads; i.e., set in
+    // sequential mode and only read during parallel mode.
+    // We use pointers so that there is no left over memory in thread zero.
+    CppAD::ADFun<double>* fun_      = CPPAD_NULL; // f(x)
+    sparse_rc*            identity_ = CPPAD_NULL; // pattern for R
+    //
+    // Result for all the threads; set by multi_jac_sparsity_takedown
+    // by merging the results for each thread.
+    sparse_rc* pattern_ = CPPAD_NULL;
+    //
+    // structure with information for one thread
+    typedef struct {
+        // object that shares fun_ operation sequence,
+        // set by multi_jac_sparsity_setup
+        CppAD::ADFun<double>* fun;
+        //
+        // pattern for the columns computed by this thread, set by worker
+        sparse_rc* pattern;
+        //
+        // false if an error occurs, true otherwise, set by worker
+        bool ok;
+    } work_one_t;
+    //
+    // Vector with information for all threads
+    // (uses pointers instead of values to avoid false sharing)
+    // allocated by multi_jac_sparsity_setup,
+    // freed by multi_jac_sparsity_takedown
+    work_one_t* work_all_[CPPAD_MAX_NUM_THREADS];
+}
+// END COMMON C++
+/*
+-------------------------------------------------------------------------------
+$begin multi_jac_sparsity_setup$$
+$spell
+    jac
+    bool
+$$
+
+$section Multi-Threaded Jacobian Sparsity Set Up$$.
+
+$head Syntax$$
+$icode%ok% = multi_jac_sparsity_setup()%$$
+
+$head Purpose$$
+This routine gives each thread its own function object that shares
+the operation sequence in the common function object.
+
+$head Thread$$
+It is assumed that this function is called by thread zero
+and all the other threads are blocked (waiting).
+
+$head ok$$
+If the return value $icode ok$$ is false,
+$code multi_jac_sparsity_setup$$ detected an error.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN SETUP C++%// END SETUP C++%
+1%$$
+
+$end
+*/
+// BEGIN SETUP C++
+namespace {
+bool multi_jac_sparsity_setup(void)
+{   size_t num_threads = std::max(num_threads_, size_t(1));
+    bool   ok          = num_threads == thread_alloc::num_threads();
+    ok                &= thread_alloc::thread_num() == 0;
+    //
+    for(size_t thread_num = 0; thread_num < num_threads; thread_num++)
+    {   // allocate separate memory for each thread to avoid false sharing
+        size_t min_bytes(sizeof(work_one_t)), cap_bytes;
+        void* v_ptr = thread_alloc::get_memory(min_bytes, cap_bytes);
+        work_all_[thread_num] = static_cast<work_one_t*>(v_ptr);
+        //
+        // Each worker gets a separate function object that shares the
+        // operation sequence in fun_. This is necessary because the
+        // sparsity patterns for the variables are stored in the object.
+        work_all_[thread_num]->fun = new CppAD::ADFun<double>;
+        work_all_[thread_num]->fun->share_op_seq(*fun_);
+        //
+        // set by the worker
+        work_all_[thread_num]->pattern = CPPAD_NULL;
+        //
+        // set to false in case this thread's worker does not get called
+        work_all_[thread_num]->ok = false;
+    }
+    return ok;
+}
+}
+// END SETUP C++
+/*
+------------------------------------------------------------------------------
+$begin multi_jac_sparsity_worker$$
+$spell
+    jac
+$$
+
+$section Multi-Threaded Jacobian Sparsity Worker$$
+
+$head Purpose$$
+This routine does the computation for one thread.
+The columns of the identity matrix $latex R$$ are partitioned between the
+threads using
+$cref/n_part/for_jac_sparsity/n_part/$$ equal to the number of threads
+and $cref/i_part/for_jac_sparsity/i_part/$$ equal to the current thread number.
+The calculations use the boolean representation for the sets.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN WORKER C++%// END WORKER C++%
+1%$$
+
+$end
+*/
+// BEGIN WORKER C++
+namespace {
+void multi_jac_sparsity_worker(void)
+{   size_t thread_num  = thread_alloc::thread_num();
+    size_t num_threads = std::max(num_threads_, size_t(1));
+    bool   ok          = thread_num < num_threads;
+    //
+    CppAD::ADFun<double>* fun = work_all_[thread_num]->fun;
+    bool transpose     = false;
+    bool dependency    = false;
+    bool internal_bool = true;
+    //
+    // this thread's columns of the Jacobian sparsity pattern
+    sparse_rc* pattern = new sparse_rc;
+    fun->for_jac_sparsity(*identity_, transpose, dependency, internal_bool,
+        *pattern, num_threads, thread_num
+    );
+    ok &= pattern->nr() == fun->Range();
+    ok &= pattern->nc() == fun->Domain();
+    //
+    work_all_[thread_num]->pattern = pattern;
+    work_all_[thread_num]->ok      = ok;
+}
+}
+// END WORKER C++
+/*
+------------------------------------------------------------------------------
+$begin multi_jac_sparsity_takedown$$
+$spell
+    jac
+    bool
+$$
+
+$section Multi-Threaded Jacobian Sparsity Take Down$$
+
+$head Syntax$$
+$icode%ok% = multi_jac_sparsity_takedown()%$$
+
+$head Purpose$$
+This routine merges the sparsity patterns computed by each thread
+and frees memory that was allocated by
+$cref multi_jac_sparsity_setup$$ and $cref multi_jac_sparsity_worker$$.
+
+$head Thread$$
+It is assumed that this function is called by thread zero
+and all the other threads are blocked (waiting).
+
+$head ok$$
+If the return value $icode ok$$ is false,
+$code multi_jac_sparsity_takedown$$ detected an error.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN TAKEDOWN C++%// END TAKEDOWN C++%
+1%$$
+
+$end
+*/
+// BEGIN TAKEDOWN C++
+namespace {
+bool multi_jac_sparsity_takedown(void)
+{   bool ok            = true;
+    ok                &= thread_alloc::thread_num() == 0;
+    size_t num_threads = std::max(num_threads_, size_t(1));
+    //
+    // the columns for different threads are disjoint so the merged
+    // pattern is the concatenation of the patterns for each thread
+    size_t nnz = 0;
+    for(size_t thread_num = 0; thread_num < num_threads; thread_num++)
+    {   const sparse_rc* pattern = work_all_[thread_num]->pattern;
+        if( pattern == CPPAD_NULL )
+            ok = false;
+        else
+            nnz += pattern->nnz();
+    }
+    size_t m = fun_->Range();
+    size_t n = fun_->Domain();
+    pattern_->resize(m, n, nnz);
+    size_t k_out = 0;
+    for(size_t thread_num = 0; thread_num < num_threads; thread_num++)
+    {   const sparse_rc* pattern = work_all_[thread_num]->pattern;
+        if( pattern != CPPAD_NULL )
+        {   for(size_t k = 0; k < pattern->nnz(); ++k)
+                pattern_->set(k_out++, pattern->row()[k], pattern->col()[k]);
+        }
+    }
+    //
+    // go down so that free memory for other threads before memory for master
+    size_t thread_num = num_threads;
+    while(thread_num--)
+    {   // check that this tread was ok with the work it did
+        ok  &= work_all_[thread_num]->ok;
+        //
+        // run destructors for this thread
+        delete work_all_[thread_num]->pattern;
+        delete work_all_[thread_num]->fun;
+        //
+        // delete problem specific information
+        void* v_ptr = static_cast<void*>( work_all_[thread_num] );
+        thread_alloc::return_memory( v_ptr );
+        //
+        // check that there is no longer any memory inuse by this thread
+        if( thread_num > 0 )
+        {   ok &= 0 == thread_alloc::inuse(thread_num);
+            //
+            // return all memory being held for future use by this thread
+            thread_alloc::free_available(thread_num);
+        }
+    }
+    return ok;
+}
+}
+// END TAKEDOWN C++
+/*
+$begin multi_jac_sparsity_run$$
+$spell
+    jac
+    bool
+$$
+
+$section Run Multi-Threaded Jacobian Sparsity Calculation$$
+
+$head Syntax$$
+$icode%ok% = multi_jac_sparsity_run()%$$
+
+$head Thread$$
+It is assumed that this function is called by thread zero
+and all the other threads are blocked (waiting).
+
+$head ok$$
+If the return value $icode ok$$ is false,
+$code multi_jac_sparsity_run$$ detected an error.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN RUN C++%// END RUN C++%
+1%$$
+
+$end
+------------------------------------------------------------------------------
+*/
+// BEGIN RUN C++
+namespace {
+bool multi_jac_sparsity_run(void)
+{
+    bool ok = true;
+    ok     &= thread_alloc::thread_num() == 0;
+
+    // setup the work for multi-threading
+    ok &= multi_jac_sparsity_setup();
+
+    // now do the work for each thread
+    if( num_threads_ > 0 )
+        team_work( multi_jac_sparsity_worker );
+    else
+        multi_jac_sparsity_worker();
+
+    // takedown the multi-threading.
+    ok &= multi_jac_sparsity_takedown();
+
+    return ok;
+}
+}
+// END RUN C++
+/*
+------------------------------------------------------------------------------
+$begin multi_jac_sparsity_time$$
+$spell
+    jac
+    num
+    alloc
+    bool
+    CppAD
+$$
+
+$section Timing Test for Multi-Threaded Jacobian Sparsity Calculation$$
+
+$head Syntax$$
+$icode%ok% = multi_jac_sparsity_time(
+    %time_out%, %test_time%, %num_threads%, %size%
+)%$$
+
+
+$head Thread$$
+It is assumed that this function is called by thread zero in sequential
+mode; i.e., not $cref/in_parallel/ta_in_parallel/$$.
+
+$head time_out$$
+This argument has prototype
+$codei%
+    double& %time_out%
+%$$
+Its input value of the argument does not matter.
+Upon return it is the number of wall clock seconds
+used by $cref multi_jac_sparsity_run$$.
+
+$head test_time$$
+This argument has prototype
+$codei%
+    double %test_time%
+%$$
+and is the minimum amount of wall clock time that the test should take.
+The number of repeats for the test will be increased until this time
+is reached.
+The reported $icode time_out$$ is the total wall clock time divided by the
+number of repeats.
+
+$head num_threads$$
+This argument has prototype
+$codei%
+    size_t %num_threads%
+%$$
+It specifies the number of threads that are available for this test.
+If it is zero, the test is run without the multi-threading environment and
+$codei%
+    1 == thread_alloc::num_threads()
+%$$
+If it is non-zero, the test is run with the multi-threading and
+$codei%
+    %num_threads% = thread_alloc::num_threads()
+%$$
+
+$head size$$
+This argument has prototype
+$codei%
+    size_t %size%
+%$$
+It is the number of independent (and dependent) variables in the function
+and must be greater than or equal the band width (16).
+
+$head ok$$
+The return value has prototype
+$codei%
+    bool %ok%
+%$$
+If it is true,
+$code multi_jac_sparsity_time$$ passed the correctness test
+and did not detect an error.
+Otherwise it is false.
+
+$end
+*/
+
+// BEGIN TIME C++
+namespace {
+    void test_once(void)
+    {   bool ok = multi_jac_sparsity_run();
+        if( ! ok )
+        {   std::cerr << "multi_jac_sparsity_run: error" << std::endl;
+            exit(1);
+        }
+        return;
+    }
+    //
+    void test_repeat(size_t repeat)
+    {   size_t i;
+        for(i = 0; i < repeat; i++)
+            test_once();
+        return;
+    }
+}
+// This is the only routine that is accessible outside of this file
+bool multi_jac_sparsity_time(
+    double& time_out, double test_time, size_t num_threads, size_t size
+)
+{   bool ok = true;
+    ok     &= band_ <= size;
+    if( ! ok )
+        return ok;
+    //
+    size_t initial_inuse = thread_alloc::inuse(0);
+
+    // number of threads, zero for no multi-threading
+    num_threads_ = num_threads;
+
+    // create the shared information in sequential mode
+    size_t n  = size;
+    fun_      = new CppAD::ADFun<double>;
+    identity_ = new sparse_rc(n, n, n);
+    pattern_  = new sparse_rc;
+    {   // f(x)
+        vector<a_double> ax(n), ay(n);
+        for(size_t j = 0; j < n; j++)
+            ax[j] = double(j + 1) / double(n);
+        CppAD::Independent(ax);
+        band_fun(ax, ay);
+        fun_->Dependent(ax, ay);
+        //
+        // sparsity pattern for the identity matrix
+        for(size_t k = 0; k < n; k++)
+            identity_->set(k, k, k);
+    }
+
+    // create team of threads
+    ok &= thread_alloc::in_parallel() == false;
+    if( num_threads > 0 )
+    {   team_create(num_threads);
+        ok &= num_threads == thread_alloc::num_threads();
+    }
+    else
+    {   ok &= 1 == thread_alloc::num_threads();
+    }
+
+    // run the test case and set the time return value
+    time_out = CppAD::time_test(test_repeat, test_time);
+
+    // destroy team of threads
+    if( num_threads > 0 )
+        team_destroy();
+    ok &= thread_alloc::in_parallel() == false;
+
+    // correctness check
+    ok &= pattern_->nnz() == n * band_;
+    {   // pattern computed using one part
+        sparse_rc check;
+        bool transpose     = false;
+        bool dependency    = false;
+        bool internal_bool = true;
+        fun_->for_jac_sparsity(
+            *identity_, transpose, dependency, internal_bool, check
+        );
+        ok &= check.nnz() == pattern_->nnz();
+        if( ok )
+        {   s_vector check_major   = check.row_major();
+            s_vector pattern_major = pattern_->row_major();
+            for(size_t k = 0; k < check.nnz(); k++)
+            {   size_t ck = check_major[k];
+                size_t pk = pattern_major[k];
+                ok &= check.row()[ck] == pattern_->row()[pk];
+                ok &= check.col()[ck] == pattern_->col()[pk];
+            }
+        }
+    }
+    //
+    // free memory used by the shared information
+    delete fun_;
+    delete identity_;
+    delete pattern_;
+    //
+    // check that no static variables in this file are holding onto memory
+    ok &= initial_inuse == thread_alloc::inuse(0);
+    //
+    return ok;
+}
+// END TIME C++
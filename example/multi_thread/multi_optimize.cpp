@@ -0,0 +1,501 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin multi_optimize_common$$
+$spell
+    CppAD
+$$
+
+$section Multi-Threaded Optimize Common Information$$
+
+$head Purpose$$
+This source code defines the functions that we are optimizing
+and the common variables that are used by
+the $codei%multi_optimize_%name%$$ functions.
+
+$head Partition$$
+A large model is often a sum of parts that only share the
+independent variables.
+In this case the tape can be partitioned by recording each part
+as a separate $cref ADFun$$ object.
+The $cref optimize$$ routine only uses memory and information
+in the $icode f$$ object and the current thread,
+so different threads can optimize different parts at the same time.
+The optimized operation sequence does not depend on which thread
+does the optimization, nor on the number of threads.
+
+$head Function$$
+The function for part $icode k$$,
+$latex f_k : \B{R}^n \rightarrow \B{R}$$, is defined by
+$latex \[
+    f_k (x) = 2 \sum_{i=0}^{n-1} \sin( x_i ) x_{(i + k + 1) \bmod n}
+\] $$
+where $icode n$$ is the $cref/size/multi_optimize_time/size/$$.
+It is recorded by computing the sum twice and adding the results,
+so the optimizer removes about half of the operators.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN COMMON C++%// END COMMON C++%
+1%$$
+
+$end
+*/
+// BEGIN COMMON C++
+// includes used by all source code in multi_optimize.cpp file
+# include <cppad/cppad.hpp>
+# include "multi_optimize.hpp"
+# include "team_thread.hpp"
+//
+namespace {
+    using CppAD::thread_alloc; // fast multi-threading memory allocator
+    using CppAD::vector;       // uses thread_alloc
+    //
+    typedef CppAD::AD<double>                    a_double;
+    typedef vector<double>                       d_vector;
+    //
+    // number of parts in the partition of the function
+    const size_t num_part_ = 16;
+    //
+    // record the function for part k
+    void record_part(
+        size_t k, size_t n, CppAD::ADFun<double>& f
+    )
+    {   vector<a_double> ax(n), ay(1);
+        for(size_t j = 0; j < n; j++)
+            ax[j] = double(j + 1) / double(n);
+        CppAD::Independent(ax);
+        a_double sum[2];
+        for(size_t ell = 0; ell < 2; ell++)
+        {   sum[ell] = 0.0;
+            for(size_t i = 0; i < n; i++)
+                sum[ell] += sin( ax[i] ) * ax[ (i + k + 1) % n ];
+        }
+        ay[0] = sum[0] + sum[1];
+        f.Dependent(ax, ay);
+    }
+    //
+    // Number of threads, set by multi_optimize_time
+    // (zero means one thread with no multi-threading setup)
+    size_t num_threads_ = 0;
+    //
+    // Information that is shared by all the threads; i.e., set in
+    // sequential mode and only read during parallel mode.
+    // We use pointers so that there is no left over memory in thread zero.
+    size_t   size_    = 0;          // number of independent variables
+    d_vector* x_      = CPPAD_NULL; // argument value
+    //
+    // size_op() and function value for each part optimized in sequential mode
+    vector<size_t>* size_op_ = CPPAD_NULL;
+    d_vector*       y_       = CPPAD_NULL;
+    //
+    // structure with information for one thread
+    typedef struct {
+        // number of parts optimized by this thread, set by worker
+        size_t num_done;
+        //
+        // false if an error occurs, true otherwise, set by worker
+        bool ok;
+    } work_one_t;
+    //
+    // Vector with information for all threads
+    // (uses pointers instead of values to avoid false sharing)
+    // allocated by multi_optimize_setup, freed by multi_optimize_takedown
+    work_one_t* work_all_[CPPAD_MAX_NUM_THREADS];
+}
+// END COMMON C++
+/*
+-------------------------------------------------------------------------------
+$begin multi_optimize_setup$$
+$spell
+    bool
+$$
+
+$section Multi-Threaded Optimize Set Up$$.
+
+$head Syntax$$
+$icode%ok% = multi_optimize_setup()%$$
+
+$head Purpose$$
+This routine allocates the information for each thread.
+
+$head Thread$$
+It is assumed that this function is called by thread zero
+and all the other threads are blocked (waiting).
+
+$head ok$$
+If the return value $icode ok$$ is false,
+$code multi_optimize_setup$$ detected an error.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN SETUP C++%// END SETUP C++%
+1%$$
+
+$end
+*/
+// BEGIN SETUP C++
+namespace {
+bool multi_optimize_setup(void)
+{   size_t num_threads = std::max(num_threads_, size_t(1));
+    bool   ok          = num_threads == thread_alloc::num_threads();
+    ok                &= thread_alloc::thread_num() == 0;
+    //
+    for(size_t thread_num = 0; thread_num < num_threads; thread_num++)
+    {   // allocate separate memory for each thread to avoid false sharing
+        size_t min_bytes(sizeof(work_one_t)), cap_bytes;
+        void* v_ptr = thread_alloc::get_memory(min_bytes, cap_bytes);
+        work_all_[thread_num] = static_cast<work_one_t*>(v_ptr);
+        //
+        // set to false in case this thread's worker does not get called
+        work_all_[thread_num]->num_done = 0;
+        work_all_[thread_num]->ok       = false;
+    }
+    return ok;
+}
+}
+// END SETUP C++
+/*
+------------------------------------------------------------------------------
+$begin multi_optimize_worker$$
+$spell
+    op
+$$
+
+$section Multi-Threaded Optimize Worker$$
+
+$head Purpose$$
+This routine does the computation for one thread.
+The parts $icode k$$ with
+$icode%k% % %num_threads%$$ equal to the current thread number
+are recorded and optimized by this thread.
+The $cref/size_op/seq_property/size_op/$$ and function value
+for each optimized part are checked against the values computed
+in sequential mode.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN WORKER C++%// END WORKER C++%
+1%$$
+
+$end
+*/
+// BEGIN WORKER C++
+namespace {
+void multi_optimize_worker(void)
+{   size_t thread_num  = thread_alloc::thread_num();
+    size_t num_threads = std::max(num_threads_, size_t(1));
+    bool   ok          = thread_num < num_threads;
+    //
+    size_t num_done = 0;
+    for(size_t k = thread_num; k < num_part_; k += num_threads)
+    {   // record and optimize this part
+        CppAD::ADFun<double> f;
+        record_part(k, size_, f);
+        f.optimize();
+        //
+        // the result must be the same as in sequential mode
+        ok &= f.size_op() == (*size_op_)[k];
+        d_vector y = f.Forward(0, *x_);
+        ok &= y[0] == (*y_)[k];
+        //
+        ++num_done;
+    }
+    //
+    work_all_[thread_num]->num_done = num_done;
+    work_all_[thread_num]->ok       = ok;
+}
+}
+// END WORKER C++
+/*
+------------------------------------------------------------------------------
+$begin multi_optimize_takedown$$
+$spell
+    bool
+$$
+
+$section Multi-Threaded Optimize Take Down$$
+
+$head Syntax$$
+$icode%ok% = multi_optimize_takedown()%$$
+
+$head Purpose$$
+This routine frees memory that was allocated by
+$cref multi_optimize_setup$$.
+
+$head Thread$$
+It is assumed that this function is called by thread zero
+and all the other threads are blocked (waiting).
+
+$head ok$$
+If the return value $icode ok$$ is false,
+$code multi_optimize_takedown$$ detected an error.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN TAKEDOWN C++%// END TAKEDOWN C++%
+1%$$
+
+$end
+*/
+// BEGIN TAKEDOWN C++
+namespace {
+bool multi_optimize_takedown(void)
+{   bool ok            = true;
+    ok                &= thread_alloc::thread_num() == 0;
+    size_t num_threads = std::max(num_threads_, size_t(1));
+    //
+    // go down so that free memory for other threads before memory for master
+    size_t num_done   = 0;
+    size_t thread_num = num_threads;
+    while(thread_num--)
+    {   // check that this tread was ok with the work it did
+        ok       &= work_all_[thread_num]->ok;
+        num_done += work_all_[thread_num]->num_done;
+        //
+        // delete problem specific information
+        void* v_ptr = static_cast<void*>( work_all_[thread_num] );
+        thread_alloc::return_memory( v_ptr );
+        //
+        // check that there is no longer any memory inuse by this thread
+        if( thread_num > 0 )
+        {   ok &= 0 == thread_alloc::inuse(thread_num);
+            //
+            // return all memory being held for future use by this thread
+            thread_alloc::free_available(thread_num);
+        }
+    }
+    // check that every part was optimized
+    ok &= num_done == num_part_;
+    return ok;
+}
+}
+// END TAKEDOWN C++
+/*
+$begin multi_optimize_run$$
+$spell
+    bool
+$$
+
+$section Run Multi-Threaded Optimize Calculation$$
+
+$head Syntax$$
+$icode%ok% = multi_optimize_run()%$$
+
+$head Thread$$
+It is assumed that this function is called by thread zero
+and all the other threads are blocked (waiting).
+
+$head ok$$
+If the return value $icode ok$$ is false,
+$code multi_optimize_run$$ detected an error.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN RUN C++%// END RUN C++%
+1%$$
+
+$end
+------------------------------------------------------------------------------
+*/
+// BEGIN RUN C++
+namespace {
+bool multi_optimize_run(void)
+{
+    bool ok = true;
+    ok     &= thread_alloc::thread_num() == 0;
+
+    // setup the work for multi-threading
+    ok &= multi_optimize_setup();
+
+    // now do the work for each thread
+    if( num_threads_ > 0 )
+        team_work( multi_optimize_worker );
+    else
+        multi_optimize_worker();
+
+    // takedown the multi-threading.
+    ok &= multi_optimize_takedown();
+
+    return ok;
+}
+}
+// END RUN C++
+/*
+------------------------------------------------------------------------------
+$begin multi_optimize_time$$
+$spell
+    num
+    alloc
+    bool
+    CppAD
+$$
+
+$section Timing Test for Multi-Threaded Optimize Calculation$$
+
+$head Syntax$$
+$icode%ok% = multi_optimize_time(
+    %time_out%, %test_time%, %num_threads%, %size%
+)%$$
+
+
+$head Thread$$
+It is assumed that this function is called by thread zero in sequential
+mode; i.e., not $cref/in_parallel/ta_in_parallel/$$.
+
+$head time_out$$
+This argument has prototype
+$codei%
+    double& %time_out%
+%$$
+Its input value of the argument does not matter.
+Upon return it is the number of wall clock seconds
+used by $cref multi_optimize_run$$.
+
+$head test_time$$
+This argument has prototype
+$codei%
+    double %test_time%
+%$$
+and is the minimum amount of wall clock time that the test should take.
+The number of repeats for the test will be increased until this time
+is reached.
+The reported $icode time_out$$ is the total wall clock time divided by the
+number of repeats.
+
+$head num_threads$$
+This argument has prototype
+$codei%
+    size_t %num_threads%
+%$$
+It specifies the number of threads that are available for this test.
+If it is zero, the test is run without the multi-threading environment and
+$codei%
+    1 == thread_alloc::num_threads()
+%$$
+If it is non-zero, the test is run with the multi-threading and
+$codei%
+    %num_threads% = thread_alloc::num_threads()
+%$$
+
+$head size$$
+This argument has prototype
+$codei%
+    size_t %size%
+%$$
+It is the number of independent variables in the function
+for each part and must be greater than or equal two.
+
+$head ok$$
+The return value has prototype
+$codei%
+    bool %ok%
+%$$
+If it is true,
+$code multi_optimize_time$$ passed the correctness test
+and did not detect an error.
+Otherwise it is false.
+
+$end
+*/
+
+// BEGIN TIME C++
+namespace {
+    void test_once(void)
+    {   bool ok = multi_optimize_run();
+        if( ! ok )
+        {   std::cerr << "multi_optimize_run: error" << std::endl;
+            exit(1);
+        }
+        return;
+    }
+    //
+    void test_repeat(size_t repeat)
+    {   size_t i;
+        for(i = 0; i < repeat; i++)
+            test_once();
+        return;
+    }
+}
+// This is the only routine that is accessible outside of this file
+bool multi_optimize_time(
+    double& time_out, double test_time, size_t num_threads, size_t size
+)
+{   bool ok = true;
+    ok     &= 2 <= size;
+    if( ! ok )
+        return ok;
+    //
+    size_t initial_inuse = thread_alloc::inuse(0);
+
+    // number of threads, zero for no multi-threading
+    num_threads_ = num_threads;
+
+    // create the shared information in sequential mode
+    size_t n  = size;
+    size_     = n;
+    x_        = new d_vector(n);
+    size_op_  = new vector<size_t>(num_part_);
+    y_        = new d_vector(num_part_);
+    for(size_t j = 0; j < n; j++)
+        (*x_)[j] = double(j + 2) / double(n);
+    for(size_t k = 0; k < num_part_; k++)
+    {   // optimize this part in sequential mode
+        CppAD::ADFun<double> f;
+        record_part(k, n, f);
+        size_t size_op_before = f.size_op();
+        f.optimize();
+        ok &= f.size_op() < size_op_before;
+        (*size_op_)[k] = f.size_op();
+        (*y_)[k]       = f.Forward(0, *x_)[0];
+    }
+
+    // create team of threads
+    ok &= thread_alloc::in_parallel() == false;
+    if( num_threads > 0 )
+    {   team_create(num_threads);
+        ok &= num_threads == thread_alloc::num_threads();
+    }
+    else
+    {   ok &= 1 == thread_alloc::num_threads();
+    }
+
+    // run the test case and set the time return value
+    time_out = CppAD::time_test(test_repeat, test_time);
+
+    // destroy team of threads
+    if( num_threads > 0 )
+        team_destroy();
+    ok &= thread_alloc::in_parallel() == false;
+
+    // correctness check
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    for(size_t k = 0; k < num_part_; k++)
+    {   double check = 0.0;
+        for(size_t i = 0; i < n; i++)
+            check += std::sin( (*x_)[i] ) * (*x_)[ (i + k + 1) % n ];
+        check *= 2.0;
+        ok &= std::fabs( (*y_)[k] / check - 1.0 ) <= eps99;
+    }
+    //
+    // free memory used by the shared information
+    delete x_;
+    delete size_op_;
+    delete y_;
+    //
+    // check that no static variables in this file are holding onto memory
+    ok &= initial_inuse == thread_alloc::inuse(0);
+    //
+    return ok;
+}
+// END TIME C++
@@ -0,0 +1,530 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin multi_sparse_hes_common$$
+$spell
+    hes
+$$
+
+$section Multi-Threaded Sparse Hessian Common Information$$
+
+$head Purpose$$
+This source code defines the function that we are differentiating
+and the common variables that are used by
+the $codei%multi_sparse_hes_%name%$$ functions.
+
+$head Function$$
+The function $latex f : \B{R}^n \rightarrow \B{R}$$ is defined by
+$latex \[
+    f(x) = \sum_{i=0}^{n-1}
+        \exp( x_i ) \sum_{\ell=0}^{b-1} x_{(i + \ell) \bmod n}
+\] $$
+where $icode n$$ is the $cref/size/multi_sparse_hes_time/size/$$
+and $icode b$$ is the band width.
+The Hessian of $latex f$$ has $latex 2 b - 1$$ non-zero entries in each row.
+The symmetric coloring requires at least $icode b$$ colors.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN COMMON C++%// END COMMON C++%
+1%$$
+
+$end
+*/
+// BEGIN COMMON C++
+// includes used by all source code in multi_sparse_hes.cpp file
+# include <cppad/cppad.hpp>
+# include "multi_sparse_hes.hpp"
+# include "team_thread.hpp"
+//
+namespace {
+    using CppAD::thread_alloc; // fast multi-threading memory allocator
+    using CppAD::vector;       // uses thread_alloc
+    //
+    typedef CppAD::AD<double>                    a_double;
+    typedef vector<size_t>                       s_vector;
+    typedef vector<double>                       d_vector;
+    typedef CppAD::sparse_rc<s_vector>           sparse_rc;
+    typedef CppAD::sparse_rcv<s_vector, d_vector> sparse_rcv;
+    //
+    // band width for the function
+    const size_t band_ = 16;
+    //
+    // the function we are computing the Hessian of
+    template <class Vector>
+    void band_fun(const Vector& x, Vector& y)
+    {   size_t n = x.size();
+        y[0]     = 0.0;
+        for(size_t i = 0; i < n; i++)
+        {   typename Vector::value_type sum = 0.0;
+            for(size_t ell = 0; ell < band_; ell++)
+                sum += x[ (i + ell) % n ];
+            y[0] += exp( x[i] ) * sum;
+        }
+    }
+    //
+    // Number of threads, set by multi_sparse_hes_time
+    // (zero means one thread with no multi-threading setup)
+    size_t num_threads_ = 0;
+    //
+    // Information that is shared by all the threads; i.e., set in
+    // sequential mode and only read during parallel mode.
+    // We use pointers so that there is no left over memory in thread zero.
+    CppAD::ADFun<double>*   fun_      = CPPAD_NULL; // f(x)
+    sparse_rc*              pattern_  = CPPAD_NULL; // sparsity for Hessian
+    d_vector*               x_        = CPPAD_NULL; // argument value
+    d_vector*               w_        = CPPAD_NULL; // range weight vector
+    CppAD::sparse_hes_work* work_     = CPPAD_NULL; // coloring
+    //
+    // Result that is shared by all the threads; each thread sets
+    // a different subset of the elements of this vector.
+    sparse_rcv* subset_ = CPPAD_NULL; // Hessian computed by sparse_hes
+    //
+    // structure with information for one thread
+    typedef struct {
+        // function object used by this thread, set by multi_sparse_hes_setup
+        // (each thread needs its own Taylor coefficients)
+        CppAD::ADFun<double>* fun;
+        //
+        // false if an error occurs, true otherwise, set by worker
+        bool ok;
+    } work_one_t;
+    //
+    // Vector with information for all threads
+    // (uses pointers instead of values to avoid false sharing)
+    // allocated by multi_sparse_hes_setup, freed by multi_sparse_hes_takedown
+    work_one_t* work_all_[CPPAD_MAX_NUM_THREADS];
+}
+// END COMMON C++
+/*
+-------------------------------------------------------------------------------
+$begin multi_sparse_hes_setup$$
+$spell
+    hes
+    bool
+$$
+
+$section Multi-Threaded Sparse Hessian Set Up$$.
+
+$head Syntax$$
+$icode%ok% = multi_sparse_hes_setup()%$$
+
+$head Purpose$$
+This routine gives each thread its own copy of the function.
+
+$head Thread$$
+It is assumed that this function is called by thread zero
+and all the other threads are blocked (waiting).
+
+$head ok$$
+If the return value $icode ok$$ is false,
+$code multi_sparse_hes_setup$$ detected an error.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN SETUP C++%// END SETUP C++%
+1%$$
+
+$end
+*/
+// BEGIN SETUP C++
+namespace {
+bool multi_sparse_hes_setup(void)
+{   size_t num_threads = std::max(num_threads_, size_t(1));
+    bool   ok          = num_threads == thread_alloc::num_threads();
+    ok                &= thread_alloc::thread_num() == 0;
+    //
+    for(size_t thread_num = 0; thread_num < num_threads; thread_num++)
+    {   // allocate separate memory for each thread to avoid false sharing
+        size_t min_bytes(sizeof(work_one_t)), cap_bytes;
+        void* v_ptr = thread_alloc::get_memory(min_bytes, cap_bytes);
+        work_all_[thread_num] = static_cast<work_one_t*>(v_ptr);
+        //
+        // Each worker gets a separate ADFun object. This is necessary because
+        // the Taylor coefficients will be set by each thread. The operation
+        // sequence in fun_ is shared, not copied.
+        work_all_[thread_num]->fun  = new CppAD::ADFun<double>;
+        work_all_[thread_num]->fun->share_op_seq(*fun_);
+        //
+        // set to false in case this thread's worker does not get called
+        work_all_[thread_num]->ok = false;
+    }
+    return ok;
+}
+}
+// END SETUP C++
+/*
+------------------------------------------------------------------------------
+$begin multi_sparse_hes_worker$$
+$spell
+    hes
+$$
+
+$section Multi-Threaded Sparse Hessian Worker$$
+
+$head Purpose$$
+This routine does the computation for one thread.
+The colors are partitioned between the threads using
+$cref/n_part/sparse_hes/n_part/$$ equal to the number of threads
+and $cref/i_part/sparse_hes/i_part/$$ equal to the current thread number.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN WORKER C++%// END WORKER C++%
+1%$$
+
+$end
+*/
+// BEGIN WORKER C++
+namespace {
+void multi_sparse_hes_worker(void)
+{   size_t thread_num  = thread_alloc::thread_num();
+    size_t num_threads = std::max(num_threads_, size_t(1));
+    bool   ok          = thread_num < num_threads;
+    //
+    CppAD::ADFun<double>* fun = work_all_[thread_num]->fun;
+    std::string coloring      = "cppad.symmetric";
+    //
+    // this thread's part of the Hessian
+    size_t n_sweep = fun->sparse_hes(*x_, *w_, *subset_,
+        *pattern_, coloring, *work_, num_threads, thread_num
+    );
+    ok &= band_ <= n_sweep;
+    //
+    work_all_[thread_num]->ok = ok;
+}
+}
+// END WORKER C++
+/*
+------------------------------------------------------------------------------
+$begin multi_sparse_hes_takedown$$
+$spell
+    hes
+    bool
+$$
+
+$section Multi-Threaded Sparse Hessian Take Down$$
+
+$head Syntax$$
+$icode%ok% = multi_sparse_hes_takedown()%$$
+
+$head Purpose$$
+This routine frees memory that was allocated by
+$cref multi_sparse_hes_setup$$.
+
+$head Thread$$
+It is assumed that this function is called by thread zero
+and all the other threads are blocked (waiting).
+
+$head ok$$
+If the return value $icode ok$$ is false,
+$code multi_sparse_hes_takedown$$ detected an error.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN TAKEDOWN C++%// END TAKEDOWN C++%
+1%$$
+
+$end
+*/
+// BEGIN TAKEDOWN C++
+namespace {
+bool multi_sparse_hes_takedown(void)
+{   bool ok            = true;
+    ok                &= thread_alloc::thread_num() == 0;
+    size_t num_threads = std::max(num_threads_, size_t(1));
+    //
+    // go down so that free memory for other threads before memory for master
+    size_t thread_num = num_threads;
+    while(thread_num--)
+    {   // check that this tread was ok with the work it did
+        ok  &= work_all_[thread_num]->ok;
+        //
+        // run destructor on function object for this thread
+        delete work_all_[thread_num]->fun;
+        //
+        // delete problem specific information
+        void* v_ptr = static_cast<void*>( work_all_[thread_num] );
+        thread_alloc::return_memory( v_ptr );
+        //
+        // check that there is no longer any memory inuse by this thread
+        if( thread_num > 0 )
+        {   ok &= 0 == thread_alloc::inuse(thread_num);
+            //
+            // return all memory being held for future use by this thread
+            thread_alloc::free_available(thread_num);
+        }
+    }
+    return ok;
+}
+}
+// END TAKEDOWN C++
+/*
+$begin multi_sparse_hes_run$$
+$spell
+    hes
+    bool
+$$
+
+$section Run Multi-Threaded Sparse Hessian Calculation$$
+
+$head Syntax$$
+$icode%ok% = multi_sparse_hes_run()%$$
+
+$head Thread$$
+It is assumed that this function is called by thread zero
+and all the other threads are blocked (waiting).
+
+$head ok$$
+If the return value $icode ok$$ is false,
+$code multi_sparse_hes_run$$ detected an error.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN RUN C++%// END RUN C++%
+1%$$
+
+$end
+------------------------------------------------------------------------------
+*/
+// BEGIN RUN C++
+namespace {
+bool multi_sparse_hes_run(void)
+{
+    bool ok = true;
+    ok     &= thread_alloc::thread_num() == 0;
+
+    // setup the work for multi-threading
+    ok &= multi_sparse_hes_setup();
+
+    // now do the work for each thread
+    if( num_threads_ > 0 )
+        team_work( multi_sparse_hes_worker );
+    else
+        multi_sparse_hes_worker();
+
+    // takedown the multi-threading.
+    ok &= multi_sparse_hes_takedown();
+
+    return ok;
+}
+}
+// END RUN C++
+/*
+------------------------------------------------------------------------------
+$begin multi_sparse_hes_time$$
+$spell
+    hes
+    num
+    alloc
+    bool
+    CppAD
+$$
+
+$section Timing Test for Multi-Threaded Sparse Hessian Calculation$$
+
+$head Syntax$$
+$icode%ok% = multi_sparse_hes_time(
+    %time_out%, %test_time%, %num_threads%, %size%
+)%$$
+
+
+$head Thread$$
+It is assumed that this function is called by thread zero in sequential
+mode; i.e., not $cref/in_parallel/ta_in_parallel/$$.
+
+$head time_out$$
+This argument has prototype
+$codei%
+    double& %time_out%
+%$$
+Its input value of the argument does not matter.
+Upon return it is the number of wall clock seconds
+used by $cref multi_sparse_hes_run$$.
+
+$head test_time$$
+This argument has prototype
+$codei%
+    double %test_time%
+%$$
+and is the minimum amount of wall clock time that the test should take.
+The number of repeats for the test will be increased until this time
+is reached.
+The reported $icode time_out$$ is the total wall clock time divided by the
+number of repeats.
+
+$head num_threads$$
+This argument has prototype
+$codei%
+    size_t %num_threads%
+%$$
+It specifies the number of threads that are available for this test.
+If it is zero, the test is run without the multi-threading environment and
+$codei%
+    1 == thread_alloc::num_threads()
+%$$
+If it is non-zero, the test is run with the multi-threading and
+$codei%
+    %num_threads% = thread_alloc::num_threads()
+%$$
+
+$head size$$
+This argument has prototype
+$codei%
+    size_t %size%
+%$$
+It is the number of independent variables in the function
+and must be greater than or equal two times the band width (32).
+
+$head ok$$
+The return value has prototype
+$codei%
+    bool %ok%
+%$$
+If it is true,
+$code multi_sparse_hes_time$$ passed the correctness test
+and did not detect an error.
+Otherwise it is false.
+
+$end
+*/
+
+// BEGIN TIME C++
+namespace {
+    void test_once(void)
+    {   bool ok = multi_sparse_hes_run();
+        if( ! ok )
+        {   std::cerr << "multi_sparse_hes_run: error" << std::endl;
+            exit(1);
+        }
+        return;
+    }
+    //
+    void test_repeat(size_t repeat)
+    {   size_t i;
+        for(i = 0; i < repeat; i++)
+            test_once();
+        return;
+    }
+}
+// This is the only routine that is accessible outside of this file
+bool multi_sparse_hes_time(
+    double& time_out, double test_time, size_t num_threads, size_t size
+)
+{   bool ok = true;
+    ok     &= 2 * band_ <= size;
+    if( ! ok )
+        return ok;
+    //
+    size_t initial_inuse = thread_alloc::inuse(0);
+
+    // number of threads, zero for no multi-threading
+    num_threads_ = num_threads;
+
+    // create the shared information in sequential mode
+    size_t n  = size;
+    fun_      = new CppAD::ADFun<double>;
+    pattern_  = new sparse_rc;
+    x_        = new d_vector(n);
+    w_        = new d_vector(1);
+    work_     = new CppAD::sparse_hes_work;
+    {   // f(x)
+        vector<a_double> ax(n), ay(1);
+        for(size_t j = 0; j < n; j++)
+            ax[j] = double(j + 1) / double(n);
+        CppAD::Independent(ax);
+        band_fun(ax, ay);
+        fun_->Dependent(ax, ay);
+        //
+        // sparsity pattern for the Hessian
+        vector<bool> select_domain(n), select_range(1);
+        for(size_t j = 0; j < n; j++)
+            select_domain[j] = true;
+        select_range[0]    = true;
+        bool internal_bool = false;
+        fun_->for_hes_sparsity(
+            select_domain, select_range, internal_bool, *pattern_
+        );
+        //
+        // point at which we compute the Hessian
+        for(size_t j = 0; j < n; j++)
+            (*x_)[j] = double(j + 2) / double(n);
+        (*w_)[0] = 1.0;
+        //
+        // Compute all of the Hessian once in sequential mode. This
+        // computes the coloring which is read (not set) in parallel mode.
+        subset_ = new sparse_rcv(*pattern_);
+        fun_->sparse_hes(
+            *x_, *w_, *subset_, *pattern_, "cppad.symmetric", *work_
+        );
+        // set the values so we know they are recomputed
+        for(size_t k = 0; k < pattern_->nnz(); k++)
+            subset_->set(k, 0.0);
+    }
+
+    // create team of threads
+    ok &= thread_alloc::in_parallel() == false;
+    if( num_threads > 0 )
+    {   team_create(num_threads);
+        ok &= num_threads == thread_alloc::num_threads();
+    }
+    else
+    {   ok &= 1 == thread_alloc::num_threads();
+    }
+
+    // run the test case and set the time return value
+    time_out = CppAD::time_test(test_repeat, test_time);
+
+    // destroy team of threads
+    if( num_threads > 0 )
+        team_destroy();
+    ok &= thread_alloc::in_parallel() == false;
+
+    // correctness check
+    const s_vector& row( pattern_->row() );
+    const s_vector& col( pattern_->col() );
+    ok &= pattern_->nnz() == n * (2 * band_ - 1);
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    for(size_t k = 0; k < pattern_->nnz(); k++)
+    {   size_t i     = row[k];
+        size_t j     = col[k];
+        double check = 0.0;
+        if( i == j )
+        {   double sum = 0.0;
+            for(size_t ell = 0; ell < band_; ell++)
+                sum += (*x_)[ (i + ell) % n ];
+            check = std::exp( (*x_)[i] ) * (sum + 2.0);
+        }
+        else if( (j + n - i) % n < band_ )
+            check = std::exp( (*x_)[i] );
+        else
+        {   ok   &= (i + n - j) % n < band_;
+            check = std::exp( (*x_)[j] );
+        }
+        ok &= std::fabs( subset_->val()[k] / check - 1.0 ) <= eps99;
+    }
+    //
+    // free memory used by the shared information
+    delete fun_;
+    delete pattern_;
+    delete x_;
+    delete w_;
+    delete work_;
+    delete subset_;
+    //
+    // check that no static variables in this file are holding onto memory
+    ok &= initial_inuse == thread_alloc::inuse(0);
+    //
+    return ok;
+}
+// END TIME C++
@@ -0,0 +1,542 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin multi_sparse_jac_common$$
+$spell
+    jac
+$$
+
+$section Multi-Threaded Sparse Jacobian Common Information$$
+
+$head Purpose$$
+This source code defines the function that we are differentiating
+and the common variables that are used by
+the $codei%multi_sparse_jac_%name%$$ functions.
+
+$head Function$$
+For $icode%i% = 0 , %...% , %n%-1%$$,
+$latex \[
+    f_i (x) = \exp( x_i ) \sum_{\ell=0}^{b-1} x_{(i + \ell) \bmod n}
+\] $$
+where $icode n$$ is the $cref/size/multi_sparse_jac_time/size/$$
+and $icode b$$ is the band width.
+The Jacobian of $latex f$$ has $icode b$$ non-zero entries in each row
+and $icode b$$ non-zero entries in each column.
+The coloring for both forward and reverse mode requires
+at least $icode b$$ colors.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN COMMON C++%// END COMMON C++%
+1%$$
+
+$end
+*/
+// BEGIN COMMON C++
+// includes used by all source code in multi_sparse_jac.cpp file
+# include <cppad/cppad.hpp>
+# include "multi_sparse_jac.hpp"
+# include "team_thread.hpp"
+//
+namespace {
+    using CppAD::thread_alloc; // fast multi-threading memory allocator
+    using CppAD::vector;       // uses thread_alloc
+    //
+    typedef CppAD::AD<double>                    a_double;
+    typedef vector<size_t>                       s_vector;
+    typedef vector<double>                       d_vector;
+    typedef CppAD::sparse_rc<s_vector>           sparse_rc;
+    typedef CppAD::sparse_rcv<s_vector, d_vector> sparse_rcv;
+    //
+    // band width for the function
+    const size_t band_ = 16;
+    //
+    // the function we are computing the Jacobian of
+    template <class Vector>
+    void band_fun(const Vector& x, Vector& y)
+    {   size_t n = x.size();
+        for(size_t i = 0; i < n; i++)
+        {   typename Vector::value_type sum = 0.0;
+            for(size_t ell = 0; ell < band_; ell++)
+                sum += x[ (i + ell) % n ];
+            y[i] = exp( x[i] ) * sum;
+        }
+    }
+    //
+    // Number of threads, set by multi_sparse_jac_time
+    // (zero means one thread with no multi-threading setup)
+    size_t num_threads_ = 0;
+    //
+    // Information that is shared by all the threads; i.e., set in
+    // sequential mode and only read during parallel mode.
+    // We use pointers so that there is no left over memory in thread zero.
+    CppAD::ADFun<double>*   fun_      = CPPAD_NULL; // f(x)
+    sparse_rc*              pattern_  = CPPAD_NULL; // sparsity for Jacobian
+    d_vector*               x_        = CPPAD_NULL; // argument value
+    CppAD::sparse_jac_work* work_for_ = CPPAD_NULL; // sparse_jac_for coloring
+    CppAD::sparse_jac_work* work_rev_ = CPPAD_NULL; // sparse_jac_rev coloring
+    //
+    // Results that are shared by all the threads; each thread sets
+    // a different subset of the elements of these vectors.
+    sparse_rcv* subset_for_ = CPPAD_NULL; // Jacobian computed by sparse_jac_for
+    sparse_rcv* subset_rev_ = CPPAD_NULL; // Jacobian computed by sparse_jac_rev
+    //
+    // structure with information for one thread
+    typedef struct {
+        // function object used by this thread, set by multi_sparse_jac_setup
+        // (each thread needs its own Taylor coefficients)
+        CppAD::ADFun<double>* fun;
+        //
+        // false if an error occurs, true otherwise, set by worker
+        bool ok;
+    } work_one_t;
+    //
+    // Vector with information for all threads
+    // (uses pointers instead of values to avoid false sharing)
+    // allocated by multi_sparse_jac_setup, freed by multi_sparse_jac_takedown
+    work_one_t* work_all_[CPPAD_MAX_NUM_THREADS];
+}
+// END COMMON C++
+/*
+-------------------------------------------------------------------------------
+$begin multi_sparse_jac_setup$$
+$spell
+    jac
+    bool
+$$
+
+$section Multi-Threaded Sparse Jacobian Set Up$$.
+
+$head Syntax$$
+$icode%ok% = multi_sparse_jac_setup()%$$
+
+$head Purpose$$
+This routine gives each thread its own copy of the function.
+
+$head Thread$$
+It is assumed that this function is called by thread zero
+and all the other threads are blocked (waiting).
+
+$head ok$$
+If the return value $icode ok$$ is false,
+$code multi_sparse_jac_setup$$ detected an error.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN SETUP C++%// END SETUP C++%
+1%$$
+
+$end
+*/
+// BEGIN SETUP C++
+namespace {
+bool multi_sparse_jac_setup(void)
+{   size_t num_threads = std::max(num_threads_, size_t(1));
+    bool   ok          = num_threads == thread_alloc::num_threads();
+    ok                &= thread_alloc::thread_num() == 0;
+    //
+    for(size_t thread_num = 0; thread_num < num_threads; thread_num++)
+    {   // allocate separate memory for each thread to avoid false sharing
+        size_t min_bytes(sizeof(work_one_t)), cap_bytes;
+        void* v_ptr = thread_alloc::get_memory(min_bytes, cap_bytes);
+        work_all_[thread_num] = static_cast<work_one_t*>(v_ptr);
+        //
+        // Each worker gets a separate ADFun object. This is necessary because
+        // the Taylor coefficients will be set by each thread. The operation
+        // sequence in fun_ is shared, not copied.
+        work_all_[thread_num]->fun  = new CppAD::ADFun<double>;
+        work_all_[thread_num]->fun->share_op_seq(*fun_);
+        //
+        // set to false in case this thread's worker does not get called
+        work_all_[thread_num]->ok = false;
+    }
+    return ok;
+}
+}
+// END SETUP C++
+/*
+------------------------------------------------------------------------------
+$begin multi_sparse_jac_worker$$
+$spell
+    jac
+$$
+
+$section Multi-Threaded Sparse Jacobian Worker$$
+
+$head Purpose$$
+This routine does the computation for one thread.
+The colors are partitioned between the threads using
+$cref/n_part/sparse_jac/n_part/$$ equal to the number of threads
+and $cref/i_part/sparse_jac/i_part/$$ equal to the current thread number.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN WORKER C++%// END WORKER C++%
+1%$$
+
+$end
+*/
+// BEGIN WORKER C++
+namespace {
+void multi_sparse_jac_worker(void)
+{   size_t thread_num  = thread_alloc::thread_num();
+    size_t num_threads = std::max(num_threads_, size_t(1));
+    bool   ok          = thread_num < num_threads;
+    //
+    CppAD::ADFun<double>* fun = work_all_[thread_num]->fun;
+    std::string coloring      = "cppad";
+    size_t      group_max     = 1;
+    //
+    // this thread's part of the Jacobian using forward mode
+    size_t n_color = fun->sparse_jac_for(group_max, *x_, *subset_for_,
+        *pattern_, coloring, *work_for_, num_threads, thread_num
+    );
+    ok &= band_ <= n_color;
+    //
+    // this thread's part of the Jacobian using reverse mode
+    n_color = fun->sparse_jac_rev(*x_, *subset_rev_,
+        *pattern_, coloring, *work_rev_, num_threads, thread_num
+    );
+    ok &= band_ <= n_color;
+    //
+    work_all_[thread_num]->ok = ok;
+}
+}
+// END WORKER C++
+/*
+------------------------------------------------------------------------------
+$begin multi_sparse_jac_takedown$$
+$spell
+    jac
+    bool
+$$
+
+$section Multi-Threaded Sparse Jacobian Take Down$$
+
+$head Syntax$$
+$icode%ok% = multi_sparse_jac_takedown()%$$
+
+$head Purpose$$
+This routine frees memory that was allocated by
+$cref multi_sparse_jac_setup$$.
+
+$head Thread$$
+It is assumed that this function is called by thread zero
+and all the other threads are blocked (waiting).
+
+$head ok$$
+If the return value $icode ok$$ is false,
+$code multi_sparse_jac_takedown$$ detected an error.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN TAKEDOWN C++%// END TAKEDOWN C++%
+1%$$
+
+$end
+*/
+// BEGIN TAKEDOWN C++
+namespace {
+bool multi_sparse_jac_takedown(void)
+{   bool ok            = true;
+    ok                &= thread_alloc::thread_num() == 0;
+    size_t num_threads = std::max(num_threads_, size_t(1));
+    //
+    // go down so that free memory for other threads before memory for master
+    size_t thread_num = num_threads;
+    while(thread_num--)
+    {   // check that this tread was ok with the work it did
+        ok  &= work_all_[thread_num]->ok;
+        //
+        // run destructor on function object for this thread
+        delete work_all_[thread_num]->fun;
+        //
+        // delete problem specific information
+        void* v_ptr = static_cast<void*>( work_all_[thread_num] );
+        thread_alloc::return_memory( v_ptr );
+        //
+        // check that there is no longer any memory inuse by this thread
+        if( thread_num > 0 )
+        {   ok &= 0 == thread_alloc::inuse(thread_num);
+            //
+            // return all memory being held for future use by this thread
+            thread_alloc::free_available(thread_num);
+        }
+    }
+    return ok;
+}
+}
+// END TAKEDOWN C++
+/*
+$begin multi_sparse_jac_run$$
+$spell
+    jac
+    bool
+$$
+
+$section Run Multi-Threaded Sparse Jacobian Calculation$$
+
+$head Syntax$$
+$icode%ok% = multi_sparse_jac_run()%$$
+
+$head Thread$$
+It is assumed that this function is called by thread zero
+and all the other threads are blocked (waiting).
+
+$head ok$$
+If the return value $icode ok$$ is false,
+$code multi_sparse_jac_run$$ detected an error.
+
+$head Source$$
+$srcthisfile%0
+    %// BEGIN RUN C++%// END RUN C++%
+1%$$
+
+$end
+------------------------------------------------------------------------------
+*/
+// BEGIN RUN C++
+namespace {
+bool multi_sparse_jac_run(void)
+{
+    bool ok = true;
+    ok     &= thread_alloc::thread_num() == 0;
+
+    // setup the work for multi-threading
+    ok &= multi_sparse_jac_setup();
+
+    // now do the work for each thread
+    if( num_threads_ > 0 )
+        team_work( multi_sparse_jac_worker );
+    else
+        multi_sparse_jac_worker();
+
+    // takedown the multi-threading.
+    ok &= multi_sparse_jac_takedown();
+
+    return ok;
+}
+}
+// END RUN C++
+/*
+------------------------------------------------------------------------------
+$begin multi_sparse_jac_time$$
+$spell
+    jac
+    num
+    alloc
+    bool
+    CppAD
+$$
+
+$section Timing Test for Multi-Threaded Sparse Jacobian Calculation$$
+
+$head Syntax$$
+$icode%ok% = multi_sparse_jac_time(
+    %time_out%, %test_time%, %num_threads%, %size%
+)%$$
+
+
+$head Thread$$
+It is assumed that this function is called by thread zero in sequential
+mode; i.e., not $cref/in_parallel/ta_in_parallel/$$.
+
+$head time_out$$
+This argument has prototype
+$codei%
+    double& %time_out%
+%$$
+Its input value of the argument does not matter.
+Upon return it is the number of wall clock seconds
+used by $cref multi_sparse_jac_run$$.
+
+$head test_time$$
+This argument has prototype
+$codei%
+    double %test_time%
+%$$
+and is the minimum amount of wall clock time that the test should take.
+The number of repeats for the test will be increased until this time
+is reached.
+The reported $icode time_out$$ is the total wall clock time divided by the
+number of repeats.
+
+$head num_threads$$
+This argument has prototype
+$codei%
+    size_t %num_threads%
+%$$
+It specifies the number of threads that are available for this test.
+If it is zero, the test is run without the multi-threading environment and
+$codei%
+    1 == thread_alloc::num_threads()
+%$$
+If it is non-zero, the test is run with the multi-threading and
+$codei%
+    %num_threads% = thread_alloc::num_threads()
+%$$
+
+$head size$$
+This argument has prototype
+$codei%
+    size_t %size%
+%$$
+It is the number of independent (and dependent) variables in the function
+and must be greater than or equal the band width (16).
+
+$head ok$$
+The return value has prototype
+$codei%
+    bool %ok%
+%$$
+If it is true,
+$code multi_sparse_jac_time$$ passed the correctness test
+and did not detect an error.
+Otherwise it is false.
+
+$end
+*/
+
+// BEGIN TIME C++
+namespace {
+    void test_once(void)
+    {   bool ok = multi_sparse_jac_run();
+        if( ! ok )
+        {   std::cerr << "multi_sparse_jac_run: error" << std::endl;
+            exit(1);
+        }
+        return;
+    }
+    //
+    void test_repeat(size_t repeat)
+    {   size_t i;
+        for(i = 0; i < repeat; i++)
+            test_once();
+        return;
+    }
+}
+// This is the only routine that is accessible outside of this file
+bool multi_sparse_jac_time(
+    double& time_out, double test_time, size_t num_threads, size_t size
+)
+{   bool ok = true;
+    ok     &= band_ <= size;
+    if( ! ok )
+        return ok;
+    //
+    size_t initial_inuse = thread_alloc::inuse(0);
+
+    // number of threads, zero for no multi-threading
+    num_threads_ = num_threads;
+
+    // create the shared information in sequential mode
+    size_t n  = size;
+    fun_      = new CppAD::ADFun<double>;
+    pattern_  = new sparse_rc;
+    x_        = new d_vector(n);
+    work_for_ = new CppAD::sparse_jac_work;
+    work_rev_ = new CppAD::sparse_jac_work;
+    {   // f(x)
+        vector<a_double> ax(n), ay(n);
+        for(size_t j = 0; j < n; j++)
+            ax[j] = double(j + 1) / double(n);
+        CppAD::Independent(ax);
+        band_fun(ax, ay);
+        fun_->Dependent(ax, ay);
+        //
+        // sparsity pattern for the Jacobian
+        sparse_rc identity(n, n, n);
+        for(size_t k = 0; k < n; k++)
+            identity.set(k, k, k);
+        bool transpose     = false;
+        bool dependency    = false;
+        bool internal_bool = false;
+        fun_->for_jac_sparsity(
+            identity, transpose, dependency, internal_bool, *pattern_
+        );
+        //
+        // point at which we compute the Jacobian
+        for(size_t j = 0; j < n; j++)
+            (*x_)[j] = double(j + 2) / double(n);
+        //
+        // Compute all of the Jacobian once in sequential mode. This
+        // computes the colorings which are read (not set) in parallel mode.
+        subset_for_ = new sparse_rcv(*pattern_);
+        subset_rev_ = new sparse_rcv(*pattern_);
+        size_t group_max = 1;
+        fun_->sparse_jac_for(
+            group_max, *x_, *subset_for_, *pattern_, "cppad", *work_for_
+        );
+        fun_->sparse_jac_rev(
+            *x_, *subset_rev_, *pattern_, "cppad", *work_rev_
+        );
+        // set the values so we know they are recomputed
+        for(size_t k = 0; k < pattern_->nnz(); k++)
+        {   subset_for_->set(k, 0.0);
+            subset_rev_->set(k, 0.0);
+        }
+    }
+
+    // create team of threads
+    ok &= thread_alloc::in_parallel() == false;
+    if( num_threads > 0 )
+    {   team_create(num_threads);
+        ok &= num_threads == thread_alloc::num_threads();
+    }
+    else
+    {   ok &= 1 == thread_alloc::num_threads();
+    }
+
+    // run the test case and set the time return value
+    time_out = CppAD::time_test(test_repeat, test_time);
+
+    // destroy team of threads
+    if( num_threads > 0 )
+        team_destroy();
+    ok &= thread_alloc::in_parallel() == false;
+
+    // correctness check
+    const s_vector& row( pattern_->row() );
+    const s_vector& col( pattern_->col() );
+    ok &= pattern_->nnz() == n * band_;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+    for(size_t k = 0; k < pattern_->nnz(); k++)
+    {   size_t i   = row[k];
+        size_t j   = col[k];
+        double x_i = (*x_)[i];
+        double check = std::exp(x_i);
+        if( i == j )
+        {   double sum = 0.0;
+            for(size_t ell = 0; ell < band_; ell++)
+                sum += (*x_)[ (i + ell) % n ];
+            check += std::exp(x_i) * sum;
+        }
+        ok &= std::fabs( subset_for_->val()[k] / check - 1.0 ) <= eps99;
+        ok &= std::fabs( subset_rev_->val()[k] / check - 1.0 ) <= eps99;
+    }
+    //
+    // free memory used by the shared information
+    delete fun_;
+    delete pattern_;
+    delete x_;
+    delete work_for_;
+    delete work_rev_;
+    delete subset_for_;
+    delete subset_rev_;
+    //
+    // check that no static variables in this file are holding onto memory
+    ok &= initial_inuse == thread_alloc::inuse(0);
+    //
+    return ok;
+}
+// END TIME C++
@@ -80,6 +80,26 @@ echo
 echo_eval ./$program chkpoint_two 1 4 100
 next_program
 echo
+# test_time=1 max_thread=4, size=1000
+echo_eval ./$program sparse_jac 1 4 1000
+next_program
+echo
+# test_time=1 max_thread=4, size=1000
+echo_eval ./$program sparse_hes 1 4 1000
+next_program
+echo
+# test_time=1 max_thread=4, size=1000
+echo_eval ./$program optimize 1 4 1000
+next_program
+echo
+# test_time=1 max_thread=4, size=1000
+echo_eval ./$program jac_sparsity 1 4 1000
+next_program
+echo
+# test_time=1 max_thread=4, size=1000
+echo_eval ./$program subgraph_jac 1 4 1000
+next_program
+echo
 # test_time= 2 max_thread=4, num_zero=20, num_sub=30, num_sum=500, use_ad=true
 echo_eval ./$program multi_newton 2 4 20 30 500 true
 next_program
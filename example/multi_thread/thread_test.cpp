@@ -67,6 +67,11 @@ $codei%.
 ./%program% atomic_three %test_time% %max_threads% %num_solve%
 ./%program% chkpoint_one %test_time% %max_threads% %num_solve%
 ./%program% chkpoint_two %test_time% %max_threads% %num_solve%
+./%program% sparse_jac   %test_time% %max_threads% %size%
+./%program% sparse_hes   %test_time% %max_threads% %size%
+./%program% optimize     %test_time% %max_threads% %size%
+./%program% jac_sparsity %test_time% %max_threads% %size%
+./%program% subgraph_jac %test_time% %max_threads% %size%
 ./%program% multi_newton %test_time% %max_threads% \
     %num_zero% %num_sub% %num_sum% %use_ad%
 %$$
@@ -87,6 +92,11 @@ $children%
     example/multi_thread/multi_atomic_three.omh%
     example/multi_thread/multi_chkpoint_two.omh%
     example/multi_thread/multi_newton.omh%
+    example/multi_thread/multi_sparse_jac.omh%
+    example/multi_thread/multi_sparse_hes.omh%
+    example/multi_thread/multi_optimize.omh%
+    example/multi_thread/multi_jac_sparsity.omh%
+    example/multi_thread/multi_subgraph_jac.omh%
 
     example/multi_thread/team_thread.hpp
 %$$
@@ -171,6 +181,13 @@ The command line argument $icode num_solve$$
 is an integer specifying the number of solves; see
 $cref/num_solve/multi_atomic_two_time/num_solve/$$ in $code multi_atomic_two_time$$.
 
+$subhead chkpoint_two$$
+The $code chkpoint_two$$ case also prints the vectors
+$code first_all$$ and $code bytes_all$$.
+These are the time for the first call, and the memory per thread, for each
+number of threads; see
+$cref/first call/multi_chkpoint_two_time/First Call/$$.
+
 $comment ------------------------------------------------------------------- $$
 
 $head multi_newton$$
@@ -201,6 +218,63 @@ $cref/multi_newton_time/multi_newton_time/use_ad/$$.
 
 $comment ------------------------------------------------------------------- $$
 
+$head Sparse Jacobian and Hessian$$
+The $icode test_case$$ values
+$code sparse_jac$$ and $code sparse_hes$$
+preform timing tests for computing a sparse Jacobian and Hessian
+where the colors are partitioned between a team of threads.
+$table
+$icode test_case$$   $cnext Documentation                  $rnext
+$code sparse_jac$$   $cnext $cref multi_sparse_jac.cpp$$   $rnext
+$code sparse_hes$$   $cnext $cref multi_sparse_hes.cpp$$
+$tend
+
+$subhead size$$
+The command line argument $icode size$$
+is an integer greater than or equal 32 and has the same meaning as in
+$cref/multi_sparse_jac_time/multi_sparse_jac_time/size/$$ and
+$cref/multi_sparse_hes_time/multi_sparse_hes_time/size/$$.
+
+$comment ------------------------------------------------------------------- $$
+
+$head optimize$$
+The $icode test_case$$ $code optimize$$ preforms a timing test
+where the parts of a partitioned function are recorded and optimized
+by a team of threads; see $cref multi_optimize.cpp$$.
+
+$subhead size$$
+The command line argument $icode size$$
+is an integer greater than or equal 32 and has the same meaning as in
+$cref/multi_optimize_time/multi_optimize_time/size/$$.
+
+$comment ------------------------------------------------------------------- $$
+
+$head jac_sparsity$$
+The $icode test_case$$ $code jac_sparsity$$ preforms a timing test
+where the columns of a forward mode Jacobian sparsity calculation
+are partitioned between a team of threads;
+see $cref multi_jac_sparsity.cpp$$.
+
+$subhead size$$
+The command line argument $icode size$$
+is an integer greater than or equal 32 and has the same meaning as in
+$cref/multi_jac_sparsity_time/multi_jac_sparsity_time/size/$$.
+
+$comment ------------------------------------------------------------------- $$
+
+$head subgraph_jac$$
+The $icode test_case$$ $code subgraph_jac$$ preforms a timing test
+where the rows of a $cref subgraph_jac_rev$$ Jacobian calculation
+are partitioned between a team of threads;
+see $cref multi_subgraph_jac.cpp$$.
+
+$subhead size$$
+The command line argument $icode size$$
+is an integer greater than or equal 32 and has the same meaning as in
+$cref/multi_subgraph_jac_time/multi_subgraph_jac_time/size/$$.
+
+$comment ------------------------------------------------------------------- $$
+
 $head Team Implementations$$
 The following routines are used to implement the specific threading
 systems through the common interface $cref team_thread.hpp$$:
@@ -229,6 +303,11 @@ $end
 # include "multi_chkpoint_one.hpp"
 # include "multi_chkpoint_two.hpp"
 # include "multi_newton.hpp"
+# include "multi_sparse_jac.hpp"
+# include "multi_sparse_hes.hpp"
+# include "multi_optimize.hpp"
+# include "multi_jac_sparsity.hpp"
+# include "multi_subgraph_jac.hpp"
 
 extern bool a11c(void);
 extern bool simple_ad(void);
@@ -274,6 +353,11 @@ int main(int argc, char *argv[])
     "./<program> atomic_three test_time max_threads num_solve\n"
     "./<program> chkpoint_one test_time max_threads num_solve\n"
     "./<program> chkpoint_two test_time max_threads num_solve\n"
+    "./<program> sparse_jac   test_time max_threads size\n"
+    "./<program> sparse_hes   test_time max_threads size\n"
+    "./<program> optimize     test_time max_threads size\n"
+    "./<program> jac_sparsity test_time max_threads size\n"
+    "./<program> subgraph_jac test_time max_threads size\n"
     "./<program> multi_newton test_time max_threads \\\n"
     "   num_zero num_sub num_sum use_ad\\\n"
     "where <program> is example_multi_thread_<threading>\n"
@@ -318,13 +402,23 @@ int main(int argc, char *argv[])
     bool run_chkpoint_one = std::strcmp(test_name, "chkpoint_one")     == 0;
     bool run_chkpoint_two = std::strcmp(test_name, "chkpoint_two")     == 0;
     bool run_multi_newton = std::strcmp(test_name, "multi_newton")     == 0;
+    bool run_sparse_jac   = std::strcmp(test_name, "sparse_jac")       == 0;
+    bool run_sparse_hes   = std::strcmp(test_name, "sparse_hes")       == 0;
+    bool run_optimize     = std::strcmp(test_name, "optimize")         == 0;
+    bool run_jac_sparsity = std::strcmp(test_name, "jac_sparsity")     == 0;
+    bool run_subgraph_jac = std::strcmp(test_name, "subgraph_jac")     == 0;
     if( run_a11c || run_simple_ad || run_team_example )
         ok = (argc == 2);
     else if( run_harmonic
     || run_atomic_two
     || run_atomic_three
     || run_chkpoint_one
-    || run_chkpoint_two )
+    || run_chkpoint_two
+    || run_sparse_jac
+    || run_sparse_hes
+    || run_optimize
+    || run_jac_sparsity
+    || run_subgraph_jac )
         ok = (argc == 5);
     else if( run_multi_newton )
         ok = (argc == 8);
@@ -365,6 +459,7 @@ int main(int argc, char *argv[])
 
     size_t mega_sum  = 0; // assignment to avoid compiler warning
     size_t num_solve = 0;
+    size_t size      = 0;
     if( run_harmonic )
     {   // mega_sum
         mega_sum = arg2size_t( *++argv, 1,
@@ -380,6 +475,16 @@ int main(int argc, char *argv[])
             "run: num_solve is less than one"
         );
     }
+    else if( run_sparse_jac
+    || run_sparse_hes
+    || run_optimize
+    || run_jac_sparsity
+    || run_subgraph_jac )
+    {   // size
+        size = arg2size_t( *++argv, 32,
+            "run: size is less than 32"
+        );
+    }
     else
     {   ok &= run_multi_newton;
         if( ! ok )
@@ -415,6 +520,10 @@ int main(int argc, char *argv[])
         }
     }
 
+    // first call time and memory per thread for chkpoint_two
+    CppAD::vector<double> first_all;
+    CppAD::vector<size_t> bytes_all;
+    //
     // run the test for each number of threads
     cout << "time_all  = [" << endl;
     for(size_t num_threads = 0; num_threads <= max_threads; num_threads++)
@@ -434,8 +543,30 @@ int main(int argc, char *argv[])
         else if( run_chkpoint_one ) this_ok = multi_chkpoint_one_time(
             time_out, test_time, num_threads, num_solve
         );
-        else if( run_chkpoint_two ) this_ok = multi_chkpoint_two_time(
-            time_out, test_time, num_threads, num_solve
+        else if( run_chkpoint_two )
+        {   this_ok = multi_chkpoint_two_time(
+                time_out, test_time, num_threads, num_solve
+            );
+            double first_time;
+            size_t thread_bytes;
+            multi_chkpoint_two_first(first_time, thread_bytes);
+            first_all.push_back(first_time);
+            bytes_all.push_back(thread_bytes);
+        }
+        else if( run_sparse_jac ) this_ok = multi_sparse_jac_time(
+            time_out, test_time, num_threads, size
+        );
+        else if( run_sparse_hes ) this_ok = multi_sparse_hes_time(
+            time_out, test_time, num_threads, size
+        );
+        else if( run_optimize ) this_ok = multi_optimize_time(
+            time_out, test_time, num_threads, size
+        );
+        else if( run_jac_sparsity ) this_ok = multi_jac_sparsity_time(
+            time_out, test_time, num_threads, size
+        );
+        else if( run_subgraph_jac ) this_ok = multi_subgraph_jac_time(
+            time_out, test_time, num_threads, size
         );
         else
         {   assert( run_multi_newton);
@@ -464,6 +595,22 @@ int main(int argc, char *argv[])
         ok &= this_ok;
     }
     cout << "];" << endl;
+    if( run_chkpoint_two )
+    {   cout << "first_all = [" << endl;
+        for(size_t i = 0; i < first_all.size(); ++i)
+        {   cout << std::setw(20) << first_all[i];
+            cout << " % first call" << endl;
+        }
+        cout << "];" << endl;
+        cout << "bytes_all = [" << endl;
+        for(size_t i = 0; i < bytes_all.size(); ++i)
+        {   cout << std::setw(20) << bytes_all[i];
+            cout << " % bytes per thread" << endl;
+        }
+        cout << "];" << endl;
+        first_all.clear();
+        bytes_all.clear();
+    }
     //
     if( thread_alloc::free_all() )
         cout << "free_all      = true;"  << endl;
@@ -0,0 +1,141 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin hybrid_sparsity.cpp$$
+$spell
+    Cpp
+$$
+
+$section Hybrid Sparsity Calculations: Example and Test$$
+
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+
+namespace {
+    typedef CPPAD_TESTVECTOR(size_t)     SizeVector;
+    typedef CppAD::sparse_rc<SizeVector> sparsity;
+
+    // check if two sparsity patterns are equal
+    bool equal(const sparsity& a, const sparsity& b)
+    {   bool ok = a.nr() == b.nr() && a.nc() == b.nc() && a.nnz() == b.nnz();
+        if( ! ok )
+            return false;
+        SizeVector a_major = a.row_major();
+        SizeVector b_major = b.row_major();
+        for(size_t k = 0; k < a.nnz(); ++k)
+        {   ok &= a.row()[ a_major[k] ] == b.row()[ b_major[k] ];
+            ok &= a.col()[ a_major[k] ] == b.col()[ b_major[k] ];
+        }
+        return ok;
+    }
+}
+
+bool hybrid_sparsity(void)
+{   bool ok = true;
+    using CppAD::AD;
+    //
+    // domain space vector
+    size_t n = 200;
+    CPPAD_TESTVECTOR(AD<double>) ax(n);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1) / double(n);
+
+    // declare independent variables and start recording
+    CppAD::Independent(ax);
+
+    // range space vector
+    size_t m = 3;
+    CPPAD_TESTVECTOR(AD<double>) ay(m);
+    //
+    // y[0] depends on all the components of x (a dense row)
+    ay[0] = 0.0;
+    for(size_t j = 0; j < n; ++j)
+        ay[0] += ax[j];
+    //
+    // y[1] depends on two components of x (a sparse row)
+    ay[1] = ax[3] * ax[150];
+    //
+    // y[2] depends on a band of components of x (a run)
+    ay[2] = 1.0;
+    for(size_t j = 50; j < 100; ++j)
+        ay[2] *= sin( ax[j] );
+
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f(ax, ay);
+
+    // the default is not to use the hybrid sets
+    ok &= f.hybrid_sparsity() == false;
+
+    // sparsity pattern for the identity matrix
+    sparsity identity_n(n, n, n), identity_m(m, m, m);
+    for(size_t k = 0; k < n; k++)
+        identity_n.set(k, k, k);
+    for(size_t k = 0; k < m; k++)
+        identity_m.set(k, k, k);
+    //
+    bool transpose       = false;
+    bool dependency      = false;
+    bool internal_bool   = false;
+    CPPAD_TESTVECTOR(bool) select_domain(n), select_range(m);
+    for(size_t j = 0; j < n; ++j)
+        select_domain[j] = true;
+    select_range[0] = false;
+    select_range[1] = true;
+    select_range[2] = true;
+    //
+    // compute sparsity patterns with and without the hybrid sets
+    sparsity for_jac[2], rev_jac[2], for_hes[2], rev_hes[2];
+    for(size_t k = 0; k < 2; ++k)
+    {   f.hybrid_sparsity( k == 1 );
+        f.for_jac_sparsity(
+            identity_n, transpose, dependency, internal_bool, for_jac[k]
+        );
+        ok &= f.size_forward_set() > 0;
+        f.rev_hes_sparsity(
+            select_range, transpose, internal_bool, rev_hes[k]
+        );
+        f.rev_jac_sparsity(
+            identity_m, transpose, dependency, internal_bool, rev_jac[k]
+        );
+        f.for_hes_sparsity(
+            select_domain, select_range, internal_bool, for_hes[k]
+        );
+    }
+    ok &= f.hybrid_sparsity() == true;
+    //
+    // the patterns are the same
+    ok &= equal(for_jac[0], for_jac[1]);
+    ok &= equal(rev_jac[0], rev_jac[1]);
+    ok &= equal(for_hes[0], for_hes[1]);
+    ok &= equal(rev_hes[0], rev_hes[1]);
+    //
+    // Jacobian has n + 2 + 50 non-zeros
+    ok &= for_jac[1].nnz() == n + 2 + 50;
+    ok &= rev_jac[1].nnz() == n + 2 + 50;
+    //
+    // Hessian for y[1] + y[2] has 2 + 50 * 50 non-zeros
+    ok &= for_hes[1].nnz() == 2 + 50 * 50;
+    ok &= rev_hes[1].nnz() == 2 + 50 * 50;
+    //
+    // the memory used by the Jacobian sparsity results can be freed
+    f.size_forward_set(0);
+    ok &= f.size_forward_set() == 0;
+    //
+    return ok;
+}
+// END C++
@@ -38,6 +38,7 @@ extern bool dependency(void);
 extern bool for_hes_sparsity(void);
 extern bool for_jac_sparsity(void);
 extern bool for_sparse_hes(void);
+extern bool hybrid_sparsity(void);
 extern bool rc_sparsity(void);
 extern bool rev_hes_sparsity(void);
 extern bool rev_jac_sparsity(void);
@@ -50,6 +51,7 @@ extern bool sparse_jac_rev(void);
 extern bool sparse_jacobian(void);
 extern bool sparse_sub_hes(void);
 extern bool sparsity_sub(void);
+extern bool star_acyclic_hes(void);
 extern bool sub_sparse_hes(void);
 extern bool subgraph_hes2jac(void);
 extern bool subgraph_jac_rev(void);
@@ -74,6 +76,7 @@ int main(void)
     Run( for_hes_sparsity,          "for_hes_sparsity" );
     Run( for_jac_sparsity,          "for_jac_sparsity" );
     Run( for_sparse_hes,            "for_sparse_hes" );
+    Run( hybrid_sparsity,           "hybrid_sparsity" );
     Run( rc_sparsity,               "rc_sparsity" );
     Run( rev_hes_sparsity,          "rev_hes_sparsity" );
     Run( rev_jac_sparsity,          "rev_jac_sparsity" );
@@ -85,6 +88,7 @@ int main(void)
     Run( sparse_jacobian,           "sparse_jacobian" );
     Run( sparse_sub_hes,            "sparse_sub_hes" );
     Run( sparsity_sub,              "sparsity_sub" );
+    Run( star_acyclic_hes,          "star_acyclic_hes" );
     Run( sub_sparse_hes,            "sub_sparse_hes" );
     Run( subgraph_hes2jac,          "subgraph_hes2jac" );
     Run( subgraph_jac_rev,          "subgraph_jac_rev" );
@@ -0,0 +1,115 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+/*
+$begin star_acyclic_hes.cpp$$
+$spell
+    Cpp
+    Hessian
+    cppad
+$$
+
+$section Star and Acyclic Coloring of a Sparse Hessian: Example and Test$$
+
+$head Purpose$$
+This example computes a tridiagonal Hessian using the
+$cref/cppad.star/sparse_hes/coloring/cppad.star/$$ and
+$cref/cppad.acyclic/sparse_hes/coloring/cppad.acyclic/$$ colorings.
+The star coloring requires three sweeps and computes each entry directly.
+The acyclic coloring requires two sweeps and recovers the entries
+by substitution.
+
+$srcthisfile%0%// BEGIN C++%// END C++%1%$$
+
+$end
+*/
+// BEGIN C++
+# include <cppad/cppad.hpp>
+bool star_acyclic_hes(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps = 10. * CppAD::numeric_limits<double>::epsilon();
+    //
+    typedef CPPAD_TESTVECTOR(AD<double>)               a_vector;
+    typedef CPPAD_TESTVECTOR(double)                   d_vector;
+    typedef CPPAD_TESTVECTOR(size_t)                   s_vector;
+    typedef CPPAD_TESTVECTOR(bool)                     b_vector;
+    //
+    // domain space vector
+    size_t n = 10;
+    a_vector a_x(n);
+    for(size_t j = 0; j < n; j++)
+        a_x[j] = AD<double> (0);
+    //
+    // declare independent variables and starting recording
+    CppAD::Independent(a_x);
+    //
+    // range space vector
+    size_t m = 1;
+    a_vector a_y(m);
+    a_y[0] = 0.0;
+    for(size_t j = 0; j < n - 1; j++)
+        a_y[0] += a_x[j] * a_x[j+1] * a_x[j+1];
+    //
+    // create f: x -> y and stop tape recording
+    CppAD::ADFun<double> f(a_x, a_y);
+    //
+    // new value for the independent variable vector, and weighting vector
+    d_vector w(m), x(n);
+    for(size_t j = 0; j < n; j++)
+        x[j] = double(j + 1);
+    w[0] = 1.0;
+    //
+    // sparsity pattern for the Hessian
+    b_vector select_domain(n), select_range(m);
+    for(size_t j = 0; j < n; j++)
+        select_domain[j] = true;
+    select_range[0] = true;
+    CppAD::sparse_rc<s_vector> hes_pattern;
+    bool internal_bool = false;
+    f.for_hes_sparsity(
+        select_domain, select_range, internal_bool, hes_pattern
+    );
+    //
+    // compute the entire Hessian using each of the colorings
+    const char* coloring[] = { "cppad.star", "cppad.acyclic" };
+    size_t check_sweep[]   = { 3, 2 };
+    for(size_t ell = 0; ell < 2; ell++)
+    {   CppAD::sparse_rcv<s_vector, d_vector> subset( hes_pattern );
+        CppAD::sparse_hes_work work;
+        size_t n_sweep = f.sparse_hes(
+            x, w, subset, hes_pattern, coloring[ell], work
+        );
+        ok &= n_sweep == check_sweep[ell];
+        //
+        // check the tridiagonal Hessian
+        // H(j, j)   = 2 * x[j-1]
+        // H(j, j+1) = 2 * x[j+1]
+        const s_vector& row( subset.row() );
+        const s_vector& col( subset.col() );
+        const d_vector& val( subset.val() );
+        ok &= subset.nnz() == 3 * n - 3;
+        for(size_t k = 0; k < subset.nnz(); k++)
+        {   size_t i = row[k];
+            size_t j = col[k];
+            double check = 0.0;
+            if( i == j && 0 < j )
+                check = 2.0 * x[j-1];
+            else if( i + 1 == j || j + 1 == i )
+                check = 2.0 * x[ std::max(i, j) ];
+            ok &= NearEqual(val[k], check, eps, eps);
+        }
+    }
+    return ok;
+}
+// END C++
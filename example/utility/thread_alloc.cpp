@@ -63,6 +63,8 @@ bool raw_allocate(void)
             // determine the number of size_t values we have obtained
             size_t  cap_size_t = cap_bytes / sizeof(size_t);
             ok                &= min_size_t <= cap_size_t;
+            // capacity_for gives the same capacity without allocating
+            ok &= thread_alloc::capacity_for(min_bytes) == cap_bytes;
             // use placement new to call the size_t copy constructor
             for(size_t k = 0; k < cap_size_t; k++)
                 new(ptr + k) size_t(i + j + k);
@@ -885,6 +885,7 @@ void ADFun<Base,RecBase>::abs_normal_fun(ADFun& g, ADFun& a) const
     // (the resutls are no longer valid)
     g.for_jac_sparse_pack_.resize(0, 0);
     g.for_jac_sparse_set_.resize(0, 0);
+    g.for_jac_sparse_hybrid_.resize(0, 0);
 
     // free taylor coefficient memory
     g.taylor_.clear();
@@ -922,6 +923,7 @@ void ADFun<Base,RecBase>::abs_normal_fun(ADFun& g, ADFun& a) const
     // (the resutls are no longer valid)
     a.for_jac_sparse_pack_.resize(0, 0);
     a.for_jac_sparse_set_.resize(0, 0);
+    a.for_jac_sparse_hybrid_.resize(0, 0);
 
     // free taylor coefficient memory
     a.taylor_.clear();
@@ -260,6 +260,10 @@ public:
     // abort current AD<Base> recording
     static void        abort_recording(void);
 
+    // options for the current AD<Base> recording
+    static void        record_reserve(size_t num_op, size_t num_par);
+    static void        record_par_hash(const std::string& method);
+
     // set the maximum number of OpenMP threads (deprecated)
     static void        omp_max_thread(size_t number);
 
@@ -42,13 +42,17 @@ $childtable%
     omh/adfun.omh%
     include/cppad/core/optimize.hpp%
     include/cppad/core/fun_check.hpp%
-    include/cppad/core/check_for_nan.hpp
+    include/cppad/core/check_for_nan.hpp%
+    include/cppad/core/jit.hpp%
+    include/cppad/core/compact_op_seq.hpp
 %$$
 
 $end
 */
 # include <cppad/core/graph/cpp_graph.hpp>
 # include <cppad/local/subgraph/info.hpp>
+# include <cppad/local/sweep/forward0_direct.hpp>
+# include <cppad/local/jit/jit_fun.hpp>
 # include <cppad/local/graph/cpp_graph_op.hpp>
 
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
@@ -88,6 +92,17 @@ private:
     /// Check for nan's and report message to user (default value is true).
     bool check_for_nan_;
 
+    /// Use direct dispatch for zero order forward (default value is false).
+    bool forward_direct_;
+
+    /// Use compiled code for zero order forward and first order reverse
+    /// (default value is false).
+    bool jit_;
+
+    /// Use hybrid_setvec, instead of list_setvec, for vector of sets
+    /// sparsity calculations (default value is false).
+    bool hybrid_sparsity_;
+
     /// If zero, ignoring comparison operators. Otherwise is the
     /// compare change count at which to store the operator index.
     size_t compare_change_count_;
@@ -137,6 +152,14 @@ private:
     /// the operation sequence corresponding to this object
     local::player<Base> play_;
 
+    /// pre-decoded version of play_ used when forward_direct_ is true
+    /// (set during the first zero order forward after play_ changes)
+    local::sweep::forward0_direct<Base> direct_sweep_;
+
+    /// compiled version of play_ used when jit_ is true
+    /// (set during the first use after play_ changes)
+    local::jit::jit_fun<Base> jit_fun_;
+
     /// Packed results of the forward mode Jacobian sparsity calculations.
     /// for_jac_sparse_pack_.n_set() != 0  implies other sparsity results
     /// are empty
@@ -146,9 +169,18 @@ private:
     /// for_jac_sparse_set_.n_set() != 0  implies for_sparse_pack_ is empty.
     local::sparse::list_setvec for_jac_sparse_set_;
 
+    /// Hybrid results of the forward mode Jacobian sparsity calculations
+    /// for_jac_sparse_hybrid_.n_set() != 0 implies for_jac_sparse_set_
+    /// and for_jac_sparse_pack_ are empty.
+    local::sparse::hybrid_setvec for_jac_sparse_hybrid_;
+
     /// subgraph information for this object
     local::subgraph::subgraph_info subgraph_info_;
 
+    /// used for the partial derivatives in Reverse.
+    /// Declared here to avoid reallocation for each call to Reverse.
+    local::pod_vector_maybe<Base> reverse_partial_;
+
     /// used for subgraph reverse mode calculations.
     /// Declared here to avoid reallocation for each call to subgraph_reverse.
     /// Not in subgraph_info_ because it depends on Base.
@@ -317,10 +349,19 @@ public:
     std::string to_json(void);
     void to_graph(cpp_graph& graph_obj);
 
+    // save and load using a binary format
+    // (doxygen in cppad/core/binary_tape.hpp)
+    void to_binary(std::ostream& os) const;
+    void from_binary(std::istream& is);
+
     // create ADFun< AD<Base> > from this ADFun<Base>
     // (doxygen in cppad/core/base2ad.hpp)
     ADFun< AD<Base>, RecBase > base2ad(void) const;
 
+    // use the same operation sequence as another ADFun<Base>
+    // (doxygen in cppad/core/share_op_seq.hpp)
+    void share_op_seq(const ADFun& f);
+
     /// sequence constructor
     template <class ADvector>
     ADFun(const ADvector &x, const ADvector &y);
@@ -335,6 +376,33 @@ public:
     /// get check_for_nan
     bool check_for_nan(void) const;
 
+    /// set forward_direct
+    void forward_direct(bool value);
+
+    /// get forward_direct
+    bool forward_direct(void) const;
+
+    /// set jit
+    void jit(bool value);
+
+    /// get jit
+    bool jit(void) const;
+
+    /// reason that jit is not being used
+    std::string jit_msg(void) const;
+
+    /// set compact_op_seq
+    void compact_op_seq(bool value);
+
+    /// get compact_op_seq
+    bool compact_op_seq(void) const;
+
+    /// set hybrid_sparsity
+    void hybrid_sparsity(bool value);
+
+    /// get hybrid_sparsity
+    bool hybrid_sparsity(void) const;
+
     /// assign a new operation sequence
     template <class ADvector>
     void Dependent(const ADvector &x, const ADvector &y);
@@ -343,6 +411,10 @@ public:
     template <class BaseVector>
     void new_dynamic(const BaseVector& dynamic);
 
+    /// new_dynamic user API, only recompute what depends on changed
+    template <class BaseVector, class SizeVector>
+    void new_dynamic(const BaseVector& dynamic, const SizeVector& changed);
+
     /// forward mode user API, one order multiple directions.
     template <class BaseVector>
     BaseVector Forward(size_t q, size_t r, const BaseVector& x);
@@ -353,10 +425,20 @@ public:
         size_t q, const BaseVector& xq, std::ostream& s = std::cout
     );
 
+    /// zero order forward mode for a batch of points
+    template <class BaseVector>
+    BaseVector forward_batch(size_t K, const BaseVector& x) const;
+
     /// reverse mode sweep
     template <class BaseVector>
     BaseVector Reverse(size_t p, const BaseVector &v);
 
+    /// first order reverse mode using a bounded amount of memory
+    template <class BaseVector>
+    BaseVector reverse_budget(
+        size_t max_bytes, const BaseVector& x, const BaseVector& w
+    );
+
     // forward Jacobian sparsity pattern
     // (doxygen in cppad/core/for_sparse_jac.hpp)
     template <class SetVector>
@@ -404,8 +486,10 @@ public:
     // (doxygen in cppad/core/subgraph_jac_rev.hpp)
     template <class SizeVector, class BaseVector>
     void subgraph_jac_rev(
-        const BaseVector&                    x         ,
-        sparse_rcv<SizeVector, BaseVector>&  subset
+        const BaseVector&                    x          ,
+        sparse_rcv<SizeVector, BaseVector>&  subset     ,
+        size_t                               n_part = 1 ,
+        size_t                               i_part = 0
     );
 
     // subgraph_jac_rev: compute Jacobian
@@ -428,7 +512,9 @@ public:
         sparse_rcv<SizeVector, BaseVector>&  subset    ,
         const sparse_rc<SizeVector>&         pattern   ,
         const std::string&                   coloring  ,
-        sparse_jac_work&                     work
+        sparse_jac_work&                     work      ,
+        size_t                               n_part = 1,
+        size_t                               i_part = 0
     );
 
     // compute sparse Jacobian using reverse mode
@@ -439,7 +525,9 @@ public:
         sparse_rcv<SizeVector, BaseVector>&  subset   ,
         const sparse_rc<SizeVector>&         pattern  ,
         const std::string&                   coloring ,
-        sparse_jac_work&                     work
+        sparse_jac_work&                     work     ,
+        size_t                               n_part = 1,
+        size_t                               i_part = 0
     );
 
     // compute sparse Hessian
@@ -451,7 +539,9 @@ public:
         sparse_rcv<SizeVector, BaseVector>&  subset   ,
         const sparse_rc<SizeVector>&         pattern  ,
         const std::string&                   coloring ,
-        sparse_hes_work&                     work
+        sparse_hes_work&                     work     ,
+        size_t                               n_part = 1,
+        size_t                               i_part = 0
     );
 
     // compute sparsity pattern using subgraphs
@@ -473,7 +563,9 @@ public:
         bool                         transpose        ,
         bool                         dependency       ,
         bool                         internal_bool    ,
-        sparse_rc<SizeVector>&       pattern_out
+        sparse_rc<SizeVector>&       pattern_out      ,
+        size_t                       n_part = 1       ,
+        size_t                       i_part = 0
     );
 
     // reverse mode Jacobian sparsity pattern
@@ -576,7 +668,8 @@ public:
 
     /// amount of memory used for vector of set Jacobain sparsity pattern
     size_t size_forward_set(void) const
-    {   return for_jac_sparse_set_.memory(); }
+    {   return for_jac_sparse_set_.memory() + for_jac_sparse_hybrid_.memory();
+    }
 
     /// free memory used for Jacobain sparsity pattern
     void size_forward_set(size_t zero)
@@ -585,6 +678,7 @@ public:
             "size_forward_bool: argument not equal to zero"
         );
         for_jac_sparse_set_.resize(0, 0);
+        for_jac_sparse_hybrid_.resize(0, 0);
     }
 
     /// number of operators in the operation sequence
@@ -806,7 +900,8 @@ public:
     size_t Memory(void) const
     {   size_t pervar  = cap_order_taylor_ * sizeof(Base)
         + for_jac_sparse_pack_.memory()
-        + for_jac_sparse_set_.memory();
+        + for_jac_sparse_set_.memory()
+        + for_jac_sparse_hybrid_.memory();
         size_t total   = num_var_tape_  * pervar;
         total         += play_.size_op_seq();
         total         += play_.size_random();
@@ -839,9 +934,11 @@ public:
 
 // non-user interfaces
 # include <cppad/local/sweep/forward0.hpp>
+# include <cppad/local/sweep/forward0_batch.hpp>
 # include <cppad/local/sweep/forward1.hpp>
 # include <cppad/local/sweep/forward2.hpp>
 # include <cppad/local/sweep/reverse.hpp>
+# include <cppad/local/sweep/reverse_budget.hpp>
 # include <cppad/local/sweep/for_jac.hpp>
 # include <cppad/local/sweep/rev_jac.hpp>
 # include <cppad/local/sweep/rev_hes.hpp>
@@ -855,14 +952,21 @@ public:
 # include <cppad/core/dependent.hpp>
 # include <cppad/core/fun_construct.hpp>
 # include <cppad/core/base2ad.hpp>
+# include <cppad/core/share_op_seq.hpp>
 # include <cppad/core/abort_recording.hpp>
+# include <cppad/core/record_option.hpp>
 # include <cppad/core/fun_eval.hpp>
 # include <cppad/core/drivers.hpp>
 # include <cppad/core/fun_check.hpp>
 # include <cppad/core/omp_max_thread.hpp>
 # include <cppad/core/optimize.hpp>
+# include <cppad/core/jit.hpp>
+# include <cppad/core/compact_op_seq.hpp>
+# include <cppad/core/hybrid_sparsity.hpp>
 # include <cppad/core/abs_normal_fun.hpp>
 # include <cppad/core/graph/from_json.hpp>
 # include <cppad/core/graph/to_json.hpp>
+# include <cppad/core/binary_tape.hpp>
+# include <cppad/core/tape_cache.hpp>
 
 # endif
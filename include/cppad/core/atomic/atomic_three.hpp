@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_ATOMIC_ATOMIC_THREE_HPP
 # define CPPAD_CORE_ATOMIC_ATOMIC_THREE_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -62,6 +62,14 @@ $icode%ok% = %afun%.for_type(
 )
 %ok% = %afun%.rev_depend(
     %parameter_x%, %type_x%, %depend_x%, %depend_y%
+)
+%max_call% = %afun%.batch_size()
+%ok% = %afun%.forward_batch(
+    %n_call%, %parameter_x%, %type_x%, %taylor_x%, %taylor_y%
+)
+%ok% = %afun%.reverse_batch(
+    %n_call%, %parameter_x%, %type_x%,
+    %taylor_x%, %taylor_y%, %partial_x%, %partial_y%
 )%$$
 
 $head See Also$$
@@ -187,6 +195,7 @@ $childtable%include/cppad/core/atomic/three_ctor.hpp
     %include/cppad/core/atomic/three_jac_sparsity.hpp
     %include/cppad/core/atomic/three_hes_sparsity.hpp
     %include/cppad/core/atomic/three_rev_depend.hpp
+    %include/cppad/core/atomic/three_batch.hpp
 %$$
 
 $end
@@ -210,6 +219,7 @@ $end
 # include <set>
 # include <cppad/core/cppad_assert.hpp>
 # include <cppad/local/atomic_index.hpp>
+# include <cppad/local/sparse/crs_pattern.hpp>
 
 // needed before one can use in_parallel
 # include <cppad/utility/thread_alloc.hpp>
@@ -324,6 +334,25 @@ public:
         vector< AD<Base> >&          apartial_x  ,
         const vector< AD<Base> >&    apartial_y
     );
+    // ------------------------------------------------------------------------
+    // batches: see doxygen in atomic/three_batch.hpp
+    virtual size_t batch_size(void);
+    virtual bool forward_batch(
+        size_t                       n_call      ,
+        const vector<Base>&          parameter_x ,
+        const vector<ad_type_enum>&  type_x      ,
+        const vector<Base>&          taylor_x    ,
+        vector<Base>&                taylor_y
+    );
+    virtual bool reverse_batch(
+        size_t                       n_call      ,
+        const vector<Base>&          parameter_x ,
+        const vector<ad_type_enum>&  type_x      ,
+        const vector<Base>&          taylor_x    ,
+        const vector<Base>&          taylor_y    ,
+        vector<Base>&                partial_x   ,
+        const vector<Base>&          partial_y
+    );
     // ------------------------------------------------------------
     // jac_sparsity: see doxygen in atomic/three_jac_sparsity.hpp
     virtual bool jac_sparsity(
@@ -397,6 +426,26 @@ public:
         CPPAD_ASSERT_UNKNOWN( type == 3 );
         return name;
     }
+    /*!
+    Jacobian sparsity pattern that does not depend on the call.
+
+    \return
+    If this is not null, the sweeps use it in place of jac_sparsity;
+    i.e., its elements, restricted to select_x and select_y,
+    are the pattern for every call to this atomic function.
+    */
+    virtual const local::sparse::crs_pattern* fixed_jac_sparsity(void)
+    {   return CPPAD_NULL; }
+    /*!
+    Hessian sparsity pattern that does not depend on the call.
+
+    \return
+    If this is not null, the sweeps use it in place of hes_sparsity;
+    i.e., its elements, restricted to select_x, are the pattern for
+    every call to this atomic function.
+    */
+    virtual const local::sparse::crs_pattern* fixed_hes_sparsity(void)
+    {   return CPPAD_NULL; }
     /// destructor informs CppAD that this atomic function with this index
     /// has dropped out of scope by setting its pointer to null
     virtual ~atomic_three(void)
@@ -482,5 +531,6 @@ public:
 # include <cppad/core/atomic/three_reverse.hpp>
 # include <cppad/core/atomic/three_jac_sparsity.hpp>
 # include <cppad/core/atomic/three_hes_sparsity.hpp>
+# include <cppad/core/atomic/three_batch.hpp>
 
 # endif
@@ -0,0 +1,297 @@
+# ifndef CPPAD_CORE_ATOMIC_THREE_BATCH_HPP
+# define CPPAD_CORE_ATOMIC_THREE_BATCH_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin atomic_three_batch$$
+$spell
+    afun
+    enum
+    ty
+    px
+    py
+    const
+    mul
+    Taylor
+$$
+
+$section Atomic Function Batches of Calls$$
+
+$head Syntax$$
+$icode%max_call% = %afun%.batch_size()
+%$$
+$icode%ok% = %afun%.forward_batch(
+    %n_call%, %parameter_x%, %type_x%, %taylor_x%, %taylor_y%
+)
+%$$
+$icode%ok% = %afun%.reverse_batch(
+    %n_call%, %parameter_x%, %type_x%,
+    %taylor_x%, %taylor_y%, %partial_x%, %partial_y%
+)%$$
+
+$subhead Prototype$$
+$srcthisfile%0%// BEGIN_PROTOTYPE_SIZE%// END_PROTOTYPE_SIZE%1
+%$$
+$srcthisfile%0%// BEGIN_PROTOTYPE_FORWARD%// END_PROTOTYPE_FORWARD%1
+%$$
+$srcthisfile%0%// BEGIN_PROTOTYPE_REVERSE%// END_PROTOTYPE_REVERSE%1
+%$$
+
+$head Purpose$$
+When an atomic function is called many times in one recording,
+the cost of each call to
+$cref/forward/atomic_three_forward/$$ and $cref/reverse/atomic_three_reverse/$$
+can be larger than the cost of the function evaluation.
+These virtual functions let the
+zero order forward sweep ($codei%%f%.Forward(0, %x%)%$$)
+and the first order reverse sweep ($codei%%f%.Reverse(1, %w%)%$$)
+evaluate many calls with one call to the atomic function.
+
+$head Batch$$
+During a sweep, a call is added to the pending batch
+instead of being evaluated.
+The pending calls are evaluated, using one call to
+$icode forward_batch$$ ($icode reverse_batch$$),
+before the first operator that depends on one of them,
+when a call to a different atomic function (or with a different
+number of arguments or results) is added,
+and when there are $icode max_call$$ pending calls.
+Hence the calls in a batch are independent; i.e.,
+none of their arguments depend on the results of another call in the batch.
+Calls whose results are not used until after many other calls,
+for example a kernel that is applied to many blocks of data whose results
+are combined later, are evaluated in large batches.
+
+$head Implementation$$
+These functions are optional.
+The other sweeps, and the forward and reverse sweeps for other orders,
+call $icode forward$$ and $icode reverse$$ for each call.
+
+$head Base$$
+See $cref/Base/atomic_three_afun/Base/$$.
+Batches are not used by
+$cref base2ad$$ versions of a function
+because the corresponding Taylor coefficients have type $codei%AD<%Base%>%$$.
+
+$head max_call$$
+This is the maximum number of calls in a batch.
+The default implementation returns zero, in which case calls to
+this atomic function are not batched and
+$icode forward_batch$$, $icode reverse_batch$$ are not used.
+Memory proportional to $icode%max_call%*(%n%+%m%)%$$
+is used by the sweeps when the calls are batched.
+This value should not change while a sweep is in progress.
+
+$head n_call$$
+This is the number of calls in the batch;
+$icode%1% <= %n_call% <= %max_call%$$.
+Below, $icode n$$ ($icode m$$) is the number of arguments (results)
+for each of the calls in the batch.
+
+$head Storage$$
+All the vectors use a structure of arrays layout;
+e.g., the value for component $icode j$$ of the argument to call $icode c$$
+is $icode%taylor_x%[ %j% * %n_call% + %c% ]%$$.
+Thus the values for one component, and all the calls,
+are contiguous in memory.
+
+$head parameter_x$$
+This vector has size $icode%n% * %n_call%$$ and contains the
+$cref/parameter_x/atomic_three/parameter_x/$$ values for each call.
+
+$head type_x$$
+This vector has size $icode%n% * %n_call%$$ and contains the
+$cref/type_x/atomic_three/type_x/$$ values for each call.
+
+$head taylor_x$$
+This vector has size $icode%n% * %n_call%$$ and contains the
+zero order Taylor coefficient for the arguments of each call.
+
+$head taylor_y$$
+This vector has size $icode%m% * %n_call%$$.
+For $icode forward_batch$$,
+its input values are not specified (must not matter).
+Upon return it contains the zero order Taylor coefficient
+for the results of each call.
+(Only the components that are variables are used.)
+For $icode reverse_batch$$,
+it contains the zero order Taylor coefficient for the results of each call.
+
+$head partial_x$$
+This vector has size $icode%n% * %n_call%$$ and its input values
+are not specified (must not matter).
+Upon return, it contains the partial derivative of $latex G$$
+with respect to the arguments of each call; see
+$cref/partial_x/atomic_three_reverse/partial_x/$$ for the case
+$icode%order_up% == 0%$$.
+
+$head partial_y$$
+This vector has size $icode%m% * %n_call%$$ and contains the
+partial derivative of $latex G$$ with respect to the results of each call.
+
+$head Default$$
+The default implementations of $icode forward_batch$$ and
+$icode reverse_batch$$ evaluate each call using
+$cref/forward/atomic_three_forward/$$ and
+$cref/reverse/atomic_three_reverse/$$.
+
+$head ok$$
+If this calculation succeeded, $icode ok$$ is true.
+Otherwise, it is false.
+
+$children%
+    example/atomic_three/batch.cpp
+%$$
+$head Example$$
+The file $cref atomic_three_batch.cpp$$ contains an example and test
+that uses these routines.
+The program $cref speed_atomic_batch.cpp$$ compares the time
+with and without batches for a $code 3x3$$ matrix multiply kernel.
+
+$end
+-----------------------------------------------------------------------------
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file atomic/three_batch.hpp
+Third generation atomic batches of calls.
+*/
+/*!
+Maximum number of calls in a batch for this atomic function.
+
+\return
+is zero if the calls to this atomic function are not batched.
+*/
+// BEGIN_PROTOTYPE_SIZE
+template <class Base>
+size_t atomic_three<Base>::batch_size(void)
+// END_PROTOTYPE_SIZE
+{   return 0; }
+/*!
+Link from zero order forward sweep to batch of calls.
+
+\param n_call [in]
+number of calls in this batch.
+
+\param parameter_x [in]
+contains the values, in afun(ax, ay), for arguments that are parameters.
+
+\param type_x [in]
+what is the type, in afun(ax, ay), for each component of x.
+
+\param taylor_x [in]
+zero order Taylor coefficients corresponding to x.
+
+\param taylor_y [out]
+zero order Taylor coefficients corresponding to y.
+
+\par
+Component j of x (i of y) for call c has index j * n_call + c
+(i * n_call + c).
+*/
+// BEGIN_PROTOTYPE_FORWARD
+template <class Base>
+bool atomic_three<Base>::forward_batch(
+    size_t                       n_call      ,
+    const vector<Base>&          parameter_x ,
+    const vector<ad_type_enum>&  type_x      ,
+    const vector<Base>&          taylor_x    ,
+    vector<Base>&                taylor_y    )
+// END_PROTOTYPE_FORWARD
+{   CPPAD_ASSERT_UNKNOWN( 0 < n_call );
+    size_t n = taylor_x.size() / n_call;
+    size_t m = taylor_y.size() / n_call;
+    vector<Base>         par_x(n), tx(n), ty(m);
+    vector<ad_type_enum> typ_x(n);
+    size_t need_y    = size_t( variable_enum );
+    size_t order_low = 0;
+    size_t order_up  = 0;
+    bool ok = true;
+    for(size_t c = 0; c < n_call; ++c)
+    {   for(size_t j = 0; j < n; ++j)
+        {   par_x[j] = parameter_x[j * n_call + c];
+            typ_x[j] = type_x[j * n_call + c];
+            tx[j]    = taylor_x[j * n_call + c];
+        }
+        ok &= forward(par_x, typ_x, need_y, order_low, order_up, tx, ty);
+        for(size_t i = 0; i < m; ++i)
+            taylor_y[i * n_call + c] = ty[i];
+    }
+    return ok;
+}
+/*!
+Link from first order reverse sweep to batch of calls.
+
+\param n_call [in]
+number of calls in this batch.
+
+\param parameter_x [in]
+contains the values, in afun(ax, ay), for arguments that are parameters.
+
+\param type_x [in]
+what is the type, in afun(ax, ay), for each component of x.
+
+\param taylor_x [in]
+zero order Taylor coefficients corresponding to x.
+
+\param taylor_y [in]
+zero order Taylor coefficients corresponding to y.
+
+\param partial_x [out]
+partials w.r.t. the x Taylor coefficients.
+
+\param partial_y [in]
+partials w.r.t. the y Taylor coefficients.
+
+\par
+Component j of x (i of y) for call c has index j * n_call + c
+(i * n_call + c).
+*/
+// BEGIN_PROTOTYPE_REVERSE
+template <class Base>
+bool atomic_three<Base>::reverse_batch(
+    size_t                       n_call      ,
+    const vector<Base>&          parameter_x ,
+    const vector<ad_type_enum>&  type_x      ,
+    const vector<Base>&          taylor_x    ,
+    const vector<Base>&          taylor_y    ,
+    vector<Base>&                partial_x   ,
+    const vector<Base>&          partial_y   )
+// END_PROTOTYPE_REVERSE
+{   CPPAD_ASSERT_UNKNOWN( 0 < n_call );
+    size_t n = taylor_x.size() / n_call;
+    size_t m = taylor_y.size() / n_call;
+    vector<Base>         par_x(n), tx(n), ty(m), px(n), py(m);
+    vector<ad_type_enum> typ_x(n);
+    size_t order_up = 0;
+    bool ok = true;
+    for(size_t c = 0; c < n_call; ++c)
+    {   for(size_t j = 0; j < n; ++j)
+        {   par_x[j] = parameter_x[j * n_call + c];
+            typ_x[j] = type_x[j * n_call + c];
+            tx[j]    = taylor_x[j * n_call + c];
+        }
+        for(size_t i = 0; i < m; ++i)
+        {   ty[i] = taylor_y[i * n_call + c];
+            py[i] = partial_y[i * n_call + c];
+        }
+        ok &= reverse(par_x, typ_x, order_up, tx, ty, px, py);
+        for(size_t j = 0; j < n; ++j)
+            partial_x[j * n_call + c] = px[j];
+    }
+    return ok;
+}
+
+} // END_CPPAD_NAMESPACE
+
+# endif
@@ -204,53 +204,94 @@ bool atomic_three<Base>::for_hes_sparsity(
         select_y[i] = rev_jac_pattern.number_elements(y_index[i]) > 0;
     }
     // ------------------------------------------------------------------------
-    // call user's version of atomic function for Jacobian
+    // Jacobian sparsity pattern for this atomic function
+    const local::sparse::crs_pattern* fixed = fixed_jac_sparsity();
     sparse_rc< vector<size_t> > pattern_out;
-    bool dependency = false;
-    bool ok = jac_sparsity(
-        parameter_x, type_x, dependency, select_x, select_y, pattern_out
-    );
-    if( ! ok )
-        return false;
-    //
-    // transfer sparsity patterns from pattern_out to var_sparsity
-    size_t                nnz = pattern_out.nnz();
     const vector<size_t>& row( pattern_out.row() );
     const vector<size_t>& col( pattern_out.col() );
-    for(size_t k = 0; k < nnz; ++k)
-    {   size_t i = row[k];
-        size_t j = col[k];
-        CPPAD_ASSERT_KNOWN(
-            select_y[i] & select_x[j],
-            "atomic: jac_sparsity: pattern_out not in "
-            "select_x or select_y range"
+    size_t nnz;
+    bool   ok = true;
+    if( fixed != CPPAD_NULL )
+    {   // compose fixed pattern with the Jacobian patterns for the arguments
+        CPPAD_ASSERT_UNKNOWN( fixed->nr() == m && fixed->nc() == n );
+        for(size_t i = 0; i < m; ++i) if( select_y[i] )
+        {   size_t k_end = fixed->row_begin(i + 1);
+            for(size_t k = fixed->row_begin(i); k < k_end; ++k)
+            {   size_t j = fixed->col(k);
+                if( select_x[j] ) for_sparsity.binary_union(
+                    np1 + y_index[i], np1 + y_index[i],
+                    np1 + x_index[j], for_sparsity
+                );
+            }
+        }
+    }
+    else
+    {   // call user's version of atomic function for Jacobian
+        bool dependency = false;
+        ok = jac_sparsity(
+            parameter_x, type_x, dependency, select_x, select_y, pattern_out
         );
-        const_iterator itr(for_sparsity, np1 + x_index[j]);
-        size_t ell = *itr;
-        while( ell < np1 )
-        {   for_sparsity.post_element(np1 + y_index[i], ell );
-            ell = *(++itr);
+        if( ! ok )
+            return false;
+        //
+        // transfer sparsity patterns from pattern_out to var_sparsity
+        nnz = pattern_out.nnz();
+        for(size_t k = 0; k < nnz; ++k)
+        {   size_t i = row[k];
+            size_t j = col[k];
+            CPPAD_ASSERT_KNOWN(
+                select_y[i] & select_x[j],
+                "atomic: jac_sparsity: pattern_out not in "
+                "select_x or select_y range"
+            );
+            const_iterator itr(for_sparsity, np1 + x_index[j]);
+            size_t ell = *itr;
+            while( ell < np1 )
+            {   for_sparsity.post_element(np1 + y_index[i], ell );
+                ell = *(++itr);
+            }
         }
+        for(size_t i = 0; i < m; ++i)
+            for_sparsity.process_post( np1 + y_index[i] );
     }
-    for(size_t i = 0; i < m; ++i)
-        for_sparsity.process_post( np1 + y_index[i] );
     // ------------------------------------------------------------------------
-    // call user's version of atomic function for Hessian
-    ok = hes_sparsity(
-        parameter_x, type_x, select_x, select_y, pattern_out
-    );
-    if( ! ok )
-        return ok;
+    // Hessian sparsity pattern for this atomic function
+    fixed = fixed_hes_sparsity();
+    if( fixed == CPPAD_NULL )
+    {   // call user's version of atomic function for Hessian
+        ok = hes_sparsity(
+            parameter_x, type_x, select_x, select_y, pattern_out
+        );
+        if( ! ok )
+            return ok;
+        nnz = pattern_out.nnz();
+    }
+    else
+    {   CPPAD_ASSERT_UNKNOWN( fixed->nr() == n && fixed->nc() == n );
+        nnz = fixed->nnz();
+    }
     //
     // add new elements to Hessian sparisty in calling routine
-    nnz = pattern_out.nnz();
+    size_t r_fixed = 0;
     for(size_t k = 0; k < nnz; ++k)
-    {   size_t r = row[k];
-        size_t c = col[k];
-        CPPAD_ASSERT_KNOWN(
-            select_x[r] & select_x[c],
-            "atomic: hes_sparsity: pattern_out not in select_x range"
-        );
+    {   size_t r, c;
+        if( fixed == CPPAD_NULL )
+        {   r = row[k];
+            c = col[k];
+            CPPAD_ASSERT_KNOWN(
+                select_x[r] & select_x[c],
+                "atomic: hes_sparsity: pattern_out not in select_x range"
+            );
+        }
+        else
+        {   // elements of the fixed pattern in the select_x range
+            while( fixed->row_begin(r_fixed + 1) <= k )
+                ++r_fixed;
+            r = r_fixed;
+            c = fixed->col(k);
+            if( ! (select_x[r] & select_x[c]) )
+                continue;
+        }
         const_iterator itr_1(for_sparsity, np1 + x_index[r]);
         size_t v1 = *itr_1;
         while( v1 < np1 )
@@ -346,57 +387,101 @@ bool atomic_three<Base>::rev_hes_sparsity(
         CPPAD_ASSERT_UNKNOWN( y_index[i] > 0 || ! select_y[i] );
     }
     //
-    // call atomic function for Jacobain sparsity
-    bool dependency = false;
+    // Jacobian sparsity pattern for this atomic function
+    const local::sparse::crs_pattern* fixed_jac = fixed_jac_sparsity();
     sparse_rc< vector<size_t> > pattern_jac;
-    bool ok = jac_sparsity(
-        parameter_x, type_x, dependency, select_x, select_y, pattern_jac
-    );
+    size_t nnz_jac;
+    bool ok = true;
+    if( fixed_jac == CPPAD_NULL )
+    {   // call atomic function for Jacobain sparsity
+        bool dependency = false;
+        ok = jac_sparsity(
+            parameter_x, type_x, dependency, select_x, select_y, pattern_jac
+        );
+        if( ! ok )
+            return ok;
+        nnz_jac = pattern_jac.nnz();
+    }
+    else
+    {   CPPAD_ASSERT_UNKNOWN( fixed_jac->nr() == m && fixed_jac->nc() == n );
+        nnz_jac = fixed_jac->nnz();
+    }
     const vector<size_t>& row_jac( pattern_jac.row() );
     const vector<size_t>& col_jac( pattern_jac.col() );
-    size_t nnz_jac = pattern_jac.nnz();
-    if( ! ok )
-        return ok;
     //
-    // call atomic function for Hessian sparsity
+    // Hessian sparsity pattern for this atomic function
+    const local::sparse::crs_pattern* fixed_hes = fixed_hes_sparsity();
     sparse_rc< vector<size_t> > pattern_hes;
-    ok = hes_sparsity(parameter_x, type_x, select_x, select_y, pattern_hes);
+    size_t nnz_hes;
+    if( fixed_hes == CPPAD_NULL )
+    {   // call atomic function for Hessian sparsity
+        ok = hes_sparsity(
+            parameter_x, type_x, select_x, select_y, pattern_hes
+        );
+        if( ! ok )
+            return ok;
+        nnz_hes = pattern_hes.nnz();
+    }
+    else
+    {   CPPAD_ASSERT_UNKNOWN( fixed_hes->nr() == n && fixed_hes->nc() == n );
+        nnz_hes = fixed_hes->nnz();
+    }
     const vector<size_t>& row_hes( pattern_hes.row() );
     const vector<size_t>& col_hes( pattern_hes.col() );
-    size_t nnz_hes = pattern_hes.nnz();
-    if( ! ok )
-        return ok;
     //
     // propagate Hessian sparsity through the Jacobian
+    size_t r_fixed = 0;
     for(size_t k = 0; k < nnz_jac; ++k)
-    {   size_t i = row_jac[k];
-        size_t j = col_jac[k];
-        CPPAD_ASSERT_KNOWN(
-            select_y[i] & select_x[j] ,
-            "atomic: jac_sparsity: pattern_out not in "
-            "select_x or select_y range"
-        );
+    {   size_t i, j;
+        if( fixed_jac == CPPAD_NULL )
+        {   i = row_jac[k];
+            j = col_jac[k];
+            CPPAD_ASSERT_KNOWN(
+                select_y[i] & select_x[j] ,
+                "atomic: jac_sparsity: pattern_out not in "
+                "select_x or select_y range"
+            );
+        }
+        else
+        {   // elements of the fixed pattern in the select range
+            while( fixed_jac->row_begin(r_fixed + 1) <= k )
+                ++r_fixed;
+            i = r_fixed;
+            j = fixed_jac->col(k);
+            if( ! (select_y[i] & select_x[j]) )
+                continue;
+        }
         // from y_index[i] to x_index[j]
         hes_sparsity_rev.binary_union(
             x_index[j], x_index[j], y_index[i], hes_sparsity_rev
         );
-    }
-    //
-    // propagate rev_jac_flag through the Jacobian
-    // (seems OK to exclude variables with zero forward jacobian)
-    for(size_t k = 0; k < nnz_jac; ++k)
-    {   size_t j = col_jac[k];
+        //
+        // propagate rev_jac_flag through the Jacobian
+        // (seems OK to exclude variables with zero forward jacobian)
         rev_jac_flag[ x_index[j] ] = true;
     }
     //
     // new hessian sparsity terms between y and x
+    r_fixed = 0;
     for(size_t k = 0; k < nnz_hes; ++k)
-    {   size_t r = row_hes[k];
-        size_t c = col_hes[k];
-        CPPAD_ASSERT_KNOWN(
-            select_x[r] & select_x[c] ,
-            "atomic: hes_sparsity: pattern_out not in select_x range"
-        );
+    {   size_t r, c;
+        if( fixed_hes == CPPAD_NULL )
+        {   r = row_hes[k];
+            c = col_hes[k];
+            CPPAD_ASSERT_KNOWN(
+                select_x[r] & select_x[c] ,
+                "atomic: hes_sparsity: pattern_out not in select_x range"
+            );
+        }
+        else
+        {   // elements of the fixed pattern in the select_x range
+            while( fixed_hes->row_begin(r_fixed + 1) <= k )
+                ++r_fixed;
+            r = r_fixed;
+            c = fixed_hes->col(k);
+            if( ! (select_x[r] & select_x[c]) )
+                continue;
+        }
         hes_sparsity_rev.binary_union(
             x_index[r], x_index[r], x_index[c], for_jac_pattern
         );
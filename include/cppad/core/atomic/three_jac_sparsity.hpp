@@ -218,6 +218,22 @@ bool atomic_three<Base>::for_jac_sparsity(
         select_x[j] = ell < var_sparsity.end();
         CPPAD_ASSERT_UNKNOWN( x_index[j] > 0 || ! select_x[j] );
     }
+    // compose a pattern that does not depend on the call with the patterns
+    // for the arguments
+    const local::sparse::crs_pattern* fixed = fixed_jac_sparsity();
+    if( fixed != CPPAD_NULL )
+    {   CPPAD_ASSERT_UNKNOWN( fixed->nr() == m && fixed->nc() == n );
+        for(size_t i = 0; i < m; ++i) if( select_y[i] )
+        {   size_t k_end = fixed->row_begin(i + 1);
+            for(size_t k = fixed->row_begin(i); k < k_end; ++k)
+            {   size_t j = fixed->col(k);
+                if( select_x[j] ) var_sparsity.binary_union(
+                    y_index[i], y_index[i], x_index[j], var_sparsity
+                );
+            }
+        }
+        return true;
+    }
     sparse_rc< vector<size_t> > pattern_out;
     bool ok = jac_sparsity(
         parameter_x, type_x, dependency, select_x, select_y, pattern_out
@@ -319,6 +335,22 @@ bool atomic_three<Base>::rev_jac_sparsity(
         size_t ell = *itr;
         select_y[i] = ell < var_sparsity.end();
     }
+    // compose a pattern that does not depend on the call with the patterns
+    // for the results
+    const local::sparse::crs_pattern* fixed = fixed_jac_sparsity();
+    if( fixed != CPPAD_NULL )
+    {   CPPAD_ASSERT_UNKNOWN( fixed->nr() == m && fixed->nc() == n );
+        for(size_t i = 0; i < m; ++i) if( select_y[i] )
+        {   size_t k_end = fixed->row_begin(i + 1);
+            for(size_t k = fixed->row_begin(i); k < k_end; ++k)
+            {   size_t j = fixed->col(k);
+                var_sparsity.binary_union(
+                    x_index[j], x_index[j], y_index[i], var_sparsity
+                );
+            }
+        }
+        return true;
+    }
     sparse_rc< vector<size_t> > pattern_out;
     bool ok = jac_sparsity(
         parameter_x, type_x, dependency, select_x, select_y, pattern_out
@@ -80,6 +80,9 @@ ADFun< AD<Base>, RecBase > ADFun<Base,RecBase>::base2ad(void) const
     // bool values
     fun.has_been_optimized_        = has_been_optimized_;
     fun.check_for_nan_             = check_for_nan_;
+    fun.forward_direct_            = forward_direct_;
+    fun.jit_                       = jit_;
+    fun.hybrid_sparsity_           = hybrid_sparsity_;
     //
     // size_t values
     fun.compare_change_count_      = compare_change_count_;
@@ -113,6 +116,9 @@ ADFun< AD<Base>, RecBase > ADFun<Base,RecBase>::base2ad(void) const
     // sparse_list
     fun.for_jac_sparse_set_  = for_jac_sparse_set_;
     //
+    // sparse_hybrid
+    fun.for_jac_sparse_hybrid_ = for_jac_sparse_hybrid_;
+    //
     return fun;
 }
 
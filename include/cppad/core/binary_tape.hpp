@@ -0,0 +1,323 @@
+# ifndef CPPAD_CORE_BINARY_TAPE_HPP
+# define CPPAD_CORE_BINARY_TAPE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin binary_tape$$
+$spell
+    const
+    std
+    ostream
+    istream
+    os
+    json
+    endian
+    ios
+    Taylor
+$$
+
+$section Save and Load an ADFun Object Using a Binary Format$$
+
+$head Syntax$$
+$icode%f%.to_binary(%os%)
+%$$
+$icode%g%.from_binary(%is%)
+%$$
+
+$head Purpose$$
+The $cref json_ad_graph$$ representation of a function is portable
+between systems, but it is large and slow to read for big operation sequences.
+This binary format is a copy of the memory used to store the operation
+sequence. Reading it does not require any parsing or re-recording, so
+a function that took a long time to record can be loaded quickly
+by another process.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    const ADFun<%Base%> %f%
+%$$
+
+$head os$$
+The stream $icode os$$ has prototype
+$codei%
+    std::ostream& %os%
+%$$
+The operation sequence in $icode f$$ is written to this stream.
+If it is a file stream, it should be opened with
+$code std::ios::binary$$.
+
+$head g$$
+The object $icode g$$ has prototype
+$codei%
+    ADFun<%Base%> %g%
+%$$
+Upon return it has the operation sequence,
+and dynamic parameter values, that were in $icode f$$.
+There are no Taylor coefficients stored in $icode g$$; i.e.,
+$cref/g.size_order()/size_order/$$ is zero.
+The $cref check_for_nan$$, $cref forward_direct$$, and $cref jit$$
+settings for $icode g$$ are not changed.
+
+$head is$$
+The stream $icode is$$ has prototype
+$codei%
+    std::istream& %is%
+%$$
+The operation sequence is read from this stream.
+It must have been written by $code to_binary$$ using the same
+$icode Base$$ type.
+
+$head Format$$
+The binary file starts with the string $code CppAD binary tape$$,
+followed by a format version number.
+It is an error to read a file that does not start with this string,
+has a different version number,
+or was written on a system where the following values are different:
+the size of $code size_t$$, of $cref/addr_t/cmake/cppad_tape_addr_type/$$,
+of an operator code, and of $icode Base$$, and the
+endian order for $code size_t$$.
+
+$head Restrictions$$
+
+$subhead Base$$
+The type $icode Base$$ must be plain old data; e.g.,
+$code float$$ or $code double$$.
+
+$subhead Atomic and Discrete Functions$$
+The $cref atomic$$ and $cref Discrete$$ functions in the operation
+sequence are identified by their index (not by their name).
+The process that calls $code from_binary$$ must create these functions
+in the same order as the process that recorded the operation sequence.
+
+$head Example$$
+$children%
+    example/general/binary_tape.cpp
+%$$
+The file $cref binary_tape.cpp$$
+contains an example and test of this operation.
+The $cref/binary/speed_main/Global Options/binary/$$ speed test option
+compares the time to load a function to the time to record it.
+
+$end
+----------------------------------------------------------------------------
+*/
+# include <cstring>
+
+/*!
+\def CPPAD_BINARY_TAPE_VERSION
+Version number for the binary tape format. This must be changed whenever
+the format of the information written by ADFun<Base>::to_binary changes.
+*/
+# define CPPAD_BINARY_TAPE_VERSION 1
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file binary_tape.hpp
+Save and load an ADFun object using a binary format.
+*/
+namespace local { namespace play {
+    /// identifies the start of a CppAD binary tape
+    inline const char* binary_tape_magic(void)
+    {   return "CppAD binary tape"; }
+    /*!
+    sizes that must agree between the writing and reading system
+
+    \param sizes
+    is set to the sizes of size_t, addr_t, opcode_t, Base,
+    and the first byte of a size_t with value one (endian order).
+    */
+    template <class Base>
+    void binary_tape_sizes(unsigned char sizes[5])
+    {   size_t one = 1;
+        sizes[0] = static_cast<unsigned char>( sizeof(size_t) );
+        sizes[1] = static_cast<unsigned char>( sizeof(addr_t) );
+        sizes[2] = static_cast<unsigned char>( sizeof(opcode_t) );
+        sizes[3] = static_cast<unsigned char>( sizeof(Base) );
+        sizes[4] = *reinterpret_cast<unsigned char*>(&one);
+    }
+} }
+
+/*!
+Write the operation sequence in this function using a binary format.
+
+\param os
+stream that the operation sequence is written to.
+*/
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::to_binary(std::ostream& os) const
+{   using local::play::binary_write;
+    CPPAD_ASSERT_KNOWN(
+        local::is_pod<Base>() ,
+        "to_binary: Base is not plain old data"
+    );
+    //
+    // magic string, version, sizes
+    const char* magic = local::play::binary_tape_magic();
+    os.write( magic, std::streamsize( std::strlen(magic) ) );
+    unsigned char version = CPPAD_BINARY_TAPE_VERSION;
+    binary_write(os, version);
+    unsigned char sizes[5];
+    local::play::binary_tape_sizes<Base>(sizes);
+    os.write( reinterpret_cast<const char*>(sizes), 5 );
+    //
+    // information in this ADFun object
+    binary_write(os, function_name_);
+    binary_write(os, has_been_optimized_);
+    binary_write(os, num_var_tape_);
+    binary_write(os, ind_taddr_);
+    binary_write(os, dep_taddr_);
+    binary_write(os, dep_parameter_);
+    //
+    // information in the player
+    play_.write_binary(os);
+}
+
+/*!
+Replace the operation sequence in this function by one written by to_binary.
+
+\param is
+stream that the operation sequence is read from.
+*/
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::from_binary(std::istream& is)
+{   using local::play::binary_read;
+    //
+    // used to report errors (even when NDEBUG is defined)
+    bool        known = true;
+    const char* file  = __FILE__;
+    //
+    CPPAD_ASSERT_KNOWN(
+        local::is_pod<Base>() ,
+        "from_binary: Base is not plain old data"
+    );
+    //
+    // magic string
+    const char* magic = local::play::binary_tape_magic();
+    std::string check( std::strlen(magic), ' ' );
+    for(size_t i = 0; i < check.size(); ++i)
+        is.get( check[i] );
+    if( ! is || check != magic )
+    {   ErrorHandler::Call(known, __LINE__, file,
+            "check == magic",
+            "from_binary: input is not a CppAD binary tape"
+        );
+        return;
+    }
+    //
+    // version
+    unsigned char version;
+    if( ! binary_read(is, version) || version != CPPAD_BINARY_TAPE_VERSION )
+    {   ErrorHandler::Call(known, __LINE__, file,
+            "version == CPPAD_BINARY_TAPE_VERSION",
+            "from_binary: binary tape version is not supported"
+        );
+        return;
+    }
+    //
+    // sizes
+    unsigned char sizes[5], check_sizes[5];
+    local::play::binary_tape_sizes<Base>(sizes);
+    is.read( reinterpret_cast<char*>(check_sizes), 5 );
+    bool ok = bool(is);
+    for(size_t i = 0; i < 5; ++i)
+        ok &= sizes[i] == check_sizes[i];
+    if( ! ok )
+    {   ErrorHandler::Call(known, __LINE__, file,
+            "sizes == check_sizes",
+            "from_binary: binary tape was written using a different "
+            "Base, addr_t, size_t, or endian order"
+        );
+        return;
+    }
+    //
+    // information in this ADFun object
+    ok = ok && binary_read(is, function_name_);
+    ok = ok && binary_read(is, has_been_optimized_);
+    ok = ok && binary_read(is, num_var_tape_);
+    ok = ok && binary_read(is, ind_taddr_);
+    ok = ok && binary_read(is, dep_taddr_);
+    ok = ok && binary_read(is, dep_parameter_);
+    //
+    // information in the player
+    ok = ok && play_.read_binary(is, ind_taddr_.size() );
+    //
+    // consistency between this object and the player
+    ok = ok && num_var_tape_ == play_.num_var_rec();
+    ok = ok && dep_taddr_.size() == dep_parameter_.size();
+    for(size_t j = 0; ok && j < ind_taddr_.size(); ++j)
+        ok = ind_taddr_[j] == j + 1;
+    for(size_t i = 0; ok && i < dep_taddr_.size(); ++i)
+        ok = dep_taddr_[i] < num_var_tape_;
+    if( ! ok )
+    {   // do not leave a partial operation sequence in this object
+        function_name_ = "";
+        num_var_tape_  = 0;
+        ind_taddr_.resize(0);
+        dep_taddr_.resize(0);
+        dep_parameter_.resize(0);
+        play_ = local::player<Base>();
+        ErrorHandler::Call(known, __LINE__, file,
+            "ok",
+            "from_binary: error reading the binary tape"
+        );
+        return;
+    }
+    // ----------------------------------------------------------------------
+    // set private member data that was not read
+    // ----------------------------------------------------------------------
+    //
+    // bool values in this object except check_for_nan_
+    base2ad_return_value_      = false;
+    //
+    // size_t values in this object
+    compare_change_count_      = 1;
+    compare_change_number_     = 0;
+    compare_change_op_index_   = 0;
+    num_order_taylor_          = 0;
+    cap_order_taylor_          = 0;
+    num_direction_taylor_      = 0;
+    //
+    // taylor_
+    taylor_.resize(0);
+    //
+    // cskip_op_
+    cskip_op_.resize( play_.num_op_rec() );
+    //
+    // load_op2var_
+    load_op2var_.resize( play_.num_var_load_rec() );
+    //
+    // direct_sweep_
+    direct_sweep_.clear();
+    //
+    // jit_fun_
+    jit_fun_.clear();
+    //
+    // for_jac_sparse_pack_, for_jac_sparse_set_, for_jac_sparse_hybrid_
+    for_jac_sparse_pack_.resize(0, 0);
+    for_jac_sparse_set_.resize(0,0);
+    for_jac_sparse_hybrid_.resize(0,0);
+    //
+    // resize subgraph_info_
+    subgraph_info_.resize(
+        ind_taddr_.size(),   // n_ind
+        dep_taddr_.size(),   // n_dep
+        play_.num_op_rec(),  // n_op
+        play_.num_var_rec()  // n_var
+    );
+    subgraph_partial_.clear();
+    //
+    return;
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -85,6 +85,8 @@ $codei%
     %f%.capacity_order(%c%)
 %$$
 with $icode c$$ equal to $icode q$$.
+The case $icode%c% == 0%$$ also frees the memory that
+$cref Reverse$$ keeps between calls.
 Note that, if $cref ta_hold_memory$$ is true, this memory is not actually
 returned to the system, but rather held for future use by the same thread.
 
@@ -161,6 +163,7 @@ void ADFun<Base,RecBase>::capacity_order(size_t c, size_t r)
     if( c == 0 )
     {   CPPAD_ASSERT_UNKNOWN( r == 0 );
         taylor_.clear();
+        reverse_partial_.clear();
         num_order_taylor_     = 0;
         cap_order_taylor_     = 0;
         num_direction_taylor_ = r;
@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_CHKPOINT_TWO_CHKPOINT_TWO_HPP
 # define CPPAD_CORE_CHKPOINT_TWO_CHKPOINT_TWO_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -120,11 +120,11 @@ private:
     //
     /// Jacobian sparsity for g(x) with dependncy true.
     /// This is set by the constructor and constant after that.
-    sparse_rc< vector<size_t> > jac_sparsity_;
+    local::sparse::crs_pattern jac_sparsity_;
     //
     /// Hessian sparsity for g(x). If use_hes_sparsity_ is true,
     /// This is set by the constructor and constant after that.
-    sparse_rc< vector<size_t> > hes_sparsity_;
+    local::sparse::crs_pattern hes_sparsity_;
     //
     /// Function corresponding to this checkpoint object.
     /// If use_in_parallel_, this is constant after the constructor.
@@ -141,9 +141,11 @@ private:
     struct member_struct {
         //
         /// function corresponding to this checkpoint object
+        /// (shares the operation sequence in g_ when possible)
         ADFun<Base>                 g_;
         //
         /// AD version of this function object
+        /// (shares the operation sequence in ag_ when possible)
         ADFun< AD<Base>, Base >     ag_;
         //
     };
@@ -152,23 +154,53 @@ private:
     member_struct* member_[CPPAD_MAX_NUM_THREADS];
     //
     // ------------------------------------------------------------------------
-    /// allocate member_ for this thread
-    void allocate_member(size_t thread)
-    {   CPPAD_ASSERT_UNKNOWN( use_in_parallel_ );
-        if( member_[thread] == CPPAD_NULL )
-        {   // allocaate raw memory
-            size_t min_bytes = sizeof(member_struct);
-            size_t num_bytes;
-            void* v_ptr = thread_alloc::get_memory(min_bytes, num_bytes);
-            // convert to member_struct*
-            member_[thread] = reinterpret_cast<member_struct*>(v_ptr);
-            // call member_struct constructor
-            new( member_[thread] ) member_struct;
-            //
-            // The thread has a copy of corresponding informaiton.
+    /// create member_ for this thread
+    void new_member(size_t thread)
+    {   CPPAD_ASSERT_UNKNOWN( member_[thread] == CPPAD_NULL );
+        // allocaate raw memory
+        size_t min_bytes = sizeof(member_struct);
+        size_t num_bytes;
+        void* v_ptr = thread_alloc::get_memory(min_bytes, num_bytes);
+        // convert to member_struct*
+        member_[thread] = reinterpret_cast<member_struct*>(v_ptr);
+        // call member_struct constructor
+        new( member_[thread] ) member_struct;
+        //
+        if( thread_alloc::in_parallel() )
+        {   // The thread has a copy of corresponding informaiton.
             member_[thread]->g_  = g_;
             member_[thread]->ag_ = ag_;
         }
+        else
+        {   // The thread shares the operation sequence and its Taylor
+            // coefficients are allocated by its first use of the function.
+            member_[thread]->g_.share_op_seq(g_);
+            if( use_base2ad_ )
+                member_[thread]->ag_.share_op_seq(ag_);
+        }
+        return;
+    }
+    /*!
+    allocate member_ for this thread
+
+    \par
+    The operation sequence can only be shared in sequential mode.
+    Hence, in sequential mode, a member that shares the operation sequence
+    is created for each thread that does not have one.
+    In parallel mode, if this thread does not have a member,
+    it gets a copy of the operation sequence.
+    */
+    void allocate_member(size_t thread)
+    {   CPPAD_ASSERT_UNKNOWN( use_in_parallel_ );
+        if( ! thread_alloc::in_parallel() )
+        {   size_t num_threads = thread_alloc::num_threads();
+            for(size_t t = 0; t < num_threads; ++t)
+            {   if( member_[t] == CPPAD_NULL )
+                    new_member(t);
+            }
+        }
+        else if( member_[thread] == CPPAD_NULL )
+            new_member(thread);
         return;
     }
     //
@@ -252,6 +284,15 @@ private:
         const vector<bool>&            select_y     ,
         sparse_rc< vector<size_t> >&   pattern_out
     );
+    // fixed_jac_sparsity
+    virtual const local::sparse::crs_pattern* fixed_jac_sparsity(void)
+    {   return &jac_sparsity_; }
+    // fixed_hes_sparsity
+    virtual const local::sparse::crs_pattern* fixed_hes_sparsity(void)
+    {   if( ! use_hes_sparsity_ )
+            return CPPAD_NULL;
+        return &hes_sparsity_;
+    }
     // rev_depend
     virtual bool rev_depend(
         const vector<Base>&            parameter_x ,
@@ -288,7 +329,9 @@ public:
     use_in_parallel_  ( other.use_in_parallel_ ) ,
     jac_sparsity_     ( other.jac_sparsity_ ) ,
     hes_sparsity_     ( other.hes_sparsity_ )
-    {   g_  = other.g_;
+    {   for(size_t thread = 0; thread < CPPAD_MAX_NUM_THREADS; ++thread)
+            member_[thread] = CPPAD_NULL;
+        g_  = other.g_;
         ag_ = other.ag_;
     }
     //
@@ -18,6 +18,10 @@ $spell
     chk
     bool
     hes
+    op
+    seq
+    num
+    Taylor
 $$
 
 $section Checkpoint Function Constructor$$
@@ -71,8 +75,22 @@ This requires some extra memory and extra computation during the constructor.
 $head use_in_parallel$$
 If this is true, $icode chk_fun$$ can be used
 $cref/in_parallel/ta_parallel_setup/in_parallel/$$.
-This requires some extra memory for a constant copy of the $icode fun$$
-information and a separate copy (that changes) for each thread.
+Each thread gets its own $codei%ADFun<%Base%>%$$ object that
+$cref/shares/share_op_seq/$$ the operation sequence for $icode fun$$,
+so the operation sequence is not copied for each thread.
+The memory for a thread's Taylor coefficients is allocated
+the first time that thread uses $icode chk_fun$$.
+
+$subhead Sequential Use$$
+The operation sequence can only be shared in sequential mode.
+The objects for all the current
+$cref/num_threads/ta_parallel_setup/num_threads/$$ threads are created
+the first time $icode chk_fun$$ is used in sequential mode after
+$code parallel_setup$$; e.g., when recording a function that uses
+$icode chk_fun$$.
+If a thread first uses $icode chk_fun$$ in parallel mode,
+and its object was not created this way,
+it gets a separate copy of the operation sequence.
 
 $head chk_fun$$
 This is a checkpoint function representation of $latex g(x)$$
@@ -149,7 +167,7 @@ use_in_parallel_ ( use_in_parallel )
     // jac_sparsity__
     size_t n = g_.Domain();
     size_t m = g_.Range();
-    sparse_rc< vector<size_t> > pattern_in;
+    sparse_rc< vector<size_t> > pattern_in, pattern_out;
     bool transpose     = false;
     bool dependency    = true;
     if( n <= m || use_hes_sparsity )
@@ -162,7 +180,7 @@ use_in_parallel_ ( use_in_parallel )
             transpose,
             dependency,
             internal_bool,
-            jac_sparsity_
+            pattern_out
         );
     }
     else
@@ -175,9 +193,10 @@ use_in_parallel_ ( use_in_parallel )
             transpose,
             dependency,
             internal_bool,
-            jac_sparsity_
+            pattern_out
         );
     }
+    jac_sparsity_.set(pattern_out);
     //
     // hes_sparsity_
     if( use_hes_sparsity )
@@ -188,15 +207,16 @@ use_in_parallel_ ( use_in_parallel )
         {   for(size_t j = 0; j < n; ++j)
                 select_x[j] = true;
             g_.for_hes_sparsity(
-                select_x, select_y, internal_bool, hes_sparsity_
+                select_x, select_y, internal_bool, pattern_out
             );
         }
         else
         {   // forward jacobian sparsity is stored in g_
             g_.rev_hes_sparsity(
-                select_y, transpose, internal_bool, hes_sparsity_
+                select_y, transpose, internal_bool, pattern_out
             );
         }
+        hes_sparsity_.set(pattern_out);
     }
     // free memory holding forward Jacobian sparsity
     if( internal_bool )
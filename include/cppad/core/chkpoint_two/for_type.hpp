@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_CHKPOINT_TWO_FOR_TYPE_HPP
 # define CPPAD_CORE_CHKPOINT_TWO_FOR_TYPE_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-18 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -38,22 +38,18 @@ bool chkpoint_two<Base>::for_type(
     const vector<ad_type_enum>&  type_x      ,
     vector<ad_type_enum>&        type_y      )
 {   size_t nr  = jac_sparsity_.nr();
-    size_t nnz = jac_sparsity_.nnz();
-    const vector<size_t>& row( jac_sparsity_.row() );
-    const vector<size_t>& col( jac_sparsity_.col() );
     //
     CPPAD_ASSERT_UNKNOWN( jac_sparsity_.nr() == type_y.size() );
     CPPAD_ASSERT_UNKNOWN( jac_sparsity_.nc() == type_x.size() );
     //
-    // initialize type_y as constant_enum
+    // loop over rows in Dependency pattern
     for(size_t i = 0; i < nr; ++i)
-        type_y[i] = constant_enum;
-    //
-    // loop over entries in Dependency pattern
-    for(size_t k = 0; k < nnz; ++k)
-    {   size_t i  = row[k];
-        size_t j  = col[k];
-        type_y[i] = std::max(type_y[i], type_x[j]);
+    {   type_y[i]    = constant_enum;
+        size_t k_end = jac_sparsity_.row_begin(i + 1);
+        for(size_t k = jac_sparsity_.row_begin(i); k < k_end; ++k)
+        {   size_t j  = jac_sparsity_.col(k);
+            type_y[i] = std::max(type_y[i], type_x[j]);
+        }
     }
     return true;
 }
@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_CHKPOINT_TWO_JAC_SPARSITY_HPP
 # define CPPAD_CORE_CHKPOINT_TWO_JAC_SPARSITY_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-18 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -55,27 +55,28 @@ bool chkpoint_two<Base>::jac_sparsity(
     CPPAD_ASSERT_UNKNOWN( jac_sparsity_.nc() == select_x.size() );
 
     // count number of non-zeros
-    size_t nnz = jac_sparsity_.nnz();
     size_t nr  = jac_sparsity_.nr();
     size_t nc  = jac_sparsity_.nc();
-    const vector<size_t>& row = jac_sparsity_.row();
-    const vector<size_t>& col = jac_sparsity_.col();
     size_t nnz_out = 0;
-    for(size_t k = 0; k < nnz; ++k)
-    {   size_t i = row[k];
-        size_t j = col[k];
-        if( select_x[j] & select_y[i] )
-            ++nnz_out;
+    for(size_t i = 0; i < nr; ++i) if( select_y[i] )
+    {   size_t k_end = jac_sparsity_.row_begin(i + 1);
+        for(size_t k = jac_sparsity_.row_begin(i); k < k_end; ++k)
+        {   size_t j = jac_sparsity_.col(k);
+            if( select_x[j] )
+                ++nnz_out;
+        }
     }
 
     // set the output sparsity pattern
     pattern_out.resize(nr, nc, nnz_out);
     size_t ell = 0;
-    for(size_t k = 0; k < nnz; ++k)
-    {   size_t i = row[k];
-        size_t j = col[k];
-        if( select_x[j] & select_y[i] )
-            pattern_out.set(ell++, i, j);
+    for(size_t i = 0; i < nr; ++i) if( select_y[i] )
+    {   size_t k_end = jac_sparsity_.row_begin(i + 1);
+        for(size_t k = jac_sparsity_.row_begin(i); k < k_end; ++k)
+        {   size_t j = jac_sparsity_.col(k);
+            if( select_x[j] )
+                pattern_out.set(ell++, i, j);
+        }
     }
     CPPAD_ASSERT_UNKNOWN( ell == nnz_out );
     //
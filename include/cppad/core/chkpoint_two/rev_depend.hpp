@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_CHKPOINT_TWO_REV_DEPEND_HPP
 # define CPPAD_CORE_CHKPOINT_TWO_REV_DEPEND_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-18 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -39,10 +39,8 @@ bool chkpoint_two<Base>::rev_depend(
     const vector<ad_type_enum>& type_x      ,
     vector<bool>&               depend_x    ,
     const vector<bool>&         depend_y    )
-{   size_t nc  = jac_sparsity_.nc();
-    size_t nnz = jac_sparsity_.nnz();
-    const vector<size_t>& row( jac_sparsity_.row() );
-    const vector<size_t>& col( jac_sparsity_.col() );
+{   size_t nr  = jac_sparsity_.nr();
+    size_t nc  = jac_sparsity_.nc();
     //
     CPPAD_ASSERT_UNKNOWN( jac_sparsity_.nr() == depend_y.size() );
     CPPAD_ASSERT_UNKNOWN( jac_sparsity_.nc() == depend_x.size() );
@@ -51,12 +49,11 @@ bool chkpoint_two<Base>::rev_depend(
     for(size_t j = 0; j < nc; ++j)
         depend_x[j] = false;
     //
-    // loop over entries in Dependency pattern
-    for(size_t k = 0; k < nnz; ++k)
-    {   size_t i  = row[k];
-        size_t j  = col[k];
-        if( depend_y[i] )
-            depend_x[j] = true;
+    // loop over rows in Dependency pattern
+    for(size_t i = 0; i < nr; ++i) if( depend_y[i] )
+    {   size_t k_end = jac_sparsity_.row_begin(i + 1);
+        for(size_t k = jac_sparsity_.row_begin(i); k < k_end; ++k)
+            depend_x[ jac_sparsity_.col(k) ] = true;
     }
     return true;
 }
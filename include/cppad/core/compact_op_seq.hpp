@@ -0,0 +1,143 @@
+# ifndef CPPAD_CORE_COMPACT_OP_SEQ_HPP
+# define CPPAD_CORE_COMPACT_OP_SEQ_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin compact_op_seq$$
+$spell
+    bool
+    const
+    addr_t
+    subgraph
+    jit
+$$
+$section Compact Storage of an Operation Sequence$$
+
+$head Syntax$$
+$icode%f%.compact_op_seq(%b%)
+%$$
+$icode%b% = %f%.compact_op_seq()
+%$$
+
+$head Purpose$$
+The arguments for each operator in an operation sequence are
+normally stored using one $cref/addr_t/cmake/cppad_tape_addr_type/$$
+value per argument.
+For large operation sequences these arguments use most of the memory
+$cref/size_op_seq/seq_property/size_op_seq/$$.
+If this option is true, the arguments are stored using a
+variable length encoding.
+A variable argument is stored as the difference between the
+index of the operator's result and the argument.
+This difference is usually small, so most arguments use one byte.
+The arguments are decoded during each forward and reverse sweep
+through the operation sequence.
+
+$head f$$
+For the syntax where $icode b$$ is an argument,
+$icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+For the syntax where $icode b$$ is the result,
+$icode f$$ has prototype
+$codei%
+    const ADFun<%Base%> %f%
+%$$
+
+$head b$$
+This argument or result has prototype
+$codei%
+    bool %b%
+%$$
+If $icode b$$ is true (false),
+the operation sequence in $icode f$$ is (is not) stored
+using the compact encoding.
+The operation sequence, and the results computed using $icode f$$,
+are the same for both encodings.
+
+$head Default$$
+The value for this setting after construction of $icode f$$ is false.
+It is also false after the following operations:
+$cref Dependent$$,
+$cref optimize$$,
+$cref/from_binary/binary_tape/$$,
+and any operation that uses
+$cref/subgraphs/subgraph_reverse/$$
+(including subgraph sparsity patterns).
+
+$head Shared Operation Sequence$$
+If the operation sequence in $icode f$$ is
+$cref/shared/share_op_seq/$$ with other functions,
+setting this option to true makes a copy of the operation sequence
+(the other functions keep the previous encoding).
+Setting it to false changes the encoding for all the
+functions that share the operation sequence
+and must be done in sequential execution mode.
+
+$head Restrictions$$
+The $cref forward_direct$$ sweep is not used when this option is true.
+The $cref jit$$ option is not affected by this option.
+
+$head Speed$$
+Decoding the arguments makes each sweep slower.
+The $cref/compact/speed_main/Global Options/compact/$$ speed test option
+can be used to compare the time, and the memory,
+with and without this option.
+
+$head Example$$
+$children%
+    example/general/compact_op_seq.cpp
+%$$
+The file
+$cref compact_op_seq.cpp$$
+contains an example and test of this option.
+
+$end
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file compact_op_seq.hpp
+Set and get the option for compact storage of the operation sequence.
+*/
+
+/*!
+Set the compact operation sequence option.
+
+\param value
+new value for this flag.
+*/
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::compact_op_seq(bool value)
+{   if( value )
+    {   // the direct sweep uses the uncompressed arguments
+        direct_sweep_.clear();
+        play_.compact_arg();
+    }
+    else
+        play_.expand_arg();
+}
+
+/*!
+Get the compact operation sequence option.
+
+\return
+current value of this flag.
+*/
+template <class Base, class RecBase>
+bool ADFun<Base,RecBase>::compact_op_seq(void) const
+{   return play_.arg_compact(); }
+
+} // END_CPPAD_NAMESPACE
+
+# endif
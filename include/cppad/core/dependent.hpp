@@ -295,6 +295,12 @@ void ADFun<Base,RecBase>::Dependent(local::ADTape<Base> *tape, const ADvector &y
     // recording to the player and and erase the recording; i.e. ERASE Rec_.
     play_.get_recording(tape->Rec_, n);
 
+    // direct_sweep_
+    direct_sweep_.clear();
+
+    // jit_fun_
+    jit_fun_.clear();
+
     // ind_taddr_
     // Note that play_ has been set, we can use it to check operators
     ind_taddr_.resize(n);
@@ -304,9 +310,10 @@ void ADFun<Base,RecBase>::Dependent(local::ADTape<Base> *tape, const ADvector &y
         ind_taddr_[j] = j+1;
     }
 
-    // for_jac_sparse_pack_, for_jac_sparse_set_
+    // for_jac_sparse_pack_, for_jac_sparse_set_, for_jac_sparse_hybrid_
     for_jac_sparse_pack_.resize(0, 0);
     for_jac_sparse_set_.resize(0,0);
+    for_jac_sparse_hybrid_.resize(0,0);
 
     // resize subgraph_info_
     subgraph_info_.resize(
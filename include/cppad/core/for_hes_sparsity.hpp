@@ -86,7 +86,8 @@ if and only if $latex s_i$$ is possibly non-zero.
 
 $head internal_bool$$
 If this is true, calculations are done with sets represented by a vector
-of boolean values. Otherwise, a vector of sets of integers is used.
+of boolean values. Otherwise, a vector of sets of integers is used
+(see $cref hybrid_sparsity$$).
 
 $head pattern_out$$
 This argument has prototype
@@ -145,7 +146,8 @@ is a sparsity pattern for for s.
 
 \param internal_bool
 If this is true, calculations are done with sets represented by a vector
-of boolean values. Otherwise, a vector of standard sets is used.
+of boolean values. Otherwise, a vector of standard sets is used
+(a hybrid_setvec if hybrid_sparsity_ is true and a list_setvec otherwise).
 
 \param pattern_out
 The return value is a sparsity pattern for H(x) where
@@ -227,6 +229,47 @@ void ADFun<Base,RecBase>::for_hes_sparsity(
             transpose, ind_taddr_, internal_for_hes, pattern_tmp
         );
     }
+    else if( hybrid_sparsity_ )
+    {
+        // reverse Jacobian sparsity pattern for select_range
+        // (corresponds to s)
+        local::sparse::hybrid_setvec internal_rev_jac;
+        internal_rev_jac.resize(num_var_tape_, 1);
+        for(size_t i = 0; i < m; i++) if( select_range[i] )
+        {   CPPAD_ASSERT_UNKNOWN( dep_taddr_[i] < num_var_tape_ );
+            // Not using post_element because only adding one element per set
+            internal_rev_jac.add_element( dep_taddr_[i] , 0 );
+        }
+        // reverse Jacobian sparsity for all variables on tape
+        local::sweep::rev_jac<addr_t>(
+            &play_,
+            dependency,
+            n,
+            num_var_tape_,
+            internal_rev_jac,
+            not_used_rec_base
+
+        );
+        // internal vector of sets that will hold Hessian
+        local::sparse::hybrid_setvec internal_for_hes;
+        internal_for_hes.resize(n + 1 + num_var_tape_, n + 1);
+        //
+        // compute forward Hessian sparsity pattern
+        local::sweep::for_hes<addr_t>(
+            &play_,
+            n,
+            num_var_tape_,
+            select_domain_pod_vector,
+            internal_rev_jac,
+            internal_for_hes,
+            not_used_rec_base
+        );
+        //
+        // put the result in pattern_tmp
+        local::sparse::get_internal_pattern(
+            transpose, ind_taddr_, internal_for_hes, pattern_tmp
+        );
+    }
     else
     {
         // reverse Jacobian sparsity pattern for select_range
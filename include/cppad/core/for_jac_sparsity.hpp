@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_FOR_JAC_SPARSITY_HPP
 # define CPPAD_CORE_FOR_JAC_SPARSITY_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -20,6 +20,7 @@ $spell
     const
     rc
     cpp
+    setvec
 $$
 
 $section Forward Mode Jacobian Sparsity Patterns$$
@@ -27,6 +28,11 @@ $section Forward Mode Jacobian Sparsity Patterns$$
 $head Syntax$$
 $icode%f%.for_jac_sparsity(
     %pattern_in%, %transpose%, %dependency%, %internal_bool%, %pattern_out%
+)
+%$$
+$icode%f%.for_jac_sparsity(
+    %pattern_in%, %transpose%, %dependency%, %internal_bool%, %pattern_out%,
+    %n_part%, %i_part%
 )%$$
 
 $head Purpose$$
@@ -131,7 +137,8 @@ $codei%
     bool %internal_bool%
 %$$
 If this is true, calculations are done with sets represented by a vector
-of boolean values. Otherwise, a vector of sets of integers is used.
+of boolean values. Otherwise, a vector of sets of integers is used
+(see $cref hybrid_sparsity$$).
 
 $head pattern_out$$
 This argument has prototype
@@ -146,6 +153,58 @@ If $icode dependency$$ is true, $icode pattern_out$$ is a
 $cref/dependency pattern/dependency.cpp/Dependency Pattern/$$
 instead of sparsity pattern.
 
+$head n_part$$
+This argument has prototype
+$codei%
+    size_t %n_part%
+%$$
+and must be greater than zero.
+The columns of $latex R$$ are partitioned into $icode n_part$$ parts
+where each part is a block of consecutive columns.
+The boundaries between the blocks are multiples of the number of bits
+in a $code size_t$$ value, so that the boolean representation
+of the sets in different parts does not share words.
+If $icode n_part$$ is not present, it is one; i.e.,
+all the columns are in one part.
+
+$head i_part$$
+This argument has prototype
+$codei%
+    size_t %i_part%
+%$$
+and must be less than $icode n_part$$.
+Only the columns of $latex R$$ in part $icode i_part$$ are used by this call.
+The row and column dimensions of $icode pattern_out$$ are the same
+as for $icode%n_part% = 1%$$,
+but it only has the non-zeros in columns of $latex J(x)$$
+(rows of $latex J(x)^\R{T}$$) that are in part $icode i_part$$.
+The union of the non-zeros in $icode pattern_out$$, for
+$icode%i_part% = 0 , %...% , %n_part%-1%$$,
+is the sparsity pattern for $icode%n_part% = 1%$$.
+If $icode i_part$$ is not present, it is zero.
+
+$subhead Stored Patterns$$
+If $icode n_part$$ is greater than one,
+the patterns for the variables in the operation sequence are not
+held in $icode f$$ after the call; i.e.,
+$code size_forward_bool$$ and $code size_forward_set$$ are zero
+and $cref rev_hes_sparsity$$ cannot be used until
+there is a call to $code for_jac_sparsity$$ with $icode n_part$$ equal one.
+
+$head Multi-Threading$$
+Calls with the same $icode n_part$$ and different values of $icode i_part$$
+can be made by different threads at the same time; see
+$cref/in_parallel/ta_in_parallel/$$.
+In this case
+each thread must use its own $code ADFun$$ object;
+e.g., a copy of $icode f$$ or an object that uses
+$cref share_op_seq$$ to share its operation sequence.
+These objects must be created in sequential mode.
+If the operation sequence contains $cref atomic$$ function calls,
+their sparsity routines must also be usable in parallel mode.
+The example $cref multi_jac_sparsity.cpp$$ uses this feature and measures
+the time as a function of the number of threads.
+
 $head Sparsity for Entire Jacobian$$
 Suppose that
 $latex R$$ is the $latex n \times n$$ identity matrix.
@@ -195,7 +254,8 @@ This is used by the optimizer to obtain the correct dependency relations.
 
 \param internal_bool
 If this is true, calculations are done with sets represented by a vector
-of boolean values. Othewise, a vector of standard sets is used.
+of boolean values. Othewise, a vector of standard sets is used
+(a hybrid_setvec if hybrid_sparsity_ is true and a list_setvec otherwise).
 
 \param pattern_out
 The value of transpose is false (true),
@@ -205,6 +265,15 @@ the return value is a sparsity pattern for J(x) ( J(x)^T ) where
 \f]
 Here F is the function corresponding to the operation sequence
 and x is any argument value.
+Only the columns of J(x) that are in part i_part are included.
+
+\param n_part
+number of parts that the columns of R are partitioned into.
+Each part is a block of consecutive columns that starts at a multiple
+of the number of bits in a pack_setvec word.
+
+\param i_part
+index of the part of the columns of R that is used by this call.
 */
 template <class Base, class RecBase>
 template <class SizeVector>
@@ -213,7 +282,9 @@ void ADFun<Base,RecBase>::for_jac_sparsity(
     bool                         transpose        ,
     bool                         dependency       ,
     bool                         internal_bool    ,
-    sparse_rc<SizeVector>&       pattern_out      )
+    sparse_rc<SizeVector>&       pattern_out      ,
+    size_t                       n_part           ,
+    size_t                       i_part           )
 {
     // used to identify the RecBase type in calls to sweeps
     RecBase not_used_rec_base;
@@ -232,6 +303,78 @@ void ADFun<Base,RecBase>::for_jac_sparsity(
         "for_jac_sparsity: number rows in R "
         "is not equal number of independent variables."
     );
+    CPPAD_ASSERT_KNOWN(
+        i_part < n_part,
+        "for_jac_sparsity: i_part is not less than n_part"
+    );
+    if( n_part > 1 )
+    {   // The columns of R in this part are [col_begin, col_end).
+        // The blocks are made of whole pack_setvec words.
+        size_t n_bit     = std::numeric_limits<size_t>::digits;
+        size_t n_word    = (ell + n_bit - 1) / n_bit;
+        size_t col_begin = (i_part * n_word / n_part) * n_bit;
+        size_t col_end   = ((i_part + 1) * n_word / n_part) * n_bit;
+        col_begin        = std::min(col_begin, ell);
+        col_end          = std::min(col_end, ell);
+        size_t ell_part  = col_end - col_begin;
+        //
+        // column index for R is row index for R^T
+        const SizeVector& col_in(
+            transpose ? pattern_in.row() : pattern_in.col()
+        );
+        size_t nnz_in = pattern_in.nnz();
+        //
+        // sparsity pattern for the columns of R in this part
+        size_t nnz_part = 0;
+        for(size_t k = 0; k < nnz_in; ++k)
+            if( col_begin <= col_in[k] && col_in[k] < col_end )
+                ++nnz_part;
+        sparse_rc<SizeVector> part_in;
+        if( transpose )
+            part_in.resize(ell_part, n, nnz_part);
+        else
+            part_in.resize(n, ell_part, nnz_part);
+        nnz_part = 0;
+        for(size_t k = 0; k < nnz_in; ++k)
+        {   size_t r = pattern_in.row()[k];
+            size_t c = pattern_in.col()[k];
+            if( col_begin <= col_in[k] && col_in[k] < col_end )
+            {   if( transpose )
+                    part_in.set(nnz_part++, r - col_begin, c);
+                else
+                    part_in.set(nnz_part++, r, c - col_begin);
+            }
+        }
+        //
+        // sparsity pattern for the columns of J(x) in this part
+        // (there are no columns in this part when n_part > n_word)
+        sparse_rc<SizeVector> part_out;
+        if( ell_part > 0 ) for_jac_sparsity(
+            part_in, transpose, dependency, internal_bool, part_out
+        );
+        //
+        // the patterns for the variables only have the columns in this part
+        for_jac_sparse_pack_.resize(0, 0);
+        for_jac_sparse_set_.resize(0, 0);
+        for_jac_sparse_hybrid_.resize(0, 0);
+        //
+        // shift the columns of J(x) back to their index in R
+        size_t m       = Range();
+        size_t nnz_out = part_out.nnz();
+        if( transpose )
+            pattern_out.resize(ell, m, nnz_out);
+        else
+            pattern_out.resize(m, ell, nnz_out);
+        for(size_t k = 0; k < nnz_out; ++k)
+        {   size_t r = part_out.row()[k];
+            size_t c = part_out.col()[k];
+            if( transpose )
+                pattern_out.set(k, r + col_begin, c);
+            else
+                pattern_out.set(k, r, c + col_begin);
+        }
+        return;
+    }
     bool zero_empty  = true;
     bool input_empty = true;
     if( internal_bool )
@@ -239,6 +382,7 @@ void ADFun<Base,RecBase>::for_jac_sparsity(
         // (sparsity pattern is emtpy after a resize)
         for_jac_sparse_pack_.resize(num_var_tape_, ell);
         for_jac_sparse_set_.resize(0, 0);
+        for_jac_sparse_hybrid_.resize(0, 0);
         //
         // set sparsity patttern for independent variables
         local::sparse::set_internal_pattern(
@@ -265,12 +409,46 @@ void ADFun<Base,RecBase>::for_jac_sparsity(
             transpose, dep_taddr_, for_jac_sparse_pack_, pattern_out
         );
     }
+    else if( hybrid_sparsity_ )
+    {
+        // allocate memory for hybrid sparsity calculation
+        // (sparsity pattern is emtpy after a resize)
+        for_jac_sparse_hybrid_.resize(num_var_tape_, ell);
+        for_jac_sparse_pack_.resize(0, 0);
+        for_jac_sparse_set_.resize(0, 0);
+        //
+        // set sparsity patttern for independent variables
+        local::sparse::set_internal_pattern(
+            zero_empty            ,
+            input_empty           ,
+            transpose             ,
+            ind_taddr_            ,
+            for_jac_sparse_hybrid_,
+            pattern_in
+        );
+
+        // compute sparsity for other variables
+        local::sweep::for_jac<addr_t>(
+            &play_,
+            dependency,
+            n,
+            num_var_tape_,
+            for_jac_sparse_hybrid_,
+            not_used_rec_base
+
+        );
+        // get the ouput pattern
+        local::sparse::get_internal_pattern(
+            transpose, dep_taddr_, for_jac_sparse_hybrid_, pattern_out
+        );
+    }
     else
     {
         // allocate memory for set sparsity calculation
         // (sparsity pattern is emtpy after a resize)
         for_jac_sparse_set_.resize(num_var_tape_, ell);
         for_jac_sparse_pack_.resize(0, 0);
+        for_jac_sparse_hybrid_.resize(0, 0);
         //
         // set sparsity patttern for independent variables
         local::sparse::set_internal_pattern(
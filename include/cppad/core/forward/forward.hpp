@@ -16,6 +16,8 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 # include <cppad/core/capacity_order.hpp>
 # include <cppad/core/num_skip.hpp>
 # include <cppad/core/check_for_nan.hpp>
+# include <cppad/core/forward_direct.hpp>
+# include <cppad/core/forward_batch.hpp>
 
 namespace CppAD { // BEGIN_CPPAD_NAMESPACE
 
@@ -185,15 +187,51 @@ BaseVector ADFun<Base,RecBase>::Forward(
     CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
     CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load_rec() );
     if( q == 0 )
-    {
-        local::sweep::forward0(&play_, s, true,
-            n, num_var_tape_, C,
-            taylor_.data(), cskip_op_.data(), load_op2var_,
-            compare_change_count_,
-            compare_change_number_,
-            compare_change_op_index_,
-            not_used_rec_base
-        );
+    {   // check if we can use the compiled code
+        bool use_jit = jit_;
+        if( use_jit && ! jit_fun_.setup_done() )
+        {   jit_fun_.setup(&play_);
+            // the compiled code does not set cskip_op_
+            if( jit_fun_.ok() )
+            {   for(i = 0; i < cskip_op_.size(); ++i)
+                    cskip_op_[i] = false;
+            }
+        }
+        use_jit &= jit_fun_.ok();
+        use_jit &= compare_change_count_ == 0 || ! jit_fun_.has_compare();
+        //
+        // check if we can use the direct sweep
+        bool direct = forward_direct_ && ! use_jit && ! play_.arg_compact();
+        if( direct && ! direct_sweep_.setup_done() )
+        {   direct_sweep_.setup(&play_);
+            // the direct sweep does not set cskip_op_
+            if( direct_sweep_.ok() )
+            {   for(i = 0; i < cskip_op_.size(); ++i)
+                    cskip_op_[i] = false;
+            }
+        }
+        direct &= direct_sweep_.ok();
+        direct &= compare_change_count_ == 0 || ! direct_sweep_.has_compare();
+        if( use_jit )
+        {   compare_change_number_   = 0;
+            compare_change_op_index_ = 0;
+            jit_fun_.forward_zero(&play_, C, taylor_.data());
+        }
+        else if( direct )
+        {   compare_change_number_   = 0;
+            compare_change_op_index_ = 0;
+            direct_sweep_.forward0(&play_, C, taylor_.data());
+        }
+        else
+        {   local::sweep::forward0(&play_, s, true,
+                n, num_var_tape_, C,
+                taylor_.data(), cskip_op_.data(), load_op2var_,
+                compare_change_count_,
+                compare_change_number_,
+                compare_change_op_index_,
+                not_used_rec_base
+            );
+        }
     }
     else
     {   local::sweep::forward1(&play_, s, true, p, q,
@@ -0,0 +1,229 @@
+# ifndef CPPAD_CORE_FORWARD_BATCH_HPP
+# define CPPAD_CORE_FORWARD_BATCH_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin forward_batch$$
+$spell
+    const
+    Vec
+    nan
+    cppad.hpp
+$$
+$section Zero Order Forward Mode for a Batch of Points$$
+
+$head Syntax$$
+$icode%y% = %f%.forward_batch(%K%, %x%)%$$
+
+$head Purpose$$
+We use $latex F : \B{R}^n \rightarrow \B{R}^m$$ to denote the
+$cref/AD function/glossary/AD Function/$$ corresponding to $icode f$$.
+This routine evaluates $latex F$$ at $icode K$$ different points.
+The result is the same as calling $cref/Forward(0, x)/forward_zero/$$
+once for each point, but the operation sequence is only traversed once
+for each block of points.
+For each operator, all the points in a block are evaluated in an inner loop
+that accesses memory contiguously (which the compiler can vectorize).
+
+$head CPPAD_FORWARD_BATCH_BLOCK$$
+This preprocessor symbol is the maximum number of points in a block.
+The values of all the variables, for all the points in a block,
+are stored at the same time and should fit in cache.
+If it is not defined before including $code cppad/cppad.hpp$$,
+its default value is 64.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    const ADFun<%Base%> %f%
+%$$
+Note that the Taylor coefficients stored in $icode f$$
+(see $cref size_order$$) are not affected by this operation.
+
+$head K$$
+This argument has prototype
+$codei%
+    size_t %K%
+%$$
+It is the number of points and must be greater than zero.
+
+$head x$$
+This argument has prototype
+$codei%
+    const %BaseVector%& %x%
+%$$
+and size $icode%n% * %K%$$.
+The value of the $th j$$ independent variable at the $th k$$ point is
+$icode%x%[ %j% * %K% + %k% ]%$$; i.e.,
+the values for each independent variable are stored contiguously.
+
+$head y$$
+The return value $icode y$$ has prototype
+$codei%
+    %BaseVector% %y%
+%$$
+and size $icode%m% * %K%$$.
+The value of the $th i$$ dependent variable at the $th k$$ point is
+$icode%y%[ %i% * %K% + %k% ]%$$.
+
+$head BaseVector$$
+The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$head Comparison Operators$$
+Comparison operators are not evaluated by this routine, so
+$cref/compare_change/compare_change/$$ is not affected by this operation.
+
+$head Restrictions$$
+If the operation sequence contains $cref VecAD$$, $cref atomic$$,
+or $cref PrintFor$$ operations,
+the points are evaluated one at a time
+(the results are the same, but there is no speed advantage).
+
+$head check_for_nan$$
+If $cref check_for_nan$$ is true (the default) and
+$code NDEBUG$$ is not defined,
+it is an error for $icode y$$ to contain a $code nan$$.
+
+$head Example$$
+$children%
+    example/general/forward_batch.cpp
+%$$
+The file
+$cref forward_batch.cpp$$
+contains an example and test of this operation.
+
+$end
+*/
+
+/*!
+\def CPPAD_FORWARD_BATCH_BLOCK
+Maximum number of points evaluated during one pass through the
+operation sequence by forward_batch. The values of all the variables
+for this many points should fit in cache.
+*/
+# ifndef CPPAD_FORWARD_BATCH_BLOCK
+# define CPPAD_FORWARD_BATCH_BLOCK 64
+# endif
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file forward_batch.hpp
+Zero order forward mode for a batch of points.
+*/
+
+/*!
+Zero order forward mode for a batch of points.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+
+\param K
+number of points.
+
+\param x
+value of the independent variables, x[j * K + k] is the value of the
+j-th independent variable at the k-th point.
+
+\return
+value of the dependent variables, y[i * K + k] is the value of the
+i-th dependent variable at the k-th point.
+*/
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::forward_batch(
+    size_t K, const BaseVector& x
+) const
+{   // used to identify the RecBase type in calls to sweeps
+    RecBase not_used_rec_base;
+    //
+    // number of independent and dependent variables
+    size_t n = ind_taddr_.size();
+    size_t m = dep_taddr_.size();
+    //
+    // check Vector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+    //
+    CPPAD_ASSERT_KNOWN(
+        K > 0,
+        "forward_batch: the number of points K is zero"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(x.size()) == n * K,
+        "forward_batch: size of x not equal domain dimension times K"
+    );
+    //
+    // return value
+    BaseVector y(m * K);
+    //
+    // values of all the variables at one block of points
+    size_t block_size = std::min(K, size_t(CPPAD_FORWARD_BATCH_BLOCK) );
+    local::pod_vector_maybe<Base> batch(num_var_tape_ * block_size);
+    //
+    // information used when the points are evaluated one at a time
+    local::pod_vector<bool>   cskip_op;
+    local::pod_vector<addr_t> load_op2var;
+    //
+    // can points be evaluated together (true until forward0_batch fails)
+    bool together = true;
+    //
+    // k_start is the index of the first point in this block
+    for(size_t k_start = 0; k_start < K; k_start += block_size)
+    {   // number of points in this block
+        size_t L = std::min(block_size, K - k_start);
+        //
+        // independent variable values for this block
+        for(size_t j = 0; j < n; ++j)
+        {   CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] < num_var_tape_ );
+            for(size_t ell = 0; ell < L; ++ell)
+                batch[ ind_taddr_[j] * L + ell ] = x[ j * K + k_start + ell ];
+        }
+        //
+        // evaluate the points in this block together
+        if( together )
+            together = local::sweep::forward0_batch(&play_, L, batch.data());
+        if( ! together )
+        {   // evaluate the points in this block one at a time
+            cskip_op.resize( play_.num_op_rec() );
+            load_op2var.resize( play_.num_var_load_rec() );
+            size_t compare_change_count    = 0;
+            size_t compare_change_number   = 0;
+            size_t compare_change_op_index = 0;
+            for(size_t ell = 0; ell < L; ++ell)
+            {   local::sweep::forward0(&play_, std::cout, true,
+                    n, num_var_tape_, L,
+                    batch.data() + ell, cskip_op.data(), load_op2var,
+                    compare_change_count,
+                    compare_change_number,
+                    compare_change_op_index,
+                    not_used_rec_base
+                );
+            }
+        }
+        //
+        // dependent variable values for this block
+        for(size_t i = 0; i < m; ++i)
+        {   CPPAD_ASSERT_UNKNOWN( dep_taddr_[i] < num_var_tape_ );
+            for(size_t ell = 0; ell < L; ++ell)
+                y[ i * K + k_start + ell ] = batch[ dep_taddr_[i] * L + ell ];
+        }
+    }
+    CPPAD_ASSERT_KNOWN( ! ( check_for_nan_ && hasnan(y) ),
+        "y = f.forward_batch(K, x): has a nan."
+    );
+    return y;
+}
+
+} // END_CPPAD_NAMESPACE
+
+# endif
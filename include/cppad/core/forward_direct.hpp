@@ -0,0 +1,125 @@
+# ifndef CPPAD_CORE_FORWARD_DIRECT_HPP
+# define CPPAD_CORE_FORWARD_DIRECT_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin forward_direct$$
+$spell
+    bool
+    const
+    Vec
+$$
+$section Direct Dispatch Zero Order Forward Mode$$
+
+$head Syntax$$
+$icode%f%.forward_direct(%b%)
+%$$
+$icode%b% = %f%.forward_direct()
+%$$
+
+$head Purpose$$
+The normal zero order forward sweep decodes every operator,
+and dispatches it using a $code switch$$ statement,
+each time $cref/Forward(0, x)/forward_zero/$$ is called.
+If this option is true, the operation sequence is decoded once
+(during the next zero order forward) and subsequent zero order
+forward sweeps use a table of pointers to functions
+that evaluate each operator.
+This can be faster when the same function is evaluated many times.
+
+$head f$$
+For the syntax where $icode b$$ is an argument,
+$icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+For the syntax where $icode b$$ is the result,
+$icode f$$ has prototype
+$codei%
+    const ADFun<%Base%> %f%
+%$$
+
+$head b$$
+This argument or result has prototype
+$codei%
+    bool %b%
+%$$
+If $icode b$$ is true (false),
+future calls to zero order $icode%f%.Forward%$$ will (will not)
+use direct dispatch.
+
+$head Default$$
+The value for this setting after construction of $icode f$$ is false.
+The value of this setting is not affected by calling
+$cref Dependent$$ or $cref optimize$$ for this function object.
+
+$head Restrictions$$
+The direct sweep is not used,
+and the normal zero order forward sweep is used instead,
+in the following cases:
+
+$list number$$
+The operation sequence contains
+$cref/conditional skip/optimize/options/no_conditional_skip/$$,
+$cref VecAD$$, $cref atomic$$, or $cref PrintFor$$ operations.
+$lnext
+The operation sequence contains comparison operators and
+the $cref/count/compare_change/count/$$ is non-zero.
+Use $icode%f%.compare_change_count(0)%$$ to turn off comparison counting.
+$lend
+The direct sweep does not evaluate comparison operators, so
+when it is used, $cref/number/compare_change/number/$$ and
+$cref/op_index/compare_change/op_index/$$ are zero.
+
+$head Example$$
+$children%
+    example/general/forward_direct.cpp
+%$$
+The file
+$cref forward_direct.cpp$$
+contains an example and test of this option.
+
+$end
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file forward_direct.hpp
+Set and get the option for direct dispatch zero order forward mode.
+*/
+
+/*!
+Set the direct dispatch zero order forward option.
+
+\param value
+new value for this flag.
+*/
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::forward_direct(bool value)
+{   forward_direct_ = value;
+    if( ! value )
+        direct_sweep_.clear();
+}
+
+/*!
+Get the direct dispatch zero order forward option.
+
+\return
+current value of this flag.
+*/
+template <class Base, class RecBase>
+bool ADFun<Base,RecBase>::forward_direct(void) const
+{   return forward_direct_; }
+
+} // END_CPPAD_NAMESPACE
+
+# endif
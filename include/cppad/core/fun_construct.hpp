@@ -250,6 +250,9 @@ function_name_(""),
 base2ad_return_value_(false),
 has_been_optimized_(false),
 check_for_nan_(true) ,
+forward_direct_(false) ,
+jit_(false) ,
+hybrid_sparsity_(false) ,
 compare_change_count_(0),
 compare_change_number_(0),
 compare_change_op_index_(0),
@@ -317,6 +320,9 @@ void ADFun<Base,RecBase>::operator=(const ADFun& f)
     base2ad_return_value_      = false;
     has_been_optimized_        = f.has_been_optimized_;
     check_for_nan_             = f.check_for_nan_;
+    forward_direct_            = f.forward_direct_;
+    jit_                       = f.jit_;
+    hybrid_sparsity_           = f.hybrid_sparsity_;
     //
     // size_t objects
     compare_change_count_      = f.compare_change_count_;
@@ -336,10 +342,13 @@ void ADFun<Base,RecBase>::operator=(const ADFun& f)
     //
     // pod_vector_maybe_vectors
     taylor_                    = f.taylor_;
+    reverse_partial_.clear(); // work space, not copied
     subgraph_partial_          = f.subgraph_partial_;
     //
     // player
     play_                      = f.play_;
+    direct_sweep_              = f.direct_sweep_;
+    jit_fun_                   = f.jit_fun_; // clears jit_fun_
     //
     // subgraph
     subgraph_info_             = f.subgraph_info_;
@@ -349,6 +358,9 @@ void ADFun<Base,RecBase>::operator=(const ADFun& f)
     //
     // sparse_list
     for_jac_sparse_set_        = f.for_jac_sparse_set_;
+    //
+    // sparse_hybrid
+    for_jac_sparse_hybrid_     = f.for_jac_sparse_hybrid_;
 }
 # if CPPAD_USE_CPLUSPLUS_2011
 /// Move semantics version of assignment operator
@@ -362,6 +374,9 @@ void ADFun<Base,RecBase>::operator=(ADFun&& f)
     base2ad_return_value_      = false; // f might be, but this is not
     has_been_optimized_        = f.has_been_optimized_;
     check_for_nan_             = f.check_for_nan_;
+    forward_direct_            = f.forward_direct_;
+    jit_                       = f.jit_;
+    hybrid_sparsity_           = f.hybrid_sparsity_;
     //
     // size_t objects
     compare_change_count_      = f.compare_change_count_;
@@ -377,11 +392,14 @@ void ADFun<Base,RecBase>::operator=(ADFun&& f)
     dep_taddr_.swap(      f.dep_taddr_);
     dep_parameter_.swap(  f.dep_parameter_);
     taylor_.swap(         f.taylor_);
+    reverse_partial_.swap(f.reverse_partial_);
     cskip_op_.swap(       f.cskip_op_);
     load_op2var_.swap(    f.load_op2var_);
     //
     // player
     play_.swap(f.play_);
+    direct_sweep_.swap(f.direct_sweep_);
+    jit_fun_.swap(f.jit_fun_);
     //
     // subgraph_info
     subgraph_info_.swap(f.subgraph_info_);
@@ -391,6 +409,9 @@ void ADFun<Base,RecBase>::operator=(ADFun&& f)
     //
     // sparse_list
     for_jac_sparse_set_.swap( f.for_jac_sparse_set_);
+    //
+    // sparse_hybrid
+    for_jac_sparse_hybrid_.swap( f.for_jac_sparse_hybrid_);
 }
 # endif
 
@@ -476,6 +497,9 @@ ADFun<Base,RecBase>::ADFun(const ADVector &x, const ADVector &y)
 
     // ad_fun.hpp member values not set by dependent
     check_for_nan_       = true;
+    forward_direct_      = false;
+    jit_                 = false;
+    hybrid_sparsity_     = false;
 
     // allocate memory for one zero order taylor_ coefficient
     CPPAD_ASSERT_UNKNOWN( num_order_taylor_ == 0 );
@@ -15,6 +15,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 # include <cppad/core/new_dynamic.hpp>
 # include <cppad/core/forward/forward.hpp>
 # include <cppad/core/reverse.hpp>
+# include <cppad/core/reverse_budget.hpp>
 # include <cppad/core/sparse.hpp>
 
 # endif
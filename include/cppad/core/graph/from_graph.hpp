@@ -1452,6 +1452,12 @@ void CppAD::ADFun<Base,RecBase>::from_graph(
     // recording to the player and and erase the recording.
     play_.get_recording(rec, n_variable_ind_fun);
     //
+    // direct_sweep_
+    direct_sweep_.clear();
+    //
+    // jit_fun_
+    jit_fun_.clear();
+    //
     // ind_taddr_
     // Note that play_ has been set, we can use it to check operators
     ind_taddr_.resize(n_variable_ind_fun);
@@ -1461,9 +1467,10 @@ void CppAD::ADFun<Base,RecBase>::from_graph(
         ind_taddr_[j] = j+1;
     }
     //
-    // for_jac_sparse_pack_, for_jac_sparse_set_
+    // for_jac_sparse_pack_, for_jac_sparse_set_, for_jac_sparse_hybrid_
     for_jac_sparse_pack_.resize(0, 0);
     for_jac_sparse_set_.resize(0,0);
+    for_jac_sparse_hybrid_.resize(0,0);
     //
     // resize subgraph_info_
     subgraph_info_.resize(
@@ -0,0 +1,128 @@
+# ifndef CPPAD_CORE_HYBRID_SPARSITY_HPP
+# define CPPAD_CORE_HYBRID_SPARSITY_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin hybrid_sparsity$$
+$spell
+    bool
+    const
+    Jacobian
+$$
+$section Hybrid Vector of Sets for Sparsity Calculations$$
+
+$head Syntax$$
+$icode%f%.hybrid_sparsity(%b%)
+%$$
+$icode%b% = %f%.hybrid_sparsity()
+%$$
+
+$head Purpose$$
+The preferred sparsity routines
+$cref for_jac_sparsity$$,
+$cref rev_jac_sparsity$$,
+$cref for_hes_sparsity$$, and
+$cref rev_hes_sparsity$$
+have an $icode internal_bool$$ argument.
+If it is true, each set is stored as a vector of bits.
+This uses a lot of memory when the number of columns in the
+sparsity pattern is large.
+If it is false, each set is stored as a linked list of integers.
+This uses a lot of memory when some of the sets are dense.
+If this option is true, and $icode internal_bool$$ is false,
+each set is stored using the container that requires the least memory;
+a sorted vector of integers, a vector of runs of consecutive integers,
+or a vector of bits from the smallest to the largest element in the set
+(see $cref hybrid_setvec$$).
+This works well for sparsity patterns with a large number of columns
+where some rows are dense and other rows are very sparse.
+
+$head f$$
+For the syntax where $icode b$$ is an argument,
+$icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+For the syntax where $icode b$$ is the result,
+$icode f$$ has prototype
+$codei%
+    const ADFun<%Base%> %f%
+%$$
+
+$head b$$
+This argument or result has prototype
+$codei%
+    bool %b%
+%$$
+If $icode b$$ is true (false),
+future sparsity calculations by $icode f$$ with $icode internal_bool$$ false
+will (will not) use the hybrid containers.
+The sparsity patterns are the same for both choices.
+
+$head Default$$
+The value for this setting after construction of $icode f$$ is false.
+The value of this setting is not affected by calling
+$cref Dependent$$ or $cref optimize$$ for this function object.
+
+$head rev_hes_sparsity$$
+The $cref rev_hes_sparsity$$ routine uses the same representation
+as the previous call to $cref for_jac_sparsity$$.
+Hence it does not depend on the value of this setting
+when it is called.
+
+$head size_forward_set$$
+The memory used by the hybrid containers to store the results of
+$cref for_jac_sparsity$$ is included in the value returned by
+$cref/size_forward_set/for_jac_sparsity/f/size_forward_set/$$.
+
+$head Example$$
+$children%
+    example/sparse/hybrid_sparsity.cpp
+%$$
+The file
+$cref hybrid_sparsity.cpp$$
+contains an example and test of this option.
+The $cref/speed_sparsity_set/speed_sparsity_set.cpp/$$ program
+compares the memory and time used by the different representations.
+
+$end
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file hybrid_sparsity.hpp
+Set and get the option for using hybrid_setvec in sparsity calculations.
+*/
+
+/*!
+Set the hybrid sparsity option.
+
+\param value
+new value for this flag.
+*/
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::hybrid_sparsity(bool value)
+{   hybrid_sparsity_ = value; }
+
+/*!
+Get the hybrid sparsity option.
+
+\return
+current value of this flag.
+*/
+template <class Base, class RecBase>
+bool ADFun<Base,RecBase>::hybrid_sparsity(void) const
+{   return hybrid_sparsity_; }
+
+} // END_CPPAD_NAMESPACE
+
+# endif
@@ -0,0 +1,208 @@
+# ifndef CPPAD_CORE_JIT_HPP
+# define CPPAD_CORE_JIT_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin jit$$
+$spell
+    jit
+    bool
+    const
+    Vec
+    dlopen
+    mkdtemp
+    cmake
+    msg
+    std
+    TMPDIR
+    noexec
+    ldl
+    glibc
+$$
+$section Compile an Operation Sequence to Native Code$$
+
+$head Syntax$$
+$icode%f%.jit(%b%)
+%$$
+$icode%b% = %f%.jit()
+%$$
+$icode%msg% = %f%.jit_msg()
+%$$
+
+$head Purpose$$
+If this option is true,
+the operation sequence for $icode f$$ is converted to C source code,
+compiled to a shared library, and loaded into the program
+(during the next zero order forward or first order reverse).
+Subsequent calls to
+$cref/Forward(0, x)/forward_zero/$$ and
+$cref/Reverse(1, w)/reverse_one/$$
+use the compiled code instead of interpreting the operation sequence.
+Compiling the code takes much longer than one evaluation of the
+function, so this is only faster when the same operation sequence
+is evaluated many times.
+
+$head f$$
+For the syntax where $icode b$$ is an argument,
+$icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+For the syntax where $icode b$$ is the result,
+$icode f$$ has prototype
+$codei%
+    const ADFun<%Base%> %f%
+%$$
+
+$head b$$
+This argument or result has prototype
+$codei%
+    bool %b%
+%$$
+If $icode b$$ is true (false),
+future calls to zero order $icode%f%.Forward%$$ and first order
+$icode%f%.Reverse%$$ will (will not) use compiled code.
+
+$head Default$$
+The value for this setting after construction of $icode f$$ is false.
+The value of this setting is not affected by calling
+$cref Dependent$$ or $cref optimize$$ for this function object,
+but the operation sequence is compiled again after such a call.
+The compiled code is not copied when $icode f$$ is assigned to
+another $code ADFun$$ object; it is compiled again when it is
+first used by the other object.
+
+$head CPPAD_USE_JIT$$
+This preprocessor symbol is defined (or not) by the user
+during the inclusion of the CppAD header files; e.g., when using $code g++$$
+one could put $code -D CPPAD_USE_JIT$$ on the compiler command line.
+It must be defined (or not) for all the files in a program.
+If it is not defined, the operation sequence is never compiled
+and the program does not use $code dlopen$$.
+If it is defined, the program may need to link with the
+$code dl$$ library; e.g., using $code -ldl$$ on systems with
+$code glibc$$ before version 2.34.
+
+$head Requirements$$
+The compiled code is only used if all of the following conditions hold:
+
+$list number$$
+The type $icode Base$$ is $code double$$.
+$lnext
+The preprocessor symbol $cref/CPPAD_USE_JIT/jit/CPPAD_USE_JIT/$$ is defined.
+$lnext
+The system has $code dlopen$$ and $code mkdtemp$$,
+and the C compiler command
+$cref/CPPAD_C_COMPILER_CMD/configure.hpp/CPPAD_C_COMPILER_CMD/$$
+is known (this is the C compiler found by $code cmake$$).
+$lnext
+The operation sequence has at most 10,000 operators
+(the time to compile larger operation sequences is usually more than
+the time saved).
+$lnext
+The operation sequence does not contain
+discrete functions,
+$cref/conditional skip/optimize/options/no_conditional_skip/$$,
+$cref VecAD$$, $cref atomic$$, or $cref PrintFor$$ operations.
+$lnext
+For zero order forward, either the operation sequence does not contain
+comparison operators, or the $cref/count/compare_change/count/$$ is zero.
+Use $icode%f%.compare_change_count(0)%$$ to turn off comparison counting.
+$lend
+If one of these conditions does not hold,
+the normal (interpreted) sweeps are used; i.e.,
+the results do not depend on this setting.
+The compiled code does not evaluate comparison operators, so
+when it is used, $cref/number/compare_change/number/$$ and
+$cref/op_index/compare_change/op_index/$$ are zero.
+This option takes precedence over $cref forward_direct$$.
+
+$head Temporary Files$$
+The source code and the shared library are written to a directory,
+created by $code mkdtemp$$, that only the current user can access.
+This directory is in $code TMPDIR$$,
+if that environment variable is set, and otherwise in $code /tmp$$.
+It is removed as soon as the library has been loaded.
+If $code /tmp$$ is mounted $code noexec$$,
+set $code TMPDIR$$ to a directory where libraries can be loaded.
+
+$head msg$$
+The result $icode msg$$ has prototype
+$codei%
+    std::string %msg%
+%$$
+If the compiled code is being used, or if the operation sequence
+has not yet been compiled, it is empty.
+Otherwise, it describes why the compiled code is not being used;
+e.g., $code CPPAD_USE_JIT$$ is not defined,
+the operation sequence is not supported,
+the compiler command is not known,
+$code mkdtemp$$ failed,
+the compiler failed (the message includes its output),
+or $code dlopen$$ failed.
+The operation sequence is compiled during the first
+zero order forward or first order reverse after $icode b$$ is set to true,
+after $code Dependent$$, and after $code optimize$$.
+
+$head Example$$
+$children%
+    example/general/jit.cpp
+%$$
+The file
+$cref jit.cpp$$
+contains an example and test of this option.
+
+$end
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file jit.hpp
+Set and get the option for compiling the operation sequence.
+*/
+
+/*!
+Set the jit option.
+
+\param value
+new value for this flag.
+*/
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::jit(bool value)
+{   jit_ = value;
+    if( ! value )
+        jit_fun_.clear();
+}
+
+/*!
+Get the jit option.
+
+\return
+current value of this flag.
+*/
+template <class Base, class RecBase>
+bool ADFun<Base,RecBase>::jit(void) const
+{   return jit_; }
+
+/*!
+Get the reason that the compiled code is not being used.
+
+\return
+empty if the compiled code is being used or has not been set up.
+*/
+template <class Base, class RecBase>
+std::string ADFun<Base,RecBase>::jit_msg(void) const
+{   return jit_fun_.msg(); }
+
+} // END_CPPAD_NAMESPACE
+
+# endif
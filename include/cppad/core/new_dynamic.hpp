@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_NEW_DYNAMIC_HPP
 # define CPPAD_CORE_NEW_DYNAMIC_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-18 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -25,7 +25,9 @@ $$
 $section Change the Dynamic Parameters$$
 
 $head Syntax$$
-$icode%f%.new_dynamic(%dynamic%)%$$
+$icode%f%.new_dynamic(%dynamic%)
+%$$
+$icode%f%.new_dynamic(%dynamic%, %changed%)%$$
 
 $head Purpose$$
 Often one is only interested in computing derivatives with respect
@@ -61,11 +63,45 @@ in the call to $code Independent$$ that started
 the recording for $icode f$$; see
 $cref/size_dyn_ind/seq_property/size_dyn_ind/$$.
 
+$head changed$$
+If this argument is present, it has prototype
+$codei%
+    const %SizeVector%& %changed%
+%$$
+(see $icode SizeVector$$ below).
+It contains the indices $icode j$$ for which $icode%dynamic%[%j%]%$$
+may be different from its value during the previous call to
+$code new_dynamic$$ (or during the recording of $icode f$$
+if there is no previous call).
+Only the elements of $icode dynamic$$ with these indices are used.
+Each index must be less than $icode%dynamic%.size()%$$
+and an index may appear more than once.
+
+$subhead Dependency Cone$$
+If $icode changed$$ is present, only the dependent dynamic parameters
+that depend on the independent dynamic parameters with these indices
+are recomputed.
+If $icode%changed%.size()%$$ is a quarter or more of
+$icode%dynamic%.size()%$$, all the dependent dynamic parameters are
+recomputed because that is usually faster.
+Otherwise, the operators that use each dynamic parameter are computed
+the first time they are needed and stored with the recording for $icode f$$.
+This uses memory proportional to the number of dynamic parameter operator
+arguments and is freed when $icode f$$ gets a new recording.
+If the recording is shared with other $code ADFun$$ objects
+(see $cref/share_op_seq/multi_thread/share_op_seq/$$),
+the first use of the dependency cone must be in sequential mode.
+
 $head BaseVector$$
 The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
 $cref/elements of type/SimpleVector/Elements of Specified Type/$$
 $icode Base$$.
 
+$head SizeVector$$
+The type $icode SizeVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$code size_t$$.
+
 $head Taylor Coefficients$$
 The Taylor coefficients computed by previous calls to
 $cref/f.Forward/Forward/$$ are lost after this operation; including the
@@ -133,6 +169,100 @@ void ADFun<Base,RecBase>::new_dynamic(const BaseVector& dynamic)
 
     return;
 }
+/*!
+Change some of the dynamic parameters in this ADFun object
+
+\param dynamic
+is the vector of new values for the dynamic parameters.
+Only the elements with index in changed are used.
+
+\param changed
+is the indices of the dynamic parameters that may have changed.
+Only the dependent dynamic parameters that depend on these indices
+are recomputed.
+*/
+template <class Base, class RecBase>
+template <class BaseVector, class SizeVector>
+void ADFun<Base,RecBase>::new_dynamic(
+    const BaseVector& dynamic, const SizeVector& changed
+)
+{   using local::pod_vector;
+    CPPAD_ASSERT_KNOWN(
+        size_t( dynamic.size() ) == play_.num_dynamic_ind() ,
+        "f.new_dynamic: dynamic.size() different from corresponding "
+        "call to Independent"
+    );
+    // check BaseVector is Simple Vector class with Base elements
+    CheckSimpleVector<Base, BaseVector>();
+    //
+    // check SizeVector is Simple Vector class with size_t elements
+    CheckSimpleVector<size_t, SizeVector>();
+# ifndef NDEBUG
+    for(size_t k = 0; k < size_t( changed.size() ); ++k)
+    {   CPPAD_ASSERT_KNOWN(
+            size_t( changed[k] ) < size_t( dynamic.size() ),
+            "f.new_dynamic: an element of changed is not less than "
+            "dynamic.size()"
+        );
+    }
+# endif
+    // retrieve player information about the dynamic parameters
+    local::pod_vector_maybe<Base>&     all_par_vec( play_.all_par_vec() );
+    const pod_vector<bool>&            dyn_par_is ( play_.dyn_par_is()  );
+    const pod_vector<local::opcode_t>& dyn_par_op ( play_.dyn_par_op()  );
+    const pod_vector<addr_t>&          dyn_par_arg( play_.dyn_par_arg() );
+    const pod_vector<addr_t>&     dyn_ind2par_ind ( play_.dyn_ind2par_ind() );
+
+    // If a large fraction of the independent dynamic parameters changed,
+    // the cone is most of the recording and a full sweep is faster.
+    RecBase not_used_rec_base;
+    size_t num_dynamic_ind = play_.num_dynamic_ind();
+    if( 4 * size_t( changed.size() ) >= num_dynamic_ind )
+    {   // elements of dynamic that are not in changed are not used
+        local::pod_vector_maybe<Base> ind_dynamic(num_dynamic_ind);
+        for(size_t j = 0; j < num_dynamic_ind; ++j)
+            ind_dynamic[j] = all_par_vec[ dyn_ind2par_ind[j] ];
+        for(size_t k = 0; k < size_t( changed.size() ); ++k)
+            ind_dynamic[ changed[k] ] = dynamic[ changed[k] ];
+        local::sweep::dynamic(
+            all_par_vec         ,
+            ind_dynamic         ,
+            dyn_par_is          ,
+            dyn_ind2par_ind     ,
+            dyn_par_op          ,
+            dyn_par_arg         ,
+            not_used_rec_base
+        );
+        num_order_taylor_ = 0;
+        return;
+    }
+    //
+    // operators that use each parameter (only needed for the cone)
+    play_.setup_dynamic();
+    const pod_vector<addr_t>&          dyn_op2arg ( play_.dyn_op2arg() );
+    const pod_vector<addr_t>&       dyn_use_begin ( play_.dyn_use_begin() );
+    const pod_vector<addr_t>&          dyn_use    ( play_.dyn_use() );
+    //
+    // set the dependent dynamic parameters that depend on changed
+    local::sweep::dynamic_cone(
+        all_par_vec         ,
+        dynamic             ,
+        changed             ,
+        dyn_par_is          ,
+        dyn_ind2par_ind     ,
+        dyn_par_op          ,
+        dyn_par_arg         ,
+        dyn_op2arg          ,
+        dyn_use_begin       ,
+        dyn_use             ,
+        not_used_rec_base
+    );
+
+    // the existing Taylor coefficients are no longer valid
+    num_order_taylor_ = 0;
+
+    return;
+}
 
 
 } // END_CPPAD_NAMESPACE
@@ -88,6 +88,20 @@ $cref PrintFor$$ operations will be removed form the optimized function.
 These operators are useful for reporting problems evaluating derivatives
 at independent variable values different from those used to record a function.
 
+$subhead grow_hash_table$$
+The $code optimize$$ function uses a hash table to find
+operators that are equivalent to previous operators.
+By default, this table has a fixed number of entries and
+the list of operators for each entry is restarted when it gets too long.
+For very large tapes, this may make the optimize routine slow and it
+may miss some equivalent operators.
+If the sub-string $code grow_hash_table$$ appears in $icode options$$,
+the hash table grows with the number of operators in $icode f$$,
+so the time per operator does not depend on the size of $icode f$$.
+This uses more memory while $code optimize$$ is running.
+The $cref/speed_optimize/speed_optimize.cpp/$$ program
+compares the time with and without this option.
+
 $head Re-Optimize$$
 Before 2019-06-28, optimizing twice was not supported and would fail
 if cumulative sum operators were present after the first optimization.
@@ -119,6 +133,19 @@ Any Taylor coefficients in the function object are lost; i.e.,
 $cref/f.size_order()/size_order/$$ after the optimization is zero.
 (See the discussion about efficiency above.)
 
+$head Parallel Mode$$
+The $code optimize$$ routine only uses information in $icode f$$
+and memory that is allocated by the current thread using $cref thread_alloc$$.
+Hence different threads can optimize different $code ADFun$$ objects at
+the same time; see $cref/in_parallel/ta_in_parallel/$$.
+The optimized operation sequence does not depend on which thread
+does the optimization.
+If $icode f$$ is sharing its operation sequence
+(see $cref share_op_seq$$), it must be optimized in sequential mode.
+A tape that is a sum of parts that only share the independent variables
+can be partitioned by recording each part as a separate $code ADFun$$ object;
+see the $cref/optimize/thread_test.cpp/optimize/$$ multi-threading test.
+
 $head Speed Testing$$
 You can run the CppAD $cref/speed/speed_main/$$ tests and see
 the corresponding changes in number of variables and execution time.
@@ -286,6 +313,12 @@ void ADFun<Base,RecBase>::optimize(const std::string& options)
     // now replace the recording
     play_.get_recording(rec, n);
 
+    // direct_sweep_
+    direct_sweep_.clear();
+
+    // jit_fun_
+    jit_fun_.clear();
+
     // set flag so this function knows it has been optimized
     has_been_optimized_ = true;
 
@@ -293,6 +326,7 @@ void ADFun<Base,RecBase>::optimize(const std::string& options)
     // (the results are no longer valid)
     for_jac_sparse_pack_.resize(0, 0);
     for_jac_sparse_set_.resize(0,0);
+    for_jac_sparse_hybrid_.resize(0,0);
 
     // free old Taylor coefficient memory
     taylor_.clear();
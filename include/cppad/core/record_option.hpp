@@ -0,0 +1,156 @@
+# ifndef CPPAD_CORE_RECORD_OPTION_HPP
+# define CPPAD_CORE_RECORD_OPTION_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin record_option$$
+$spell
+    num
+    op
+    par
+    const
+    std
+$$
+
+$section Options for the Current Recording$$
+
+$head Syntax$$
+$codei%AD<%Base%>::record_reserve(%num_op%, %num_par%)
+%$$
+$codei%AD<%Base%>::record_par_hash(%method%)
+%$$
+
+$head Purpose$$
+These options make recording faster for very large
+$cref/operation sequences/glossary/Operation/Sequence/$$.
+They apply to the current $codei%AD<%Base%>%$$ recording;
+i.e., the one started by the most recent call to $cref Independent$$
+by the current thread.
+They do not change the function that is recorded.
+
+$head Recording$$
+It is an error to use these options when
+there is no $codei%AD<%Base%>%$$ recording in progress
+for the current thread.
+
+$head record_reserve$$
+The recording grows as operations are recorded and each time
+it runs out of memory, it is copied to a larger block of memory.
+The $code record_reserve$$ routine allocates the memory for a recording
+with the specified size, so these copies are not necessary.
+
+$subhead num_op$$
+This argument has prototype
+$codei%
+    size_t %num_op%
+%$$
+It is the expected number of operators in the recording; see
+$cref/size_op/seq_property/size_op/$$.
+Memory is also reserved for two arguments per operator.
+
+$subhead num_par$$
+This argument has prototype
+$codei%
+    size_t %num_par%
+%$$
+It is the expected number of parameters in the recording; see
+$cref/size_par/seq_property/size_par/$$.
+
+$head record_par_hash$$
+Each time a constant parameter is used in the recording,
+a hash table is used to see if there is a previous parameter with the
+same value.
+If there is, the previous parameter is used.
+Otherwise the value is added to the recording.
+
+$subhead method$$
+This argument has prototype
+$codei%
+    const std::string& %method%
+%$$
+It must be one of the following values:
+$table
+$icode method$$ $pre  $$ $cnext Meaning $rnext
+$code fixed_hash_table$$ $cnext
+The table has $code CPPAD_HASH_TABLE_SIZE$$ entries and each entry
+holds the most recent parameter with its
+$cref/hash code/base_hash/$$.
+This is the default.
+When there are many different constants,
+most of the duplicate values are not found.
+$rnext
+$code grow_hash_table$$ $cnext
+The table grows with the number of constant parameters.
+All the duplicate values are found, but the table uses more memory
+and it is slower than the other methods when most of the constants
+are different.
+This method computes its own hash code using the bytes in a
+$icode Base$$ value, instead of the $cref base_hash$$ function.
+Values whose representation has the same bytes are found as duplicates.
+$rnext
+$code no_hash_table$$ $cnext
+Duplicate values are not checked for.
+This is the fastest method when most of the constants are different.
+$tend
+The $icode method$$ can be changed during a recording.
+It is used for the constant parameters that are recorded after the change.
+
+$head Example$$
+$children%
+    example/general/record_option.cpp
+%$$
+The file
+$cref record_option.cpp$$
+contains an example and test of these options.
+The $cref/speed_record/speed_record.cpp/$$ program
+compares the time it takes to record with different options.
+
+$end
+----------------------------------------------------------------------------
+*/
+
+
+namespace CppAD {
+    template <class Base>
+    void AD<Base>::record_reserve(size_t num_op, size_t num_par)
+    {   local::ADTape<Base>* tape = AD<Base>::tape_ptr();
+        CPPAD_ASSERT_KNOWN(
+            tape != CPPAD_NULL,
+            "record_reserve: there is no AD<Base> recording in progress"
+        );
+        tape->Rec_.reserve(num_op, 2 * num_op, num_par);
+    }
+    template <class Base>
+    void AD<Base>::record_par_hash(const std::string& method)
+    {   local::ADTape<Base>* tape = AD<Base>::tape_ptr();
+        CPPAD_ASSERT_KNOWN(
+            tape != CPPAD_NULL,
+            "record_par_hash: there is no AD<Base> recording in progress"
+        );
+        local::con_par_hash_enum con_par_hash;
+        if( method == "fixed_hash_table" )
+            con_par_hash = local::fixed_con_par_hash;
+        else if( method == "grow_hash_table" )
+            con_par_hash = local::grow_con_par_hash;
+        else
+        {   CPPAD_ASSERT_KNOWN(
+                method == "no_hash_table",
+                "record_par_hash: method is not fixed_hash_table, "
+                "grow_hash_table, or no_hash_table"
+            );
+            con_par_hash = local::no_con_par_hash;
+        }
+        tape->Rec_.set_con_par_hash(con_par_hash);
+    }
+}
+
+# endif
@@ -94,6 +94,8 @@ If this is true, calculations are done with sets represented by a vector
 of boolean values. Otherwise, a vector of sets of integers is used.
 This must be the same as in the previous call to
 $icode%f%.for_jac_sparsity%$$.
+If it is false, the $cref hybrid_sparsity$$ setting during the
+previous call to $icode%f%.for_jac_sparsity%$$ is used.
 
 $head pattern_out$$
 This argument has prototype
@@ -148,7 +150,8 @@ Is the returned sparsity pattern transposed.
 
 \param internal_bool
 If this is true, calculations are done with sets represented by a vector
-of boolean values. Otherwise, a vector of standard sets is used.
+of boolean values. Otherwise, a vector of standard sets is used
+(the same type as in the previous call to for_jac_sparsity).
 
 \param pattern_out
 The value of transpose is false (true),
@@ -218,6 +221,30 @@ void ADFun<Base,RecBase>::rev_hes_sparsity(
             transpose, ind_taddr_, internal_hes, pattern_out
         );
     }
+    else if( for_jac_sparse_hybrid_.n_set() > 0 )
+    {   // column dimension of internal sparstiy pattern
+        size_t ell = for_jac_sparse_hybrid_.end();
+        //
+        // allocate memory for hybrid sparsity calculation
+        // (sparsity pattern is emtpy after a resize)
+        local::sparse::hybrid_setvec internal_hes;
+        internal_hes.resize(num_var_tape_, ell);
+        //
+        // compute the Hessian sparsity pattern
+        local::sweep::rev_hes<addr_t>(
+            &play_,
+            n,
+            num_var_tape_,
+            for_jac_sparse_hybrid_,
+            rev_jac_pattern.data(),
+            internal_hes,
+            not_used_rec_base
+        );
+        // get sparstiy pattern for independent variables
+        local::sparse::get_internal_pattern(
+            transpose, ind_taddr_, internal_hes, pattern_out
+        );
+    }
     else
     {   CPPAD_ASSERT_KNOWN(
             for_jac_sparse_set_.n_set() > 0,
@@ -84,7 +84,8 @@ see $cref/pattern_out/rev_jac_sparsity/pattern_out/$$ below.
 
 $head internal_bool$$
 If this is true, calculations are done with sets represented by a vector
-of boolean values. Otherwise, a vector of sets of integers is used.
+of boolean values. Otherwise, a vector of sets of integers is used
+(see $cref hybrid_sparsity$$).
 
 $head pattern_out$$
 This argument has prototype
@@ -148,7 +149,8 @@ This is used by the optimizer to obtain the correct dependency relations.
 
 \param internal_bool
 If this is true, calculations are done with sets represented by a vector
-of boolean values. Otherwise, a vector of standard sets is used.
+of boolean values. Otherwise, a vector of standard sets is used
+(a hybrid_setvec if hybrid_sparsity_ is true and a list_setvec otherwise).
 
 \param pattern_out
 The value of transpose is false (true),
@@ -221,6 +223,37 @@ void ADFun<Base,RecBase>::rev_jac_sparsity(
             ! transpose, ind_taddr_, internal_jac, pattern_out
         );
     }
+    else if( hybrid_sparsity_ )
+    {   // allocate memory for hybrid sparsity calculation
+        // (sparsity pattern is emtpy after a resize)
+        local::sparse::hybrid_setvec internal_jac;
+        internal_jac.resize(num_var_tape_, ell);
+        //
+        // set sparsity patttern for dependent variables
+        local::sparse::set_internal_pattern(
+            zero_empty            ,
+            input_empty           ,
+            ! transpose           ,
+            dep_taddr_            ,
+            internal_jac          ,
+            pattern_in
+        );
+
+        // compute sparsity for other variables
+        local::sweep::rev_jac<addr_t>(
+            &play_,
+            dependency,
+            n,
+            num_var_tape_,
+            internal_jac,
+            not_used_rec_base
+
+        );
+        // get sparstiy pattern for independent variables
+        local::sparse::get_internal_pattern(
+            ! transpose, ind_taddr_, internal_jac, pattern_out
+        );
+    }
     else
     {   // allocate memory for bool sparsity calculation
         // (sparsity pattern is emtpy after a resize)
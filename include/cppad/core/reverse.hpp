@@ -137,10 +137,11 @@ BaseVector ADFun<Base,RecBase>::Reverse(size_t q, const BaseVector &w)
     );
 
     // initialize entire Partial matrix to zero
-    local::pod_vector_maybe<Base> Partial(num_var_tape_ * q);
-    for(i = 0; i < num_var_tape_; i++)
-        for(j = 0; j < q; j++)
-            Partial[i * q + j] = zero;
+    // (reverse_partial_ keeps its memory between calls to Reverse)
+    reverse_partial_.resize(num_var_tape_ * q);
+    Base* Partial = reverse_partial_.data();
+    for(i = 0; i < num_var_tape_ * q; i++)
+        Partial[i] = zero;
 
     // set the dependent variable direction
     // (use += because two dependent variables can point to same location)
@@ -158,21 +159,33 @@ BaseVector ADFun<Base,RecBase>::Reverse(size_t q, const BaseVector &w)
     // evaluate the derivatives
     CPPAD_ASSERT_UNKNOWN( cskip_op_.size() == play_.num_op_rec() );
     CPPAD_ASSERT_UNKNOWN( load_op2var_.size()  == play_.num_var_load_rec() );
-    local::play::const_sequential_iterator play_itr = play_.end();
-    local::sweep::reverse(
-        q - 1,
-        n,
-        num_var_tape_,
-        &play_,
-        cap_order_taylor_,
-        taylor_.data(),
-        q,
-        Partial.data(),
-        cskip_op_.data(),
-        load_op2var_,
-        play_itr,
-        not_used_rec_base
-    );
+    // check if we can use the compiled code
+    bool use_jit = jit_ && q == 1;
+    if( use_jit && ! jit_fun_.setup_done() )
+        jit_fun_.setup(&play_);
+    use_jit &= jit_fun_.ok();
+    if( use_jit )
+    {   jit_fun_.reverse_one(
+            &play_, cap_order_taylor_, taylor_.data(), Partial
+        );
+    }
+    else
+    {   local::play::const_sequential_iterator play_itr = play_.end();
+        local::sweep::reverse(
+            q - 1,
+            n,
+            num_var_tape_,
+            &play_,
+            cap_order_taylor_,
+            taylor_.data(),
+            q,
+            Partial,
+            cskip_op_.data(),
+            load_op2var_,
+            play_itr,
+            not_used_rec_base
+        );
+    }
 
     // return the derivative values
     BaseVector value(n * q);
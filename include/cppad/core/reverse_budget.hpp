@@ -0,0 +1,203 @@
+# ifndef CPPAD_CORE_REVERSE_BUDGET_HPP
+# define CPPAD_CORE_REVERSE_BUDGET_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin reverse_budget$$
+$spell
+    const
+    dw
+    nan
+    Taylor
+    inuse
+$$
+$section First Order Reverse Mode Using a Memory Budget$$
+
+$head Syntax$$
+$icode%dw% = %f%.reverse_budget(%max_bytes%, %x%, %w%)%$$
+
+$head Purpose$$
+We use $latex F : \B{R}^n \rightarrow \B{R}^m$$ to denote the
+$cref/AD function/glossary/AD Function/$$ corresponding to $icode f$$.
+This routine computes the same derivative as
+$codei%
+    %f%.Forward(0, %x%)
+    %dw% = %f%.Reverse(1, %w%)
+%$$
+see $cref reverse_one$$.
+Those routines store the value, and the partial derivative,
+of every variable in the operation sequence at the same time.
+For very large operation sequences this memory may not be available.
+This routine instead stores the values of a subset of the variables
+(checkpoints) during the forward sweep.
+The reverse sweep recomputes the other values one segment of the operation
+sequence at a time.
+This reduces the memory at the cost of evaluating the operation sequence
+twice in zero order forward mode.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    ADFun<%Base%> %f%
+%$$
+If this routine does not use $code Forward$$ and $code Reverse$$
+(see $cref/Restrictions/reverse_budget/Restrictions/$$),
+the Taylor coefficients stored in $icode f$$ are not affected.
+
+$head max_bytes$$
+This argument has prototype
+$codei%
+    size_t %max_bytes%
+%$$
+It is the number of bytes that this routine should use for
+storing values and partials; i.e., the increase in
+$cref/thread_alloc::inuse/ta_inuse/$$ during this operation.
+The segments are made smaller until this bound is satisfied,
+or making them smaller does not reduce the memory; e.g.,
+because most of the variables must be checkpoints.
+The memory used for $icode x$$, $icode w$$ and $icode dw$$
+is not included in this bound.
+
+$head x$$
+This argument has prototype
+$codei%
+    const %BaseVector%& %x%
+%$$
+and size $icode n$$.
+It is the argument value at which the derivative is computed.
+
+$head w$$
+This argument has prototype
+$codei%
+    const %BaseVector%& %w%
+%$$
+and size $icode m$$.
+It specifies the weighting for the dependent variables.
+
+$head dw$$
+The return value $icode dw$$ has prototype
+$codei%
+    %BaseVector% %dw%
+%$$
+and size $icode n$$.
+It is the derivative of $latex w^\R{T} F(x)$$ with respect to $icode x$$.
+
+$head BaseVector$$
+The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$head Comparison Operators$$
+Comparison operators are not evaluated by this routine, so
+$cref/compare_change/compare_change/$$ is not affected by this operation.
+
+$head Restrictions$$
+If the operation sequence contains $cref VecAD$$ or $cref atomic$$
+operations, this routine uses $codei%%f%.Forward(0, %x%)%$$ and
+$codei%%f%.Reverse(1, %w%)%$$ to compute $icode dw$$
+(the result is the same, but the memory is not bounded).
+
+$head check_for_nan$$
+If $cref check_for_nan$$ is true (the default) and
+$code NDEBUG$$ is not defined,
+it is an error for $icode dw$$ to contain a $code nan$$.
+
+$head Example$$
+$children%
+    example/general/reverse_budget.cpp
+%$$
+The file
+$cref reverse_budget.cpp$$
+contains an example and test of this operation.
+
+$end
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file reverse_budget.hpp
+First order reverse mode using a bounded amount of memory.
+*/
+
+/*!
+First order reverse mode using a bounded amount of memory.
+
+\tparam BaseVector
+is a Simple Vector class with elements of type Base.
+
+\param max_bytes
+bound for the number of bytes used to store values and partials.
+
+\param x
+value of the independent variables.
+
+\param w
+weights for the dependent variables.
+
+\return
+derivative of w^T F(x) with respect to x.
+*/
+template <class Base, class RecBase>
+template <class BaseVector>
+BaseVector ADFun<Base,RecBase>::reverse_budget(
+    size_t max_bytes, const BaseVector& x, const BaseVector& w
+)
+{   // number of independent and dependent variables
+    size_t n = ind_taddr_.size();
+    size_t m = dep_taddr_.size();
+    //
+    // check Vector is Simple Vector class with Base type elements
+    CheckSimpleVector<Base, BaseVector>();
+    //
+    CPPAD_ASSERT_KNOWN(
+        size_t(x.size()) == n,
+        "reverse_budget: size of x not equal domain dimension for f"
+    );
+    CPPAD_ASSERT_KNOWN(
+        size_t(w.size()) == m,
+        "reverse_budget: size of w not equal range dimension for f"
+    );
+    //
+    // The independent variables have index 1, ..., n
+    for(size_t j = 0; j < n; ++j)
+        CPPAD_ASSERT_UNKNOWN( ind_taddr_[j] == j + 1 );
+    //
+    // copy the arguments so that BaseVector need not have a data function
+    local::pod_vector_maybe<Base> x_vec(n), w_vec(m), dw_vec(n);
+    for(size_t j = 0; j < n; ++j)
+        x_vec[j] = x[j];
+    for(size_t i = 0; i < m; ++i)
+        w_vec[i] = w[i];
+    //
+    BaseVector dw(n);
+    bool ok = local::sweep::reverse_budget(
+        &play_, max_bytes,
+        n, x_vec.data(), m, dep_taddr_.data(), w_vec.data(), dw_vec.data()
+    );
+    if( ok )
+    {   for(size_t j = 0; j < n; ++j)
+            dw[j] = dw_vec[j];
+    }
+    else
+    {   // operators that are not supported by sweep::reverse_budget
+        Forward(0, x);
+        dw = Reverse(1, w);
+    }
+    CPPAD_ASSERT_KNOWN( ! ( check_for_nan_ && hasnan(dw) ),
+        "dw = f.reverse_budget(max_bytes, x, w): has a nan."
+    );
+    return dw;
+}
+
+} // END_CPPAD_NAMESPACE
+
+# endif
@@ -0,0 +1,167 @@
+# ifndef CPPAD_CORE_SHARE_OP_SEQ_HPP
+# define CPPAD_CORE_SHARE_OP_SEQ_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin share_op_seq$$
+$spell
+    const
+    op
+    seq
+    Taylor
+$$
+
+$section Share an Operation Sequence Between ADFun Objects$$
+
+$head Syntax$$
+$icode%g%.share_op_seq(%f%)%$$
+
+$head Purpose$$
+The assignment $icode%g% = %f%$$ makes a separate copy of the
+operation sequence in $icode f$$.
+When each thread uses its own $code ADFun$$ object, this multiplies
+the memory used to store the operation sequence by the number of threads.
+This routine instead has $icode g$$ use the same operation sequence
+as $icode f$$ (the operation sequence is not copied).
+Each of the objects $icode f$$ and $icode g$$ has its own
+Taylor coefficients, so they can be used by different threads
+at the same time.
+
+$head f$$
+The object $icode f$$ has prototype
+$codei%
+    const ADFun<%Base%> %f%
+%$$
+
+$head g$$
+The object $icode g$$ has prototype
+$codei%
+    ADFun<%Base%> %g%
+%$$
+Upon return it has the same operation sequence, and the same
+$cref/dynamic parameter/new_dynamic/$$ values, as $icode f$$.
+There are no Taylor coefficients stored in $icode g$$; i.e.,
+$cref/g.size_order()/size_order/$$ is zero.
+None of the sparsity patterns stored in $icode f$$ are copied to $icode g$$.
+
+$head Dynamic Parameters$$
+The values of the dynamic parameters are not shared.
+Calling $cref new_dynamic$$ for $icode g$$ does not change the
+dynamic parameter values in $icode f$$ (and vice versa).
+
+$head New Operation Sequence$$
+If a new operation sequence is stored in $icode f$$ or $icode g$$,
+using $cref Dependent$$, $cref optimize$$, assignment,
+or another $code share_op_seq$$,
+only that object changes.
+The other objects that were sharing its previous operation sequence
+continue to use it.
+
+$head Parallel Mode$$
+This routine must be called in sequential execution mode; see
+$cref/in_parallel/ta_in_parallel/$$.
+In addition, an object that shares its operation sequence can
+only be deleted, or get a new operation sequence, in sequential mode.
+The first use of $cref subgraph_reverse$$ or $cref subgraph_jac_rev$$
+for a shared operation sequence must also be in sequential mode.
+
+$head Example$$
+$children%
+    example/general/share_op_seq.cpp
+%$$
+The file $cref share_op_seq.cpp$$
+contains an example and test of this operation.
+The file $cref multi_sparse_jac.cpp$$ uses this operation to
+give each thread its own $code ADFun$$ object.
+
+$end
+----------------------------------------------------------------------------
+*/
+
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file share_op_seq.hpp
+Share an operation sequence between ADFun objects.
+*/
+/*!
+Use the same operation sequence as another ADFun object.
+
+\param f
+is the function object that contains the operation sequence.
+Only the player is shared, the Taylor coefficients, sparsity patterns,
+and other information that changes during evaluation are not.
+*/
+template <class Base, class RecBase>
+void ADFun<Base,RecBase>::share_op_seq(const ADFun& f)
+{   CPPAD_ASSERT_KNOWN(
+        ! thread_alloc::in_parallel() ,
+        "share_op_seq: called in parallel mode"
+    );
+    // go through member variables in ad_fun.hpp order
+    //
+    // string objects
+    function_name_             = f.function_name_;
+    //
+    // bool objects
+    base2ad_return_value_      = false;
+    has_been_optimized_        = f.has_been_optimized_;
+    check_for_nan_             = f.check_for_nan_;
+    forward_direct_            = f.forward_direct_;
+    jit_                       = f.jit_;
+    hybrid_sparsity_           = f.hybrid_sparsity_;
+    //
+    // size_t objects
+    compare_change_count_      = f.compare_change_count_;
+    compare_change_number_     = 0;
+    compare_change_op_index_   = 0;
+    num_order_taylor_          = 0;
+    cap_order_taylor_          = 0;
+    num_direction_taylor_      = 0;
+    num_var_tape_              = f.num_var_tape_;
+    //
+    // pod_vector objects
+    ind_taddr_                 = f.ind_taddr_;
+    dep_taddr_                 = f.dep_taddr_;
+    dep_parameter_             = f.dep_parameter_;
+    cskip_op_.resize( f.play_.num_op_rec() );
+    load_op2var_.resize( f.play_.num_var_load_rec() );
+    //
+    // pod_vector_maybe_vectors
+    taylor_.clear();
+    reverse_partial_.clear();
+    subgraph_partial_.clear();
+    //
+    // player
+    play_.share( f.play_ );
+    direct_sweep_.clear();
+    jit_fun_.clear();
+    //
+    // subgraph
+    subgraph_info_.resize(
+        ind_taddr_.size(),   // n_ind
+        dep_taddr_.size(),   // n_dep
+        play_.num_op_rec(),  // n_op
+        play_.num_var_rec()  // n_var
+    );
+    //
+    // sparse_pack
+    for_jac_sparse_pack_.resize(0, 0);
+    //
+    // sparse_list
+    for_jac_sparse_set_.resize(0, 0);
+    //
+    // sparse_hybrid
+    for_jac_sparse_hybrid_.resize(0, 0);
+}
+
+} // END_CPPAD_NAMESPACE
+# endif
@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_SPARSE_HES_HPP
 # define CPPAD_CORE_SPARSE_HES_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -27,6 +27,7 @@ $spell
     colpack
     cmake
     Jacobian
+    jac
 $$
 
 $section Computing Sparse Hessians$$
@@ -35,6 +36,9 @@ $head Syntax$$
 $icode%n_sweep% = %f%.sparse_hes(
     %x%, %w%, %subset%, %pattern%, %coloring%, %work%
 )%$$
+$icode%n_sweep% = %f%.sparse_hes(
+    %x%, %w%, %subset%, %pattern%, %coloring%, %work%, %n_part%, %i_part%
+)%$$
 
 $head Purpose$$
 We use $latex F : \B{R}^n \rightarrow \B{R}^m$$ to denote the
@@ -153,6 +157,27 @@ This is the same as the sparse Jacobian
 $cref/cppad/sparse_jac/coloring/cppad/$$ method
 which does not take advantage of symmetry.
 
+$subhead cppad.star$$
+This is a star coloring of the graph corresponding to the
+Hessian sparsity pattern; i.e., indices connected by an edge have
+different colors and every path with four indices uses at least three
+colors.
+Each entry of the Hessian is computed directly from one sweep.
+It is the same type of coloring as $code colpack.symmetric$$
+but it does not require $cref colpack_prefix$$.
+
+$subhead cppad.acyclic$$
+This is an acyclic coloring of the graph corresponding to the
+Hessian sparsity pattern; i.e., indices connected by an edge have
+different colors and every cycle uses at least three colors.
+The entries of the Hessian are recovered by substitution
+using the results for all the colors.
+It usually requires fewer sweeps than $code cppad.star$$,
+but each substitution subtracts values which may result in
+more rounding error.
+In addition, it is an error to use this coloring with
+$icode%n_part% > 1%$$.
+
 $subhead colpack.symmetric$$
 If $cref colpack_prefix$$ was specified on the
 $cref/cmake command/cmake/CMake Command/$$ line,
@@ -190,6 +215,36 @@ for $icode f$$ and the sparsity pattern in $icode subset$$ are the same.
 If either of these values change, use $icode%work%.clear()%$$ to
 empty this structure.
 
+$head n_part$$
+This argument has prototype
+$codei%
+    size_t %n_part%
+%$$
+and must be greater than zero.
+The colors are partitioned into $icode n_part$$ parts.
+If $icode n_part$$ is not present, it is one; i.e.,
+all the colors are in one part.
+
+$head i_part$$
+This argument has prototype
+$codei%
+    size_t %i_part%
+%$$
+and must be less than $icode n_part$$.
+Only the elements of $icode subset$$ that correspond
+to colors in part $icode i_part$$ are set by this call.
+The other elements of $icode%subset%.val()%$$ are not modified.
+If $icode i_part$$ is not present, it is zero.
+
+$head Multi-Threading$$
+Calls with the same $icode n_part$$ and different values of $icode i_part$$
+can be made by different threads at the same time.
+The conditions for this are the same as for
+$cref/sparse_jac/sparse_jac/Multi-Threading/$$
+where the argument $icode w$$ can also be shared by all the threads.
+The file $cref multi_sparse_hes.cpp$$ is an example
+and timing test for this case.
+
 $head n_sweep$$
 The return value $icode n_sweep$$ has prototype
 $codei%
@@ -218,11 +273,14 @@ All the other forward mode coefficients are unspecified.
 
 $head Example$$
 $children%
-    example/sparse/sparse_hes.cpp
+    example/sparse/sparse_hes.cpp%
+    example/sparse/star_acyclic_hes.cpp
 %$$
 The files $cref sparse_hes.cpp$$
 is an example and test of $code sparse_hes$$.
 It returns $code true$$, if it succeeds, and $code false$$ otherwise.
+The file $cref star_acyclic_hes.cpp$$ is an example and test
+of the $code cppad.star$$ and $code cppad.acyclic$$ colorings.
 
 $head Subset Hessian$$
 The routine
@@ -257,6 +315,9 @@ class sparse_hes_work {
         CppAD::vector<size_t> order;
         /// results of the coloring algorithm
         CppAD::vector<size_t> color;
+        /// information used to recover the Hessian by substitution
+        /// (only used by the cppad.acyclic coloring)
+        local::color_substitution substitution;
 
         /// constructor
         sparse_hes_work(void)
@@ -268,6 +329,7 @@ class sparse_hes_work {
             col.clear();
             order.clear();
             color.clear();
+            substitution.clear();
         }
 };
 // ----------------------------------------------------------------------------
@@ -304,8 +366,8 @@ where m is number of dependent variables in f.
 
 \param coloring
 determines which coloring algorithm is used.
-This must be cppad.symmetric, cppad.general, colpack.symmetic,
-or colpack.star.
+This must be cppad.symmetric, cppad.general, cppad.star, cppad.acyclic,
+colpack.symmetic, or colpack.star.
 
 \param work
 this structure must be empty, or contain the information stored
@@ -313,9 +375,17 @@ by a previous call to sparse_hes.
 The previous call must be for the same ADFun object f
 and the same subset.
 
+\param n_part
+number of parts that the colors are partitioned into.
+
+\param i_part
+index of the part of the colors computed by this call.
+Only the elements of subset corresponding to these colors are set.
+
 \return
 This is the number of first order forward
-(and second order reverse) sweeps used to compute thhe Hessian.
+(and second order reverse) sweeps used to compute thhe Hessian
+(for all the parts).
 */
 template <class Base, class RecBase>
 template <class SizeVector, class BaseVector>
@@ -325,7 +395,9 @@ size_t ADFun<Base,RecBase>::sparse_hes(
     sparse_rcv<SizeVector , BaseVector>& subset   ,
     const sparse_rc<SizeVector>&         pattern  ,
     const std::string&                   coloring ,
-    sparse_hes_work&                     work     )
+    sparse_hes_work&                     work     ,
+    size_t                               n_part   ,
+    size_t                               i_part   )
 {   size_t n = Domain();
     //
     CPPAD_ASSERT_KNOWN(
@@ -344,6 +416,10 @@ size_t ADFun<Base,RecBase>::sparse_hes(
         size_t( w.size() ) == Range(),
         "sparse_hes: w.size() not equal range dimension for f"
     );
+    CPPAD_ASSERT_KNOWN(
+        i_part < n_part,
+        "sparse_hes: i_part is not less than n_part"
+    );
     //
     // work information
     vector<size_t>& row(work.row);
@@ -395,6 +471,10 @@ size_t ADFun<Base,RecBase>::sparse_hes(
     // check for case where input work is empty
     if( color.size() == 0 )
     {   // compute work color and order vectors
+        CPPAD_ASSERT_KNOWN(
+            ! thread_alloc::in_parallel(),
+            "sparse_hes: work is empty and in parallel mode"
+        );
         CPPAD_ASSERT_KNOWN(
             pattern.nr() == n,
             "sparse_hes: pattern.nr() not equal domain dimension for f"
@@ -434,6 +514,17 @@ size_t ADFun<Base,RecBase>::sparse_hes(
             local::color_general_cppad(internal_pattern, col, row, color);
         else if( coloring == "cppad.symmetric" )
             local::color_symmetric_cppad(internal_pattern, col, row, color);
+        else if( coloring == "cppad.star" )
+            local::color_star_cppad(internal_pattern, col, row, color);
+        else if( coloring == "cppad.acyclic" )
+        {   CPPAD_ASSERT_KNOWN(
+                n_part == 1,
+                "sparse_hes: coloring = cppad.acyclic and n_part > 1"
+            );
+            local::color_acyclic_cppad(
+                internal_pattern, col, row, color, work.substitution
+            );
+        }
         else if( coloring == "colpack.general" )
         {
 # if CPPAD_HAS_COLPACK
@@ -481,26 +572,66 @@ size_t ADFun<Base,RecBase>::sparse_hes(
     for(size_t j = 0; j < n; j++) if( color[j] < n )
         n_color = std::max(n_color, color[j] + 1);
     //
-    // initialize the return Hessian values as zero
-    for(size_t k = 0; k < K; k++)
-        subset.set(k, zero);
-    //
     // direction vector for calls to first order forward
     BaseVector dx(n);
     //
     // return values for calls to second order reverse
     BaseVector ddw(2 * n);
     //
-    // loop over colors
-    size_t k = 0;
-    for(size_t ell = 0; ell < n_color; ell++)
+    // acyclic coloring: recover the Hessian by substitution
+    const local::color_substitution& substitution( work.substitution );
+    if( substitution.n_color() > 0 )
+    {   CPPAD_ASSERT_KNOWN(
+            n_part == 1,
+            "sparse_hes: work was computed using coloring = cppad.acyclic "
+            "and n_part > 1"
+        );
+        CppAD::vector<Base> acc, val;
+        for(size_t ell = 0; ell < substitution.n_color(); ell++)
+        {   for(size_t j = 0; j < n; j++)
+            {   dx[j] = zero;
+                if( color[j] == ell )
+                    dx[j] = one;
+            }
+            Forward(1, dx);
+            ddw = Reverse(2, w);
+            substitution.set_color(ell, ddw, acc);
+        }
+        substitution.solve(acc, val);
+        for(size_t k = 0; k < K; k++)
+            subset.set(k, substitution.value(k, acc, val) );
+        return substitution.n_color();
+    }
+    //
+    // colors in this part are color_begin, ..., color_end - 1
+    size_t color_begin = i_part * n_color / n_part;
+    size_t color_end   = (i_part + 1) * n_color / n_part;
+    //
+    // first index in subset (in color order) for this part
+    size_t k_begin = 0;
+    while( k_begin < K && color[ col[ order[k_begin] ] ] < color_begin )
+        ++k_begin;
+    //
+    // initialize the return Hessian values for this part as zero
+    for(size_t k = k_begin; k < K; ++k)
+    {   if( color[ col[ order[k] ] ] >= color_end )
+            break;
+        subset.set(order[k], zero);
+    }
+    //
+    // loop over colors in this part
+    size_t k = k_begin;
+    for(size_t ell = color_begin; ell < color_end; ell++)
     if( k  == K )
     {   // kludge because colpack returns colors that are not used
         // (it does not know about the subset corresponding to row, col)
+        // (the cppad.star coloring may also have colors that are only
+        // used for reading values)
         CPPAD_ASSERT_UNKNOWN(
             coloring == "colpack.general" ||
             coloring == "colpack.symmetric" ||
-            coloring == "colpack.star"
+            coloring == "colpack.star" ||
+            coloring == "cppad.star"
         );
     }
     else if( color[ col[ order[k] ] ] != ell )
@@ -509,7 +640,8 @@ size_t ADFun<Base,RecBase>::sparse_hes(
         CPPAD_ASSERT_UNKNOWN(
             coloring == "colpack.general" ||
             coloring == "colpack.symmetic" ||
-            coloring == "colpack.star"
+            coloring == "colpack.star" ||
+            coloring == "cppad.star"
         );
     }
     else
@@ -534,8 +666,8 @@ size_t ADFun<Base,RecBase>::sparse_hes(
             k++;
         }
     }
-    // check that all the required entries have been set
-    CPPAD_ASSERT_UNKNOWN( k == K );
+    // check that all the required entries for this part have been set
+    CPPAD_ASSERT_UNKNOWN( k == K || color[ col[ order[k] ] ] >= color_end );
     return n_color;
 }
 
@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_SPARSE_HESSIAN_HPP
 # define CPPAD_CORE_SPARSE_HESSIAN_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -216,6 +216,20 @@ This is the same as the $code "cppad"$$ method for the
 $cref/sparse_jacobian/sparse_jacobian/work/color_method/$$ calculation.
 $codei%
 
+"cppad.star"
+%$$
+This is the same as the
+$cref/cppad.star/sparse_hes/coloring/cppad.star/$$ method for the
+$code sparse_hes$$ calculation.
+$codei%
+
+"cppad.acyclic"
+%$$
+This is the same as the
+$cref/cppad.acyclic/sparse_hes/coloring/cppad.acyclic/$$ method for the
+$code sparse_hes$$ calculation.
+$codei%
+
 "colpack.symmetric"
 %$$
 This method requires that
@@ -344,6 +358,9 @@ class sparse_hessian_work {
         CppAD::vector<size_t> order;
         /// results of the coloring algorithm
         CppAD::vector<size_t> color;
+        /// information used to recover the Hessian by substitution
+        /// (only used by the cppad.acyclic coloring)
+        local::color_substitution substitution;
 
         /// constructor
         sparse_hessian_work(void) : color_method("cppad.symmetric")
@@ -355,6 +372,7 @@ class sparse_hessian_work {
             col.clear();
             order.clear();
             color.clear();
+            substitution.clear();
         }
 };
 // ===========================================================================
@@ -480,6 +498,12 @@ size_t ADFun<Base,RecBase>::SparseHessianCompute(
             local::color_general_cppad(sparsity, row, col, color);
         else if( work.color_method == "cppad.symmetric" )
             local::color_symmetric_cppad(sparsity, row, col, color);
+        else if( work.color_method == "cppad.star" )
+            local::color_star_cppad(sparsity, row, col, color);
+        else if( work.color_method == "cppad.acyclic" )
+            local::color_acyclic_cppad(
+                sparsity, row, col, color, work.substitution
+            );
         else if( work.color_method == "colpack.general" )
         {
 # if CPPAD_HAS_COLPACK
@@ -533,6 +557,26 @@ size_t ADFun<Base,RecBase>::SparseHessianCompute(
     // location for return values from reverse (columns of the Hessian)
     BaseVector ddw(2 * n);
 
+    // acyclic coloring: recover the Hessian by substitution
+    const local::color_substitution& substitution( work.substitution );
+    if( substitution.n_color() > 0 )
+    {   CppAD::vector<Base> acc, val;
+        for(ell = 0; ell < substitution.n_color(); ell++)
+        {   for(i = 0; i < n; i++)
+            {   u[i] = zero;
+                if( color[i] == ell )
+                    u[i] = one;
+            }
+            Forward(1, u);
+            ddw = Reverse(2, w);
+            substitution.set_color(ell, ddw, acc);
+        }
+        substitution.solve(acc, val);
+        for(k = 0; k < K; k++)
+            hes[k] = substitution.value(k, acc, val);
+        return substitution.n_color();
+    }
+
     // initialize the return value
     for(k = 0; k < K; k++)
         hes[k] = zero;
@@ -549,7 +593,8 @@ size_t ADFun<Base,RecBase>::SparseHessianCompute(
         CPPAD_ASSERT_UNKNOWN(
             coloring == "colpack.general" ||
             coloring == "colpack.symmetic" ||
-            coloring == "colpack.star"
+            coloring == "colpack.star" ||
+            coloring == "cppad.star"
         );
     }
     else if( color[ row[ order[k] ] ] != ell )
@@ -558,7 +603,8 @@ size_t ADFun<Base,RecBase>::SparseHessianCompute(
         CPPAD_ASSERT_UNKNOWN(
             coloring == "colpack.general" ||
             coloring == "colpack.symmetic" ||
-            coloring == "colpack.star"
+            coloring == "colpack.star" ||
+            coloring == "cppad.star"
         );
     }
     else
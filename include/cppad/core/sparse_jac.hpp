@@ -28,6 +28,7 @@ $spell
     Cppad
     Colpack
     cmake
+    alloc
 $$
 
 $section Computing Sparse Jacobians$$
@@ -40,6 +41,13 @@ $icode%n_color% = %f%.sparse_jac_for(
 $icode%n_color% = %f%.sparse_jac_rev(
     %x%, %subset%, %pattern%, %coloring%, %work%
 )%$$
+$icode%n_color% = %f%.sparse_jac_for(
+    %group_max%, %x%, %subset%, %pattern%, %coloring%, %work%, %n_part%, %i_part%
+)
+%$$
+$icode%n_color% = %f%.sparse_jac_rev(
+    %x%, %subset%, %pattern%, %coloring%, %work%, %n_part%, %i_part%
+)%$$
 
 $head Purpose$$
 We use $latex F : \B{R}^n \rightarrow \B{R}^m$$ to denote the
@@ -171,6 +179,54 @@ for $icode f$$ and the sparsity pattern in $icode subset$$ are the same.
 If any of these values change, use $icode%work%.clear()%$$ to
 empty this structure.
 
+$head n_part$$
+This argument has prototype
+$codei%
+    size_t %n_part%
+%$$
+and must be greater than zero.
+The colors are partitioned into $icode n_part$$ parts
+(for $code sparse_jac_for$$,
+a group of colors is never split between parts).
+If $icode n_part$$ is not present, it is one; i.e.,
+all the colors are in one part.
+
+$head i_part$$
+This argument has prototype
+$codei%
+    size_t %i_part%
+%$$
+and must be less than $icode n_part$$.
+Only the elements of $icode subset$$ that correspond
+to colors in part $icode i_part$$ are set by this call.
+The other elements of $icode%subset%.val()%$$ are not modified.
+If $icode i_part$$ is not present, it is zero.
+
+$head Multi-Threading$$
+Calls with the same $icode n_part$$ and different values of $icode i_part$$
+can be made by different threads at the same time; see
+$cref/in_parallel/ta_in_parallel/$$.
+In this case:
+
+$list number$$
+Each thread must use its own copy of $icode f$$
+(because the Taylor coefficients in $icode f$$ are changed).
+The copies must be made in sequential mode.
+$lnext
+The arguments $icode x$$, $icode subset$$, $icode pattern$$, and
+$icode work$$ can be shared by all the threads.
+Each thread sets a different subset of the elements of
+$icode%subset%.val()%$$.
+$lnext
+The argument $icode work$$ must not be empty;
+i.e., the coloring must have been computed by a previous call in
+sequential mode.
+$lend
+The memory used for each thread's Taylor coefficients is
+allocated by that thread using $cref thread_alloc$$.
+The file $cref multi_sparse_jac.cpp$$ is an example
+and timing test for this case.
+
 $head n_color$$
 The return value $icode n_color$$ has prototype
 $codei%
@@ -283,9 +339,16 @@ by a previous call to sparse_jac_for.
 The previous call must be for the same ADFun object f
 and the same subset.
 
+\param n_part
+number of parts that the groups of colors are partitioned into.
+
+\param i_part
+index of the part of the groups of colors computed by this call.
+Only the elements of subset corresponding to these colors are set.
+
 \return
 This is the number of first order forward sweeps used to compute
-the Jacobian.
+the Jacobian (for all the parts).
 */
 template <class Base, class RecBase>
 template <class SizeVector, class BaseVector>
@@ -295,7 +358,9 @@ size_t ADFun<Base,RecBase>::sparse_jac_for(
     sparse_rcv<SizeVector, BaseVector>&  subset     ,
     const sparse_rc<SizeVector>&         pattern    ,
     const std::string&                   coloring   ,
-    sparse_jac_work&                     work       )
+    sparse_jac_work&                     work       ,
+    size_t                               n_part     ,
+    size_t                               i_part     )
 {   size_t m = Range();
     size_t n = Domain();
     //
@@ -307,6 +372,14 @@ size_t ADFun<Base,RecBase>::sparse_jac_for(
         subset.nc() == n,
         "sparse_jac_for: subset.nc() not equal domain dimension for f"
     );
+    CPPAD_ASSERT_KNOWN(
+        group_max > 0,
+        "sparse_jac_for: group_max is zero"
+    );
+    CPPAD_ASSERT_KNOWN(
+        i_part < n_part,
+        "sparse_jac_for: i_part is not less than n_part"
+    );
     //
     // row and column vectors in subset
     const SizeVector& row( subset.row() );
@@ -333,6 +406,10 @@ size_t ADFun<Base,RecBase>::sparse_jac_for(
     // check for case where input work is empty
     if( color.size() == 0 )
     {   // compute work color and order vectors
+        CPPAD_ASSERT_KNOWN(
+            ! thread_alloc::in_parallel(),
+            "sparse_jac_for: work is empty and in parallel mode"
+        );
         CPPAD_ASSERT_KNOWN(
             pattern.nr() == m,
             "sparse_jac_for: pattern.nr() not equal range dimension for f"
@@ -392,18 +469,33 @@ size_t ADFun<Base,RecBase>::sparse_jac_for(
     for(size_t j = 0; j < n; j++) if( color[j] < n )
         n_color = std::max(n_color, color[j] + 1);
     //
-    // initialize the return Jacobian values as zero
-    for(size_t k = 0; k < K; k++)
-        subset.set(k, zero);
+    // colors in this part are color_begin, ..., color_end - 1
+    size_t n_group     = (n_color + group_max - 1) / group_max;
+    size_t color_begin = (i_part * n_group / n_part) * group_max;
+    size_t color_end   = ((i_part + 1) * n_group / n_part) * group_max;
+    color_begin        = std::min(color_begin, n_color);
+    color_end          = std::min(color_end, n_color);
+    //
+    // first index in subset (in color order) for this part
+    size_t k_begin = 0;
+    while( k_begin < K && color[ col[ order[k_begin] ] ] < color_begin )
+        ++k_begin;
+    //
+    // initialize the return Jacobian values for this part as zero
+    for(size_t k = k_begin; k < K; ++k)
+    {   if( color[ col[ order[k] ] ] >= color_end )
+            break;
+        subset.set(order[k], zero);
+    }
     //
     // index in subset
-    size_t k = 0;
+    size_t k = k_begin;
     // number of colors computed so far
-    size_t color_count = 0;
+    size_t color_count = color_begin;
     //
-    while( color_count < n_color )
+    while( color_count < color_end )
     {   // number of colors that will be in this group
-        size_t group_size = std::min(group_max, n_color - color_count);
+        size_t group_size = std::min(group_max, color_end - color_count);
         //
         // forward mode values for independent and dependent variables
         BaseVector dx(n * group_size), dy(m * group_size);
@@ -435,7 +527,7 @@ size_t ADFun<Base,RecBase>::sparse_jac_for(
         // advance color count
         color_count += group_size;
     }
-    CPPAD_ASSERT_UNKNOWN( color_count == n_color );
+    CPPAD_ASSERT_UNKNOWN( color_count == color_end );
     //
     return n_color;
 }
@@ -477,9 +569,16 @@ by a previous call to sparse_jac_rev.
 The previous call must be for the same ADFun object f
 and the same subset.
 
+\param n_part
+number of parts that the colors are partitioned into.
+
+\param i_part
+index of the part of the colors computed by this call.
+Only the elements of subset corresponding to these colors are set.
+
 \return
 This is the number of first order reverse sweeps used to compute
-the Jacobian.
+the Jacobian (for all the parts).
 */
 template <class Base, class RecBase>
 template <class SizeVector, class BaseVector>
@@ -488,7 +587,9 @@ size_t ADFun<Base,RecBase>::sparse_jac_rev(
     sparse_rcv<SizeVector, BaseVector>&  subset   ,
     const sparse_rc<SizeVector>&         pattern  ,
     const std::string&                   coloring ,
-    sparse_jac_work&                     work     )
+    sparse_jac_work&                     work     ,
+    size_t                               n_part   ,
+    size_t                               i_part   )
 {   size_t m = Range();
     size_t n = Domain();
     //
@@ -500,6 +601,10 @@ size_t ADFun<Base,RecBase>::sparse_jac_rev(
         subset.nc() == n,
         "sparse_jac_rev: subset.nc() not equal domain dimension for f"
     );
+    CPPAD_ASSERT_KNOWN(
+        i_part < n_part,
+        "sparse_jac_rev: i_part is not less than n_part"
+    );
     //
     // row and column vectors in subset
     const SizeVector& row( subset.row() );
@@ -526,6 +631,10 @@ size_t ADFun<Base,RecBase>::sparse_jac_rev(
     // check for case where input work is empty
     if( color.size() == 0 )
     {   // compute work color and order vectors
+        CPPAD_ASSERT_KNOWN(
+            ! thread_alloc::in_parallel(),
+            "sparse_jac_rev: work is empty and in parallel mode"
+        );
         CPPAD_ASSERT_KNOWN(
             pattern.nr() == m,
             "sparse_jac_rev: pattern.nr() not equal range dimension for f"
@@ -584,16 +693,28 @@ size_t ADFun<Base,RecBase>::sparse_jac_rev(
     for(size_t i = 0; i < m; i++) if( color[i] < m )
         n_color = std::max(n_color, color[i] + 1);
     //
-    // initialize the return Jacobian values as zero
-    for(size_t k = 0; k < K; k++)
-        subset.set(k, zero);
+    // colors in this part are color_begin, ..., color_end - 1
+    size_t color_begin = i_part * n_color / n_part;
+    size_t color_end   = (i_part + 1) * n_color / n_part;
+    //
+    // first index in subset (in color order) for this part
+    size_t k_begin = 0;
+    while( k_begin < K && color[ row[ order[k_begin] ] ] < color_begin )
+        ++k_begin;
+    //
+    // initialize the return Jacobian values for this part as zero
+    for(size_t k = k_begin; k < K; ++k)
+    {   if( color[ row[ order[k] ] ] >= color_end )
+            break;
+        subset.set(order[k], zero);
+    }
     //
     // weighting vector and return values for calls to Reverse
     BaseVector w(m), dw(n);
     //
-    // loop over colors
-    size_t k = 0;
-    for(size_t ell = 0; ell < n_color; ell++)
+    // loop over colors in this part
+    size_t k = k_begin;
+    for(size_t ell = color_begin; ell < color_end; ell++)
     if( k  == K )
     {   // kludge because colpack returns colors that are not used
         // (it does not know about the subset corresponding to row, col)
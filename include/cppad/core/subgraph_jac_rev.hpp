@@ -1,7 +1,7 @@
 # ifndef CPPAD_CORE_SUBGRAPH_JAC_REV_HPP
 # define CPPAD_CORE_SUBGRAPH_JAC_REV_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-18 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -27,6 +27,7 @@ $spell
     const
     Bool
     nnz
+    alloc
 $$
 
 $section Compute Sparse Jacobians Using Subgraphs$$
@@ -34,6 +35,8 @@ $section Compute Sparse Jacobians Using Subgraphs$$
 $head Syntax$$
 $icode%f%.subgraph_jac_rev(%x%, %subset%)
 %$$
+$icode%f%.subgraph_jac_rev(%x%, %subset%, %n_part%, %i_part%)
+%$$
 $icode%f%.subgraph_jac_rev(
     %select_domain%, %select_range%, %x%, %matrix_out%
 )%$$
@@ -120,6 +123,58 @@ $icode%subset%.val()%$$ do not matter.
 Upon return it contains the value of the corresponding elements
 of the Jacobian.
 
+$head n_part$$
+This argument has prototype
+$codei%
+    size_t %n_part%
+%$$
+and must be greater than zero.
+The rows of $icode subset$$ that have non-zero entries are
+partitioned into $icode n_part$$ parts, each with about the same
+number of rows.
+If $icode n_part$$ is not present, it is one; i.e.,
+all the rows are in one part.
+
+$head i_part$$
+This argument has prototype
+$codei%
+    size_t %i_part%
+%$$
+and must be less than $icode n_part$$.
+Only the elements of $icode subset$$ that are in rows in part
+$icode i_part$$ are set by this call.
+The other elements of $icode%subset%.val()%$$ are not modified.
+If $icode i_part$$ is not present, it is zero.
+
+$head Multi-Threading$$
+Calls with the same $icode n_part$$ and different values of $icode i_part$$
+can be made by different threads at the same time; see
+$cref/in_parallel/ta_in_parallel/$$.
+In this case:
+
+$list number$$
+Each thread must use its own copy of $icode f$$
+(because the Taylor coefficients and the subgraph information
+in $icode f$$ are changed).
+The copies can share the operation sequence; see
+$cref/share_op_seq/multi_thread/share_op_seq/$$.
+They must be made in sequential mode.
+$lnext
+The first use of subgraphs for the shared operation sequence,
+for example a call to $code subgraph_jac_rev$$ without $icode n_part$$,
+must be in sequential mode.
+$lnext
+The arguments $icode x$$ and $icode subset$$
+can be shared by all the threads.
+Each thread sets a different subset of the elements of
+$icode%subset%.val()%$$, so the result does not depend on the
+number of threads.
+$lend
+The memory used for each thread's Taylor coefficients and subgraphs is
+allocated by that thread using $cref thread_alloc$$.
+The file $cref multi_subgraph_jac.cpp$$ is an example
+and timing test for this case.
+
 $head select_domain$$
 The argument $icode select_domain$$ has prototype
 $codei%
@@ -199,15 +254,27 @@ a vector of length n, the number of independent variables in f
 specifices the subset of the sparsity pattern where the Jacobian is evaluated.
 subset.nr() == m,
 subset.nc() == n.
+
+\param n_part
+number of parts that the rows of subset are partitioned into.
+
+\param i_part
+only the elements of subset in rows that are in this part are set.
 */
 template <class Base, class RecBase>
 template <class SizeVector, class BaseVector>
 void ADFun<Base,RecBase>::subgraph_jac_rev(
     const BaseVector&                   x      ,
-    sparse_rcv<SizeVector, BaseVector>& subset )
+    sparse_rcv<SizeVector, BaseVector>& subset ,
+    size_t                              n_part ,
+    size_t                              i_part )
 {   size_t m = Range();
     size_t n = Domain();
     //
+    CPPAD_ASSERT_KNOWN(
+        i_part < n_part,
+        "subgraph_jac_rev: i_part is not less than n_part"
+    );
     CPPAD_ASSERT_KNOWN(
         subset.nr() == m,
         "subgraph_jac_rev: subset.nr() not equal range dimension for f"
@@ -226,12 +293,36 @@ void ADFun<Base,RecBase>::subgraph_jac_rev(
     const SizeVector& col( subset.col() );
     SizeVector row_major = subset.row_major();
     //
+    // number of rows with entries in subset
+    size_t n_row = 0;
+    for(size_t k = 0; k < nnz; k++)
+    {   if( k == 0 || row[ row_major[k] ] != row[ row_major[k-1] ] )
+            ++n_row;
+    }
+    //
+    // [k_begin, k_end) are the indices in row_major for this part
+    size_t row_begin = i_part * n_row / n_part;
+    size_t row_end   = (i_part + 1) * n_row / n_part;
+    size_t k_begin   = nnz;
+    size_t k_end     = nnz;
+    size_t i_row     = 0;
+    for(size_t k = 0; k < nnz; k++)
+    {   if( k > 0 && row[ row_major[k] ] != row[ row_major[k-1] ] )
+            ++i_row;
+        if( i_row == row_begin && k_begin == nnz )
+            k_begin = k;
+        if( i_row == row_end )
+        {   k_end = k;
+            break;
+        }
+    }
+    //
     // determine set of independent variabels
     local::pod_vector<bool> select_domain(n);
     for(size_t j = 0; j < n; j++)
         select_domain[j] = false;
-    for(size_t k = 0; k < nnz; k++)
-        select_domain[ col[k] ] = true;
+    for(size_t k = k_begin; k < k_end; k++)
+        select_domain[ col[ row_major[k] ] ] = true;
     //
     // initialize reverse mode computation on subgraphs
     subgraph_reverse(select_domain);
@@ -241,39 +332,30 @@ void ADFun<Base,RecBase>::subgraph_jac_rev(
     SizeVector dw_col;
     //
     // initialize index in row_major
-    size_t k = 0;
+    size_t k = k_begin;
     Base zero(0);
-    while(k < nnz )
-    {   size_t q   = 1;
+    while(k < k_end )
+    {   size_t q     = 1;
         size_t i_dep = row[ row_major[k] ];
-        size_t i_ind = col[ row_major[k] ];
-        size_t ell   = i_dep;
-        subgraph_reverse(q, ell, dw_col, dw);
+        subgraph_reverse(q, i_dep, dw_col, dw);
         //
         size_t c = 0;
-        while( i_dep == ell )
+        while( k < k_end && row[ row_major[k] ] == i_dep )
         {   // row numbers match
+            size_t i_ind = col[ row_major[k] ];
             //
             // advance c to possible match with column i_ind
             while( c < size_t( dw_col.size() ) && dw_col[c] < i_ind )
                 ++c;
             //
             // check for match with i_ind
-            if( i_ind == dw_col[c] )
+            if( c < size_t( dw_col.size() ) && i_ind == dw_col[c] )
                 subset.set( row_major[k], dw[i_ind] );
             else
                 subset.set( row_major[k], zero);
             //
             // advance to next (i_dep, i_ind)
             ++k;
-            if( k == nnz )
-            {   i_dep = m;
-                i_ind = n;
-            }
-            else
-            {   i_dep = row[ row_major[k] ];
-                i_ind = col[ row_major[k] ];
-            }
         }
     }
     return;
@@ -0,0 +1,281 @@
+# ifndef CPPAD_CORE_TAPE_CACHE_HPP
+# define CPPAD_CORE_TAPE_CACHE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin tape_cache$$
+$spell
+    const
+    Taylor
+    retape
+    ipopt
+$$
+
+$section Cache of Recordings Keyed by Comparison Results$$
+
+$head Syntax$$
+$codei%tape_cache<%Base%, %RecBase%> %cache%(%max_tape%)
+%$$
+$icode%f% = %cache%.forward(%record%, %x%, %y%)
+%$$
+$icode%n_tape% = %cache%.size()
+%$$
+$icode%n_hit% = %cache%.n_hit()
+%$$
+$icode%n_miss% = %cache%.n_miss()
+%$$
+$icode%cache%.clear()
+%$$
+
+$head Purpose$$
+If the control flow in a function depends on the value of its argument,
+an $cref ADFun$$ recording is only valid for arguments that give the same
+results for the comparisons made during the recording.
+Re-recording the function for every new argument is expensive.
+This object keeps several recordings and returns one that is valid
+for the current argument.
+A new recording is made only when none of the cached recordings is valid.
+
+$head Branch Pattern$$
+The key for each recording is its branch pattern; i.e., the results of
+the $cref/comparison operators/Compare/$$ during the recording.
+These results are stored in the operation sequence
+(see $cref/record_compare/Independent/record_compare/$$).
+A recording is valid for $icode x$$ if
+$cref/compare_change_number/compare_change/number/$$ is zero
+after a zero order forward sweep at $icode x$$.
+Control flow that depends on $icode x$$ without using an
+$codei%AD<%Base%>%$$ comparison (for example using $cref Integer$$ or
+$cref Value$$) is not detected and must not be used with this cache.
+
+$head Base$$
+is the base type for the recordings.
+
+$head RecBase$$
+is the $cref/RecBase/ADFun/$$ type for the recordings.
+This argument is optional and its default value is $icode Base$$.
+
+$head max_tape$$
+This argument has prototype
+$codei%
+    size_t %max_tape%
+%$$
+and is the maximum number of recordings in the cache.
+It must be greater than zero.
+When the cache is full and a new recording is made,
+the least recently used recording is replaced.
+This argument is optional and its default value is ten.
+
+$head record$$
+The object $icode record$$ supports the syntax
+$codei%
+    %record%(%g%, %x%)
+%$$
+where $icode g$$ has type $codei%ADFun<%Base%, %RecBase%>&%$$.
+It must use $icode x$$ for the value of the independent variables,
+record the function, and store the recording in $icode g$$.
+The comparison operators must be recorded; i.e.,
+$icode record_compare$$ must be true in the call to $code Independent$$.
+
+$head x$$
+This argument has prototype
+$codei%
+    const %BaseVector%& %x%
+%$$
+and is the argument value for the function.
+The type $icode BaseVector$$ must be a $cref SimpleVector$$ class with
+$cref/elements of type/SimpleVector/Elements of Specified Type/$$
+$icode Base$$.
+
+$head y$$
+This argument has prototype
+$codei%
+    %BaseVector%& %y%
+%$$
+and its input value does not matter.
+Upon return it is the value of the function at $icode x$$.
+
+$head f$$
+The return value has prototype
+$codei%
+    ADFun<%Base%, %RecBase%>& %f%
+%$$
+It is a recording in the cache that is valid for $icode x$$
+and its zero order Taylor coefficients correspond to $icode x$$.
+It remains valid until the next call to $icode%cache%.forward%$$
+or $icode%cache%.clear%$$.
+
+$head size$$
+The return value $icode n_tape$$ is the number of recordings
+currently in the cache.
+
+$head n_hit$$
+The return value $icode n_hit$$ is the number of calls to
+$icode%cache%.forward%$$ that did not require a new recording.
+
+$head n_miss$$
+The return value $icode n_miss$$ is the number of calls to
+$icode%cache%.forward%$$ that made a new recording.
+
+$head clear$$
+This removes all the recordings from the cache
+and sets the hit and miss counts to zero.
+
+$head ipopt$$
+The $cref/TapeCache/ipopt_solve/options/TapeCache/$$ option uses
+this cache when $code ipopt::solve$$ retapes for each new $icode x$$.
+
+$head Example$$
+$children%
+    example/general/tape_cache.cpp
+%$$
+The file $cref tape_cache.cpp$$ contains an example and test
+of this class.
+
+$end
+------------------------------------------------------------------------------
+*/
+namespace CppAD { // BEGIN_CPPAD_NAMESPACE
+/*!
+\file tape_cache.hpp
+Cache of ADFun recordings that are valid for different branch patterns.
+*/
+
+/*!
+Cache of ADFun recordings keyed by the comparison results during recording.
+
+\tparam Base
+base type for the recordings.
+
+\tparam RecBase
+RecBase type for the recordings.
+*/
+template <class Base, class RecBase = Base>
+class tape_cache {
+public:
+    /// type of the recordings in the cache
+    typedef ADFun<Base, RecBase> fun_type;
+private:
+    /// storage for the recordings, fun_[order_[k]] is valid for k < n_tape_
+    vector<fun_type> fun_;
+    /// indices in fun_ with the most recently used recording first
+    vector<size_t>   order_;
+    /// number of recordings in the cache
+    size_t           n_tape_;
+    /// number of calls to forward that used a recording in the cache
+    size_t           n_hit_;
+    /// number of calls to forward that made a new recording
+    size_t           n_miss_;
+    //
+    /// move order_[k] to the front of order_
+    void move_to_front(size_t k)
+    {   size_t index = order_[k];
+        for(size_t ell = k; ell > 0; --ell)
+            order_[ell] = order_[ell - 1];
+        order_[0] = index;
+    }
+public:
+    /*!
+    Constructor
+
+    \param max_tape
+    maximum number of recordings in the cache.
+    */
+    tape_cache(size_t max_tape = 10)
+    : fun_(max_tape), order_(max_tape), n_tape_(0), n_hit_(0), n_miss_(0)
+    {   CPPAD_ASSERT_KNOWN(
+            max_tape > 0,
+            "tape_cache: max_tape is zero"
+        );
+        for(size_t k = 0; k < max_tape; ++k)
+            order_[k] = k;
+    }
+    /*!
+    Evaluate the function using a recording that is valid for x.
+
+    \param record
+    function object that records the function at x using record(g, x).
+
+    \param x
+    argument value for the function.
+
+    \param y
+    the input value does not matter. Upon return it is the function value.
+
+    \return
+    is a recording that is valid for x.
+    Its zero order Taylor coefficients correspond to x.
+    */
+    template <class Record, class BaseVector>
+    fun_type& forward(Record& record, const BaseVector& x, BaseVector& y)
+    {   // check BaseVector is Simple Vector class with Base elements
+        CheckSimpleVector<Base, BaseVector>();
+        //
+        // check the recordings, most recently used first
+        for(size_t k = 0; k < n_tape_; ++k)
+        {   fun_type& f( fun_[ order_[k] ] );
+            CPPAD_ASSERT_KNOWN(
+                size_t( x.size() ) == f.Domain(),
+                "tape_cache: x.size() is not equal to the domain size "
+                "of a previous recording"
+            );
+            f.compare_change_count(1);
+            y = f.Forward(0, x);
+            if( f.compare_change_number() == 0 )
+            {   ++n_hit_;
+                move_to_front(k);
+                return fun_[ order_[0] ];
+            }
+        }
+        //
+        // make a new recording, replacing the least recently used one
+        ++n_miss_;
+        if( n_tape_ < size_t( order_.size() ) )
+            ++n_tape_;
+        move_to_front(n_tape_ - 1);
+        fun_type& f( fun_[ order_[0] ] );
+        record(f, x);
+        CPPAD_ASSERT_KNOWN(
+            size_t( x.size() ) == f.Domain(),
+            "tape_cache: x.size() is not equal to the domain size "
+            "of the new recording"
+        );
+        f.compare_change_count(1);
+        y = f.Forward(0, x);
+        CPPAD_ASSERT_KNOWN(
+            f.compare_change_number() == 0,
+            "tape_cache: new recording is not valid at its argument"
+        );
+        return f;
+    }
+    /// number of recordings in the cache
+    size_t size(void) const
+    {   return n_tape_; }
+    /// number of calls to forward that used a recording in the cache
+    size_t n_hit(void) const
+    {   return n_hit_; }
+    /// number of calls to forward that made a new recording
+    size_t n_miss(void) const
+    {   return n_miss_; }
+    /// remove all the recordings and zero the statistics
+    void clear(void)
+    {   fun_type empty;
+        for(size_t k = 0; k < size_t( fun_.size() ); ++k)
+            fun_[k] = empty;
+        n_tape_ = 0;
+        n_hit_  = 0;
+        n_miss_ = 0;
+    }
+};
+
+} // END_CPPAD_NAMESPACE
+# endif
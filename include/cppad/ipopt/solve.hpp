@@ -123,6 +123,23 @@ will tape the operation sequence at the value
 of $icode xi$$ and use that sequence for the entire optimization process.
 The default value is $code false$$.
 
+$subhead TapeCache$$
+You can set the maximum number of cached operation sequences
+with the following syntax:
+$codei%
+    TapeCache %value%
+%$$
+If $icode value$$ is greater than zero and $icode Retape$$ is true,
+the operation sequence for a new $icode x$$ is only recorded
+when none of the previous $icode value$$ operation sequences has
+the same comparison results at $icode x$$; see $cref tape_cache$$.
+This can be much faster than retaping when the control flow in
+$icode fg_eval$$ depends on $icode x$$ through $codei%AD<double>%$$
+comparisons.
+It must not be used if the control flow depends on $icode x$$ in any other
+way.
+The default value is zero (no cache).
+
 $subhead Sparse$$
 You can set the sparse Jacobian and Hessian flag with the following syntax:
 $codei%
@@ -439,6 +456,7 @@ Ipopt options (are optional) and have one of the following forms
 The following other possible options are listed below:
 \code
     Retape   value
+    TapeCache value
 \endcode
 
 
@@ -499,6 +517,7 @@ void solve(
     size_t begin_1, end_1, begin_2, end_2, begin_3, end_3;
     begin_1     = 0;
     bool retape          = false;
+    size_t max_tape      = 0;
     bool sparse_forward  = false;
     bool sparse_reverse  = false;
     while( begin_1 < options.size() )
@@ -555,6 +574,14 @@ void solve(
             );
             retape = (tok_2 == "true");
         }
+        else if( tok_1 == "TapeCache" )
+        {   int value = std::atoi( tok_2.c_str() );
+            CPPAD_ASSERT_KNOWN(
+                value >= 0,
+                "ipopt::solve: TapeCache value is less than zero"
+            );
+            max_tape = size_t( value );
+        }
         else if( tok_1 == "Sparse" )
         {   CPPAD_ASSERT_KNOWN(
                 (tok_2 == "true") | (tok_2 == "false") ,
@@ -587,7 +614,7 @@ void solve(
             CPPAD_ASSERT_KNOWN(
             false,
             "ipopt::solve: First token is not one of\n"
-            "Retape, Sparse, String, Numeric, Integer"
+            "Retape, TapeCache, Sparse, String, Numeric, Integer"
         );
 
         begin_1 = end_3;
@@ -628,6 +655,7 @@ void solve(
         gu,
         fg_eval,
         retape,
+        max_tape,
         sparse_forward,
         sparse_reverse,
         solution
@@ -1,7 +1,7 @@
 # ifndef CPPAD_IPOPT_SOLVE_CALLBACK_HPP
 # define CPPAD_IPOPT_SOLVE_CALLBACK_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-16 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -51,6 +51,25 @@ private:
     typedef Ipopt::Index                          Index;
     /// Indexing style used in Ipopt sparsity structure
     typedef Ipopt::TNLP::IndexStyleEnum           IndexStyleEnum;
+    /// Records x -> [ f(x), g(x) ] for use by tape_cache_
+    class record_fg {
+    private:
+        FG_eval&     fg_eval_;
+        const size_t nx_;
+        const size_t nfg_;
+    public:
+        record_fg(FG_eval& fg_eval, size_t nx, size_t nfg)
+        : fg_eval_(fg_eval), nx_(nx), nfg_(nfg)
+        { }
+        void operator()(CppAD::ADFun<double>& g, const Dvector& x)
+        {   ADvector a_x(nx_), a_fg(nfg_);
+            for(size_t i = 0; i < nx_; i++)
+                a_x[i] = x[i];
+            CppAD::Independent(a_x);
+            fg_eval_(a_fg, a_x);
+            g.Dependent(a_x, a_fg);
+        }
+    };
     // ------------------------------------------------------------------
     // Values directly passed in to constuctor
     // ------------------------------------------------------------------
@@ -76,6 +95,9 @@ private:
     FG_eval&                        fg_eval_;
     /// should operation sequence be retaped for each new x.
     bool                            retape_;
+    /// if retape is true and this is non-zero, maximum number of
+    /// operation sequences in tape_cache_.
+    size_t                          max_tape_;
     /// Should sparse methods be used to compute Jacobians and Hessians
     /// with forward mode used for Jacobian.
     bool                            sparse_forward_;
@@ -91,6 +113,12 @@ private:
     /// If retape is false, this object is initialzed by constructor
     /// otherwise it is set by cache_new_x each time it is called.
     CppAD::ADFun<double>            adfun_;
+    /// operation sequences for x -> [ f(x), g(x) ] with different
+    /// comparison results (only used when retape_ and max_tape_ > 0).
+    CppAD::tape_cache<double>       tape_cache_;
+    /// the function object currently in use; i.e., adfun_ or
+    /// an element of tape_cache_.
+    CppAD::ADFun<double>*           fun_;
     /// value of x corresponding to previous new_x
     Dvector                         x0_;
     /// value of fg corresponding to previous new_x
@@ -144,8 +172,10 @@ private:
     \par fg0_
     the elements of this vector are set to the new value for [f(x), g(x)]
 
-    \par adfun_
-    If retape is true, the operation sequence for this function
+    \par fun_
+    If retape is true and max_tape is non-zero, fun_ is set to an
+    operation sequence in tape_cache_ that is valid for x.
+    Otherwise, if retape is true, the operation sequence for adfun_
     is changes to correspond to the argument x.
     If retape is false, the operation sequence is not changed.
     The zero order Taylor coefficients for this function are set
@@ -153,6 +183,14 @@ private:
     */
     void cache_new_x(const Number* x)
     {   size_t i;
+        if( retape_ && max_tape_ > 0 )
+        {   // only record if no cached operation sequence is valid for x
+            for(i = 0; i < nx_; i++)
+                x0_[i] = x[i];
+            record_fg record(fg_eval_, nx_, nf_ + ng_);
+            fun_ = &tape_cache_.forward(record, x0_, fg0_);
+            return;
+        }
         if( retape_ )
         {   // make adfun_, as well as x0_ and fg0_ correspond to this x
             ADvector a_x(nx_), a_fg(nf_ + ng_);
@@ -206,6 +244,10 @@ public:
     \param retape
     should the operation sequence be retaped for each argument value.
 
+    \param max_tape
+    if retape is true and this is non-zero, it is the maximum number
+    of operation sequences that are cached; see tape_cache.
+
     \param sparse_forward
     should sparse matrix computations be used for Jacobians and Hessians
     with forward mode for Jacobian.
@@ -229,6 +271,7 @@ public:
         const Dvector&         gu              ,
         FG_eval&               fg_eval         ,
         bool                   retape          ,
+        size_t                 max_tape        ,
         bool                   sparse_forward  ,
         bool                   sparse_reverse  ,
         solve_result<Dvector>& solution ) :
@@ -242,9 +285,12 @@ public:
     gu_ ( gu ),
     fg_eval_ ( fg_eval ),
     retape_ ( retape ),
+    max_tape_ ( max_tape ),
     sparse_forward_ ( sparse_forward ),
     sparse_reverse_ ( sparse_reverse ),
-    solution_ ( solution )
+    solution_ ( solution ),
+    tape_cache_ ( max_tape > 0 ? max_tape : 1 ),
+    fun_ ( &adfun_ )
     {   CPPAD_ASSERT_UNKNOWN( ! ( sparse_forward_ & sparse_reverse_ ) );
 
         size_t i, j;
@@ -296,7 +342,7 @@ public:
                     {   for(j = 0; j < n_column; j++)
                             r[i * n_column + j] = (i == i_column + j);
                     }
-                    s = adfun_.ForSparseJac(n_column, r);
+                    s = fun_->ForSparseJac(n_column, r);
 
                     // fill in the corresponding columns of total_sparsity
                     for(i = 0; i < m; i++)
@@ -328,7 +374,7 @@ public:
                     {   for(j = 0; j < m; j++)
                             r[i * m + j] = (i_row + i ==  j);
                     }
-                    s = adfun_.RevSparseJac(n_row, r);
+                    s = fun_->RevSparseJac(n_row, r);
 
                     // fill in correspoding rows of total sparsity
                     for(i = 0; i < n_row; i++)
@@ -346,7 +392,7 @@ public:
                 {   for(j = 0; j < m; j++)
                         s[i * m + j] = (i == j);
                 }
-                pattern_jac_ = adfun_.RevSparseJac(m, s);
+                pattern_jac_ = fun_->RevSparseJac(m, s);
             }
             */
             // Set row and column indices in Jacoian of [f(x), g(x)]
@@ -387,12 +433,12 @@ public:
                 {   for(j = 0; j < n_column; j++)
                         r[i * n_column + j] = (i == i_column + j);
                 }
-                adfun_.ForSparseJac(n_column, r);
+                fun_->ForSparseJac(n_column, r);
 
                 // sparsity pattern corresponding to paritls w.r.t. (theta, u)
                 // of partial w.r.t. the selected columns
                 bool transpose = true;
-                h = adfun_.RevSparseHes(n_column, s, transpose);
+                h = fun_->RevSparseHes(n_column, s, transpose);
 
                 // fill in the corresponding columns of total_sparsity
                 for(i = 0; i < nx_; i++)
@@ -675,7 +721,7 @@ public:
             w[i] = 1.0;
         for(i = 0; i < ng_; i++)
             w[nf_ + i] = 0.0;
-        dw = adfun_.Reverse(1, w);
+        dw = fun_->Reverse(1, w);
         for(i = 0; i < nx_; i++)
             grad_f[i] = dw[i];
         return true;
@@ -815,7 +861,7 @@ public:
         //
         if( sparse_forward_ )
         {   Dvector jac(nk);
-            adfun_.SparseJacobianForward(
+            fun_->SparseJacobianForward(
                 x0_ , pattern_jac_, row_jac_, col_jac_, jac, work_jac_
             );
             for(k = 0; k < nk; k++)
@@ -823,7 +869,7 @@ public:
         }
         else if( sparse_reverse_ )
         {   Dvector jac(nk);
-            adfun_.SparseJacobianReverse(
+            fun_->SparseJacobianReverse(
                 x0_ , pattern_jac_, row_jac_, col_jac_, jac, work_jac_
             );
             for(k = 0; k < nk; k++)
@@ -840,7 +886,7 @@ public:
             for(j = 0; j < nx_; j++)
             {   // compute j-th column of Jacobian of g(x)
                 x1[j] = 1.0;
-                fg1 = adfun_.Forward(1, x1);
+                fg1 = fun_->Forward(1, x1);
                 while( ell < nk && col_jac_[k] <= j )
                 {   CPPAD_ASSERT_UNKNOWN( col_jac_[k] == j );
                     i = row_jac_[k];
@@ -865,7 +911,7 @@ public:
             for(i = nf_; i < nfg; i++)
             {   // compute i-th row of Jacobian of g(x)
                 w[i] = 1.0;
-                dw = adfun_.Reverse(1, w);
+                dw = fun_->Reverse(1, w);
                 while( k < nk && row_jac_[k] <= i )
                 {   CPPAD_ASSERT_UNKNOWN( row_jac_[k] == i );
                     j = col_jac_[k];
@@ -1001,7 +1047,7 @@ public:
         //
         if( sparse_forward_ | sparse_reverse_ )
         {   Dvector hes(nk);
-            adfun_.SparseHessian(
+            fun_->SparseHessian(
                 x0_, w, pattern_hes_, row_hes_, col_hes_, hes, work_hes_
             );
             for(k = 0; k < nk; k++)
@@ -1009,7 +1055,7 @@ public:
         }
         else
         {   Dvector hes(nx_ * nx_);
-            hes = adfun_.Hessian(x0_, w);
+            hes = fun_->Hessian(x0_, w);
             for(k = 0; k < nk; k++)
             {   i = row_hes_[k];
                 j = col_hes_[k];
@@ -2,9 +2,11 @@
 # define CPPAD_LOCAL_COLOR_SYMMETRIC_HPP
 # include <cppad/configure.hpp>
 # include <cppad/local/cppad_colpack.hpp>
+# include <algorithm>
+# include <map>
 
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-17 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -304,6 +306,667 @@ void color_symmetric_colpack(
 # endif // CPPAD_HAS_COLPACK
 }
 
+// --------------------------------------------------------------------------
+/*!
+Adjacency graph used by the star and acyclic coloring algorithms.
+
+\tparam SetVector
+is a vector_of_sets class.
+
+\param pattern [in]
+Is a representation of the sparsity pattern for a symmetric matrix.
+
+\param row [in]
+is a vector specifying which row indices to compute.
+
+\param col [in]
+is a vector, with the same size as row,
+that specifies which column indices to compute.
+
+\param active [out]
+The input size and value of its elements does not matter.
+Upon return it has size m and active[i] is true if
+index i appears in row or col.
+
+\param adj_begin [out]
+The input size and value of its elements does not matter.
+Upon return it has size m+1.
+
+\param adj [out]
+The input size and value of its elements does not matter.
+Upon return, for each active index i, the neighbors of i are
+<code>adj[k]</code> for k = adj_begin[i], ... , adj_begin[i+1]-1.
+These are the active indices j != i such that (i, j) or (j, i)
+is in the sparsity pattern, in increasing order.
+Indices that are not active do not have any neighbors.
+*/
+template <class SetVector>
+void color_symmetric_graph(
+    const SetVector&        pattern   ,
+    const vector<size_t>&   row       ,
+    const vector<size_t>&   col       ,
+    vector<bool>&           active    ,
+    vector<size_t>&         adj_begin ,
+    vector<size_t>&         adj       )
+{   size_t K = row.size();
+    size_t m = pattern.n_set();
+    CPPAD_ASSERT_UNKNOWN( m == pattern.end() );
+    CPPAD_ASSERT_UNKNOWN( col.size() == K );
+    //
+    // indices that need to be colored
+    active.resize(m);
+    for(size_t i = 0; i < m; ++i)
+        active[i] = false;
+    for(size_t k = 0; k < K; ++k)
+    {   CPPAD_ASSERT_UNKNOWN( pattern.is_element(row[k], col[k]) );
+        active[ row[k] ] = true;
+        active[ col[k] ] = true;
+    }
+    //
+    // upper bound for number of neighbors of each index
+    // (each off-diagonal entry is counted for its row and column)
+    vector<size_t> count(m);
+    for(size_t i = 0; i < m; ++i)
+        count[i] = 0;
+    for(size_t i = 0; i < m; ++i) if( active[i] )
+    {   typename SetVector::const_iterator itr(pattern, i);
+        size_t j = *itr;
+        while( j != pattern.end() )
+        {   if( active[j] && j != i )
+            {   ++count[i];
+                ++count[j];
+            }
+            j = *(++itr);
+        }
+    }
+    adj_begin.resize(m + 1);
+    adj_begin[0] = 0;
+    for(size_t i = 0; i < m; ++i)
+        adj_begin[i+1] = adj_begin[i] + count[i];
+    //
+    // neighbors with possible duplicates
+    vector<size_t> nbr( adj_begin[m] );
+    for(size_t i = 0; i < m; ++i)
+        count[i] = adj_begin[i];
+    for(size_t i = 0; i < m; ++i) if( active[i] )
+    {   typename SetVector::const_iterator itr(pattern, i);
+        size_t j = *itr;
+        while( j != pattern.end() )
+        {   if( active[j] && j != i )
+            {   nbr[ count[i]++ ] = j;
+                nbr[ count[j]++ ] = i;
+            }
+            j = *(++itr);
+        }
+    }
+    //
+    // sort and remove duplicates
+    adj.resize( adj_begin[m] );
+    size_t n_adj = 0;
+    for(size_t i = 0; i < m; ++i)
+    {   size_t* first = nbr.data() + adj_begin[i];
+        size_t* last  = nbr.data() + adj_begin[i+1];
+        std::sort(first, last);
+        last          = std::unique(first, last);
+        adj_begin[i]  = n_adj;
+        while( first != last )
+            adj[n_adj++] = *first++;
+    }
+    adj_begin[m] = n_adj;
+    adj.resize(n_adj);
+}
+// --------------------------------------------------------------------------
+/*!
+CppAD star coloring algorithm for determining which rows of a symmetric
+sparse matrix can be computed together.
+
+\copydetails CppAD::local::color_symmetric_cppad
+
+\par Star Coloring
+Two indices i1 != i2 with (i1, i2) in the sparsity pattern have
+different colors, and every path of length three in the graph
+of the sparsity pattern uses at least three colors.
+This is a greedy algorithm that colors the indices in order of
+decreasing number of neighbors.
+Each entry can be computed directly from the rows with one color
+(possibly after reflection).
+*/
+template <class SetVector>
+void color_star_cppad(
+    const SetVector&        pattern   ,
+    CppAD::vector<size_t>&  row       ,
+    CppAD::vector<size_t>&  col       ,
+    CppAD::vector<size_t>&  color     )
+{   size_t K = row.size();
+    size_t m = pattern.n_set();
+    CPPAD_ASSERT_UNKNOWN( color.size() == m );
+    //
+    // graph for the indices that need to be colored
+    vector<bool>   active;
+    vector<size_t> adj_begin, adj;
+    color_symmetric_graph(pattern, row, col, active, adj_begin, adj);
+    //
+    // order the indices by decreasing number of neighbors
+    vector<size_t> key(m), order(m);
+    for(size_t i = 0; i < m; ++i)
+        key[i] = m - (adj_begin[i+1] - adj_begin[i]);
+    CppAD::index_sort(key, order);
+    //
+    // n_nbr[i][c] is the number of colored neighbors of i with color c
+    vector< std::map<size_t, size_t> > n_nbr(m);
+    std::map<size_t, size_t>::const_iterator itr;
+    //
+    // forbidden[c] == v if color c is forbidden for index v
+    vector<size_t> forbidden(m + 1);
+    for(size_t c = 0; c <= m; ++c)
+        forbidden[c] = m;
+    //
+    for(size_t i = 0; i < m; ++i)
+        color[i] = m;
+    for(size_t o = 0; o < m; ++o) if( active[ order[o] ] )
+    {   size_t v = order[o];
+        for(size_t k1 = adj_begin[v]; k1 < adj_begin[v+1]; ++k1)
+        {   size_t w = adj[k1];
+            size_t b = color[w];
+            if( b < m )
+            {   // distance one neighbors have different colors
+                forbidden[b] = v;
+                //
+                // v has another neighbor with color b
+                itr = n_nbr[v].find(b);
+                bool v_two = itr != n_nbr[v].end() && itr->second >= 2;
+                //
+                for(size_t k2 = adj_begin[w]; k2 < adj_begin[w+1]; ++k2)
+                {   size_t x = adj[k2];
+                    if( x != v && color[x] < m )
+                    {   // path v, w, x, y with color[y] == color[w]
+                        itr = n_nbr[x].find(b);
+                        bool x_two = itr->second >= 2;
+                        //
+                        // path u, v, w, x with color[u] == color[w]
+                        if( v_two || x_two )
+                            forbidden[ color[x] ] = v;
+                    }
+                }
+            }
+        }
+        // use the smallest color that is not forbidden
+        size_t c = 0;
+        while( forbidden[c] == v )
+            ++c;
+        color[v] = c;
+        for(size_t k1 = adj_begin[v]; k1 < adj_begin[v+1]; ++k1)
+            ++n_nbr[ adj[k1] ][c];
+    }
+    //
+    // determine which sparsity entries need to be reflected
+    for(size_t k = 0; k < K; ++k)
+    {   size_t i = row[k];
+        size_t j = col[k];
+        if( i != j )
+        {   // (i, j) is computed directly using color[i] if j does not
+            // have another neighbor with the same color as i
+            itr = n_nbr[j].find( color[i] );
+            CPPAD_ASSERT_UNKNOWN( itr != n_nbr[j].end() );
+            if( itr->second > 1 )
+            {   row[k] = j;
+                col[k] = i;
+# ifndef NDEBUG
+                itr = n_nbr[i].find( color[j] );
+                CPPAD_ASSERT_UNKNOWN( itr->second == 1 );
+# endif
+            }
+        }
+    }
+    return;
+}
+// --------------------------------------------------------------------------
+/*!
+Information used to recover a symmetric matrix, from the products
+with one direction for each color of an acyclic coloring, by substitution.
+
+An accumulator corresponds to an index r and a color c.
+It is initialized as the r-th component of the product of the matrix
+with the sum of the unit vectors for indices with color c.
+Each substitution step solves for one off-diagonal entry using an
+accumulator that has only one unknown entry left,
+and then subtracts that entry from another accumulator.
+*/
+class color_substitution {
+private:
+    /// number of colors
+    size_t n_color_;
+    /// accumulators for color c are acc_begin_[c], ..., acc_begin_[c+1]-1
+    vector<size_t> acc_begin_;
+    /// index r in the product vector for each accumulator
+    vector<size_t> acc_row_;
+    /// accumulator that is equal to the entry solved for by each step
+    vector<size_t> step_acc_;
+    /// accumulator that the entry is subtracted from by each step
+    vector<size_t> step_sub_;
+    /// for each requested entry, index of the step that solves for it,
+    /// or number of steps plus accumulator index for diagonal entries
+    vector<size_t> entry_;
+public:
+    /// constructor
+    color_substitution(void) : n_color_(0)
+    { }
+    /// number of colors (zero if this information is empty)
+    size_t n_color(void) const
+    {   return n_color_; }
+    /// empty this information
+    void clear(void)
+    {   n_color_ = 0;
+        acc_begin_.clear();
+        acc_row_.clear();
+        step_acc_.clear();
+        step_sub_.clear();
+        entry_.clear();
+    }
+    /*!
+    Set the accumulators for one color.
+
+    \param c
+    is the color.
+
+    \param ddw
+    is the return value from second order reverse mode after
+    first order forward mode in the direction corresponding to color c.
+    The product of the matrix with this direction is
+    ddw[2*r+1] for r = 0, ..., m-1.
+
+    \param acc
+    is the vector of accumulators.
+    */
+    template <class BaseVector, class Base>
+    void set_color(
+        size_t c, const BaseVector& ddw, vector<Base>& acc
+    ) const
+    {   CPPAD_ASSERT_UNKNOWN( c < n_color_ );
+        acc.resize( acc_row_.size() );
+        for(size_t a = acc_begin_[c]; a < acc_begin_[c+1]; ++a)
+            acc[a] = ddw[ 2 * acc_row_[a] + 1 ];
+    }
+    /*!
+    Solve for the entries by substitution.
+
+    \param acc
+    is the vector of accumulators after set_color was called for
+    every color. It is modified by this routine.
+
+    \param val
+    The input size and value of its elements does not matter.
+    Upon return it contains the value solved for by each step.
+    */
+    template <class Base>
+    void solve(vector<Base>& acc, vector<Base>& val) const
+    {   size_t n_step = step_acc_.size();
+        val.resize(n_step);
+        for(size_t s = 0; s < n_step; ++s)
+        {   val[s]              = acc[ step_acc_[s] ];
+            acc[ step_sub_[s] ] -= val[s];
+        }
+    }
+    /*!
+    Value of a requested entry.
+
+    \param k
+    index of the requested entry in the row and col vectors
+    that were used to compute the coloring.
+
+    \param acc
+    accumulators after the call to solve.
+
+    \param val
+    values after the call to solve.
+    */
+    template <class Base>
+    const Base& value(
+        size_t k, const vector<Base>& acc, const vector<Base>& val
+    ) const
+    {   size_t n_step = step_acc_.size();
+        if( entry_[k] < n_step )
+            return val[ entry_[k] ];
+        return acc[ entry_[k] - n_step ];
+    }
+    //
+    template <class SetVector>
+    friend void color_acyclic_cppad(
+        const SetVector&        pattern   ,
+        CppAD::vector<size_t>&  row       ,
+        CppAD::vector<size_t>&  col       ,
+        CppAD::vector<size_t>&  color     ,
+        color_substitution&     subs
+    );
+};
+// --------------------------------------------------------------------------
+/*!
+Find the root of the set that contains an element using
+union find with path halving.
+
+\param parent [in/out]
+parent[e] is the parent of element e (it is a root if parent[e] == e).
+
+\param e [in]
+is the element.
+*/
+inline size_t color_acyclic_find(vector<size_t>& parent, size_t e)
+{   while( parent[e] != e )
+    {   parent[e] = parent[ parent[e] ];
+        e         = parent[e];
+    }
+    return e;
+}
+// --------------------------------------------------------------------------
+/*!
+CppAD acyclic coloring algorithm for determining which rows of a symmetric
+sparse matrix can be computed together.
+
+\tparam SetVector
+is a vector_of_sets class.
+
+\param pattern [in]
+Is a representation of the sparsity pattern for the matrix.
+
+\param row [in]
+is a vector specifying which row indices to compute.
+
+\param col [in]
+is a vector, with the same size as row,
+that specifies which column indices to compute.
+For each  valid index k, the index pair
+<code>(row[k], col[k])</code> must be present in the sparsity pattern.
+
+\param color [out]
+is a vector with size m.
+The input value of its elements does not matter.
+Upon return, it is a coloring for the rows of the sparse matrix.
+If color[i] == m, then there is no index k for which
+row[k] == i or col[k] == i.
+Two indices i1 != i2 with (i1, i2) in the sparsity pattern have
+different colors, and every cycle in the graph of the sparsity pattern
+uses at least three colors.
+
+\param subs [out]
+The input value of this information does not matter.
+Upon return it contains the information used to compute the entries
+(row[k], col[k]) by substitution; see color_substitution.
+
+\par Algorithm
+This is a greedy algorithm that colors the indices in order of
+decreasing number of neighbors.
+The edges of the graph that have both end points colored are kept
+in disjoint sets; i.e., the trees in the forest with the same two colors.
+A color is forbidden for an index if two neighbors with the same color
+have edges in the same tree that has that color.
+*/
+template <class SetVector>
+void color_acyclic_cppad(
+    const SetVector&        pattern   ,
+    CppAD::vector<size_t>&  row       ,
+    CppAD::vector<size_t>&  col       ,
+    CppAD::vector<size_t>&  color     ,
+    color_substitution&     subs      )
+{   size_t K = row.size();
+    size_t m = pattern.n_set();
+    CPPAD_ASSERT_UNKNOWN( color.size() == m );
+    //
+    // graph for the indices that need to be colored
+    vector<bool>   active;
+    vector<size_t> adj_begin, adj;
+    color_symmetric_graph(pattern, row, col, active, adj_begin, adj);
+    size_t n_adj = adj.size();
+    //
+    // edge[k] is the same for the two directions of an edge
+    vector<size_t> edge(n_adj);
+    for(size_t i = 0; i < m; ++i)
+    {   for(size_t k = adj_begin[i]; k < adj_begin[i+1]; ++k)
+        {   size_t j = adj[k];
+            if( i < j )
+                edge[k] = k;
+            else
+            {   const size_t* first = adj.data() + adj_begin[j];
+                const size_t* last  = adj.data() + adj_begin[j+1];
+                const size_t* ptr   = std::lower_bound(first, last, i);
+                CPPAD_ASSERT_UNKNOWN( ptr != last && *ptr == i );
+                edge[k] = size_t( ptr - adj.data() );
+            }
+        }
+    }
+    //
+    // order the indices by decreasing number of neighbors
+    vector<size_t> key(m), order(m);
+    for(size_t i = 0; i < m; ++i)
+        key[i] = m - (adj_begin[i+1] - adj_begin[i]);
+    CppAD::index_sort(key, order);
+    //
+    // disjoint sets of edges
+    vector<size_t> parent(n_adj);
+    for(size_t e = 0; e < n_adj; ++e)
+        parent[e] = e;
+    //
+    // first neighbor in the current group that has an edge in a set
+    vector<size_t> set_stamp(n_adj), set_first(n_adj);
+    for(size_t e = 0; e < n_adj; ++e)
+        set_stamp[e] = 0;
+    size_t stamp = 0;
+    //
+    // forbidden[c] == v if color c is forbidden for index v
+    vector<size_t> forbidden(m + 1);
+    for(size_t c = 0; c <= m; ++c)
+        forbidden[c] = m;
+    //
+    // colored neighbors of the current index sorted by color
+    vector<size_t> nbr_color, nbr_order, nbr_k;
+    //
+    for(size_t i = 0; i < m; ++i)
+        color[i] = m;
+    for(size_t o = 0; o < m; ++o) if( active[ order[o] ] )
+    {   size_t v = order[o];
+        //
+        // distance one neighbors have different colors
+        nbr_color.resize(0);
+        nbr_k.resize(0);
+        for(size_t k1 = adj_begin[v]; k1 < adj_begin[v+1]; ++k1)
+        {   size_t b = color[ adj[k1] ];
+            if( b < m )
+            {   forbidden[b] = v;
+                nbr_color.push_back(b);
+                nbr_k.push_back(k1);
+            }
+        }
+        size_t n_nbr = nbr_color.size();
+        nbr_order.resize(n_nbr);
+        CppAD::index_sort(nbr_color, nbr_order);
+        //
+        // two neighbors with color b that are in the same tree with colors
+        // b and c would create a cycle with colors b and c
+        size_t g_begin = 0;
+        while( g_begin < n_nbr )
+        {   size_t b     = nbr_color[ nbr_order[g_begin] ];
+            size_t g_end = g_begin + 1;
+            while( g_end < n_nbr && nbr_color[ nbr_order[g_end] ] == b )
+                ++g_end;
+            if( g_end - g_begin > 1 )
+            {   ++stamp;
+                for(size_t g = g_begin; g < g_end; ++g)
+                {   size_t w = adj[ nbr_k[ nbr_order[g] ] ];
+                    for(size_t k2 = adj_begin[w]; k2 < adj_begin[w+1]; ++k2)
+                    {   size_t x = adj[k2];
+                        if( x != v && color[x] < m )
+                        {   size_t r = color_acyclic_find(parent, edge[k2]);
+                            if( set_stamp[r] != stamp )
+                            {   set_stamp[r] = stamp;
+                                set_first[r] = w;
+                            }
+                            else if( set_first[r] != w )
+                                forbidden[ color[x] ] = v;
+                        }
+                    }
+                }
+            }
+            g_begin = g_end;
+        }
+        // use the smallest color that is not forbidden
+        size_t c = 0;
+        while( forbidden[c] == v )
+            ++c;
+        color[v] = c;
+        //
+        // join the new edges to the trees with colors color[w] and c
+        for(size_t g = 0; g < n_nbr; ++g)
+        {   size_t k1 = nbr_k[ nbr_order[g] ];
+            size_t w  = adj[k1];
+            size_t r1 = color_acyclic_find(parent, edge[k1]);
+            for(size_t k2 = adj_begin[w]; k2 < adj_begin[w+1]; ++k2)
+            {   if( color[ adj[k2] ] == c && adj[k2] != v )
+                {   size_t r2 = color_acyclic_find(parent, edge[k2]);
+                    if( r1 != r2 )
+                        parent[r2] = r1;
+                }
+            }
+            if( g > 0 && nbr_color[ nbr_order[g-1] ] == color[w] )
+            {   size_t k0 = nbr_k[ nbr_order[g-1] ];
+                size_t r0 = color_acyclic_find(parent, edge[k0]);
+                r1        = color_acyclic_find(parent, edge[k1]);
+                if( r0 != r1 )
+                    parent[r0] = r1;
+            }
+        }
+    }
+    // -----------------------------------------------------------------------
+    // number of colors
+    size_t n_color = 0;
+    for(size_t i = 0; i < m; ++i) if( color[i] < m )
+        n_color = std::max(n_color, color[i] + 1);
+    //
+    // indices that have a requested diagonal entry
+    vector<bool> diagonal(m);
+    for(size_t i = 0; i < m; ++i)
+        diagonal[i] = false;
+    for(size_t k = 0; k < K; ++k)
+        if( row[k] == col[k] )
+            diagonal[ row[k] ] = true;
+    //
+    // accumulators: acc_of[k] is the accumulator for index i and color
+    // color[ adj[k] ] where adj_begin[i] <= k < adj_begin[i+1]
+    vector<size_t> acc_of(n_adj), acc_diagonal(m);
+    vector<size_t> acc_row, acc_color, acc_count, acc_sum;
+    vector<size_t> last_acc(n_color), last_row(n_color);
+    for(size_t c = 0; c < n_color; ++c)
+        last_row[c] = m;
+    for(size_t i = 0; i < m; ++i) if( active[i] )
+    {   for(size_t k = adj_begin[i]; k < adj_begin[i+1]; ++k)
+        {   size_t c = color[ adj[k] ];
+            if( last_row[c] != i )
+            {   last_row[c] = i;
+                last_acc[c] = acc_row.size();
+                acc_row.push_back(i);
+                acc_color.push_back(c);
+                acc_count.push_back(0);
+                acc_sum.push_back(0);
+            }
+            size_t a  = last_acc[c];
+            acc_of[k] = a;
+            // number and sum of the edges that are not yet solved for
+            ++acc_count[a];
+            acc_sum[a] += k;
+        }
+        if( diagonal[i] )
+        {   acc_diagonal[i] = acc_row.size();
+            acc_row.push_back(i);
+            acc_color.push_back( color[i] );
+            acc_count.push_back(0);
+            acc_sum.push_back(0);
+        }
+    }
+    size_t n_acc = acc_row.size();
+    //
+    // substitution steps: the coloring is acyclic so the edges with two
+    // colors form a forest and there is always a leaf that can be removed
+    vector<size_t> step_of(n_adj), step_acc, step_sub, leaf;
+    for(size_t a = 0; a < n_acc; ++a)
+        if( acc_count[a] == 1 )
+            leaf.push_back(a);
+    while( leaf.size() > 0 )
+    {   size_t a = leaf[ leaf.size() - 1 ];
+        leaf.resize( leaf.size() - 1 );
+        if( acc_count[a] == 1 )
+        {   // the edge that is not yet solved for
+            size_t k1 = acc_sum[a];
+            size_t i  = acc_row[a];
+            size_t j  = adj[k1];
+            CPPAD_ASSERT_UNKNOWN( adj_begin[i] <= k1 && k1 < adj_begin[i+1] );
+            //
+            // direction of the edge from j to i
+            size_t k2 = edge[k1];
+            if( k2 == k1 )
+            {   const size_t* first = adj.data() + adj_begin[j];
+                const size_t* last  = adj.data() + adj_begin[j+1];
+                k2 = size_t( std::lower_bound(first, last, i) - adj.data() );
+            }
+            CPPAD_ASSERT_UNKNOWN( adj[k2] == i );
+            size_t b = acc_of[k2];
+            //
+            step_of[k1] = step_acc.size();
+            step_of[k2] = step_acc.size();
+            step_acc.push_back(a);
+            step_sub.push_back(b);
+            //
+            --acc_count[a];
+            acc_sum[a] -= k1;
+            --acc_count[b];
+            acc_sum[b] -= k2;
+            if( acc_count[b] == 1 )
+                leaf.push_back(b);
+        }
+    }
+    CPPAD_ASSERT_UNKNOWN( 2 * step_acc.size() == n_adj );
+    //
+    // sort the accumulators by color
+    vector<size_t> acc_order(n_acc), acc_new(n_acc);
+    CppAD::index_sort(acc_color, acc_order);
+    subs.n_color_ = n_color;
+    subs.acc_begin_.resize(n_color + 1);
+    subs.acc_row_.resize(n_acc);
+    for(size_t c = 0; c <= n_color; ++c)
+        subs.acc_begin_[c] = n_acc;
+    for(size_t a = n_acc; a > 0; --a)
+    {   size_t a_old = acc_order[a-1];
+        acc_new[a_old]                       = a - 1;
+        subs.acc_row_[a-1]                   = acc_row[a_old];
+        subs.acc_begin_[ acc_color[a_old] ]  = a - 1;
+    }
+    for(size_t c = n_color; c > 0; --c)
+        subs.acc_begin_[c-1] = std::min(
+            subs.acc_begin_[c-1], subs.acc_begin_[c]
+        );
+    size_t n_step = step_acc.size();
+    subs.step_acc_.resize(n_step);
+    subs.step_sub_.resize(n_step);
+    for(size_t s = 0; s < n_step; ++s)
+    {   subs.step_acc_[s] = acc_new[ step_acc[s] ];
+        subs.step_sub_[s] = acc_new[ step_sub[s] ];
+    }
+    //
+    // the step or diagonal accumulator for each requested entry
+    subs.entry_.resize(K);
+    for(size_t k = 0; k < K; ++k)
+    {   size_t i = row[k];
+        size_t j = col[k];
+        if( i == j )
+            subs.entry_[k] = n_step + acc_new[ acc_diagonal[i] ];
+        else
+        {   const size_t* first = adj.data() + adj_begin[i];
+            const size_t* last  = adj.data() + adj_begin[i+1];
+            size_t k1 = size_t( std::lower_bound(first, last, j) - adj.data() );
+            CPPAD_ASSERT_UNKNOWN( adj[k1] == j );
+            subs.entry_[k] = step_of[k1];
+        }
+    }
+    return;
+}
+
 } } // END_CPPAD_LOCAL_NAMESPACE
 
 # endif
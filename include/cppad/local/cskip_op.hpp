@@ -19,7 +19,7 @@ Zero order forward mode set which operations to skip.
 */
 
 /*!
-Zero order forward mode execution of op = CSkipOp.
+Determine which operations a CSkipOp skips during zero order forward mode.
 
 \par Parameters and Variables
 The terms parameter and variable depend on if we are referring to its
@@ -110,20 +110,20 @@ If right is an AD<Base> variable,
 <code>taylor [ size_t(arg[3]) * cap_order + 0 ]</code>
 is the zeroth order Taylor coefficient corresponding to right.
 
-\param cskip_op [in,out]
-is vector specifying which operations are at this point are know to be
-unecessary and can be skipped.
-This is both an input and an output.
+\return
+is zero if no operations are skipped,
+one if the operations <tt>arg[5+i]</tt> for <tt>i = 1 , ... , arg[4]</tt>
+are skipped, and two if the operations
+<tt>arg[5+arg[4]+i]</tt> for <tt>i = 1 , ... , arg[5]</tt> are skipped.
 */
 template <class Base>
-void forward_cskip_op_0(
+size_t forward_cskip_op_case(
     size_t               i_z            ,
     const addr_t*        arg            ,
     size_t               num_par        ,
     const Base*          parameter      ,
     size_t               cap_order      ,
-    Base*                taylor         ,
-    bool*                cskip_op       )
+    const Base*          taylor         )
 {
     CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < size_t(CompareNe) );
     CPPAD_ASSERT_UNKNOWN( arg[1] != 0 );
@@ -151,7 +151,7 @@ void forward_cskip_op_0(
     }
     bool ok_to_skip = IdenticalCon(left) & IdenticalCon(right);
     if( ! ok_to_skip )
-        return;
+        return 0;
 
     // initialize to avoid compiler warning
     bool true_case = false;
@@ -186,14 +186,60 @@ void forward_cskip_op_0(
         CPPAD_ASSERT_UNKNOWN(false);
     }
     if( true_case )
+        return 1;
+    return 2;
+}
+/*!
+Zero order forward mode execution of op = CSkipOp.
+
+\param i_z
+see forward_cskip_op_case.
+
+\param arg [in]
+see forward_cskip_op_case.
+
+\param num_par [in]
+see forward_cskip_op_case.
+
+\param parameter [in]
+see forward_cskip_op_case.
+
+\param cap_order [in]
+see forward_cskip_op_case.
+
+\param taylor [in]
+see forward_cskip_op_case.
+
+\param cskip_op [in,out]
+is vector specifying which operations are at this point are know to be
+unecessary and can be skipped.
+This is both an input and an output.
+
+\return
+is the return value for forward_cskip_op_case; i.e.,
+which operations have been added to the ones in cskip_op.
+*/
+template <class Base>
+size_t forward_cskip_op_0(
+    size_t               i_z            ,
+    const addr_t*        arg            ,
+    size_t               num_par        ,
+    const Base*          parameter      ,
+    size_t               cap_order      ,
+    Base*                taylor         ,
+    bool*                cskip_op       )
+{   size_t skip_case = forward_cskip_op_case(
+        i_z, arg, num_par, parameter, cap_order, taylor
+    );
+    if( skip_case == 1 )
     {   for(addr_t i = 0; i < arg[4]; i++)
             cskip_op[ arg[6+i] ] = true;
     }
-    else
+    else if( skip_case == 2 )
     {   for(addr_t i = 0; i < arg[5]; i++)
             cskip_op[ arg[6+arg[4]+i] ] = true;
     }
-    return;
+    return skip_case;
 }
 } } // END_CPPAD_LOCAL_NAMESPACE
 # endif
@@ -104,13 +104,23 @@ void forward_divvv_op_dir(
 
     // Using CondExp, it can make sense to divide by zero,
     // so do not make it an error.
-    size_t m = (q-1) * r + 1;
+    // (directions are the inner loops; see forward_mulvv_op_dir)
+    size_t m  = (q-1) * r + 1;
+    Base   y0 = y[0];
+    Base   z0 = z[0];
+    Base*  zq = z + m;
+    const Base* xq = x + m;
+    const Base* yq = y + m;
     for(size_t ell = 0; ell < r; ell++)
-    {   z[m+ell] = x[m+ell] - z[0] * y[m+ell];
-        for(size_t k = 1; k < q; k++)
-            z[m+ell] -= z[(q-k-1)*r+1+ell] * y[(k-1)*r+1+ell];
-        z[m+ell] /= y[0];
+        zq[ell] = xq[ell] - z0 * yq[ell];
+    for(size_t k = 1; k < q; k++)
+    {   const Base* zk = z + (q-k-1)*r + 1;
+        const Base* yk = y + (k-1)*r + 1;
+        for(size_t ell = 0; ell < r; ell++)
+            zq[ell] -= zk[ell] * yk[ell];
     }
+    for(size_t ell = 0; ell < r; ell++)
+        zq[ell] /= y0;
 }
 
 
@@ -296,13 +306,22 @@ void forward_divpv_op_dir(
 
     // Using CondExp, it can make sense to divide by zero,
     // so do not make it an error.
-    size_t m = (q-1) * r + 1;
+    // (directions are the inner loops; see forward_mulvv_op_dir)
+    size_t m  = (q-1) * r + 1;
+    Base   y0 = y[0];
+    Base   z0 = z[0];
+    Base*  zq = z + m;
+    const Base* yq = y + m;
     for(size_t ell = 0; ell < r; ell++)
-    {   z[m+ell] = - z[0] * y[m+ell];
-        for(size_t k = 1; k < q; k++)
-            z[m+ell] -= z[(q-k-1)*r+1+ell] * y[(k-1)*r+1+ell];
-        z[m+ell] /= y[0];
+        zq[ell] = - z0 * yq[ell];
+    for(size_t k = 1; k < q; k++)
+    {   const Base* zk = z + (q-k-1)*r + 1;
+        const Base* yk = y + (k-1)*r + 1;
+        for(size_t ell = 0; ell < r; ell++)
+            zq[ell] -= zk[ell] * yk[ell];
     }
+    for(size_t ell = 0; ell < r; ell++)
+        zq[ell] /= y0;
 }
 
 /*!
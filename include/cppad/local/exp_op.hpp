@@ -94,13 +94,23 @@ void forward_exp_op_dir(
     Base* x = taylor + i_x * num_taylor_per_var;
     Base* z = taylor + i_z * num_taylor_per_var;
 
-    size_t m = (q-1)*r + 1;
+    // directions are the inner loops; see forward_mulvv_op_dir
+    size_t m  = (q-1)*r + 1;
+    Base   bq = Base(double(q));
+    Base   z0 = z[0];
+    Base*  zq = z + m;
+    const Base* xq = x + m;
     for(size_t ell = 0; ell < r; ell++)
-    {   z[m+ell] = Base(double(q)) * x[m+ell] * z[0];
-        for(size_t k = 1; k < q; k++)
-            z[m+ell] += Base(double(k)) * x[(k-1)*r+ell+1] * z[(q-k-1)*r+ell+1];
-        z[m+ell] /= Base(double(q));
+        zq[ell] = bq * xq[ell] * z0;
+    for(size_t k = 1; k < q; k++)
+    {   Base bk = Base(double(k));
+        const Base* xk = x + (k-1)*r + 1;
+        const Base* zk = z + (q-k-1)*r + 1;
+        for(size_t ell = 0; ell < r; ell++)
+            zq[ell] += bk * xk[ell] * zk[ell];
     }
+    for(size_t ell = 0; ell < r; ell++)
+        zq[ell] /= bq;
 }
 
 /*!
@@ -67,6 +67,44 @@ unsigned short local_hash_code(const Value& value)
     return code;
 }
 
+/*!
+Hash code, that uses all the bits in a size_t, for an arbitrary value.
+
+\tparam Value
+is the type of the argument being hash coded.
+It should be a plain old data class; see local_hash_code.
+
+\param value
+the value that we are generating a hash code for.
+
+\return
+is a hash code that is used by hash tables that grow; e.g.,
+the constant parameter table in the recorder.
+Unlike local_hash_code, the bytes in value are mixed so that
+values that are permutations of each other have different codes.
+
+\par Checked Assertions
+\li sizeof(value) is even
+\li sizeof(unsigned short)  == 2
+*/
+template <class Value>
+size_t local_wide_hash_code(const Value& value)
+{   CPPAD_ASSERT_UNKNOWN( sizeof(unsigned short) == 2 );
+    CPPAD_ASSERT_UNKNOWN( sizeof(value) % 2  == 0 );
+    //
+    const unsigned short* v
+             = reinterpret_cast<const unsigned short*>(& value);
+    //
+    // 2^32 / golden ratio (fits in a size_t with 32 bits)
+    const size_t multiplier = size_t( 2654435769UL );
+    size_t code = 0;
+    for(size_t i = 0; i < sizeof(value) / 2; ++i)
+    {   code  = (code ^ size_t(v[i])) * multiplier;
+        code ^= code >> 16;
+    }
+    return code;
+}
+
 /*!
 Specialized hash code for a CppAD operator and its arguments.
 
@@ -0,0 +1,682 @@
+# ifndef CPPAD_LOCAL_JIT_CSRC_HPP
+# define CPPAD_LOCAL_JIT_CSRC_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <string>
+# include <sstream>
+# include <algorithm>
+# include <cppad/local/play/player.hpp>
+
+// BEGIN_CPPAD_LOCAL_JIT_NAMESPACE
+namespace CppAD { namespace local { namespace jit {
+/*!
+\file csrc.hpp
+Create C source code that evaluates an operation sequence.
+*/
+
+/*
+$begin jit_csrc$$
+$spell
+    csrc
+    jit
+    const
+    bool
+    Taylor
+    cskip
+    Vec
+    az
+    pz
+    nc
+$$
+
+$section C Source Code For Zero Order Forward and First Order Reverse$$
+
+$head Syntax$$
+$icode%ok% = local::jit::csrc(%play%, %source%, %has_compare%)%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_PROTOTYPE%// END_PROTOTYPE%1
+%$$
+
+$head play$$
+is the operation sequence that is converted to C source code.
+
+$head source$$
+The input value of this string does not matter.
+If $icode ok$$ is true, upon return it contains the C source code for
+the following two functions:
+
+$subhead cppad_jit_forward_zero$$
+$codei%void cppad_jit_forward_zero(
+    size_t %J%, const double* %p%, double* %t%
+)%$$
+computes the zero order Taylor coefficients for all the variables; see
+$cref/taylor/sweep_forward0/taylor/$$ in $code sweep_forward0$$.
+Here $icode J$$ is the number of columns in the Taylor coefficient matrix
+$icode t$$ and $icode p$$ is the vector of all the parameters
+$codei%%play%->GetPar()%$$.
+
+$subhead cppad_jit_reverse_one$$
+$codei%void cppad_jit_reverse_one(
+    size_t %J%, const double* %p%, const double* %t%, double* %pz%
+)%$$
+computes the first order reverse mode partials for all the variables.
+Here $icode J$$, $icode p$$, $icode t$$ are as above and
+$icode%pz%[%i%]%$$ is the partial w.r.t. the variable with index $icode i$$.
+This is the same as the $code partial$$ argument to
+$code local::sweep::reverse$$ with $icode%d% = 0%$$ and
+$icode%nc_partial% = 1%$$.
+
+$head has_compare$$
+The input value of this flag does not matter.
+Upon return, it is true if the operation sequence contains
+comparison operators.
+These operators are not evaluated by the C source code.
+
+$head ok$$
+This is true if the conversion succeeded.
+It is false if $icode Base$$ is not $code double$$,
+if the operation sequence has more than $code csrc_max_num_op$$ operators,
+or if it contains an operator that is not supported;
+i.e., discrete functions,
+$cref/conditional skip/op_code_var/CSkipOp/$$,
+$cref VecAD$$, $cref atomic$$ or $cref PrintFor$$ operators.
+
+$end
+*/
+
+/// Converts values to strings for the C source code.
+template <class Type>
+std::string csrc_string(const Type& value)
+{   std::ostringstream os;
+    os << value;
+    return os.str();
+}
+
+/// C source for the zero order Taylor coefficient of a variable
+inline std::string csrc_taylor(size_t i_var)
+{   return "T(" + csrc_string(i_var) + ")"; }
+
+/// C source for the partial of a variable
+inline std::string csrc_partial(size_t i_var)
+{   return "R(" + csrc_string(i_var) + ")"; }
+
+/// C source for the value of a parameter
+inline std::string csrc_parameter(size_t i_par)
+{   return "P(" + csrc_string(i_par) + ")"; }
+
+/// C source for a CExpOp argument that may be a variable or parameter
+inline std::string csrc_cexp_arg(const addr_t* arg, size_t i)
+{   CPPAD_ASSERT_UNKNOWN( 2 <= i && i <= 5 );
+    if( arg[1] & (1 << (i-2)) )
+        return csrc_taylor( size_t(arg[i]) );
+    return csrc_parameter( size_t(arg[i]) );
+}
+
+/// C source for a CExpOp comparison
+inline std::string csrc_cexp_compare(const addr_t* arg)
+{   std::string cop;
+    switch( CompareOp( arg[0] ) )
+    {   case CompareLt: cop = " < ";  break;
+        case CompareLe: cop = " <= "; break;
+        case CompareEq: cop = " == "; break;
+        case CompareGe: cop = " >= "; break;
+        case CompareGt: cop = " > ";  break;
+        default:
+        CPPAD_ASSERT_UNKNOWN(false);
+    }
+    return "(" + csrc_cexp_arg(arg, 2) + cop + csrc_cexp_arg(arg, 3) + ")";
+}
+
+/// Join C statements into functions with at most this many operators
+/// so that the C compiler does not see one very large function.
+/// (These functions are not static so that they are not inlined.)
+static const size_t csrc_ops_per_function = 2000;
+
+/// Operation sequences with more than this many operators are not converted
+/// because the C compiler takes longer than many interpreted evaluations.
+static const size_t csrc_max_num_op = 10000;
+
+/*!
+Add the functions that evaluate the statements to the C source code.
+
+\param source
+the functions are appended to this C source code.
+
+\param name
+is the name of the function that calls all the others.
+
+\param args
+is the argument declaration for all of the functions.
+
+\param call
+is the argument list used to call the other functions.
+
+\param statement
+is the C source code for each operator (in the order they are evaluated).
+*/
+inline void csrc_functions(
+    std::string&                     source    ,
+    const std::string&               name      ,
+    const std::string&               args      ,
+    const std::string&               call      ,
+    const CppAD::vector<std::string>& statement )
+{   size_t n_statement = statement.size();
+    size_t n_function  = 0;
+    for(size_t i = 0; i < n_statement; i += csrc_ops_per_function)
+    {   source += "void " + name + "_" + csrc_string(n_function);
+        source += "(" + args + ")\n{\n";
+        size_t end = std::min(i + csrc_ops_per_function, n_statement);
+        for(size_t k = i; k < end; ++k)
+            source += statement[k];
+        source += "}\n";
+        ++n_function;
+    }
+    source += "void " + name + "(" + args + ")\n{\n";
+    for(size_t k = 0; k < n_function; ++k)
+        source += "\t" + name + "_" + csrc_string(k) + "(" + call + ");\n";
+    source += "}\n";
+}
+
+// BEGIN_PROTOTYPE
+template <class Base>
+bool csrc(
+    const player<Base>* play        ,
+    std::string&        source      ,
+    bool&               has_compare )
+// END_PROTOTYPE
+{   CPPAD_ASSERT_UNKNOWN( play != CPPAD_NULL );
+    // only Base = double is supported; see the double version below
+    source      = "";
+    has_compare = false;
+    return false;
+}
+
+/// csrc for the case where Base is double
+inline bool csrc(
+    const player<double>* play        ,
+    std::string&          source      ,
+    bool&                 has_compare )
+{   has_compare = false;
+    source      = "";
+    if( play->num_op_rec() > csrc_max_num_op )
+        return false;
+    //
+    // C source for each operator in forward and reverse order
+    CppAD::vector<std::string> forward, reverse;
+    //
+    // skip the BeginOp at the beginning of the recording
+    play::const_sequential_iterator itr = play->begin();
+    OpCode        op;
+    size_t        i_var;
+    const addr_t* arg;
+    itr.op_info(op, arg, i_var);
+    CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+    //
+    bool more_operators = true;
+    while(more_operators)
+    {   (++itr).op_info(op, arg, i_var);
+        //
+        // primary result, first argument, second argument
+        std::string z  = csrc_taylor(i_var);
+        std::string pz = csrc_partial(i_var);
+        std::string x, px, y, py;
+        //
+        // C source for this operator
+        std::string fwd, rev;
+        switch( op )
+        {
+            // --------------------------------------------------------------
+            // unary operators with one result
+            case AbsOp:
+            case ExpOp:
+            case LogOp:
+            case SignOp:
+            case SqrtOp:
+# if CPPAD_USE_CPLUSPLUS_2011
+            case Expm1Op:
+            case Log1pOp:
+# endif
+            x   = csrc_taylor( size_t(arg[0]) );
+            px  = csrc_partial( size_t(arg[0]) );
+            switch( op )
+            {   case AbsOp:
+                fwd = z + " = fabs(" + x + ");\n";
+                rev = px + " += sign(" + x + ") * " + pz + ";\n";
+                break;
+
+                case ExpOp:
+                fwd = z + " = exp(" + x + ");\n";
+                rev = px + " += azmul(" + pz + ", " + z + ");\n";
+                break;
+
+                case LogOp:
+                fwd = z + " = log(" + x + ");\n";
+                rev = px + " += azmul(" + pz + ", 1.0 / " + x + ");\n";
+                break;
+
+                case SignOp:
+                fwd = z + " = sign(" + x + ");\n";
+                break;
+
+                case SqrtOp:
+                fwd = z + " = sqrt(" + x + ");\n";
+                rev = px + " += azmul(" + pz + ", 1.0 / " + z + ") / 2.0;\n";
+                break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+                case Expm1Op:
+                fwd = z + " = expm1(" + x + ");\n";
+                rev = px + " += " + pz + " + azmul(" + pz + ", " + z + ");\n";
+                break;
+
+                case Log1pOp:
+                fwd = z + " = log1p(" + x + ");\n";
+                rev = px + " += azmul(" + pz + ", 1.0 / (1.0 + " + x + "));\n";
+                break;
+# endif
+                default:
+                CPPAD_ASSERT_UNKNOWN(false);
+            }
+            break;
+            // --------------------------------------------------------------
+            // unary operators with an auxillary result b = i_var - 1
+            case AcosOp:
+            case AsinOp:
+            case AtanOp:
+            case CosOp:
+            case CoshOp:
+            case SinOp:
+            case SinhOp:
+            case TanOp:
+            case TanhOp:
+# if CPPAD_USE_CPLUSPLUS_2011
+            case AcoshOp:
+            case AsinhOp:
+            case AtanhOp:
+# endif
+            {   x   = csrc_taylor( size_t(arg[0]) );
+                px  = csrc_partial( size_t(arg[0]) );
+                std::string b = csrc_taylor(i_var - 1);
+                std::string fun, aux, sgn = " += ", scale;
+                switch( op )
+                {   case AcosOp:
+                    fun = "acos";
+                    aux = "sqrt(1.0 - " + x + " * " + x + ")";
+                    sgn = " -= ";
+                    scale = "1.0 / " + b;
+                    break;
+
+                    case AsinOp:
+                    fun = "asin";
+                    aux = "sqrt(1.0 - " + x + " * " + x + ")";
+                    scale = "1.0 / " + b;
+                    break;
+
+                    case AtanOp:
+                    fun = "atan";
+                    aux = "1.0 + " + x + " * " + x;
+                    scale = "1.0 / " + b;
+                    break;
+
+                    case CosOp:
+                    fun = "cos";
+                    aux = "sin(" + x + ")";
+                    sgn = " -= ";
+                    scale = b;
+                    break;
+
+                    case CoshOp:
+                    fun = "cosh";
+                    aux = "sinh(" + x + ")";
+                    scale = b;
+                    break;
+
+                    case SinOp:
+                    fun = "sin";
+                    aux = "cos(" + x + ")";
+                    scale = b;
+                    break;
+
+                    case SinhOp:
+                    fun = "sinh";
+                    aux = "cosh(" + x + ")";
+                    scale = b;
+                    break;
+
+                    case TanOp:
+                    fun = "tan";
+                    aux = z + " * " + z;
+                    scale = "1.0 + " + b;
+                    break;
+
+                    case TanhOp:
+                    fun = "tanh";
+                    aux = z + " * " + z;
+                    scale = "1.0 - " + b;
+                    break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+                    case AcoshOp:
+                    fun = "acosh";
+                    aux = "sqrt(" + x + " * " + x + " - 1.0)";
+                    scale = "1.0 / " + b;
+                    break;
+
+                    case AsinhOp:
+                    fun = "asinh";
+                    aux = "sqrt(1.0 + " + x + " * " + x + ")";
+                    scale = "1.0 / " + b;
+                    break;
+
+                    case AtanhOp:
+                    fun = "atanh";
+                    aux = "1.0 - " + x + " * " + x;
+                    scale = "1.0 / " + b;
+                    break;
+# endif
+                    default:
+                    CPPAD_ASSERT_UNKNOWN(false);
+                }
+                fwd  = z + " = " + fun + "(" + x + ");\n";
+                fwd += b + " = " + aux + ";\n";
+                rev  = px + sgn + "azmul(" + pz + ", " + scale + ");\n";
+            }
+            break;
+            // --------------------------------------------------------------
+            // binary operators with one result
+            case AddpvOp:
+            case AddvvOp:
+            case DivpvOp:
+            case DivvpOp:
+            case DivvvOp:
+            case MulpvOp:
+            case MulvvOp:
+            case SubpvOp:
+            case SubvpOp:
+            case SubvvOp:
+            case ZmulpvOp:
+            case ZmulvpOp:
+            case ZmulvvOp:
+            switch( op )
+            {   case AddpvOp:
+                case DivpvOp:
+                case MulpvOp:
+                case SubpvOp:
+                case ZmulpvOp:
+                x  = csrc_parameter( size_t(arg[0]) );
+                y  = csrc_taylor( size_t(arg[1]) );
+                py = csrc_partial( size_t(arg[1]) );
+                break;
+
+                case DivvpOp:
+                case SubvpOp:
+                case ZmulvpOp:
+                x  = csrc_taylor( size_t(arg[0]) );
+                px = csrc_partial( size_t(arg[0]) );
+                y  = csrc_parameter( size_t(arg[1]) );
+                break;
+
+                default:
+                x  = csrc_taylor( size_t(arg[0]) );
+                px = csrc_partial( size_t(arg[0]) );
+                y  = csrc_taylor( size_t(arg[1]) );
+                py = csrc_partial( size_t(arg[1]) );
+                break;
+            }
+            switch( op )
+            {   case AddpvOp:
+                fwd = z + " = " + x + " + " + y + ";\n";
+                rev = py + " += " + pz + ";\n";
+                break;
+
+                case AddvvOp:
+                fwd  = z + " = " + x + " + " + y + ";\n";
+                rev  = px + " += " + pz + ";\n";
+                rev += py + " += " + pz + ";\n";
+                break;
+
+                case DivpvOp:
+                fwd = z + " = " + x + " / " + y + ";\n";
+                rev = py + " -= azmul(azmul(" + pz + ", 1.0 / " + y + "), "
+                    + z + ");\n";
+                break;
+
+                case DivvpOp:
+                fwd = z + " = " + x + " / " + y + ";\n";
+                rev = px + " += azmul(" + pz + ", 1.0 / " + y + ");\n";
+                break;
+
+                case DivvvOp:
+                fwd  = z + " = " + x + " / " + y + ";\n";
+                rev  = "{\tdouble s = azmul(" + pz + ", 1.0 / " + y + ");\n";
+                rev += "\t" + px + " += s;\n";
+                rev += "\t" + py + " -= azmul(s, " + z + ");\n}\n";
+                break;
+
+                case MulpvOp:
+                fwd = z + " = " + x + " * " + y + ";\n";
+                rev = py + " += azmul(" + pz + ", " + x + ");\n";
+                break;
+
+                case MulvvOp:
+                fwd  = z + " = " + x + " * " + y + ";\n";
+                rev  = px + " += azmul(" + pz + ", " + y + ");\n";
+                rev += py + " += azmul(" + pz + ", " + x + ");\n";
+                break;
+
+                case SubpvOp:
+                fwd = z + " = " + x + " - " + y + ";\n";
+                rev = py + " -= " + pz + ";\n";
+                break;
+
+                case SubvpOp:
+                fwd = z + " = " + x + " - " + y + ";\n";
+                rev = px + " += " + pz + ";\n";
+                break;
+
+                case SubvvOp:
+                fwd  = z + " = " + x + " - " + y + ";\n";
+                rev  = px + " += " + pz + ";\n";
+                rev += py + " -= " + pz + ";\n";
+                break;
+
+                case ZmulpvOp:
+                fwd = z + " = azmul(" + x + ", " + y + ");\n";
+                rev = py + " += azmul(" + pz + ", " + x + ");\n";
+                break;
+
+                case ZmulvpOp:
+                fwd = z + " = azmul(" + x + ", " + y + ");\n";
+                rev = px + " += azmul(" + pz + ", " + y + ");\n";
+                break;
+
+                case ZmulvvOp:
+                fwd  = z + " = azmul(" + x + ", " + y + ");\n";
+                rev  = px + " += azmul(" + pz + ", " + y + ");\n";
+                rev += py + " += azmul(" + pz + ", " + x + ");\n";
+                break;
+
+                default:
+                CPPAD_ASSERT_UNKNOWN(false);
+            }
+            break;
+            // --------------------------------------------------------------
+            // pow operators: z_0 = log(x), z_1 = z_0 * y, z_2 = exp(z_1)
+            case PowpvOp:
+            case PowvpOp:
+            case PowvvOp:
+            {   std::string z_0  = csrc_taylor(i_var - 2);
+                std::string z_1  = csrc_taylor(i_var - 1);
+                std::string pz_0 = csrc_partial(i_var - 2);
+                std::string pz_1 = csrc_partial(i_var - 1);
+                if( op == PowpvOp )
+                    x = csrc_parameter( size_t(arg[0]) );
+                else
+                {   x  = csrc_taylor( size_t(arg[0]) );
+                    px = csrc_partial( size_t(arg[0]) );
+                }
+                if( op == PowvpOp )
+                    y = csrc_parameter( size_t(arg[1]) );
+                else
+                {   y  = csrc_taylor( size_t(arg[1]) );
+                    py = csrc_partial( size_t(arg[1]) );
+                }
+                fwd  = z_0 + " = log(" + x + ");\n";
+                fwd += z_1 + " = " + z_0 + " * " + y + ";\n";
+                fwd += z + " = pow(" + x + ", " + y + ");\n";
+                //
+                rev = pz_1 + " += azmul(" + pz + ", " + z + ");\n";
+                if( op != PowvpOp )
+                    rev += py + " += azmul(" + pz_1 + ", " + z_0 + ");\n";
+                if( op != PowpvOp )
+                {   rev += pz_0 + " += azmul(" + pz_1 + ", " + y + ");\n";
+                    rev += px + " += azmul(" + pz_0 + ", 1.0 / " + x + ");\n";
+                }
+            }
+            break;
+            // --------------------------------------------------------------
+# if CPPAD_USE_CPLUSPLUS_2011
+            // erf operators: z_0 = x * x, z_1 = 0 - z_0, z_2 = exp(z_1),
+            // z_3 = (2 / sqrt(pi)) * z_2, z_4 = erf(x) or erfc(x)
+            case ErfOp:
+            case ErfcOp:
+            {   std::string z_0 = csrc_taylor(i_var - 4);
+                std::string z_1 = csrc_taylor(i_var - 3);
+                std::string z_2 = csrc_taylor(i_var - 2);
+                std::string z_3 = csrc_taylor(i_var - 1);
+                x   = csrc_taylor( size_t(arg[0]) );
+                px  = csrc_partial( size_t(arg[0]) );
+                fwd  = z_0 + " = " + x + " * " + x + ";\n";
+                fwd += z_1 + " = " + csrc_parameter( size_t(arg[1]) ) + " - " + z_0 + ";\n";
+                fwd += z_2 + " = exp(" + z_1 + ");\n";
+                fwd += z_3 + " = " + csrc_parameter( size_t(arg[2]) ) + " * " + z_2 + ";\n";
+                if( op == ErfOp )
+                {   fwd += z + " = erf(" + x + ");\n";
+                    rev  = px + " += azmul(" + pz + ", " + z_3 + ");\n";
+                }
+                else
+                {   fwd += z + " = erfc(" + x + ");\n";
+                    rev  = px + " -= azmul(" + pz + ", " + z_3 + ");\n";
+                }
+            }
+            break;
+# endif
+            // --------------------------------------------------------------
+            case CExpOp:
+            {   std::string flag = csrc_cexp_compare(arg);
+                fwd  = z + " = " + flag + " ? ";
+                fwd += csrc_cexp_arg(arg, 4) + " : " + csrc_cexp_arg(arg, 5) + ";\n";
+                if( arg[1] & 4 )
+                {   rev += csrc_partial( size_t(arg[4]) ) + " += " + flag + " ? ";
+                    rev += pz + " : 0.0;\n";
+                }
+                if( arg[1] & 8 )
+                {   rev += csrc_partial( size_t(arg[5]) ) + " += " + flag + " ? ";
+                    rev += "0.0 : " + pz + ";\n";
+                }
+            }
+            break;
+            // --------------------------------------------------------------
+            case CSumOp:
+            fwd = z + " = " + csrc_parameter( size_t(arg[0]) );
+            for(size_t i = size_t(arg[2]); i < size_t(arg[3]); ++i)
+                fwd += " + " + csrc_parameter( size_t(arg[i]) );
+            for(size_t i = size_t(arg[3]); i < size_t(arg[4]); ++i)
+                fwd += " - " + csrc_parameter( size_t(arg[i]) );
+            for(size_t i = 5; i < size_t(arg[1]); ++i)
+            {   fwd += " + " + csrc_taylor( size_t(arg[i]) );
+                rev += csrc_partial( size_t(arg[i]) ) + " += " + pz + ";\n";
+            }
+            for(size_t i = size_t(arg[1]); i < size_t(arg[2]); ++i)
+            {   fwd += " - " + csrc_taylor( size_t(arg[i]) );
+                rev += csrc_partial( size_t(arg[i]) ) + " -= " + pz + ";\n";
+            }
+            fwd += ";\n";
+            itr.correct_before_increment();
+            break;
+            // --------------------------------------------------------------
+            case ParOp:
+            fwd = z + " = " + csrc_parameter( size_t(arg[0]) ) + ";\n";
+            break;
+            // --------------------------------------------------------------
+            // comparison operators are not evaluated
+            case EqppOp:
+            case EqpvOp:
+            case EqvvOp:
+            case LeppOp:
+            case LepvOp:
+            case LevpOp:
+            case LevvOp:
+            case LtppOp:
+            case LtpvOp:
+            case LtvpOp:
+            case LtvvOp:
+            case NeppOp:
+            case NepvOp:
+            case NevvOp:
+            has_compare = true;
+            break;
+            // --------------------------------------------------------------
+            case InvOp:
+            // values for independent variables are set by caller
+            break;
+            // --------------------------------------------------------------
+            case EndOp:
+            more_operators = false;
+            break;
+            // --------------------------------------------------------------
+            default:
+            // DisOp, CSkipOp, VecAD, atomic function, and print operators
+            return false;
+        }
+        if( fwd != "" )
+            forward.push_back(fwd);
+        if( rev != "" )
+            reverse.push_back(rev);
+    }
+    // reverse mode statements are evaluated in reverse order
+    size_t n_rev = reverse.size();
+    for(size_t i = 0; i < n_rev / 2; ++i)
+        reverse[i].swap( reverse[n_rev - 1 - i] );
+    //
+    source  = "# include <stddef.h>\n";
+    source += "# include <math.h>\n";
+    source += "# define T(i) t[(i) * J]\n";
+    source += "# define R(i) pz[i]\n";
+    source += "# define P(i) p[i]\n";
+    source += "static double azmul(double x, double y)\n";
+    source += "{\treturn x == 0.0 ? 0.0 : x * y; }\n";
+    source += "static double sign(double x)\n";
+    source += "{\treturn x > 0.0 ? 1.0 : ( x == 0.0 ? 0.0 : -1.0 ); }\n";
+    csrc_functions(
+        source,
+        "cppad_jit_forward_zero",
+        "size_t J, const double* p, double* t",
+        "J, p, t",
+        forward
+    );
+    csrc_functions(
+        source,
+        "cppad_jit_reverse_one",
+        "size_t J, const double* p, const double* t, double* pz",
+        "J, p, t, pz",
+        reverse
+    );
+    return true;
+}
+
+} } } // END_CPPAD_LOCAL_JIT_NAMESPACE
+
+# endif
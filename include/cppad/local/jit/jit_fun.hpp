@@ -0,0 +1,419 @@
+# ifndef CPPAD_LOCAL_JIT_JIT_FUN_HPP
+# define CPPAD_LOCAL_JIT_JIT_FUN_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cstdio>
+# include <cstdlib>
+# include <cstring>
+# include <fstream>
+# include <sstream>
+# include <string>
+# include <vector>
+# include <cppad/configure.hpp>
+# include <cppad/local/jit/csrc.hpp>
+
+// The compiled code is only used if the user defines CPPAD_USE_JIT because
+// a program that uses dlopen may need to link with the dl library.
+// (mkdtemp is in the same POSIX header as mkstemp.)
+# if defined(CPPAD_USE_JIT) && CPPAD_HAS_DLOPEN && CPPAD_HAS_MKSTEMP
+# include <dlfcn.h>
+# include <stdlib.h>
+# include <unistd.h>
+# define CPPAD_LOCAL_JIT_JIT_FUN_OK 1
+# else
+# define CPPAD_LOCAL_JIT_JIT_FUN_OK 0
+# endif
+
+// BEGIN_CPPAD_LOCAL_JIT_NAMESPACE
+namespace CppAD { namespace local { namespace jit {
+/*!
+\file jit_fun.hpp
+Compile and load the C source code for an operation sequence.
+*/
+
+/*
+$begin jit_fun$$
+$spell
+    jit
+    const
+    bool
+    Taylor
+    csrc
+    dlopen
+    mkdtemp
+    cmd
+    msg
+    TMPDIR
+    std
+$$
+
+$section Compiled Zero Order Forward and First Order Reverse$$
+
+$head Syntax$$
+$codei%local::jit::jit_fun<%Base%> %jit%
+%$$
+$icode%jit%.setup(%play%)
+%$$
+$icode%jit%.clear()
+%$$
+$icode%done% = %jit%.setup_done()
+%$$
+$icode%ok% = %jit%.ok()
+%$$
+$icode%has_compare% = %jit%.has_compare()
+%$$
+$icode%msg% = %jit%.msg()
+%$$
+$icode%jit%.forward_zero(%play%, %J%, %taylor%)
+%$$
+$icode%jit%.reverse_one(%play%, %J%, %taylor%, %partial%)
+%$$
+
+$head Purpose$$
+This class converts an operation sequence to C source code using
+$cref jit_csrc$$,
+compiles the source code to a shared library using the command
+$cref/CPPAD_C_COMPILER_CMD/configure.hpp/CPPAD_C_COMPILER_CMD/$$,
+loads the library using $code dlopen$$,
+and then evaluates the operation sequence using the compiled functions.
+The temporary files used for this purpose are in a directory,
+created by $code mkdtemp$$, that only the current user can access.
+This directory is in $code TMPDIR$$, if that environment variable is set,
+and otherwise it is in $code /tmp$$.
+The files and the directory are removed before $code setup$$ returns.
+If the preprocessor symbol $code CPPAD_USE_JIT$$ is not defined,
+the operation sequence is not compiled and the library is not loaded.
+
+$head Base$$
+The type used during the computations; i.e., the corresponding
+recording of operations used the type $codei%AD<%Base%>%$$.
+Only the case where $icode Base$$ is $code double$$ is supported.
+
+$head Copy$$
+A copy of a $code jit_fun$$ object does not share its library.
+Instead, the copy is in the same state as after $code clear$$.
+
+$head play$$
+This argument has prototype
+$codei%
+    const player<%Base%>* %play%
+%$$
+In the $code setup$$ syntax, it is the operation sequence that is compiled.
+In the other syntaxes, it must have the same operation sequence
+as in the previous call to $code setup$$.
+(The parameter values may be different; see $cref new_dynamic$$.)
+
+$head setup$$
+This compiles and loads the operation sequence in $icode play$$.
+Any previously loaded library is unloaded.
+
+$head clear$$
+This unloads the library (if one was loaded)
+and sets $icode done$$ and $icode ok$$ to false.
+
+$head done$$
+It is true if $code setup$$ has been called since the previous $code clear$$
+(or since construction).
+
+$head ok$$
+It is true if $code setup$$ has been called (since the previous $code clear$$)
+and it succeeded.
+It is false if
+$code CPPAD_USE_JIT$$ is not defined,
+$code dlopen$$ or $code mkdtemp$$ is not available on this system,
+the C compiler command is not known,
+the compilation failed,
+or the operation sequence is not supported by $cref jit_csrc$$.
+
+$head has_compare$$
+It is true if the operation sequence contains comparison operators.
+These operators are not evaluated by the compiled code
+and hence it should not be used when comparison changes are being counted;
+see $cref compare_change$$.
+
+$head msg$$
+The result $icode msg$$ has prototype
+$codei%
+    const std::string& %msg%
+%$$
+If $icode done$$ is true and $icode ok$$ is false,
+it is a description of why $code setup$$ failed.
+This includes the output of the compiler when the compilation failed.
+Otherwise it is empty.
+
+$head J$$
+Is the number of columns in the coefficient matrix taylor.
+This must be greater than or equal one.
+
+$head taylor$$
+Is the matrix of Taylor coefficients; see
+$cref/taylor/sweep_forward0/taylor/$$ in $code sweep_forward0$$.
+For $code forward_zero$$, the zero order coefficients for the
+independent variables are inputs and the zero order coefficients
+for the other variables are outputs.
+For $code reverse_one$$, the zero order coefficients for
+all the variables are inputs.
+
+$head partial$$
+On input, $icode%partial%[%i%]%$$ is the partial of the scalar
+function being differentiated w.r.t. the variable with index $icode i$$
+(only the dependent variables should be non-zero).
+Upon return, it has been updated to include the dependence
+through all the variables; see $code local::sweep::reverse$$ with
+$icode%d% = 0%$$.
+
+$end
+*/
+
+/*!
+Compiled version of zero order forward and first order reverse
+for one operation sequence.
+
+\tparam Base
+base type for the operator; i.e., this operation sequence was recorded
+using AD<Base> and computations by this routine are done using type Base.
+*/
+template <class Base>
+class jit_fun {
+private:
+    /// type of the compiled zero order forward function
+    typedef void (*forward_zero_t)(size_t J, const Base* p, Base* t);
+    //
+    /// type of the compiled first order reverse function
+    typedef void (*reverse_one_t)(
+        size_t J, const Base* p, const Base* t, Base* pz
+    );
+    //
+    /// has setup been called since the previous clear
+    bool setup_done_;
+    //
+    /// does the operation sequence contain comparison operators
+    bool has_compare_;
+    //
+    /// handle for the loaded library (null if not loaded)
+    void* handle_;
+    //
+    /// compiled zero order forward function
+    forward_zero_t forward_zero_;
+    //
+    /// compiled first order reverse function
+    reverse_one_t reverse_one_;
+    //
+    /// reason that setup failed (empty if it has not failed)
+    std::string msg_;
+    //
+    /// copy constructor not implemented
+    jit_fun(const jit_fun& other);
+public:
+    /// default constructor
+    jit_fun(void)
+    : setup_done_(false)
+    , has_compare_(false)
+    , handle_(CPPAD_NULL)
+    , forward_zero_(CPPAD_NULL)
+    , reverse_one_(CPPAD_NULL)
+    , msg_("")
+    { }
+    /// destructor unloads the library
+    ~jit_fun(void)
+    {   clear(); }
+    /// assignment does not share the library, it just clears this object
+    void operator=(const jit_fun&)
+    {   clear(); }
+    /// unload the library and set ok to false
+    void clear(void)
+    {
+# if CPPAD_LOCAL_JIT_JIT_FUN_OK
+        if( handle_ != CPPAD_NULL )
+            dlclose(handle_);
+# endif
+        setup_done_   = false;
+        has_compare_  = false;
+        handle_       = CPPAD_NULL;
+        forward_zero_ = CPPAD_NULL;
+        reverse_one_  = CPPAD_NULL;
+        msg_          = "";
+    }
+    /// has setup been called since the previous clear
+    bool setup_done(void) const
+    {   return setup_done_; }
+    /// can forward_zero and reverse_one be used
+    bool ok(void) const
+    {   return handle_ != CPPAD_NULL; }
+    /// does this operation sequence have comparison operators
+    bool has_compare(void) const
+    {   return has_compare_; }
+    /// reason that setup failed
+    const std::string& msg(void) const
+    {   return msg_; }
+    /// swap with another jit_fun object
+    void swap(jit_fun& other)
+    {   std::swap(setup_done_,   other.setup_done_);
+        std::swap(has_compare_,  other.has_compare_);
+        std::swap(handle_,       other.handle_);
+        std::swap(forward_zero_, other.forward_zero_);
+        std::swap(reverse_one_,  other.reverse_one_);
+        msg_.swap(other.msg_);
+    }
+    // -----------------------------------------------------------------------
+    /*!
+    compile and load an operation sequence
+
+    \param play
+    is the operation sequence that is compiled.
+    */
+    void setup(const player<Base>* play)
+    {   clear();
+        setup_done_ = true;
+        //
+        // C source code
+        std::string source;
+        if( ! csrc(play, source, has_compare_) )
+        {   msg_ = "jit: operation sequence is not supported";
+            return;
+        }
+# if ! CPPAD_LOCAL_JIT_JIT_FUN_OK
+# ifndef CPPAD_USE_JIT
+        msg_ = "jit: CPPAD_USE_JIT is not defined";
+# else
+        msg_ = "jit: dlopen or mkdtemp is not available";
+# endif
+# else
+        const char* compiler = CPPAD_C_COMPILER_CMD;
+        if( std::strlen(compiler) == 0 )
+        {   msg_ = "jit: the C compiler command is not known";
+            return;
+        }
+        //
+        // private directory for the temporary files (mode 0700) so that
+        // another user cannot replace the source code or the library
+        std::string directory = "/tmp";
+        const char* tmpdir    = std::getenv("TMPDIR");
+        if( tmpdir != CPPAD_NULL && tmpdir[0] != '\0' )
+            directory = tmpdir;
+        directory += "/cppad_jit_XXXXXX";
+        std::vector<char> pattern( directory.size() + 1 );
+        std::strcpy( &pattern[0], directory.c_str() );
+        if( mkdtemp( &pattern[0] ) == CPPAD_NULL )
+        {   msg_ = "jit: mkdtemp failed for " + directory;
+            return;
+        }
+        directory               = &pattern[0];
+        std::string source_file = directory + "/jit.c";
+        std::string library     = directory + "/jit.so";
+        std::string log_file    = directory + "/jit.log";
+        //
+        // write the source code
+        bool written;
+        {   std::ofstream file( source_file.c_str() );
+            file << source;
+            file.close();
+            written = ! file.fail();
+        }
+        if( ! written )
+            msg_ = "jit: cannot write " + source_file;
+        //
+        // compile the shared library
+        std::string command = compiler;
+        command += " -O1 -fPIC -shared -o '" + library + "'";
+        command += " '" + source_file + "' -lm > '" + log_file + "' 2>&1";
+        if( written && std::system( command.c_str() ) != 0 )
+        {   std::ifstream     file( log_file.c_str() );
+            std::stringstream output;
+            output << file.rdbuf();
+            msg_  = "jit: the command\n" + command + "\n";
+            msg_ += "failed with the output\n" + output.str();
+        }
+        else if( written )
+        {   handle_ = dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL);
+            if( handle_ == CPPAD_NULL )
+            {   const char* error = dlerror();
+                msg_ = "jit: dlopen failed";
+                if( error != CPPAD_NULL )
+                    msg_ += std::string(": ") + error;
+            }
+        }
+        //
+        // the library stays loaded after its file is removed
+        std::remove( log_file.c_str() );
+        std::remove( library.c_str() );
+        std::remove( source_file.c_str() );
+        rmdir( directory.c_str() );
+        if( handle_ == CPPAD_NULL )
+            return;
+        //
+        // function pointers (memcpy avoids object to function pointer cast)
+        void* forward_ptr = dlsym(handle_, "cppad_jit_forward_zero");
+        void* reverse_ptr = dlsym(handle_, "cppad_jit_reverse_one");
+        if( forward_ptr == CPPAD_NULL || reverse_ptr == CPPAD_NULL )
+        {   dlclose(handle_);
+            handle_ = CPPAD_NULL;
+            msg_    = "jit: compiled functions not found in library";
+            return;
+        }
+        std::memcpy(&forward_zero_, &forward_ptr, sizeof(forward_ptr) );
+        std::memcpy(&reverse_one_,  &reverse_ptr, sizeof(reverse_ptr) );
+# endif
+    }
+    // -----------------------------------------------------------------------
+    /*!
+    zero order forward mode using the compiled code
+
+    \param play
+    operation sequence, only used for its parameter values.
+
+    \param J
+    number of columns in the Taylor coefficient matrix.
+
+    \param taylor
+    On input, the zero order coefficients for the independent variables.
+    On output, the zero order coefficients for all the variables.
+    */
+    void forward_zero(const player<Base>* play, size_t J, Base* taylor) const
+    {   CPPAD_ASSERT_UNKNOWN( ok() );
+        CPPAD_ASSERT_UNKNOWN( J >= 1 );
+        forward_zero_(J, play->GetPar(), taylor);
+    }
+    // -----------------------------------------------------------------------
+    /*!
+    first order reverse mode using the compiled code
+
+    \param play
+    operation sequence, only used for its parameter values.
+
+    \param J
+    number of columns in the Taylor coefficient matrix.
+
+    \param taylor
+    zero order coefficients for all the variables.
+
+    \param partial
+    On input, partials w.r.t. the dependent variables.
+    On output, partials w.r.t. all the variables.
+    */
+    void reverse_one(
+        const player<Base>* play    ,
+        size_t              J       ,
+        const Base*         taylor  ,
+        Base*               partial ) const
+    {   CPPAD_ASSERT_UNKNOWN( ok() );
+        CPPAD_ASSERT_UNKNOWN( J >= 1 );
+        reverse_one_(J, play->GetPar(), taylor, partial);
+    }
+};
+
+} } } // END_CPPAD_LOCAL_JIT_NAMESPACE
+
+# undef CPPAD_LOCAL_JIT_JIT_FUN_OK
+
+# endif
@@ -89,7 +89,13 @@ using AD<Base> and computations by this routine are done using type Base.
 
 $head play$$
 is the tape that this operation appears in.
-This is for error detection and not used when NDEBUG is defined.
+If there is no store operator for $icode v$$,
+$codei%%play%->vecad_store(%arg%[0] - 1)%$$ is false and
+$codei%
+    %play%->GetVecInd(%arg%[0] + %i_vec%)
+%$$
+is the parameter index for the element of $icode v$$ that is loaded.
+In this case $icode vec_ad2isvar$$ and $icode vec_ad2index$$ are not used.
 
 $head i_z$$
 is the AD variable index corresponding to the result of this load operation.
@@ -133,6 +139,7 @@ is set to the zero order Taylor coefficient for the result of this operator.
 
 $head vec_ad2isvar$$
 This vector has size $icode n_all$$.
+It is only used when there is a store operator for $icode v$$.
 If $icode%vec_ad2isvar%[ %arg%[%0%] + %i_vec% ]%$$ is false (true),
 the vector element is parameter (variable).
 
@@ -188,13 +195,19 @@ void forward_load_p_op_0(
 
     addr_t i_vec = addr_t( Integer( parameter[ arg[1] ] ) );
     CPPAD_ASSERT_KNOWN(
-        size_t(i_vec) < vec_ad2index[ arg[0] - 1 ] ,
+        size_t(i_vec) < play->GetVecInd( size_t(arg[0] - 1) ) ,
         "VecAD: dynamic parmaeter index out or range during zero order forward"
     );
     CPPAD_ASSERT_UNKNOWN( size_t(arg[0] + i_vec) < play->num_var_vecad_ind_rec() );
 
-    size_t i_pv   = vec_ad2index[ arg[0] + i_vec ];
     Base* z       = taylor + i_z * cap_order;
+    if( ! play->vecad_store( size_t(arg[0] - 1) ) )
+    {   // the elements of this vector are always the recorded parameters
+        load_op2var[ arg[2] ] = 0;
+        z[0] = parameter[ play->GetVecInd( size_t(arg[0] + i_vec) ) ];
+        return;
+    }
+    size_t i_pv   = vec_ad2index[ arg[0] + i_vec ];
     if( vec_ad2isvar[ arg[0] + i_vec ]  )
     {   CPPAD_ASSERT_UNKNOWN( i_pv < i_z );
         load_op2var[ arg[2] ] = addr_t( i_pv );
@@ -230,13 +243,19 @@ void forward_load_v_op_0(
 
     addr_t i_vec = addr_t(Integer(taylor[ size_t(arg[1]) * cap_order + 0 ] ));
     CPPAD_ASSERT_KNOWN(
-        size_t(i_vec) < vec_ad2index[ arg[0] - 1 ] ,
+        size_t(i_vec) < play->GetVecInd( size_t(arg[0] - 1) ) ,
         "VecAD: variable index out or range during zero order forward"
     );
     CPPAD_ASSERT_UNKNOWN( size_t(arg[0] + i_vec) < play->num_var_vecad_ind_rec() );
 
-    size_t i_pv   = vec_ad2index[ arg[0] + i_vec ];
     Base* z       = taylor + i_z * cap_order;
+    if( ! play->vecad_store( size_t(arg[0] - 1) ) )
+    {   // the elements of this vector are always the recorded parameters
+        load_op2var[ arg[2] ] = 0;
+        z[0] = parameter[ play->GetVecInd( size_t(arg[0] + i_vec) ) ];
+        return;
+    }
+    size_t i_pv   = vec_ad2index[ arg[0] + i_vec ];
     if( vec_ad2isvar[ arg[0] + i_vec ]  )
     {   CPPAD_ASSERT_UNKNOWN( i_pv < i_z );
         load_op2var[ arg[2] ] = addr_t( i_pv );
@@ -101,13 +101,23 @@ void forward_log_op_dir(
     Base* x = taylor + i_x * num_taylor_per_var;
     Base* z = taylor + i_z * num_taylor_per_var;
 
-    size_t m = (q-1) * r + 1;
+    // directions are the inner loops; see forward_mulvv_op_dir
+    size_t m   = (q-1) * r + 1;
+    Base   bq  = Base(double(q));
+    Base   bx0 = bq * x[0];
+    Base*  zq  = z + m;
+    const Base* xq = x + m;
     for(size_t ell = 0; ell < r; ell++)
-    {   z[m+ell] = Base(double(q)) * x[m+ell];
-        for(size_t k = 1; k < q; k++)
-            z[m+ell] -= Base(double(k)) * z[(k-1)*r+1+ell] * x[(q-k-1)*r+1+ell];
-        z[m+ell] /= (Base(double(q)) * x[0]);
+        zq[ell] = bq * xq[ell];
+    for(size_t k = 1; k < q; k++)
+    {   Base bk = Base(double(k));
+        const Base* zk = z + (k-1)*r + 1;
+        const Base* xk = x + (q-k-1)*r + 1;
+        for(size_t ell = 0; ell < r; ell++)
+            zq[ell] -= bk * zk[ell] * xk[ell];
     }
+    for(size_t ell = 0; ell < r; ell++)
+        zq[ell] /= bx0;
 }
 
 /*!
@@ -97,12 +97,22 @@ void forward_mulvv_op_dir(
     Base* y = taylor + size_t(arg[1]) * num_taylor_per_var;
     Base* z = taylor +    i_z * num_taylor_per_var;
 
-    size_t k, ell, m;
-    for(ell = 0; ell < r; ell++)
-    {   m = (q-1)*r + ell + 1;
-        z[m] = x[0] * y[m] + x[m] * y[0];
-        for(k = 1; k < q; k++)
-            z[m] += x[(q-k-1)*r + ell + 1] * y[(k-1)*r + ell + 1];
+    // The directions are the inner loops so that memory access is
+    // contiguous, and the zero order coefficients are copied to local
+    // variables so the compiler knows they do not change during the loops.
+    size_t m  = (q-1)*r + 1;
+    Base   x0 = x[0];
+    Base   y0 = y[0];
+    Base*  zq = z + m;
+    const Base* xq = x + m;
+    const Base* yq = y + m;
+    for(size_t ell = 0; ell < r; ell++)
+        zq[ell] = x0 * yq[ell] + xq[ell] * y0;
+    for(size_t k = 1; k < q; k++)
+    {   const Base* xk = x + (q-k-1)*r + 1;
+        const Base* yk = y + (k-1)*r + 1;
+        for(size_t ell = 0; ell < r; ell++)
+            zq[ell] += xk[ell] * yk[ell];
     }
 }
 
@@ -68,6 +68,12 @@ On input, op_usage[i] is the usage for
 the i-th operator in the operation sequence not counting previous
 optimization.
 On output, it is the usage counting previous operator optimization.
+
+\param grow_hash_table
+If true, an op_hash_table, that grows with the number of operators,
+is used to find matching operators.
+Otherwise, a list_setvec with CPPAD_HASH_TABLE_SIZE sets is used
+and the set for a hash code is restarted when it gets too long.
 */
 
 template <class Addr, class Base>
@@ -76,7 +82,8 @@ void get_op_previous(
     const play::const_random_iterator<Addr>&    random_itr          ,
     sparse::list_setvec&                        cexp_set            ,
     pod_vector<addr_t>&                         op_previous         ,
-    pod_vector<usage_t>&                        op_usage            )
+    pod_vector<usage_t>&                        op_usage            ,
+    bool                                        grow_hash_table     )
 {
     // number of operators in the tape
     const size_t num_op = random_itr.num_op();
@@ -94,7 +101,11 @@ void get_op_previous(
     // compute op_previous
     // ----------------------------------------------------------------------
     sparse::list_setvec  hash_table_op;
-    hash_table_op.resize(CPPAD_HASH_TABLE_SIZE, num_op);
+    op_hash_table        hash_table_grow;
+    if( grow_hash_table )
+        hash_table_grow.resize(CPPAD_HASH_TABLE_SIZE, num_op);
+    else
+        hash_table_op.resize(CPPAD_HASH_TABLE_SIZE, num_op);
     //
     pod_vector<bool> work_bool;
     pod_vector<addr_t> work_addr_t;
@@ -177,7 +188,15 @@ void get_op_previous(
             case ZmulpvOp:
             case ZmulvpOp:
             case ZmulvvOp:
-            match_op(
+            if( grow_hash_table ) match_op(
+                random_itr,
+                op_previous,
+                i_op,
+                hash_table_grow,
+                work_bool,
+                work_addr_t
+            );
+            else match_op(
                 random_itr,
                 op_previous,
                 i_op,
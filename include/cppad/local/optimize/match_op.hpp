@@ -11,7 +11,7 @@ Secondary License when the conditions for such availability set forth
 in the Eclipse Public License, Version 2.0 are satisfied:
       GNU General Public License, Version 2.0 or later.
 ---------------------------------------------------------------------------- */
-# include <cppad/local/optimize/hash_code.hpp>
+# include <cppad/local/optimize/op_hash_table.hpp>
 /*!
 \file match_op.hpp
 Check if current operator matches a previous operator.
@@ -68,6 +68,9 @@ then the operation op_previous[i_op] has hash code j,
 and op_previous[i_op] does not match any other element of set[j].
 An entry to set[j] is added each time match_op is called
 and a match for the current operator is not found.
+If HashTable is op_hash_table, the same is true except that
+the hash codes are not limited to CPPAD_HASH_TABLE_SIZE and
+the sets are never restarted; see hash_table_collision.
 
 \param work_bool
 work space that is used by match_op between calls to increase speed.
@@ -80,12 +83,12 @@ Should be empty on first call for this forward passs of the operation
 sequence and not modified untill forward pass is done
 
 */
-template <class Addr>
+template <class Addr, class HashTable>
 void match_op(
     const play::const_random_iterator<Addr>&    random_itr     ,
     pod_vector<addr_t>&                         op_previous    ,
     size_t                                      current        ,
-    sparse::list_setvec&                        hash_table_op  ,
+    HashTable&                                  hash_table_op  ,
     pod_vector<bool>&                           work_bool      ,
     pod_vector<addr_t>&                         work_addr_t    )
 {   //
@@ -109,9 +112,6 @@ void match_op(
     CPPAD_ASSERT_UNKNOWN( var2previous_var.size() == num_var );
     CPPAD_ASSERT_UNKNOWN( num_op == op_previous.size() );
     CPPAD_ASSERT_UNKNOWN( op_previous[current] == 0 );
-    CPPAD_ASSERT_UNKNOWN(
-        hash_table_op.n_set() == CPPAD_HASH_TABLE_SIZE
-    );
     CPPAD_ASSERT_UNKNOWN( hash_table_op.end() == num_op );
     CPPAD_ASSERT_UNKNOWN( current < num_op );
     //
@@ -139,10 +139,12 @@ void match_op(
             arg_match[j] = var2previous_var[ arg[j] ];
     }
     //
-    size_t code = optimize_hash_code(opcode_t(op), num_arg, arg_match);
+    size_t code = hash_table_code(
+        hash_table_op, opcode_t(op), num_arg, arg_match
+    );
     //
     // iterator for the set with this hash code
-    sparse::list_setvec_const_iterator itr(hash_table_op, code);
+    typename HashTable::const_iterator itr(hash_table_op, code);
     //
     // check for a match
     size_t count = 0;
@@ -185,8 +187,10 @@ void match_op(
     {   CPPAD_ASSERT_UNKNOWN( NumArg(op) == 2 );
         std::swap( arg_match[0], arg_match[1] );
         //
-        code      = optimize_hash_code(opcode_t(op), num_arg, arg_match);
-        sparse::list_setvec_const_iterator itr_swap(hash_table_op, code);
+        size_t code_swap = hash_table_code(
+            hash_table_op, opcode_t(op), num_arg, arg_match
+        );
+        typename HashTable::const_iterator itr_swap(hash_table_op, code_swap);
         while( *itr_swap != num_op )
         {
             size_t candidate  = *itr_swap;
@@ -216,12 +220,11 @@ void match_op(
             ++itr_swap;
         }
     }
-    CPPAD_ASSERT_UNKNOWN( count < 11 );
-    if( count == 10 )
-    {   // restart the list
-        hash_table_op.clear(code);
-    }
+    // (list_setvec) restart the list if it is too long
+    hash_table_collision(hash_table_op, code, count);
     // No match was found. Add this operator the the set for this hash code
+    // (use the code for the original argument order because the
+    // op_hash_table code depends on the order).
     // Not using post_element becasue we need to iterate for
     // this code before adding another element for this code.
     hash_table_op.add_element(code, current);
@@ -0,0 +1,258 @@
+# ifndef CPPAD_LOCAL_OPTIMIZE_OP_HASH_TABLE_HPP
+# define CPPAD_LOCAL_OPTIMIZE_OP_HASH_TABLE_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+# include <cppad/local/pod_vector.hpp>
+# include <cppad/local/sparse/list_setvec.hpp>
+# include <cppad/local/optimize/hash_code.hpp>
+
+/*!
+\file op_hash_table.hpp
+Growable hash table used to match operators during optimization.
+*/
+
+// BEGIN_CPPAD_LOCAL_OPTIMIZE_NAMESPACE
+namespace CppAD { namespace local { namespace optimize {
+
+class op_hash_table_const_iterator;
+
+/*!
+Open addressing hash table from operator hash codes to operator indices.
+
+This is used by match_op in place of a sparse::list_setvec with
+CPPAD_HASH_TABLE_SIZE sets when the grow_hash_table optimize option
+is present. The number of slots is a power of two and it is doubled
+when more than half of the slots are in use, so the expected number of
+probes for each search does not depend on the size of the tape.
+*/
+class op_hash_table {
+private:
+    /// value returned by an iterator when there are no more elements
+    size_t end_;
+
+    /// number of slots that are in use
+    size_t n_used_;
+
+    /// operator index for each slot (zero for an empty slot)
+    pod_vector<addr_t> slot_op_;
+
+    /// hash code for the operator in each slot (used to grow the table)
+    pod_vector<size_t> slot_code_;
+
+    /// mask that maps a hash code to a slot index
+    size_t mask_;
+
+    /// put an element in the table without checking its size
+    void insert(size_t code, size_t i_op)
+    {   size_t slot = code & mask_;
+        while( slot_op_[slot] != 0 )
+            slot = (slot + 1) & mask_;
+        slot_op_[slot]   = addr_t( i_op );
+        slot_code_[slot] = code;
+        ++n_used_;
+    }
+
+    /// double the number of slots
+    void grow(void)
+    {   pod_vector<addr_t> old_op;
+        pod_vector<size_t> old_code;
+        old_op.swap(slot_op_);
+        old_code.swap(slot_code_);
+        //
+        size_t n_slot = 2 * old_op.size();
+        slot_op_.resize(n_slot);
+        slot_code_.resize(n_slot);
+        for(size_t i = 0; i < n_slot; ++i)
+            slot_op_[i] = 0;
+        mask_   = n_slot - 1;
+        n_used_ = 0;
+        for(size_t i = 0; i < old_op.size(); ++i)
+        {   if( old_op[i] != 0 )
+                insert(old_code[i], size_t( old_op[i] ));
+        }
+    }
+public:
+    /// type of iterator for the elements with a specified hash code
+    typedef op_hash_table_const_iterator const_iterator;
+    friend class op_hash_table_const_iterator;
+
+    /// default constructor
+    op_hash_table(void) : end_(0), n_used_(0), mask_(0)
+    { }
+
+    /*!
+    Start a new table with no elements.
+
+    \param n_slot
+    is the initial number of slots. It is rounded up to a power of two.
+
+    \param end
+    is the number of operators in the tape. All the elements in the
+    table are less than end and greater than zero.
+    */
+    void resize(size_t n_slot, size_t end)
+    {   size_t n = 2;
+        while( n < n_slot )
+            n *= 2;
+        slot_op_.resize(n);
+        slot_code_.resize(n);
+        for(size_t i = 0; i < n; ++i)
+            slot_op_[i] = 0;
+        mask_   = n - 1;
+        n_used_ = 0;
+        end_    = end;
+    }
+
+    /// the value returned by an iterator when there are no more elements
+    size_t end(void) const
+    {   return end_; }
+
+    /// number of slots in the table
+    size_t n_slot(void) const
+    {   return slot_op_.size(); }
+
+    /*!
+    Add an element to the table.
+
+    \param code
+    is the hash code for this element; see hash_table_code.
+
+    \param i_op
+    is the operator index for this element.
+    */
+    void add_element(size_t code, size_t i_op)
+    {   CPPAD_ASSERT_UNKNOWN( 0 < i_op && i_op < end_ );
+        if( 2 * (n_used_ + 1) > slot_op_.size() )
+            grow();
+        insert(code, i_op);
+    }
+};
+
+/*!
+Iterator over the elements of an op_hash_table that have a specified
+hash code.
+*/
+class op_hash_table_const_iterator {
+private:
+    /// the table we are iterating
+    const op_hash_table& table_;
+
+    /// the hash code we are searching for
+    const size_t code_;
+
+    /// current slot
+    size_t slot_;
+
+    /// advance slot_ to the next slot with this code or an empty slot
+    void skip(void)
+    {   while( table_.slot_op_[slot_] != 0 &&
+               table_.slot_code_[slot_] != code_ )
+            slot_ = (slot_ + 1) & table_.mask_;
+    }
+public:
+    /// construct an iterator for the elements with a specified hash code
+    op_hash_table_const_iterator(const op_hash_table& table, size_t code)
+    : table_(table), code_(code), slot_(code & table.mask_)
+    {   skip(); }
+
+    /// current element (table.end() if there are no more elements)
+    size_t operator*(void) const
+    {   if( table_.slot_op_[slot_] == 0 )
+            return table_.end_;
+        return size_t( table_.slot_op_[slot_] );
+    }
+
+    /// advance to the next element
+    op_hash_table_const_iterator& operator++(void)
+    {   CPPAD_ASSERT_UNKNOWN( table_.slot_op_[slot_] != 0 );
+        slot_ = (slot_ + 1) & table_.mask_;
+        skip();
+        return *this;
+    }
+};
+
+// ---------------------------------------------------------------------------
+/*!
+Hash code for an operator and its arguments in a list_setvec hash table.
+
+\return
+is optimize_hash_code(op, num_arg, arg) which is
+between zero and CPPAD_HASH_TABLE_SIZE - 1.
+*/
+inline size_t hash_table_code(
+    const sparse::list_setvec&  /* hash_table */ ,
+    opcode_t                    op               ,
+    size_t                      num_arg          ,
+    const addr_t*               arg              )
+{   return optimize_hash_code(op, num_arg, arg); }
+
+/*!
+Hash code for an operator and its arguments in an op_hash_table.
+
+\return
+is a hash code that uses all the bits in a size_t value.
+Unlike optimize_hash_code, the arguments are mixed so that
+changing the order of the arguments changes the code.
+*/
+inline size_t hash_table_code(
+    const op_hash_table&        /* hash_table */ ,
+    opcode_t                    op               ,
+    size_t                      num_arg          ,
+    const addr_t*               arg              )
+{   // 2^32 / golden ratio (fits in a size_t with 32 bits)
+    const size_t multiplier = size_t( 2654435769UL );
+    size_t code = size_t(op);
+    for(size_t i = 0; i < num_arg; i++)
+    {   code  = (code ^ size_t(arg[i])) * multiplier;
+        code ^= code >> 16;
+    }
+    return code;
+}
+
+/*!
+Limit the length of the list of elements with a specified hash code
+in a list_setvec hash table.
+
+\param hash_table
+is the table.
+
+\param code
+is the hash code that was just searched.
+
+\param count
+is the number of elements in the list for this code.
+If it is ten, the list is restarted.
+*/
+inline void hash_table_collision(
+    sparse::list_setvec&        hash_table ,
+    size_t                      code       ,
+    size_t                      count      )
+{   CPPAD_ASSERT_UNKNOWN( count < 11 );
+    if( count == 10 )
+    {   // restart the list
+        hash_table.clear(code);
+    }
+}
+
+/*!
+Limit the length of the list of elements with a specified hash code
+in an op_hash_table (there is no limit because the table grows).
+*/
+inline void hash_table_collision(
+    op_hash_table&              /* hash_table */ ,
+    size_t                      /* code */       ,
+    size_t                      /* count */      )
+{ }
+
+} } } // END_CPPAD_LOCAL_OPTIMIZE_NAMESPACE
+
+# endif
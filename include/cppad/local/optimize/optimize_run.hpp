@@ -83,6 +83,13 @@ will be removed from the optimized tape.
 These operators are useful for reporting problems evaluating derivatives
 at independent variable values different from those used to record a function.
 
+$subhead grow_hash_table$$
+If this sub-string appears,
+an $code op_hash_table$$, that grows with the number of operators,
+is used to find matching operators.
+Otherwise, a $code list_setvec$$ with $code CPPAD_HASH_TABLE_SIZE$$ sets
+is used.
+
 $head n$$
 is the number of independent variables on the tape.
 
@@ -132,6 +139,7 @@ void optimize_run(
     bool conditional_skip = true;
     bool compare_op       = true;
     bool print_for_op     = true;
+    bool grow_hash_table  = false;
     size_t index = 0;
     while( index < options.size() )
     {   while( index < options.size() && options[index] == ' ' )
@@ -146,6 +154,8 @@ void optimize_run(
                 compare_op = false;
             else if( option == "no_print_for_op" )
                 print_for_op = false;
+            else if( option == "grow_hash_table" )
+                grow_hash_table = true;
             else
             {   option += " is not a valid optimize option";
                 CPPAD_ASSERT_KNOWN( false , option.c_str() );
@@ -206,7 +216,8 @@ void optimize_run(
         random_itr,
         cexp_set,
         op_previous,
-        op_usage
+        op_usage,
+        grow_hash_table
     );
     size_t num_cexp = cexp2op.size();
     CPPAD_ASSERT_UNKNOWN( conditional_skip || num_cexp == 0 );
@@ -566,13 +577,17 @@ void optimize_run(
         // is this new result the top of a cummulative summation
         bool top_csum;
         //
-        // determine if we should insert a conditional skip here
+        // determine if we should insert conditional skips here
+        // (all the skips that can be inserted here are inserted so that the
+        // operators that follow are not separated by CSkipOp operators)
         bool skip  = conditional_skip;
         if( skip )
-        {   skip      &= cskip_order_next < num_cexp;
-            skip      &= op != BeginOp;
+        {   skip      &= op != BeginOp;
             skip      &= op != InvOp;
             skip      &= atom_state == start_atom;
+        }
+        while( skip )
+        {   skip &= cskip_order_next < num_cexp;
             if( skip )
             {   size_t j = cskip_order[cskip_order_next];
                 if( NumRes(op) > 0 )
@@ -585,8 +600,7 @@ void optimize_run(
                 cskip_order_next++;
                 size_t n_true   = skip_op_true.number_elements(j);
                 size_t n_false  = skip_op_false.number_elements(j);
-                skip &= n_true > 0 || n_false > 0;
-                if( skip )
+                if( n_true > 0 || n_false > 0 )
                 {   CPPAD_ASSERT_UNKNOWN( NumRes(CSkipOp) == 0 );
                     size_t n_arg   = 7 + size_t(n_true) + size_t(n_false);
                     // reserve space for the arguments to this operator but
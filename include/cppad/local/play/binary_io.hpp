@@ -0,0 +1,158 @@
+# ifndef CPPAD_LOCAL_PLAY_BINARY_IO_HPP
+# define CPPAD_LOCAL_PLAY_BINARY_IO_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+# include <algorithm>
+# include <iostream>
+# include <string>
+# include <cppad/local/pod_vector.hpp>
+# include <cppad/local/is_pod.hpp>
+
+// BEGIN_CPPAD_LOCAL_PLAY_NAMESPACE
+namespace CppAD { namespace local { namespace play {
+/*!
+\file binary_io.hpp
+Read and write scalars and pod vectors using their binary representation.
+
+\par
+Each vector is written as its size (a size_t) followed by its elements.
+The elements are written using one call to write and read using a few
+calls to read, so there is no conversion or parsing.
+The size of a vector is not trusted when it is read; see binary_read_data.
+*/
+
+/// write one scalar value
+template <class Type>
+void binary_write(std::ostream& os, const Type& value)
+{   os.write( reinterpret_cast<const char*>(&value), sizeof(Type) ); }
+
+/// write a pod_vector
+template <class Type>
+void binary_write(std::ostream& os, const pod_vector<Type>& vec)
+{   size_t n = vec.size();
+    binary_write(os, n);
+    if( n > 0 ) os.write(
+        reinterpret_cast<const char*>( vec.data() ),
+        std::streamsize( n * sizeof(Type) )
+    );
+}
+
+/// write a pod_vector_maybe (Type must be plain old data)
+template <class Type>
+void binary_write(std::ostream& os, const pod_vector_maybe<Type>& vec)
+{   CPPAD_ASSERT_UNKNOWN( is_pod<Type>() );
+    size_t n = vec.size();
+    binary_write(os, n);
+    if( n > 0 ) os.write(
+        reinterpret_cast<const char*>( vec.data() ),
+        std::streamsize( n * sizeof(Type) )
+    );
+}
+
+/// write a string
+inline void binary_write(std::ostream& os, const std::string& str)
+{   size_t n = str.size();
+    binary_write(os, n);
+    os.write( str.data(), std::streamsize(n) );
+}
+
+/*!
+read one scalar value
+
+\return
+is false if the read failed.
+*/
+template <class Type>
+bool binary_read(std::istream& is, Type& value)
+{   is.read( reinterpret_cast<char*>(&value), sizeof(Type) );
+    return bool(is);
+}
+
+/*!
+read the elements of a vector
+
+\tparam Type
+is the type of the elements of the vector.
+
+\tparam Vector
+is pod_vector<Type> or pod_vector_maybe<Type>.
+
+\param is
+is the stream that the elements are read from.
+
+\param n
+is the number of elements, as read from the stream.
+
+\param vec
+Upon return, if the read succeeded, vec.size() is n and
+its elements are the values read.
+
+\return
+is false if the read failed.
+
+\par
+The vector is extended one chunk (about a megabyte) at a time.
+Thus if the stream is truncated or corrupt, and n is very large,
+the read fails at the end of the stream instead of first
+allocating memory for n elements.
+*/
+template <class Type, class Vector>
+bool binary_read_data(std::istream& is, size_t n, Vector& vec)
+{   size_t chunk = 1 + (size_t(1) << 20) / sizeof(Type);
+    vec.resize(0);
+    while( vec.size() < n )
+    {   size_t m     = std::min(n - vec.size(), chunk);
+        size_t start = vec.extend(m);
+        is.read(
+            reinterpret_cast<char*>( vec.data() + start ),
+            std::streamsize( m * sizeof(Type) )
+        );
+        if( ! is )
+            return false;
+    }
+    return true;
+}
+
+/// read a pod_vector (return false if the read failed)
+template <class Type>
+bool binary_read(std::istream& is, pod_vector<Type>& vec)
+{   size_t n;
+    if( ! binary_read(is, n) )
+        return false;
+    return binary_read_data<Type>(is, n, vec);
+}
+
+/// read a pod_vector_maybe (return false if the read failed)
+template <class Type>
+bool binary_read(std::istream& is, pod_vector_maybe<Type>& vec)
+{   CPPAD_ASSERT_UNKNOWN( is_pod<Type>() );
+    size_t n;
+    if( ! binary_read(is, n) )
+        return false;
+    return binary_read_data<Type>(is, n, vec);
+}
+
+/// read a string (return false if the read failed)
+inline bool binary_read(std::istream& is, std::string& str)
+{   size_t n;
+    if( ! binary_read(is, n) )
+        return false;
+    pod_vector<char> vec;
+    if( ! binary_read_data<char>(is, n, vec) )
+        return false;
+    str.assign(vec.data(), n);
+    return true;
+}
+
+} } } // END_CPPAD_LOCAL_PLAY_NAMESPACE
+
+# endif
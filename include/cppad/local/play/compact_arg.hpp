@@ -0,0 +1,280 @@
+# ifndef CPPAD_LOCAL_PLAY_COMPACT_ARG_HPP
+# define CPPAD_LOCAL_PLAY_COMPACT_ARG_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+// BEGIN_CPPAD_LOCAL_PLAY_NAMESPACE
+namespace CppAD { namespace local { namespace play {
+
+/*!
+\file compact_arg.hpp
+Compact encoding of the operator arguments in a player.
+
+\par Encoding
+The arguments for each operator, except CSumOp and CSkipOp, are stored
+as NumArg(op) unsigned LEB128 varints; i.e., seven bits per byte with the
+high bit set when more bytes follow.
+An argument that is a variable index is replaced by the difference between
+the var_index for the operator, as reported by const_sequential_iterator,
+and the argument. This difference is usually small so most arguments
+use one byte.
+The first byte in the encoding is a zero that does not correspond to any
+argument. It stops the backward scan done by compact_arg_back.
+
+\par CSumOp and CSkipOp
+The arguments for these operators are not encoded. They are copied to a
+separate addr_t vector in the same order and format as in the uncompressed
+argument vector; see const_sequential_iterator::correct_before_increment.
+*/
+
+/*!
+Which arguments, for an operator, are variable indices.
+
+\param op
+is the operator.
+
+\return
+bit i is set if the i-th argument is a variable index.
+The value for CExpOp and PriOp is zero because this information
+is in the arguments; see compact_arg_decode.
+The value for CSumOp and CSkipOp is zero because their arguments
+are not encoded.
+*/
+inline size_t compact_arg_mask(OpCode op)
+{   switch( op )
+    {
+        // first argument is a variable
+        case AbsOp:
+        case AcoshOp:
+        case AcosOp:
+        case AsinhOp:
+        case AsinOp:
+        case AtanhOp:
+        case AtanOp:
+        case CoshOp:
+        case CosOp:
+        case DivvpOp:
+        case ErfOp:
+        case ErfcOp:
+        case Expm1Op:
+        case ExpOp:
+        case FunavOp:
+        case LevpOp:
+        case Log1pOp:
+        case LogOp:
+        case LtvpOp:
+        case PowvpOp:
+        case SignOp:
+        case SinhOp:
+        case SinOp:
+        case SqrtOp:
+        case SubvpOp:
+        case TanhOp:
+        case TanOp:
+        case ZmulvpOp:
+        return 1;
+
+        // second argument is a variable
+        case AddpvOp:
+        case DisOp:
+        case DivpvOp:
+        case EqpvOp:
+        case LdvOp:
+        case LepvOp:
+        case LtpvOp:
+        case MulpvOp:
+        case NepvOp:
+        case PowpvOp:
+        case StvpOp:
+        case SubpvOp:
+        case ZmulpvOp:
+        return 2;
+
+        // first and second arguments are variables
+        case AddvvOp:
+        case DivvvOp:
+        case EqvvOp:
+        case LevvOp:
+        case LtvvOp:
+        case MulvvOp:
+        case NevvOp:
+        case PowvvOp:
+        case SubvvOp:
+        case ZmulvvOp:
+        return 3;
+
+        // third argument is a variable
+        case StpvOp:
+        return 4;
+
+        // second and third arguments are variables
+        case StvvOp:
+        return 6;
+
+        default:
+        break;
+    }
+    return 0;
+}
+
+/*!
+Append an argument to a compact encoding.
+
+\param value
+is the value that is encoded.
+
+\param vec [in,out]
+the encoding for value is added at the end of this vector.
+*/
+inline void compact_arg_write(addr_t value, pod_vector<unsigned char>& vec)
+{   size_t v = size_t(value);
+    while( v >= 128 )
+    {   vec.push_back( static_cast<unsigned char>( (v & 127) | 128 ) );
+        v >>= 7;
+    }
+    vec.push_back( static_cast<unsigned char>(v) );
+}
+
+/*!
+Read an argument from a compact encoding.
+
+\param ptr [in,out]
+On input, it points to the first byte of the encoded value.
+On output, it points to the byte following the encoded value.
+
+\return
+the value that was encoded.
+*/
+inline addr_t compact_arg_read(const unsigned char*& ptr)
+{   unsigned char byte  = *ptr++;
+    size_t        value = byte & 127;
+    size_t        shift = 7;
+    while( byte & 128 )
+    {   byte   = *ptr++;
+        value |= size_t(byte & 127) << shift;
+        shift += 7;
+    }
+    return addr_t(value);
+}
+
+/*!
+Backup over the arguments for an operator in a compact encoding.
+
+\param n_arg
+is the number of arguments that are encoded for this operator.
+
+\param ptr
+points to the byte following the encoding for the last argument.
+
+\return
+pointer to the first byte of the encoding for the first argument.
+*/
+inline const unsigned char* compact_arg_back(
+    size_t n_arg, const unsigned char* ptr
+)
+{   for(size_t i = 0; i < n_arg; ++i)
+    {   // last byte for this argument
+        --ptr;
+        // other bytes for this argument have their high bit set
+        while( *(ptr - 1) & 128 )
+            --ptr;
+    }
+    return ptr;
+}
+
+/*!
+Decode the arguments for an operator.
+
+\param op
+is the operator. If it is CSumOp or CSkipOp, there are no arguments
+to decode because NumArg(op) is zero.
+
+\param var_index
+is the var_index for this operator; see
+const_sequential_iterator::op_info.
+
+\param ptr
+points to the first byte of the encoding for the first argument.
+
+\param arg [out]
+the NumArg(op) arguments for this operator are stored here.
+
+\return
+pointer to the byte following the encoding for the last argument.
+*/
+inline const unsigned char* compact_arg_decode(
+    OpCode               op        ,
+    size_t               var_index ,
+    const unsigned char* ptr       ,
+    addr_t*              arg       )
+{   size_t n_arg = NumArg(op);
+    size_t mask  = compact_arg_mask(op);
+    CPPAD_ASSERT_UNKNOWN( n_arg <= 6 );
+    for(size_t i = 0; i < n_arg; ++i)
+    {   addr_t value = compact_arg_read(ptr);
+        if( mask & (size_t(1) << i) )
+            value = addr_t( var_index - size_t(value) );
+        arg[i] = value;
+        //
+        // PriOp: arg[1] and arg[3] can be variables
+        if( op == PriOp && i == 0 )
+            mask = ( size_t(value & 1) << 1 ) | ( size_t(value & 2) << 2 );
+        //
+        // CExpOp: arg[2], ..., arg[5] can be variables
+        if( op == CExpOp && i == 1 )
+            mask = size_t(value & 15) << 2;
+    }
+    return ptr;
+}
+
+/*!
+Encode the arguments for an operator.
+
+\param op
+is the operator. It must not be CSumOp or CSkipOp.
+
+\param var_index
+is the var_index for this operator.
+
+\param arg
+are the NumArg(op) arguments for this operator.
+
+\param vec [in,out]
+the encoding of the arguments is added at the end of this vector.
+*/
+inline void compact_arg_encode(
+    OpCode                     op        ,
+    size_t                     var_index ,
+    const addr_t*              arg       ,
+    pod_vector<unsigned char>& vec       )
+{   size_t n_arg = NumArg(op);
+    size_t mask  = compact_arg_mask(op);
+    CPPAD_ASSERT_UNKNOWN( n_arg <= 6 );
+    for(size_t i = 0; i < n_arg; ++i)
+    {   addr_t value = arg[i];
+        if( mask & (size_t(1) << i) )
+        {   CPPAD_ASSERT_UNKNOWN( size_t(value) <= var_index );
+            value = addr_t( var_index - size_t(value) );
+        }
+        compact_arg_write(value, vec);
+        //
+        if( op == PriOp && i == 0 )
+            mask = ( size_t(arg[0] & 1) << 1 ) | ( size_t(arg[0] & 2) << 2 );
+        //
+        if( op == CExpOp && i == 1 )
+            mask = size_t(arg[1] & 15) << 2;
+    }
+}
+
+} } } // BEGIN_CPPAD_LOCAL_PLAY_NAMESPACE
+
+# endif
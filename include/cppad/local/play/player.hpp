@@ -1,7 +1,7 @@
 # ifndef CPPAD_LOCAL_PLAY_PLAYER_HPP
 # define CPPAD_LOCAL_PLAY_PLAYER_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -12,12 +12,15 @@ in the Eclipse Public License, Version 2.0 are satisfied:
       GNU General Public License, Version 2.0 or later.
 ---------------------------------------------------------------------------- */
 
+# include <algorithm>
 # include <cppad/local/play/addr_enum.hpp>
 # include <cppad/local/play/sequential_iterator.hpp>
 # include <cppad/local/play/subgraph_iterator.hpp>
 # include <cppad/local/play/random_setup.hpp>
+# include <cppad/local/play/binary_io.hpp>
 # include <cppad/local/atom_state.hpp>
 # include <cppad/local/is_pod.hpp>
+# include <cppad/utility/thread_alloc.hpp>
 
 namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
 /*!
@@ -39,87 +42,211 @@ class player {
     template <class AnotherBase> friend class player;
 private:
     // ----------------------------------------------------------------------
-    // information that defines the recording
+    /*!
+    Information that defines the recording, except for the parameter values.
+    This information is never changed once it is set by get_recording,
+    so it can be shared by more than one player (see share below).
+    */
+    struct shared_info {
+        /// number of players that are using this information
+        size_t count_;
+
+        /// Number of independent dynamic parameters
+        size_t num_dynamic_ind_;
 
-    /// Number of independent dynamic parameters
-    size_t num_dynamic_ind_;
+        /// Number of variables in the recording.
+        size_t num_var_rec_;
 
-    /// Number of variables in the recording.
-    size_t num_var_rec_;
+        /// number of vecad load opeations in the reconding
+        size_t num_var_load_rec_;
 
-    /// number of vecad load opeations in the reconding
-    size_t num_var_load_rec_;
+        /// Number of VecAD vectors in the recording
+        size_t num_var_vecad_rec_;
+
+        /// The operators in the recording.
+        pod_vector<opcode_t> op_vec_;
 
-    /// Number of VecAD vectors in the recording
-    size_t num_var_vecad_rec_;
+        /// The operation argument indices in the recording
+        /// (empty when arg_compact_ is not empty)
+        pod_vector<addr_t> arg_vec_;
 
-    /// The operators in the recording.
-    pod_vector<opcode_t> op_vec_;
+        /// If not empty, the compact encoding for the arguments of all
+        /// the operators except CSumOp and CSkipOp; see compact_arg.hpp.
+        pod_vector<unsigned char> arg_compact_;
 
-    /// The operation argument indices in the recording
-    pod_vector<addr_t> arg_vec_;
+        /// If arg_compact_ is not empty, the arguments for the
+        /// CSumOp and CSkipOp operators.
+        pod_vector<addr_t> arg_long_;
 
-    /// Character strings ('\\0' terminated) in the recording.
-    pod_vector<char> text_vec_;
+        /// If arg_compact_ is not empty, the number of arguments in the
+        /// recording; i.e., size of arg_vec_ before it was compacted.
+        size_t num_arg_compact_;
 
-    /// The VecAD indices in the recording.
-    pod_vector<addr_t> all_var_vecad_ind_;
+        /// Character strings ('\\0' terminated) in the recording.
+        pod_vector<char> text_vec_;
 
-    /// All of the parameters in the recording.
-    /// Use pod_maybe because Base may not be plain old data.
-    pod_vector_maybe<Base> all_par_vec_;
+        /// The VecAD indices in the recording.
+        pod_vector<addr_t> all_var_vecad_ind_;
 
-    /// Which elements of all_par_vec_ are dynamic parameters
-    /// (size equal number of parametrers)
-    pod_vector<bool> dyn_par_is_;
+        /// Which elements of all_par_vec_ are dynamic parameters
+        /// (size equal number of parametrers)
+        pod_vector<bool> dyn_par_is_;
 
-    /// mapping from dynamic parameter index to parameter index
-    /// 1: size equal to number of dynamic parameters
-    /// 2: dyn_ind2par_ind_[j] < dyn_ind2par_ind_[j+1]
-    pod_vector<addr_t> dyn_ind2par_ind_;
+        /// mapping from dynamic parameter index to parameter index
+        /// 1: size equal to number of dynamic parameters
+        /// 2: dyn_ind2par_ind_[j] < dyn_ind2par_ind_[j+1]
+        pod_vector<addr_t> dyn_ind2par_ind_;
 
-    /// operators for just the dynamic parameters
-    /// (size equal number of dynamic parameters)
-    pod_vector<opcode_t> dyn_par_op_;
+        /// operators for just the dynamic parameters
+        /// (size equal number of dynamic parameters)
+        pod_vector<opcode_t> dyn_par_op_;
+
+        /// arguments for the dynamic parameter operators
+        pod_vector<addr_t> dyn_par_arg_;
+
+        // ------------------------------------------------------------------
+        // Information needed to use member functions that begin with random_
+        // and for using const_subgraph_iterator.
+
+        /// index in arg_vec_ corresonding to the first argument for each
+        /// operator
+        pod_vector<unsigned char> op2arg_vec_;
+
+        /*!
+        Index of the result variable for each operator. If the operator has
+        no results, this is not defined. The invalid index num_var_rec_ is
+        used when NDEBUG is not defined. If the operator has more than one
+        result, this is the primary result; i.e., the last result.
+        Auxillary are only used by the operator and not used by other
+        operators.
+        */
+        pod_vector<unsigned char> op2var_vec_;
+
+        /// Mapping from primary variable index to corresponding operator
+        /// index. This is used to traverse sub-graphs of the operation
+        /// sequence. This value is valid (invalid) for primary (auxillary)
+        /// variables.
+        pod_vector<unsigned char> var2op_vec_;
+
+        // ------------------------------------------------------------------
+        // Information needed to recompute only the dynamic parameters that
+        // depend on a subset of the independent dynamic parameters.
+
+        /// index in dyn_par_arg_ corresponding to the first argument for
+        /// each dynamic parameter operator (size zero if not setup)
+        pod_vector<addr_t> dyn_op2arg_;
+
+        /// the operators that use parameter i as an argument are
+        /// dyn_use_[k] for k = dyn_use_begin_[i], ..., dyn_use_begin_[i+1]-1
+        /// (size zero if not setup)
+        pod_vector<addr_t> dyn_use_begin_;
+
+        /// dynamic parameter index for the operators that use each parameter
+        pod_vector<addr_t> dyn_use_;
+
+        // ------------------------------------------------------------------
+        // Information needed to batch calls to atomic functions.
+
+        /// for each atomic function call, in order, the index of the first
+        /// operator that uses one of its variable results
+        /// (the index of EndOp if there is no such operator)
+        pod_vector<addr_t> atom_first_use_;
+
+        // ------------------------------------------------------------------
+        // Information needed to jump over operators skipped by CSkipOp.
+        // A range is a maximal block of consecutive operators, not AFunOp,
+        // in the true or false list for one CSkipOp.
+
+        /// sorted operator indices for the CSkipOp operators
+        pod_vector<addr_t> cskip_range_op_;
+
+        /// the ranges for the true (false) list of the k-th CSkipOp start at
+        /// cskip_range_list_[2*k] (cskip_range_list_[2*k+1]) and end before
+        /// cskip_range_list_[2*k+1] (cskip_range_list_[2*k+2])
+        pod_vector<addr_t> cskip_range_list_;
+
+        /// first operator in each range
+        pod_vector<addr_t> cskip_range_begin_;
+
+        /// index in the cskip_jump_ vectors of the operator that directly
+        /// follows each range
+        pod_vector<addr_t> cskip_range_jump_;
+
+        /// sorted operator indices that directly follow a range
+        pod_vector<addr_t> cskip_jump_op_;
+
+        /// argument index (see const_sequential_iterator::position)
+        /// for each operator in cskip_jump_op_
+        pod_vector<addr_t> cskip_jump_arg_;
+
+        /// index of the last result for each operator in cskip_jump_op_
+        pod_vector<addr_t> cskip_jump_var_;
+
+        /// byte index (see const_sequential_iterator::position)
+        /// for each operator in cskip_jump_op_ (empty if not arg_compact)
+        pod_vector<addr_t> cskip_jump_byte_;
+
+        // ------------------------------------------------------------------
+        // Information needed to load from VecAD vectors directly.
+
+        /// vecad_store_[i] is true if i is the index in all_var_vecad_ind_
+        /// of the length of a VecAD vector and there is a store operator
+        /// for that vector (empty if there are no VecAD vectors)
+        pod_vector<bool> vecad_store_;
+
+        // set all scalars to zero to avoid valgraind warning when an
+        // assignment occures before values get set.
+        shared_info(void) :
+        count_(1)             ,
+        num_dynamic_ind_(0)   ,
+        num_var_rec_(0)       ,
+        num_var_load_rec_(0)  ,
+        num_var_vecad_rec_(0) ,
+        num_arg_compact_(0)
+        { }
+    };
+
+    /// recording information (possibly shared with other players)
+    shared_info* info_;
 
-    /// arguments for the dynamic parameter operators
-    pod_vector<addr_t> dyn_par_arg_;
+    /// All of the parameters in the recording.
+    /// Use pod_maybe because Base may not be plain old data.
+    /// This is not shared so each player can have its own value for the
+    /// dynamic parameters.
+    pod_vector_maybe<Base> all_par_vec_;
 
     // ----------------------------------------------------------------------
-    // Information needed to use member functions that begin with random_
-    // and for using const_subgraph_iterator.
-
-    /// index in arg_vec_ corresonding to the first argument for each operator
-    pod_vector<unsigned char> op2arg_vec_;
-
-    /*!
-    Index of the result variable for each operator. If the operator has
-    no results, this is not defined. The invalid index num_var_rec_ is used
-    when NDEBUG is not defined. If the operator has more than one result, this
-    is the primary result; i.e., the last result. Auxillary are only used by
-    the operator and not used by other operators.
-    */
-    pod_vector<unsigned char> op2var_vec_;
-
-    /// Mapping from primary variable index to corresponding operator index.
-    /// This is used to traverse sub-graphs of the operation sequence.
-    /// This value is valid (invalid) for primary (auxillary) variables.
-    pod_vector<unsigned char> var2op_vec_;
+    /// stop using info_ (delete it if no other player is using it)
+    void release(void)
+    {   if( info_ == CPPAD_NULL )
+            return;
+        CPPAD_ASSERT_KNOWN(
+            info_->count_ == 1 || ! thread_alloc::in_parallel() ,
+            "A player that is shared is being deleted or changed "
+            "in parallel mode"
+        );
+        if( --(info_->count_) == 0 )
+            delete info_;
+        info_ = CPPAD_NULL;
+    }
+    /// make sure that info_ is not shared with another player
+    void unshare(void)
+    {   CPPAD_ASSERT_UNKNOWN( info_ != CPPAD_NULL );
+        if( info_->count_ == 1 )
+            return;
+        release();
+        info_ = new shared_info;
+    }
 
 public:
     // =================================================================
     /// default constructor
-    // set all scalars to zero to avoid valgraind warning when ani assignment
-    // occures before values get set.
-    player(void) :
-    num_dynamic_ind_(0)  ,
-    num_var_rec_(0)      ,
-    num_var_load_rec_(0)  ,
-    num_var_vecad_rec_(0)
+    // (scalars in shared_info are set to zero by its constructor)
+    player(void) : info_( new shared_info )
     { }
     // =================================================================
     /// copy constructor (needed for base2ad)
-    player(const player& play)
+    player(const player& play) : info_( new shared_info )
     {   // 2DO: want to use move semantics here because it is a temporary
         // in base2ad case.
         *this = play;
@@ -128,16 +255,47 @@ public:
     // =================================================================
     /// destructor
     ~player(void)
-    { }
+    {   release(); }
+    // =================================================================
+    /*!
+    Share the recording in another player.
+
+    \param play
+    is the player that this player will share its recording with.
+    Only the parameter values, all_par_vec_, are copied.
+    The operators, arguments, and other information that does not change
+    during playback are shared until this player, or the other player,
+    gets a new recording.
+
+    \par
+    This routine must be called in sequential mode. Once two or more
+    players share a recording, they can be used by different threads at the
+    same time (as long as setup_random is called in sequential mode first).
+    */
+    void share(const player& play)
+    {   CPPAD_ASSERT_KNOWN(
+            ! thread_alloc::in_parallel() ,
+            "A player is being shared in parallel mode"
+        );
+        if( info_ != play.info_ )
+        {   release();
+            info_ = play.info_;
+            ++(info_->count_);
+        }
+        all_par_vec_ = play.all_par_vec_;
+    }
+    /// is the recording in this player shared with another player
+    bool shared(void) const
+    {   return info_->count_ > 1; }
     // ======================================================================
     /// type used for addressing iterators for this player
     play::addr_enum address_type(void) const
     {
         // required
         size_t required = 0;
-        required = std::max(required, num_var_rec_   );  // number variables
-        required = std::max(required, op_vec_.size()  ); // number operators
-        required = std::max(required, arg_vec_.size() ); // number arguments
+        required = std::max(required, info_->num_var_rec_   );  // number variables
+        required = std::max(required, info_->op_vec_.size()  ); // number operators
+        required = std::max(required, num_op_arg_rec()      ); // number arguments
         //
         // unsigned short
         if( required <= std::numeric_limits<unsigned short>::max() )
@@ -178,67 +336,87 @@ public:
 # ifndef NDEBUG
         size_t addr_t_max = size_t( std::numeric_limits<addr_t>::max() );
 # endif
+        // other players that share the previous recording keep it
+        unshare();
+
         // just set size_t values
-        num_dynamic_ind_    = rec.num_dynamic_ind_;
-        num_var_rec_        = rec.num_var_rec_;
-        num_var_load_rec_   = rec.num_var_load_rec_;
+        info_->num_dynamic_ind_    = rec.num_dynamic_ind_;
+        info_->num_var_rec_        = rec.num_var_rec_;
+        info_->num_var_load_rec_   = rec.num_var_load_rec_;
 
         // op_vec_
-        op_vec_.swap(rec.op_vec_);
-        CPPAD_ASSERT_UNKNOWN(op_vec_.size() < addr_t_max );
+        info_->op_vec_.swap(rec.op_vec_);
+        CPPAD_ASSERT_UNKNOWN(info_->op_vec_.size() < addr_t_max );
 
         // op_arg_vec_
-        arg_vec_.swap(rec.arg_vec_);
-        CPPAD_ASSERT_UNKNOWN(arg_vec_.size()    < addr_t_max );
+        info_->arg_vec_.swap(rec.arg_vec_);
+        CPPAD_ASSERT_UNKNOWN(info_->arg_vec_.size()    < addr_t_max );
+
+        // a new recording does not use the compact encoding
+        info_->arg_compact_.clear();
+        info_->arg_long_.clear();
+        info_->num_arg_compact_ = 0;
 
         // all_par_vec_
         all_par_vec_.swap(rec.all_par_vec_);
         CPPAD_ASSERT_UNKNOWN(all_par_vec_.size() < addr_t_max );
 
         // dyn_par_is_, dyn_par_op_, dyn_par_arg_
-        dyn_par_is_.swap( rec.dyn_par_is_ );
-        dyn_par_op_.swap( rec.dyn_par_op_ );
-        dyn_par_arg_.swap( rec.dyn_par_arg_ );
-        CPPAD_ASSERT_UNKNOWN(dyn_par_arg_.size() < addr_t_max );
+        info_->dyn_par_is_.swap( rec.dyn_par_is_ );
+        info_->dyn_par_op_.swap( rec.dyn_par_op_ );
+        info_->dyn_par_arg_.swap( rec.dyn_par_arg_ );
+        CPPAD_ASSERT_UNKNOWN(info_->dyn_par_arg_.size() < addr_t_max );
 
         // text_rec_
-        text_vec_.swap(rec.text_vec_);
-        CPPAD_ASSERT_UNKNOWN(text_vec_.size() < addr_t_max );
+        info_->text_vec_.swap(rec.text_vec_);
+        CPPAD_ASSERT_UNKNOWN(info_->text_vec_.size() < addr_t_max );
 
         // all_var_vecad_ind_
-        all_var_vecad_ind_.swap(rec.all_var_vecad_ind_);
-        CPPAD_ASSERT_UNKNOWN(all_var_vecad_ind_.size() < addr_t_max );
+        info_->all_var_vecad_ind_.swap(rec.all_var_vecad_ind_);
+        CPPAD_ASSERT_UNKNOWN(info_->all_var_vecad_ind_.size() < addr_t_max );
 
         // num_var_vecad_rec_
-        num_var_vecad_rec_ = 0;
+        info_->num_var_vecad_rec_ = 0;
         {   // all_var_vecad_ind_ contains size of each VecAD followed by
             // the parameter indices used to inialize it.
             size_t i = 0;
-            while( i < all_var_vecad_ind_.size() )
-            {   num_var_vecad_rec_++;
-                i += size_t( all_var_vecad_ind_[i] ) + 1;
+            while( i < info_->all_var_vecad_ind_.size() )
+            {   info_->num_var_vecad_rec_++;
+                i += size_t( info_->all_var_vecad_ind_[i] ) + 1;
             }
-            CPPAD_ASSERT_UNKNOWN( i == all_var_vecad_ind_.size() );
+            CPPAD_ASSERT_UNKNOWN( i == info_->all_var_vecad_ind_.size() );
         }
 
         // mapping from dynamic parameter index to parameter index
-        dyn_ind2par_ind_.resize( dyn_par_op_.size() );
+        info_->dyn_ind2par_ind_.resize( info_->dyn_par_op_.size() );
         size_t i_dyn = 0;
         for(size_t i_par = 0; i_par < all_par_vec_.size(); ++i_par)
-        {   if( dyn_par_is_[i_par] )
-            {   dyn_ind2par_ind_[i_dyn] = addr_t( i_par );
+        {   if( info_->dyn_par_is_[i_par] )
+            {   info_->dyn_ind2par_ind_[i_dyn] = addr_t( i_par );
                 ++i_dyn;
             }
         }
-        CPPAD_ASSERT_UNKNOWN( i_dyn == dyn_ind2par_ind_.size() );
+        CPPAD_ASSERT_UNKNOWN( i_dyn == info_->dyn_ind2par_ind_.size() );
 
         // random access information
         clear_random();
 
+        // dynamic parameter dependency information
+        clear_dynamic();
+
         // some checks
         check_inv_op(n_ind);
         check_variable_dag();
         check_dynamic_dag();
+
+        // first use of the results of each atomic function call
+        setup_atom_first_use();
+
+        // blocks of operators that may be skipped
+        setup_cskip_jump();
+
+        // VecAD vectors that are changed by store operators
+        setup_vecad_store();
     }
     // ----------------------------------------------------------------------
     /*!
@@ -451,31 +629,31 @@ public:
 # else
     void check_dynamic_dag(void) const
     {   // number of dynamic parameters
-        size_t num_dyn = dyn_par_op_.size();
+        size_t num_dyn = info_->dyn_par_op_.size();
         //
         size_t i_arg = 0; // initialize dynamic parameter argument index
         for(size_t i_dyn = 0; i_dyn < num_dyn; ++i_dyn)
         {   // i_par is parameter index
-            addr_t i_par = dyn_ind2par_ind_[i_dyn];
-            CPPAD_ASSERT_UNKNOWN( dyn_par_is_[i_par] );
+            addr_t i_par = info_->dyn_ind2par_ind_[i_dyn];
+            CPPAD_ASSERT_UNKNOWN( info_->dyn_par_is_[i_par] );
             //
             // operator for this dynamic parameter
-            op_code_dyn op = op_code_dyn( dyn_par_op_[i_dyn] );
+            op_code_dyn op = op_code_dyn( info_->dyn_par_op_[i_dyn] );
             //
             // number of arguments for this dynamic parameter
             size_t n_arg       = num_arg_dyn(op);
             if( op == atom_dyn )
-            {   size_t n = size_t( dyn_par_arg_[i_arg + 1] );
-                size_t m = size_t( dyn_par_arg_[i_arg + 2] );
+            {   size_t n = size_t( info_->dyn_par_arg_[i_arg + 1] );
+                size_t m = size_t( info_->dyn_par_arg_[i_arg + 2] );
                 n_arg    = 5 + n + m;
                 CPPAD_ASSERT_UNKNOWN(
-                    n_arg == size_t( dyn_par_arg_[i_arg + 4 + n + m] )
+                    n_arg == size_t( info_->dyn_par_arg_[i_arg + 4 + n + m] )
                 );
                 for(size_t i = 4; i < n - 1; ++i)
-                    CPPAD_ASSERT_UNKNOWN( dyn_par_arg_[i_arg + i] <  i_par );
+                    CPPAD_ASSERT_UNKNOWN( info_->dyn_par_arg_[i_arg + i] <  i_par );
 # ifndef NDEBUG
                 for(size_t i = 4+n; i < 4+n+m; ++i)
-                {   addr_t j_par = dyn_par_arg_[i_arg + i];
+                {   addr_t j_par = info_->dyn_par_arg_[i_arg + i];
                     CPPAD_ASSERT_UNKNOWN( (j_par == 0) || (j_par >= i_par) );
                 }
 # endif
@@ -483,7 +661,7 @@ public:
             else
             {   size_t num_non_par = num_non_par_arg_dyn(op);
                 for(size_t i = num_non_par; i < n_arg; ++i)
-                    CPPAD_ASSERT_UNKNOWN( dyn_par_arg_[i_arg + i] < i_par);
+                    CPPAD_ASSERT_UNKNOWN( info_->dyn_par_arg_[i_arg + i] < i_par);
             }
             //
             // next dynamic parameter
@@ -500,25 +678,47 @@ public:
     object that contains the operatoion sequence to copy.
     */
     void operator=(const player& play)
-    {
+    {   if( info_ == play.info_ && ! shared() )
+        {   // this is the same as play
+            return;
+        }
+        // get a recording that is not shared with any other player
+        unshare();
+        //
         // size_t objects
-        num_dynamic_ind_    = play.num_dynamic_ind_;
-        num_var_rec_        = play.num_var_rec_;
-        num_var_load_rec_   = play.num_var_load_rec_;
-        num_var_vecad_rec_  = play.num_var_vecad_rec_;
+        info_->num_dynamic_ind_    = play.info_->num_dynamic_ind_;
+        info_->num_var_rec_        = play.info_->num_var_rec_;
+        info_->num_var_load_rec_   = play.info_->num_var_load_rec_;
+        info_->num_var_vecad_rec_  = play.info_->num_var_vecad_rec_;
+        info_->num_arg_compact_    = play.info_->num_arg_compact_;
         //
         // pod_vectors
-        op_vec_             = play.op_vec_;
-        arg_vec_            = play.arg_vec_;
-        text_vec_           = play.text_vec_;
-        all_var_vecad_ind_  = play.all_var_vecad_ind_;
-        dyn_par_is_         = play.dyn_par_is_;
-        dyn_ind2par_ind_    = play.dyn_ind2par_ind_;
-        dyn_par_op_         = play.dyn_par_op_;
-        dyn_par_arg_        = play.dyn_par_arg_;
-        op2arg_vec_         = play.op2arg_vec_;
-        op2var_vec_         = play.op2var_vec_;
-        var2op_vec_         = play.var2op_vec_;
+        info_->op_vec_             = play.info_->op_vec_;
+        info_->arg_vec_            = play.info_->arg_vec_;
+        info_->arg_compact_        = play.info_->arg_compact_;
+        info_->arg_long_           = play.info_->arg_long_;
+        info_->text_vec_           = play.info_->text_vec_;
+        info_->all_var_vecad_ind_  = play.info_->all_var_vecad_ind_;
+        info_->dyn_par_is_         = play.info_->dyn_par_is_;
+        info_->dyn_ind2par_ind_    = play.info_->dyn_ind2par_ind_;
+        info_->dyn_par_op_         = play.info_->dyn_par_op_;
+        info_->dyn_par_arg_        = play.info_->dyn_par_arg_;
+        info_->op2arg_vec_         = play.info_->op2arg_vec_;
+        info_->op2var_vec_         = play.info_->op2var_vec_;
+        info_->var2op_vec_         = play.info_->var2op_vec_;
+        info_->dyn_op2arg_         = play.info_->dyn_op2arg_;
+        info_->dyn_use_begin_      = play.info_->dyn_use_begin_;
+        info_->dyn_use_            = play.info_->dyn_use_;
+        info_->atom_first_use_     = play.info_->atom_first_use_;
+        info_->cskip_range_op_     = play.info_->cskip_range_op_;
+        info_->cskip_range_list_   = play.info_->cskip_range_list_;
+        info_->cskip_range_begin_  = play.info_->cskip_range_begin_;
+        info_->cskip_range_jump_   = play.info_->cskip_range_jump_;
+        info_->cskip_jump_op_      = play.info_->cskip_jump_op_;
+        info_->cskip_jump_arg_     = play.info_->cskip_jump_arg_;
+        info_->cskip_jump_var_     = play.info_->cskip_jump_var_;
+        info_->cskip_jump_byte_    = play.info_->cskip_jump_byte_;
+        info_->vecad_store_        = play.info_->vecad_store_;
         //
         // pod_maybe_vectors
         all_par_vec_        = play.all_par_vec_;
@@ -527,25 +727,8 @@ public:
 # if CPPAD_USE_CPLUSPLUS_2011
     // move semantics version of assignment operator
     void operator=(player&& play)
-    {
-        // size_t objects
-        num_dynamic_ind_    = play.num_dynamic_ind_;
-        num_var_rec_        = play.num_var_rec_;
-        num_var_load_rec_   = play.num_var_load_rec_;
-        num_var_vecad_rec_  = play.num_var_vecad_rec_;
-        //
-        // pod_vectors
-        op_vec_.swap(            play.op_vec_);
-        arg_vec_.swap(           play.arg_vec_);
-        text_vec_.swap(          play.text_vec_);
-        all_var_vecad_ind_.swap( play.all_var_vecad_ind_);
-        dyn_par_is_.swap(        play.dyn_par_is_);
-        dyn_ind2par_ind_.swap(   play.dyn_ind2par_ind_);
-        dyn_par_op_.swap(        play.dyn_par_op_);
-        dyn_par_arg_.swap(       play.dyn_par_arg_);
-        op2arg_vec_.swap(        play.op2arg_vec_);
-        op2var_vec_.swap(        play.op2var_vec_);
-        var2op_vec_.swap(        play.var2op_vec_);
+    {   // recording information (play will release the old info_)
+        std::swap(info_, play.info_);
         //
         // pod_maybe_vectors
         all_par_vec_.swap(       play.all_par_vec_);
@@ -557,23 +740,39 @@ public:
     {   player< AD<Base> > play;
         //
         // size_t objects
-        play.num_dynamic_ind_    = num_dynamic_ind_;
-        play.num_var_rec_        = num_var_rec_;
-        play.num_var_load_rec_   = num_var_load_rec_;
-        play.num_var_vecad_rec_  = num_var_vecad_rec_;
+        play.info_->num_dynamic_ind_    = info_->num_dynamic_ind_;
+        play.info_->num_var_rec_        = info_->num_var_rec_;
+        play.info_->num_var_load_rec_   = info_->num_var_load_rec_;
+        play.info_->num_var_vecad_rec_  = info_->num_var_vecad_rec_;
+        play.info_->num_arg_compact_    = info_->num_arg_compact_;
         //
         // pod_vectors
-        play.op_vec_             = op_vec_;
-        play.arg_vec_            = arg_vec_;
-        play.text_vec_           = text_vec_;
-        play.all_var_vecad_ind_  = all_var_vecad_ind_;
-        play.dyn_par_is_         = dyn_par_is_;
-        play.dyn_ind2par_ind_    = dyn_ind2par_ind_;
-        play.dyn_par_op_         = dyn_par_op_;
-        play.dyn_par_arg_        = dyn_par_arg_;
-        play.op2arg_vec_         = op2arg_vec_;
-        play.op2var_vec_         = op2var_vec_;
-        play.var2op_vec_         = var2op_vec_;
+        play.info_->op_vec_             = info_->op_vec_;
+        play.info_->arg_vec_            = info_->arg_vec_;
+        play.info_->arg_compact_        = info_->arg_compact_;
+        play.info_->arg_long_           = info_->arg_long_;
+        play.info_->text_vec_           = info_->text_vec_;
+        play.info_->all_var_vecad_ind_  = info_->all_var_vecad_ind_;
+        play.info_->dyn_par_is_         = info_->dyn_par_is_;
+        play.info_->dyn_ind2par_ind_    = info_->dyn_ind2par_ind_;
+        play.info_->dyn_par_op_         = info_->dyn_par_op_;
+        play.info_->dyn_par_arg_        = info_->dyn_par_arg_;
+        play.info_->op2arg_vec_         = info_->op2arg_vec_;
+        play.info_->op2var_vec_         = info_->op2var_vec_;
+        play.info_->var2op_vec_         = info_->var2op_vec_;
+        play.info_->dyn_op2arg_         = info_->dyn_op2arg_;
+        play.info_->dyn_use_begin_      = info_->dyn_use_begin_;
+        play.info_->dyn_use_            = info_->dyn_use_;
+        play.info_->atom_first_use_     = info_->atom_first_use_;
+        play.info_->cskip_range_op_     = info_->cskip_range_op_;
+        play.info_->cskip_range_list_   = info_->cskip_range_list_;
+        play.info_->cskip_range_begin_  = info_->cskip_range_begin_;
+        play.info_->cskip_range_jump_   = info_->cskip_range_jump_;
+        play.info_->cskip_jump_op_      = info_->cskip_jump_op_;
+        play.info_->cskip_jump_arg_     = info_->cskip_jump_arg_;
+        play.info_->cskip_jump_var_     = info_->cskip_jump_var_;
+        play.info_->cskip_jump_byte_    = info_->cskip_jump_byte_;
+        play.info_->vecad_store_        = info_->vecad_store_;
         //
         // pod_maybe_vector< AD<Base> > = pod_maybe_vector<Base>
         play.all_par_vec_.resize( all_par_vec_.size() );
@@ -586,53 +785,767 @@ public:
     /// swap this recording with another recording
     /// (used for move semantics version of ADFun assignment operation)
     void swap(player& other)
-    {   // size_t objects
-        std::swap(num_dynamic_ind_,    other.num_dynamic_ind_);
-        std::swap(num_var_rec_,        other.num_var_rec_);
-        std::swap(num_var_load_rec_,   other.num_var_load_rec_);
-        std::swap(num_var_vecad_rec_,  other.num_var_vecad_rec_);
+    {   // recording information
+        std::swap(info_, other.info_);
+        //
+        // pod_maybe_vectors
+        all_par_vec_.swap(    other.all_par_vec_);
+    }
+    // ===============================================================
+    /*!
+    Write this recording using its binary representation.
+
+    \param os
+    stream that the recording is written to. The random access information
+    is included (it is empty if setup_random has not been called).
+    The arguments are written using the uncompressed format
+    (even if arg_compact() is true).
+    */
+    void write_binary(std::ostream& os) const
+    {   CPPAD_ASSERT_UNKNOWN( is_pod<Base>() );
+        //
+        // size_t objects
+        play::binary_write(os, info_->num_dynamic_ind_);
+        play::binary_write(os, info_->num_var_rec_);
+        play::binary_write(os, info_->num_var_load_rec_);
+        play::binary_write(os, info_->num_var_vecad_rec_);
         //
         // pod_vectors
-        op_vec_.swap(             other.op_vec_);
-        arg_vec_.swap(            other.arg_vec_);
-        text_vec_.swap(           other.text_vec_);
-        all_var_vecad_ind_.swap(  other.all_var_vecad_ind_);
-        dyn_par_is_.swap(         other.dyn_par_is_);
-        dyn_ind2par_ind_.swap(    other.dyn_ind2par_ind_);
-        dyn_par_op_.swap(         other.dyn_par_op_);
-        dyn_par_arg_.swap(        other.dyn_par_arg_);
-        op2arg_vec_.swap(         other.op2arg_vec_);
-        op2var_vec_.swap(         other.op2var_vec_);
-        var2op_vec_.swap(         other.var2op_vec_);
+        play::binary_write(os, info_->op_vec_);
+        if( arg_compact() )
+        {   pod_vector<addr_t> arg_vec;
+            get_arg_vec(arg_vec);
+            play::binary_write(os, arg_vec);
+        }
+        else
+            play::binary_write(os, info_->arg_vec_);
+        play::binary_write(os, info_->text_vec_);
+        play::binary_write(os, info_->all_var_vecad_ind_);
+        play::binary_write(os, info_->dyn_par_is_);
+        play::binary_write(os, info_->dyn_ind2par_ind_);
+        play::binary_write(os, info_->dyn_par_op_);
+        play::binary_write(os, info_->dyn_par_arg_);
+        play::binary_write(os, info_->op2arg_vec_);
+        play::binary_write(os, info_->op2var_vec_);
+        play::binary_write(os, info_->var2op_vec_);
         //
         // pod_maybe_vectors
-        all_par_vec_.swap(    other.all_par_vec_);
+        play::binary_write(os, all_par_vec_);
+    }
+    /*!
+    Replace this recording by one written using write_binary.
+
+    \param is
+    stream that the recording is read from.
+
+    \param n_ind
+    the number of independent variables (only used for error checking
+    when NDEBUG is not defined).
+
+    \return
+    is false if the read failed or the information read is not a valid
+    recording. In this case, the recording in this player is not valid.
+    */
+    bool read_binary(std::istream& is, size_t n_ind)
+    {   CPPAD_ASSERT_UNKNOWN( is_pod<Base>() );
+        //
+        // other players that share the previous recording keep it
+        unshare();
+        //
+        // size_t objects
+        bool ok = true;
+        ok = ok && play::binary_read(is, info_->num_dynamic_ind_);
+        ok = ok && play::binary_read(is, info_->num_var_rec_);
+        ok = ok && play::binary_read(is, info_->num_var_load_rec_);
+        ok = ok && play::binary_read(is, info_->num_var_vecad_rec_);
+        //
+        // pod_vectors
+        ok = ok && play::binary_read(is, info_->op_vec_);
+        ok = ok && play::binary_read(is, info_->arg_vec_);
+        ok = ok && play::binary_read(is, info_->text_vec_);
+        ok = ok && play::binary_read(is, info_->all_var_vecad_ind_);
+        ok = ok && play::binary_read(is, info_->dyn_par_is_);
+        ok = ok && play::binary_read(is, info_->dyn_ind2par_ind_);
+        ok = ok && play::binary_read(is, info_->dyn_par_op_);
+        ok = ok && play::binary_read(is, info_->dyn_par_arg_);
+        ok = ok && play::binary_read(is, info_->op2arg_vec_);
+        ok = ok && play::binary_read(is, info_->op2var_vec_);
+        ok = ok && play::binary_read(is, info_->var2op_vec_);
+        //
+        // pod_maybe_vectors
+        ok = ok && play::binary_read(is, all_par_vec_);
+        //
+        // the arguments are not compact
+        info_->arg_compact_.clear();
+        info_->arg_long_.clear();
+        info_->num_arg_compact_ = 0;
+        //
+        // dynamic parameter dependency information is not in the file
+        clear_dynamic();
+        if( ! ok )
+            return false;
+        //
+        // check the sizes that the playback routines depend on
+        size_t n_op = info_->op_vec_.size();
+        ok &= 1 < n_op && n_ind < info_->num_var_rec_;
+        ok &= info_->num_dynamic_ind_ <= info_->dyn_par_op_.size();
+        ok &= info_->dyn_par_is_.size() == all_par_vec_.size();
+        ok &= info_->dyn_ind2par_ind_.size() == info_->dyn_par_op_.size();
+        if( ! ok )
+            return false;
+        ok &= OpCode( info_->op_vec_[0] ) == BeginOp;
+        ok &= OpCode( info_->op_vec_[n_op - 1] ) == EndOp;
+        //
+        // random access information is empty or has the expected size
+        if( info_->op2arg_vec_.size() != 0 )
+        {   size_t size = 0;
+            switch( address_type() )
+            {   case play::unsigned_short_enum:
+                size = sizeof(unsigned short);
+                break;
+                //
+                case play::unsigned_int_enum:
+                size = sizeof(unsigned int);
+                break;
+                //
+                default:
+                CPPAD_ASSERT_UNKNOWN( address_type() == play::size_t_enum );
+                size = sizeof(size_t);
+                break;
+            }
+            ok &= info_->op2arg_vec_.size() == n_op * size;
+            ok &= info_->op2var_vec_.size() == n_op * size;
+            ok &= info_->var2op_vec_.size() == info_->num_var_rec_ * size;
+        }
+        else
+        {   ok &= info_->op2var_vec_.size() == 0;
+            ok &= info_->var2op_vec_.size() == 0;
+        }
+        if( ! ok )
+            return false;
+        //
+        // some checks
+        check_inv_op(n_ind);
+        check_variable_dag();
+        check_dynamic_dag();
+        //
+        // first use of the results of each atomic function call
+        setup_atom_first_use();
+        //
+        // blocks of operators that may be skipped
+        setup_cskip_jump();
+        //
+        // VecAD vectors that are changed by store operators
+        setup_vecad_store();
+        //
+        return true;
     }
     // =================================================================
     /// Enable use of const_subgraph_iterator and member functions that begin
     // with random_(no work if already setup).
     template <class Addr>
     void setup_random(void)
-    {   play::random_setup(
-            num_var_rec_                               ,
-            op_vec_                                    ,
-            arg_vec_                                   ,
-            op2arg_vec_.pod_vector_ptr<Addr>()         ,
-            op2var_vec_.pod_vector_ptr<Addr>()         ,
-            var2op_vec_.pod_vector_ptr<Addr>()
+    {   CPPAD_ASSERT_KNOWN(
+            info_->op2arg_vec_.size() != 0 ||
+            ! ( shared() && thread_alloc::in_parallel() ) ,
+            "A shared recording is using subgraphs or random access "
+            "for the first time in parallel mode"
+        );
+        // random access uses the uncompressed arguments
+        expand_arg();
+        play::random_setup(
+            info_->num_var_rec_                                 ,
+            info_->op_vec_                                      ,
+            info_->arg_vec_                                     ,
+            info_->op2arg_vec_.template pod_vector_ptr<Addr>()  ,
+            info_->op2var_vec_.template pod_vector_ptr<Addr>()  ,
+            info_->var2op_vec_.template pod_vector_ptr<Addr>()
         );
     }
     /// Free memory used for functions that begin with random_
     /// and random iterators and subgraph iterators
+    /// (no work if this recording is shared with another player).
     void clear_random(void)
-    {
-        op2arg_vec_.clear();
-        op2var_vec_.clear();
-        var2op_vec_.clear();
-        CPPAD_ASSERT_UNKNOWN( op2arg_vec_.size() == 0  );
-        CPPAD_ASSERT_UNKNOWN( op2var_vec_.size() == 0  );
-        CPPAD_ASSERT_UNKNOWN( var2op_vec_.size() == 0  );
+    {   if( shared() )
+            return;
+        info_->op2arg_vec_.clear();
+        info_->op2var_vec_.clear();
+        info_->var2op_vec_.clear();
+        CPPAD_ASSERT_UNKNOWN( info_->op2arg_vec_.size() == 0  );
+        CPPAD_ASSERT_UNKNOWN( info_->op2var_vec_.size() == 0  );
+        CPPAD_ASSERT_UNKNOWN( info_->var2op_vec_.size() == 0  );
+    }
+    // =================================================================
+    /*!
+    Enable use of dyn_op2arg, dyn_use_begin, and dyn_use
+    (no work if already setup).
+    */
+    void setup_dynamic(void)
+    {   if( info_->dyn_use_begin_.size() != 0 )
+            return;
+        CPPAD_ASSERT_KNOWN(
+            ! ( shared() && thread_alloc::in_parallel() ) ,
+            "A shared recording is using new_dynamic with changed indices "
+            "for the first time in parallel mode"
+        );
+        const pod_vector<bool>&     dyn_par_is( info_->dyn_par_is_ );
+        const pod_vector<opcode_t>& dyn_par_op( info_->dyn_par_op_ );
+        const pod_vector<addr_t>&   dyn_par_arg( info_->dyn_par_arg_ );
+        size_t num_dyn = dyn_par_op.size();
+        size_t num_par = dyn_par_is.size();
+        //
+        // dyn_op2arg_, and number of operators that use each parameter
+        pod_vector<addr_t> count(num_par);
+        for(size_t i_par = 0; i_par < num_par; ++i_par)
+            count[i_par] = 0;
+        info_->dyn_op2arg_.resize(num_dyn);
+        size_t i_arg = 0;
+        for(size_t i_dyn = 0; i_dyn < num_dyn; ++i_dyn)
+        {   info_->dyn_op2arg_[i_dyn] = addr_t( i_arg );
+            op_code_dyn op   = op_code_dyn( dyn_par_op[i_dyn] );
+            size_t n_arg     = num_arg_dyn(op);
+            size_t arg_begin = num_non_par_arg_dyn(op);
+            size_t arg_end   = n_arg;
+            if( op == atom_dyn )
+            {   size_t n  = size_t( dyn_par_arg[i_arg + 1] );
+                size_t m  = size_t( dyn_par_arg[i_arg + 2] );
+                n_arg     = 5 + n + m;
+                arg_begin = 4;
+                arg_end   = 4 + n;
+            }
+            for(size_t k = arg_begin; k < arg_end; ++k)
+            {   size_t j_par = size_t( dyn_par_arg[i_arg + k] );
+                if( dyn_par_is[j_par] )
+                    ++count[j_par];
+            }
+            i_arg += n_arg;
+        }
+        CPPAD_ASSERT_UNKNOWN( i_arg == dyn_par_arg.size() );
+        //
+        // dyn_use_begin_
+        info_->dyn_use_begin_.resize(num_par + 1);
+        info_->dyn_use_begin_[0] = 0;
+        for(size_t i_par = 0; i_par < num_par; ++i_par)
+        {   info_->dyn_use_begin_[i_par + 1] =
+                info_->dyn_use_begin_[i_par] + count[i_par];
+            count[i_par] = info_->dyn_use_begin_[i_par];
+        }
+        //
+        // dyn_use_
+        info_->dyn_use_.resize( size_t( info_->dyn_use_begin_[num_par] ) );
+        for(size_t i_dyn = 0; i_dyn < num_dyn; ++i_dyn)
+        {   i_arg            = size_t( info_->dyn_op2arg_[i_dyn] );
+            op_code_dyn op   = op_code_dyn( dyn_par_op[i_dyn] );
+            size_t arg_begin = num_non_par_arg_dyn(op);
+            size_t arg_end   = num_arg_dyn(op);
+            if( op == atom_dyn )
+            {   arg_begin = 4;
+                arg_end   = 4 + size_t( dyn_par_arg[i_arg + 1] );
+            }
+            for(size_t k = arg_begin; k < arg_end; ++k)
+            {   size_t j_par = size_t( dyn_par_arg[i_arg + k] );
+                if( dyn_par_is[j_par] )
+                    info_->dyn_use_[ count[j_par]++ ] = addr_t( i_dyn );
+            }
+        }
+    }
+    /// Free memory used by setup_dynamic
+    /// (no work if this recording is shared with another player).
+    void clear_dynamic(void)
+    {   if( shared() )
+            return;
+        info_->dyn_op2arg_.clear();
+        info_->dyn_use_begin_.clear();
+        info_->dyn_use_.clear();
+    }
+    // =================================================================
+    /*!
+    Set atom_first_use_ for the current recording.
+
+    \par
+    The operators inside an atomic function call are included; i.e.,
+    if a FunavOp uses a result of a previous call, its operator index
+    is the first use for the previous call.
+    This is empty if there are no atomic function calls in the recording.
+    */
+    void setup_atom_first_use(void)
+    {   info_->atom_first_use_.resize(0);
+        //
+        // check for atomic function calls
+        const pod_vector<opcode_t>& op_vec( info_->op_vec_ );
+        size_t num_op = op_vec.size();
+        bool   found  = false;
+        for(size_t i_op = 0; i_op < num_op; ++i_op)
+            found |= OpCode( op_vec[i_op] ) == AFunOp;
+        if( ! found )
+            return;
+        //
+        // var2call[i_var] is the call that has i_var as a result
+        // (no_call if i_var is not the result of a call)
+        addr_t no_call = std::numeric_limits<addr_t>::max();
+        pod_vector<addr_t> var2call( info_->num_var_rec_ );
+        for(size_t i_var = 0; i_var < info_->num_var_rec_; ++i_var)
+            var2call[i_var] = no_call;
+        //
+        pod_vector<addr_t>& first_use( info_->atom_first_use_ );
+        addr_t end_op  = addr_t( num_op - 1 );
+        size_t n_call  = 0;
+        bool   in_call = false;
+        pod_vector<bool> is_variable;
+        //
+        play::const_sequential_iterator itr = begin();
+        OpCode        op;
+        const addr_t* op_arg;
+        size_t        i_var;
+        itr.op_info(op, op_arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+        while( op != EndOp )
+        {   (++itr).op_info(op, op_arg, i_var);
+            addr_t i_op = addr_t( itr.op_index() );
+            switch( op )
+            {   case AFunOp:
+                if( ! in_call )
+                {   first_use.push_back(end_op);
+                    ++n_call;
+                }
+                in_call = ! in_call;
+                break;
+
+                case FunrvOp:
+                var2call[i_var] = addr_t( n_call - 1 );
+                break;
+
+                default:
+                arg_is_variable(op, op_arg, is_variable);
+                for(size_t j = 0; j < is_variable.size(); ++j)
+                if( is_variable[j] )
+                {   addr_t i_call = var2call[ op_arg[j] ];
+                    if( i_call != no_call && i_op < first_use[i_call] )
+                        first_use[i_call] = i_op;
+                }
+                if( op == CSumOp || op == CSkipOp )
+                    itr.correct_before_increment();
+                break;
+            }
+        }
+        CPPAD_ASSERT_UNKNOWN( ! in_call );
     }
+    // =================================================================
+    /*!
+    Set the cskip_range_ and cskip_jump_ vectors for the current recording.
+
+    \par
+    For each CSkipOp, the operators in its true list, and in its false list,
+    are split into ranges; i.e., maximal blocks of consecutive operators
+    that are not AFunOp. The position of the operator that directly follows
+    each range is stored so that const_sequential_iterator can jump to it;
+    see cskip_push and cskip_jump.
+    These vectors are empty if there are no CSkipOp operators
+    in the recording.
+    They depend on the argument representation and must be recomputed
+    when it changes; see compact_arg and expand_arg.
+    */
+    void setup_cskip_jump(void)
+    {   info_->cskip_range_op_.resize(0);
+        info_->cskip_range_list_.resize(0);
+        info_->cskip_range_begin_.resize(0);
+        info_->cskip_range_jump_.resize(0);
+        info_->cskip_jump_op_.resize(0);
+        info_->cskip_jump_arg_.resize(0);
+        info_->cskip_jump_var_.resize(0);
+        info_->cskip_jump_byte_.resize(0);
+        //
+        // check for CSkipOp operators
+        const pod_vector<opcode_t>& op_vec( info_->op_vec_ );
+        size_t num_op = op_vec.size();
+        bool   found  = false;
+        for(size_t i_op = 0; i_op < num_op; ++i_op)
+            found |= OpCode( op_vec[i_op] ) == CSkipOp;
+        if( ! found )
+            return;
+        //
+        // jump_to[i_op] is true if operator i_op directly follows a range
+        pod_vector<bool> jump_to(num_op);
+        for(size_t i_op = 0; i_op < num_op; ++i_op)
+            jump_to[i_op] = false;
+        //
+        // operator that directly follows each range
+        pod_vector<addr_t> range_end;
+        //
+        // sorted version of one list for a CSkipOp
+        pod_vector<addr_t> list;
+        //
+        play::const_sequential_iterator itr = begin();
+        OpCode        op;
+        const addr_t* op_arg;
+        size_t        i_var;
+        itr.op_info(op, op_arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+        while( op != EndOp )
+        {   if( op == CSkipOp )
+            {   info_->cskip_range_op_.push_back( addr_t( itr.op_index() ) );
+                for(size_t k_list = 0; k_list < 2; ++k_list)
+                {   info_->cskip_range_list_.push_back(
+                        addr_t( info_->cskip_range_begin_.size() )
+                    );
+                    size_t n_list = size_t( op_arg[4 + k_list] );
+                    size_t start  = 6;
+                    if( k_list == 1 )
+                        start += size_t( op_arg[4] );
+                    list.resize(n_list);
+                    for(size_t i = 0; i < n_list; ++i)
+                        list[i] = op_arg[start + i];
+                    std::sort(list.data(), list.data() + n_list);
+                    //
+                    size_t i = 0;
+                    while( i < n_list )
+                    {   size_t begin_op = size_t( list[i] );
+                        size_t end_op   = begin_op;
+                        while( i < n_list && size_t( list[i] ) <= end_op )
+                        {   if( size_t( list[i] ) == end_op )
+                            {   if( OpCode( op_vec[end_op] ) == AFunOp )
+                                    break;
+                                ++end_op;
+                            }
+                            ++i;
+                        }
+                        if( end_op == begin_op )
+                        {   // an AFunOp is not part of a range
+                            ++i;
+                        }
+                        else
+                        {   info_->cskip_range_begin_.push_back(
+                                addr_t( begin_op )
+                            );
+                            range_end.push_back( addr_t( end_op ) );
+                            jump_to[end_op] = true;
+                        }
+                    }
+                }
+            }
+            if( op == CSumOp || op == CSkipOp )
+                itr.correct_before_increment();
+            (++itr).op_info(op, op_arg, i_var);
+        }
+        info_->cskip_range_list_.push_back(
+            addr_t( info_->cskip_range_begin_.size() )
+        );
+        //
+        // position of the operators that directly follow a range
+        bool compact = arg_compact();
+        itr = begin();
+        itr.op_info(op, op_arg, i_var);
+        while( op != EndOp )
+        {   if( op == CSumOp || op == CSkipOp )
+                itr.correct_before_increment();
+            (++itr).op_info(op, op_arg, i_var);
+            size_t i_op = itr.op_index();
+            if( jump_to[i_op] )
+            {   size_t arg_index, byte_index;
+                itr.position(arg_index, byte_index);
+                info_->cskip_jump_op_.push_back( addr_t(i_op) );
+                info_->cskip_jump_arg_.push_back( addr_t(arg_index) );
+                info_->cskip_jump_var_.push_back( addr_t(i_var) );
+                if( compact )
+                    info_->cskip_jump_byte_.push_back( addr_t(byte_index) );
+            }
+        }
+        //
+        // index in the cskip_jump_ vectors for each range
+        const addr_t* jump_op = info_->cskip_jump_op_.data();
+        size_t        n_jump  = info_->cskip_jump_op_.size();
+        size_t        n_range = range_end.size();
+        info_->cskip_range_jump_.resize(n_range);
+        for(size_t r = 0; r < n_range; ++r)
+        {   size_t k = size_t(
+                std::lower_bound(jump_op, jump_op + n_jump, range_end[r])
+                - jump_op
+            );
+            CPPAD_ASSERT_UNKNOWN( k < n_jump && jump_op[k] == range_end[r] );
+            info_->cskip_range_jump_[r] = addr_t(k);
+        }
+    }
+    /// Compare ranges so that a heap has the first range at its front
+    class cskip_range_later {
+    private:
+        /// first operator in each range; see cskip_range_begin_
+        const addr_t* range_begin_;
+    public:
+        /// constructor
+        cskip_range_later(const addr_t* range_begin)
+        : range_begin_(range_begin)
+        { }
+        /// does range r1 begin after range r2
+        bool operator()(addr_t r1, addr_t r2) const
+        {   return range_begin_[r1] > range_begin_[r2]; }
+    };
+    /*!
+    Add the ranges of operators that a CSkipOp skips to the pending ranges.
+
+    \param i_op [in]
+    is the operator index for a CSkipOp.
+
+    \param skip_case [in]
+    is the non-zero return value of forward_cskip_op_0 for this CSkipOp;
+    i.e., one (two) if its true (false) list of operators is skipped.
+
+    \param pending [in,out]
+    is a heap containing the ranges for the CSkipOp operators that have
+    fired during the current forward sweep (it should be empty at the
+    start of the sweep). The ranges for this CSkipOp are added to it.
+    */
+    void cskip_push(
+        size_t              i_op      ,
+        size_t              skip_case ,
+        pod_vector<addr_t>& pending   ) const
+    {   CPPAD_ASSERT_UNKNOWN( skip_case == 1 || skip_case == 2 );
+        const addr_t* range_op = info_->cskip_range_op_.data();
+        size_t        n_cskip  = info_->cskip_range_op_.size();
+        size_t k = size_t(
+            std::lower_bound(range_op, range_op + n_cskip, addr_t(i_op))
+            - range_op
+        );
+        CPPAD_ASSERT_UNKNOWN( k < n_cskip && size_t( range_op[k] ) == i_op );
+        //
+        const addr_t* range_list = info_->cskip_range_list_.data();
+        size_t r_begin = size_t( range_list[2 * k + skip_case - 1] );
+        size_t r_end   = size_t( range_list[2 * k + skip_case] );
+        cskip_range_later later( info_->cskip_range_begin_.data() );
+        for(size_t r = r_begin; r < r_end; ++r)
+        {   pending.push_back( addr_t(r) );
+            std::push_heap(
+                pending.data(), pending.data() + pending.size(), later
+            );
+        }
+    }
+    /*!
+    Move a sequential iterator over a block of operators that are skipped.
+
+    \param itr [in,out]
+    On input, the current operator for itr is skipped and it is not an AFunOp.
+    Upon return, it is the operator that directly follows the range,
+    in pending, that contains the input operator.
+
+    \param pending [in,out]
+    is the heap of ranges for the CSkipOp operators that have fired
+    during the current forward sweep; see cskip_push.
+    The ranges that end at or before the input operator are removed.
+    */
+    void cskip_jump(
+        play::const_sequential_iterator& itr     ,
+        pod_vector<addr_t>&              pending ) const
+    {   const opcode_t* op_vec      = info_->op_vec_.data();
+        const addr_t*   range_begin = info_->cskip_range_begin_.data();
+        const addr_t*   range_jump  = info_->cskip_range_jump_.data();
+        const addr_t*   jump_op     = info_->cskip_jump_op_.data();
+        size_t i_op = itr.op_index();
+        CPPAD_ASSERT_UNKNOWN( OpCode( op_vec[i_op] ) != AFunOp );
+        //
+        // remove the ranges that end at or before this operator
+        cskip_range_later later(range_begin);
+        while( pending.size() > 0 &&
+            size_t( jump_op[ range_jump[ pending[0] ] ] ) <= i_op )
+        {   std::pop_heap(
+                pending.data(), pending.data() + pending.size(), later
+            );
+            pending.resize( pending.size() - 1 );
+        }
+        //
+        // The first pending range contains this operator because the
+        // operators that a CSkipOp skips come after the CSkipOp.
+        CPPAD_ASSERT_UNKNOWN( pending.size() > 0 );
+        CPPAD_ASSERT_UNKNOWN( size_t( range_begin[ pending[0] ] ) <= i_op );
+        size_t k    = size_t( range_jump[ pending[0] ] );
+        size_t j_op = size_t( jump_op[k] );
+        CPPAD_ASSERT_UNKNOWN( i_op < j_op );
+        //
+        // for a small block, it is faster to advance the iterator
+        if( j_op < i_op + 8 )
+        {   while( i_op < j_op )
+            {   OpCode op = OpCode( op_vec[i_op] );
+                if( op == CSumOp || op == CSkipOp )
+                    itr.correct_before_increment();
+                ++itr;
+                ++i_op;
+            }
+            return;
+        }
+        //
+        // position of the operator j_op
+        size_t byte_index = 0;
+        if( arg_compact() )
+            byte_index = size_t( info_->cskip_jump_byte_[k] );
+        itr.jump(
+            j_op,
+            size_t( info_->cskip_jump_arg_[k] ),
+            size_t( info_->cskip_jump_var_[k] ),
+            byte_index
+        );
+    }
+    // =================================================================
+    /// are the arguments in this recording stored using a compact encoding
+    bool arg_compact(void) const
+    {   return info_->arg_compact_.size() != 0; }
+    /*!
+    Get the uncompressed arguments for this recording.
+
+    \param arg_vec [out]
+    is set to the argument vector as it was before it was compacted.
+    The arguments must be compact; i.e., arg_compact() is true.
+    */
+    void get_arg_vec(pod_vector<addr_t>& arg_vec) const
+    {   CPPAD_ASSERT_UNKNOWN( arg_compact() );
+        arg_vec.resize( info_->num_arg_compact_ );
+        size_t i_arg = 0;
+        //
+        play::const_sequential_iterator itr = begin();
+        OpCode        op;
+        const addr_t* arg;
+        size_t        var_index;
+        itr.op_info(op, arg, var_index);
+        CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+        while( op != EndOp )
+        {   size_t n_arg = NumArg(op);
+            if( op == CSumOp )
+                n_arg = size_t( arg[4] ) + 1;
+            if( op == CSkipOp )
+                n_arg = 7 + size_t( arg[4] + arg[5] );
+            for(size_t j = 0; j < n_arg; ++j)
+                arg_vec[i_arg++] = arg[j];
+            if( op == CSumOp || op == CSkipOp )
+                itr.correct_before_increment();
+            (++itr).op_info(op, arg, var_index);
+        }
+        CPPAD_ASSERT_UNKNOWN( i_arg == arg_vec.size() );
+    }
+    /*!
+    Store the arguments for this recording using a compact encoding
+    (no work if they are already compact).
+    The arguments for each operator are decoded by
+    const_sequential_iterator; see compact_arg.hpp.
+    Other players that share this recording keep the uncompressed version.
+    */
+    void compact_arg(void)
+    {   if( arg_compact() )
+            return;
+        //
+        // copy the recording if it is shared with another player
+        if( shared() )
+        {   player copy;
+            copy = *this;
+            swap(copy);
+        }
+        //
+        // the random access information is for the uncompressed arguments
+        clear_random();
+        //
+        // the first byte is not part of the encoding for any operator
+        pod_vector<unsigned char> byte_vec;
+        pod_vector<addr_t>        long_vec;
+        byte_vec.push_back(0);
+        //
+        play::const_sequential_iterator itr = begin();
+        OpCode        op;
+        const addr_t* arg;
+        size_t        var_index;
+        itr.op_info(op, arg, var_index);
+        CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+        while( op != EndOp )
+        {   if( op == CSumOp || op == CSkipOp )
+            {   size_t n_arg;
+                if( op == CSumOp )
+                    n_arg = size_t( arg[4] ) + 1;
+                else
+                    n_arg = 7 + size_t( arg[4] + arg[5] );
+                for(size_t j = 0; j < n_arg; ++j)
+                    long_vec.push_back( arg[j] );
+                itr.correct_before_increment();
+            }
+            else
+                play::compact_arg_encode(op, var_index, arg, byte_vec);
+            (++itr).op_info(op, arg, var_index);
+        }
+        //
+        // assignment does not keep the extra capacity used by push_back
+        info_->num_arg_compact_ = info_->arg_vec_.size();
+        info_->arg_compact_     = byte_vec;
+        info_->arg_long_        = long_vec;
+        info_->arg_vec_.clear();
+        CPPAD_ASSERT_UNKNOWN( arg_compact() );
+        //
+        // positions for the compact arguments
+        setup_cskip_jump();
+    }
+    /*!
+    Store the arguments for this recording using the uncompressed format
+    (no work if they are not compact).
+    This changes the representation for all players that share this
+    recording, but not the operation sequence.
+    */
+    void expand_arg(void)
+    {   if( ! arg_compact() )
+            return;
+        CPPAD_ASSERT_KNOWN(
+            ! ( shared() && thread_alloc::in_parallel() ) ,
+            "A shared recording with compact arguments is being expanded "
+            "in parallel mode"
+        );
+        get_arg_vec( info_->arg_vec_ );
+        info_->arg_compact_.clear();
+        info_->arg_long_.clear();
+        info_->num_arg_compact_ = 0;
+        //
+        // positions for the uncompressed arguments
+        setup_cskip_jump();
+    }
+    // =================================================================
+    /*!
+    Set vecad_store_ for the current recording.
+
+    \par
+    A VecAD vector that does not have any store operators is a constant
+    table; i.e., its elements are always the parameters in
+    all_var_vecad_ind_. Loads from such a vector can use the recording
+    directly and a zero order forward sweep does not need to initialize
+    its elements.
+    */
+    void setup_vecad_store(void)
+    {   size_t num = info_->all_var_vecad_ind_.size();
+        info_->vecad_store_.resize(num);
+        for(size_t i = 0; i < num; ++i)
+            info_->vecad_store_[i] = false;
+        if( num == 0 )
+            return;
+        //
+        play::const_sequential_iterator itr = begin();
+        OpCode        op;
+        const addr_t* op_arg;
+        size_t        i_var;
+        itr.op_info(op, op_arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+        while( op != EndOp )
+        {   switch( op )
+            {   case StppOp:
+                case StpvOp:
+                case StvpOp:
+                case StvvOp:
+                CPPAD_ASSERT_UNKNOWN( 0 < op_arg[0] );
+                CPPAD_ASSERT_UNKNOWN( size_t(op_arg[0]) < num );
+                info_->vecad_store_[ op_arg[0] - 1 ] = true;
+                break;
+
+                case CSumOp:
+                case CSkipOp:
+                itr.correct_before_increment();
+                break;
+
+                default:
+                break;
+            }
+            (++itr).op_info(op, op_arg, i_var);
+        }
+    }
+    // =================================================================
     /// get non-const version of all_par_vec
     pod_vector_maybe<Base>& all_par_vec(void)
     {   return all_par_vec_; }
@@ -644,16 +1557,30 @@ public:
     // ================================================================
     /// const version of dynamic parameter flag
     const pod_vector<bool>& dyn_par_is(void) const
-    {   return dyn_par_is_; }
+    {   return info_->dyn_par_is_; }
     /// const version of dynamic parameter index to parameter index
     const pod_vector<addr_t>& dyn_ind2par_ind(void) const
-    {   return dyn_ind2par_ind_; }
+    {   return info_->dyn_ind2par_ind_; }
     /// const version of dynamic parameter operator
     const pod_vector<opcode_t>& dyn_par_op(void) const
-    {   return dyn_par_op_; }
+    {   return info_->dyn_par_op_; }
     /// const version of dynamic parameter arguments
     const pod_vector<addr_t>& dyn_par_arg(void) const
-    {   return dyn_par_arg_; }
+    {   return info_->dyn_par_arg_; }
+    /// index in dyn_par_arg of first argument for each dynamic operator
+    /// (empty if setup_dynamic has not been called)
+    const pod_vector<addr_t>& dyn_op2arg(void) const
+    {   return info_->dyn_op2arg_; }
+    /// start of the operators that use each parameter in dyn_use
+    /// (empty if setup_dynamic has not been called)
+    const pod_vector<addr_t>& dyn_use_begin(void) const
+    {   return info_->dyn_use_begin_; }
+    /// operators that use each parameter
+    const pod_vector<addr_t>& dyn_use(void) const
+    {   return info_->dyn_use_; }
+    /// first operator that uses a variable result of each atomic call
+    const pod_vector<addr_t>& atom_first_use(void) const
+    {   return info_->atom_first_use_; }
     /*!
     \brief
     fetch an operator from the recording.
@@ -665,7 +1592,7 @@ public:
     the index of the operator in recording
     */
     OpCode GetOp (size_t i) const
-    {   return OpCode(op_vec_[i]); }
+    {   return OpCode(info_->op_vec_[i]); }
 
     /*!
     \brief
@@ -678,7 +1605,24 @@ public:
     the index of the VecAD index in recording
     */
     size_t GetVecInd (size_t i) const
-    {   return size_t( all_var_vecad_ind_[i] ); }
+    {   return size_t( info_->all_var_vecad_ind_[i] ); }
+
+    /*!
+    \brief
+    Is there a store operator for a VecAD vector.
+
+    \return
+    true if there is a store operator in the recording for the vector
+    and false if its elements are always the parameters in the recording.
+
+    \param i
+    the index of the VecAD index in the recording that is the length of
+    the vector; i.e., arg[0] - 1 for a load or store operator.
+    */
+    bool vecad_store(size_t i) const
+    {   CPPAD_ASSERT_UNKNOWN( i < info_->vecad_store_.size() );
+        return info_->vecad_store_[i];
+    }
 
     /*!
     \brief
@@ -715,45 +1659,48 @@ public:
     the index where the string begins.
     */
     const char *GetTxt(size_t i) const
-    {   CPPAD_ASSERT_UNKNOWN(i < text_vec_.size() );
-        return text_vec_.data() + i;
+    {   CPPAD_ASSERT_UNKNOWN(i < info_->text_vec_.size() );
+        return info_->text_vec_.data() + i;
     }
 
     /// Fetch number of independent dynamic parameters in the recording
     size_t num_dynamic_ind(void) const
-    {   return num_dynamic_ind_; }
+    {   return info_->num_dynamic_ind_; }
 
     /// Fetch number of dynamic parameters in the recording
     size_t num_dynamic_par(void) const
-    {   return dyn_par_op_.size(); }
+    {   return info_->dyn_par_op_.size(); }
 
     /// Fetch number of dynamic parameters operator arguments in the recording
     size_t num_dynamic_arg(void) const
-    {   return dyn_par_arg_.size(); }
+    {   return info_->dyn_par_arg_.size(); }
 
     /// Fetch number of variables in the recording.
     size_t num_var_rec(void) const
-    {   return num_var_rec_; }
+    {   return info_->num_var_rec_; }
 
     /// Fetch number of vecad load operations
     size_t num_var_load_rec(void) const
-    {   return num_var_load_rec_; }
+    {   return info_->num_var_load_rec_; }
 
     /// Fetch number of operators in the recording.
     size_t num_op_rec(void) const
-    {   return op_vec_.size(); }
+    {   return info_->op_vec_.size(); }
 
     /// Fetch number of VecAD indices in the recording.
     size_t num_var_vecad_ind_rec(void) const
-    {   return all_var_vecad_ind_.size(); }
+    {   return info_->all_var_vecad_ind_.size(); }
 
     /// Fetch number of VecAD vectors in the recording
     size_t num_var_vecad_rec(void) const
-    {   return num_var_vecad_rec_; }
+    {   return info_->num_var_vecad_rec_; }
 
     /// Fetch number of argument indices in the recording.
     size_t num_op_arg_rec(void) const
-    {   return arg_vec_.size(); }
+    {   if( arg_compact() )
+            return info_->num_arg_compact_;
+        return info_->arg_vec_.size();
+    }
 
     /// Fetch number of parameters in the recording.
     size_t num_par_rec(void) const
@@ -761,27 +1708,31 @@ public:
 
     /// Fetch number of characters (representing strings) in the recording.
     size_t num_text_rec(void) const
-    {   return text_vec_.size(); }
+    {   return info_->text_vec_.size(); }
 
     /// A measure of amount of memory used to store
     /// the operation sequence, just lengths, not capacities.
     /// In user api as f.size_op_seq(); see the file seq_property.omh.
     size_t size_op_seq(void) const
     {   // check assumptions made by ad_fun<Base>::size_op_seq()
-        CPPAD_ASSERT_UNKNOWN( op_vec_.size() == num_op_rec() );
-        CPPAD_ASSERT_UNKNOWN( arg_vec_.size()    == num_op_arg_rec() );
+        CPPAD_ASSERT_UNKNOWN( info_->op_vec_.size() == num_op_rec() );
+        CPPAD_ASSERT_UNKNOWN(
+            arg_compact() || info_->arg_vec_.size() == num_op_arg_rec()
+        );
         CPPAD_ASSERT_UNKNOWN( all_par_vec_.size() == num_par_rec() );
-        CPPAD_ASSERT_UNKNOWN( text_vec_.size() == num_text_rec() );
-        CPPAD_ASSERT_UNKNOWN( all_var_vecad_ind_.size() == num_var_vecad_ind_rec() );
-        return op_vec_.size()        * sizeof(opcode_t)
-             + arg_vec_.size()       * sizeof(addr_t)
+        CPPAD_ASSERT_UNKNOWN( info_->text_vec_.size() == num_text_rec() );
+        CPPAD_ASSERT_UNKNOWN( info_->all_var_vecad_ind_.size() == num_var_vecad_ind_rec() );
+        return info_->op_vec_.size()        * sizeof(opcode_t)
+             + info_->arg_vec_.size()       * sizeof(addr_t)
+             + info_->arg_compact_.size()   * sizeof(unsigned char)
+             + info_->arg_long_.size()      * sizeof(addr_t)
              + all_par_vec_.size()   * sizeof(Base)
-             + dyn_par_is_.size()    * sizeof(bool)
-             + dyn_ind2par_ind_.size() * sizeof(addr_t)
-             + dyn_par_op_.size()    * sizeof(opcode_t)
-             + dyn_par_arg_.size()   * sizeof(addr_t)
-             + text_vec_.size()      * sizeof(char)
-             + all_var_vecad_ind_.size() * sizeof(addr_t)
+             + info_->dyn_par_is_.size()    * sizeof(bool)
+             + info_->dyn_ind2par_ind_.size() * sizeof(addr_t)
+             + info_->dyn_par_op_.size()    * sizeof(opcode_t)
+             + info_->dyn_par_arg_.size()   * sizeof(addr_t)
+             + info_->text_vec_.size()      * sizeof(char)
+             + info_->all_var_vecad_ind_.size() * sizeof(addr_t)
         ;
     }
     /// A measure of amount of memory used for random access routine
@@ -789,9 +1740,9 @@ public:
     size_t size_random(void) const
     {
 # ifndef NDEBUG
-        if( op2arg_vec_.size() == 0 )
-        {   CPPAD_ASSERT_UNKNOWN( op2var_vec_.size() == 0 );
-            CPPAD_ASSERT_UNKNOWN( var2op_vec_.size() == 0 );
+        if( info_->op2arg_vec_.size() == 0 )
+        {   CPPAD_ASSERT_UNKNOWN( info_->op2var_vec_.size() == 0 );
+            CPPAD_ASSERT_UNKNOWN( info_->var2op_vec_.size() == 0 );
         }
         else
         {   size_t size = 0;
@@ -812,32 +1763,40 @@ public:
                 CPPAD_ASSERT_UNKNOWN(false);
                 break;
             }
-            CPPAD_ASSERT_UNKNOWN( op2arg_vec_.size()/size  == num_op_rec() );
-            CPPAD_ASSERT_UNKNOWN( op2var_vec_.size()/size  == num_op_rec() );
-            CPPAD_ASSERT_UNKNOWN( var2op_vec_.size()/size  == num_var_rec() );
+            CPPAD_ASSERT_UNKNOWN( info_->op2arg_vec_.size()/size  == num_op_rec() );
+            CPPAD_ASSERT_UNKNOWN( info_->op2var_vec_.size()/size  == num_op_rec() );
+            CPPAD_ASSERT_UNKNOWN( info_->var2op_vec_.size()/size  == num_var_rec() );
         }
 # endif
         CPPAD_ASSERT_UNKNOWN( sizeof(unsigned char) == 1 );
-        return op2arg_vec_.size()
-             + op2var_vec_.size()
-             + var2op_vec_.size()
+        return info_->op2arg_vec_.size()
+             + info_->op2var_vec_.size()
+             + info_->var2op_vec_.size()
         ;
     }
     // -----------------------------------------------------------------------
     /// const sequential iterator begin
     play::const_sequential_iterator begin(void) const
     {   size_t op_index = 0;
-        size_t num_var  = num_var_rec_;
+        size_t num_var  = info_->num_var_rec_;
+        if( arg_compact() ) return play::const_sequential_iterator(
+            num_var, &info_->op_vec_,
+            &info_->arg_compact_, &info_->arg_long_, op_index
+        );
         return play::const_sequential_iterator(
-            num_var, &op_vec_, &arg_vec_, op_index
+            num_var, &info_->op_vec_, &info_->arg_vec_, op_index
         );
     }
     /// const sequential iterator end
     play::const_sequential_iterator end(void) const
-    {   size_t op_index = op_vec_.size() - 1;
-        size_t num_var  = num_var_rec_;
+    {   size_t op_index = info_->op_vec_.size() - 1;
+        size_t num_var  = info_->num_var_rec_;
+        if( arg_compact() ) return play::const_sequential_iterator(
+            num_var, &info_->op_vec_,
+            &info_->arg_compact_, &info_->arg_long_, op_index
+        );
         return play::const_sequential_iterator(
-            num_var, &op_vec_, &arg_vec_, op_index
+            num_var, &info_->op_vec_, &info_->arg_vec_, op_index
         );
     }
     // -----------------------------------------------------------------------
@@ -868,12 +1827,13 @@ public:
     /// const random iterator
     template <class Addr>
     play::const_random_iterator<Addr> get_random(void) const
-    {   return play::const_random_iterator<Addr>(
-            op_vec_,
-            arg_vec_,
-            op2arg_vec_.pod_vector_ptr<Addr>(),
-            op2var_vec_.pod_vector_ptr<Addr>(),
-            var2op_vec_.pod_vector_ptr<Addr>()
+    {   CPPAD_ASSERT_UNKNOWN( ! arg_compact() );
+        return play::const_random_iterator<Addr>(
+            info_->op_vec_,
+            info_->arg_vec_,
+            info_->op2arg_vec_.template pod_vector_ptr<Addr>(),
+            info_->op2var_vec_.template pod_vector_ptr<Addr>(),
+            info_->var2op_vec_.template pod_vector_ptr<Addr>()
         );
     }
 };
@@ -1,7 +1,7 @@
 # ifndef CPPAD_LOCAL_PLAY_SEQUENTIAL_ITERATOR_HPP
 # define CPPAD_LOCAL_PLAY_SEQUENTIAL_ITERATOR_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-18 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -12,6 +12,8 @@ in the Eclipse Public License, Version 2.0 are satisfied:
       GNU General Public License, Version 2.0 or later.
 ---------------------------------------------------------------------------- */
 
+# include <cppad/local/play/compact_arg.hpp>
+
 // BEGIN_CPPAD_LOCAL_PLAY_NAMESPACE
 namespace CppAD { namespace local { namespace play {
 
@@ -29,6 +31,14 @@ arg_vec, op2arg_vec, op2var_vec, var2op_vec.
 \par
 Except for constructor, the public API for this class is the same as
 for the subgraph_iterator class.
+
+\par Compact Arguments
+If the arguments are stored using a compact encoding (see compact_arg.hpp),
+they are decoded on the fly and op_info returns a pointer to a copy
+of the arguments that is stored in this iterator. This pointer is only
+valid until the iterator is incremented, decremented, or destroyed.
+The arguments for CSumOp and CSkipOp are not compact and are accessed the
+same way as when the arguments are not compact.
 */
 class const_sequential_iterator {
 private:
@@ -58,6 +68,21 @@ private:
 
     /// value of current operator; i.e. op_ = *op_cur_
     OpCode                    op_;
+
+    /// are the arguments (other than for CSumOp and CSkipOp) compact
+    bool                      compact_;
+
+    /// if compact_, first byte of the encoding for all the operators
+    const unsigned char*      byte_begin_;
+
+    /// if compact_, first byte of encoding for current operator arguments
+    const unsigned char*      byte_cur_;
+
+    /// if compact_, first byte of encoding for next operator arguments
+    const unsigned char*      byte_next_;
+
+    /// if compact_, decoded arguments for current operator
+    addr_t                    buf_[6];
 public:
     /// default constructor
     const_sequential_iterator(void) :
@@ -69,7 +94,11 @@ public:
     arg_(CPPAD_NULL)       ,
     num_var_(0)            ,
     var_index_(0)          ,
-    op_(NumberOp)
+    op_(NumberOp)          ,
+    compact_(false)        ,
+    byte_begin_(CPPAD_NULL),
+    byte_cur_(CPPAD_NULL)  ,
+    byte_next_(CPPAD_NULL)
     { }
     /// assignment operator
     void operator=(const const_sequential_iterator& rhs)
@@ -83,6 +112,12 @@ public:
         num_var_   = rhs.num_var_;
         var_index_ = rhs.var_index_;
         op_        = rhs.op_;
+        compact_   = rhs.compact_;
+        byte_begin_= rhs.byte_begin_;
+        byte_cur_  = rhs.byte_cur_;
+        byte_next_ = rhs.byte_next_;
+        for(size_t i = 0; i < 6; ++i)
+            buf_[i] = rhs.buf_[i];
         return;
     }
     /*!
@@ -115,7 +150,11 @@ public:
     op_end_     ( op_vec->data() + op_vec->size() )  ,
     arg_begin_  ( arg_vec->data() )                  ,
     arg_end_    ( arg_vec->data() + arg_vec->size() ),
-    num_var_    ( num_var )
+    num_var_    ( num_var )                          ,
+    compact_    ( false )                            ,
+    byte_begin_ ( CPPAD_NULL )                       ,
+    byte_cur_   ( CPPAD_NULL )                       ,
+    byte_next_  ( CPPAD_NULL )
     {   if( op_index == 0 )
         {
             // index of last result for BeginOp
@@ -147,12 +186,74 @@ public:
         }
     }
     /*!
+    Create a sequential iterator, for compact arguments, starting either
+    at beginning or end of tape
+
+    \param num_var
+    is the number of variables in the tape.
+
+    \param op_vec
+    is the vector of operators on the tape.
+
+    \param arg_compact
+    is the compact encoding of the arguments for all the operators
+    except CSumOp and CSkipOp; see compact_arg.hpp.
+
+    \param arg_long
+    is the vector of arguments for the CSumOp and CSkipOp operators.
+
+    \param op_index
+    is the operator index that iterator will start at.
+    It must be zero or op_vec_->size() - 1.
+    */
+    const_sequential_iterator(
+        size_t                                num_var     ,
+        const pod_vector<opcode_t>*           op_vec      ,
+        const pod_vector<unsigned char>*      arg_compact ,
+        const pod_vector<addr_t>*             arg_long    ,
+        size_t                                op_index    )
+    :
+    op_begin_   ( op_vec->data() )                      ,
+    op_end_     ( op_vec->data() + op_vec->size() )     ,
+    arg_begin_  ( arg_long->data() )                    ,
+    arg_end_    ( arg_long->data() + arg_long->size() ) ,
+    num_var_    ( num_var )                             ,
+    compact_    ( true )                                ,
+    byte_begin_ ( arg_compact->data() )
+    {   CPPAD_ASSERT_UNKNOWN( 1 < arg_compact->size() );
+        CPPAD_ASSERT_UNKNOWN( (*arg_compact)[0] == 0 );
+        if( op_index == 0 )
+        {   var_index_ = 0;
+            arg_       = arg_begin_;
+            op_cur_    = op_begin_;
+            op_        = OpCode( *op_cur_ );
+            CPPAD_ASSERT_UNKNOWN( op_ == BeginOp );
+            //
+            // the first byte is not part of the encoding for BeginOp
+            byte_cur_  = arg_compact->data() + 1;
+            byte_next_ = compact_arg_decode(op_, var_index_, byte_cur_, buf_);
+        }
+        else
+        {   CPPAD_ASSERT_UNKNOWN(op_index == op_vec->size()-1);
+            var_index_ = num_var - 1;
+            arg_       = arg_end_;
+            op_cur_    = op_end_ - 1;
+            op_        = OpCode( *op_cur_ );
+            CPPAD_ASSERT_UNKNOWN( op_ == EndOp );
+            //
+            // EndOp has no arguments
+            byte_cur_  = arg_compact->data() + arg_compact->size();
+            byte_next_ = byte_cur_;
+        }
+    }
+    /*!
     Advance iterator to next operator
     */
     const_sequential_iterator& operator++(void)
     {
         // first argument for next operator
-        arg_ += NumArg(op_);
+        if( ! compact_ )
+            arg_ += NumArg(op_);
         //
         // next operator
         ++op_cur_;
@@ -161,6 +262,12 @@ public:
         // last result for next operator
         var_index_ += NumRes(op_);
         //
+        // decode arguments for next operator
+        if( compact_ )
+        {   byte_cur_  = byte_next_;
+            byte_next_ = compact_arg_decode(op_, var_index_, byte_cur_, buf_);
+        }
+        //
         return *this;
     }
     /*!
@@ -192,6 +299,57 @@ public:
         return;
     }
     /*!
+    Get the position of the arguments for the current operator.
+
+    \param arg_index [out]
+    is the index of the first argument for the current operator in the
+    argument vector (in the vector of arguments for CSumOp and CSkipOp
+    if the arguments are compact).
+
+    \param byte_index [out]
+    if the arguments are compact, this is the index of the first byte
+    in the encoding of the arguments for the current operator.
+    Otherwise it is zero.
+    */
+    void position(size_t& arg_index, size_t& byte_index) const
+    {   arg_index  = size_t( arg_ - arg_begin_ );
+        byte_index = 0;
+        if( compact_ )
+            byte_index = size_t( byte_cur_ - byte_begin_ );
+    }
+    /*!
+    Move iterator forward to a position returned by a previous call to
+    position; see player::cskip_jump.
+
+    \param op_index
+    is the index of the operator that the iterator is moved to.
+
+    \param arg_index
+    is the arg_index returned by position for this operator.
+
+    \param var_index
+    is the index of the last result for this operator.
+
+    \param byte_index
+    is the byte_index returned by position for this operator.
+    */
+    void jump(
+        size_t op_index   ,
+        size_t arg_index  ,
+        size_t var_index  ,
+        size_t byte_index )
+    {   CPPAD_ASSERT_UNKNOWN( op_begin_ + op_index < op_end_ );
+        CPPAD_ASSERT_UNKNOWN( op_cur_ < op_begin_ + op_index );
+        op_cur_    = op_begin_ + op_index;
+        op_        = OpCode( *op_cur_ );
+        arg_       = arg_begin_ + arg_index;
+        var_index_ = var_index;
+        if( compact_ )
+        {   byte_cur_  = byte_begin_ + byte_index;
+            byte_next_ = compact_arg_decode(op_, var_index_, byte_cur_, buf_);
+        }
+    }
+    /*!
     Backup iterator to previous operator
     */
     const_sequential_iterator& operator--(void)
@@ -204,7 +362,13 @@ public:
         op_ = OpCode( *op_cur_ );
         //
         // first argument for next operator
-        arg_ -= NumArg(op_);
+        if( ! compact_ )
+            arg_ -= NumArg(op_);
+        else
+        {   byte_next_ = byte_cur_;
+            byte_cur_  = compact_arg_back(NumArg(op_), byte_cur_);
+            compact_arg_decode(op_, var_index_, byte_cur_, buf_);
+        }
         //
         return *this;
     }
@@ -272,9 +436,13 @@ public:
         op        = op_;
         //
         // arg
-        arg = arg_;
-        CPPAD_ASSERT_UNKNOWN( arg_begin_ <= arg );
-        CPPAD_ASSERT_UNKNOWN( arg + NumArg(op) <= arg_end_ );
+        if( compact_ && NumArg(op) > 0 )
+            arg = buf_;
+        else
+        {   arg = arg_;
+            CPPAD_ASSERT_UNKNOWN( arg_begin_ <= arg );
+            CPPAD_ASSERT_UNKNOWN( arg + NumArg(op) <= arg_end_ );
+        }
         //
         // var_index
         CPPAD_ASSERT_UNKNOWN( var_index_ < num_var_ || NumRes(op) == 0 );
@@ -258,6 +258,22 @@ public:
     }
     // ----------------------------------------------------------------------
     /*!
+    Make sure the capacity is at least a specified value
+    (existing elements are always preserved).
+
+    \param n
+    is the minimum capacity for this vector.
+    If n <= capacity(), this vector is not changed.
+    */
+    void reserve(size_t n)
+    {   size_t length = size();
+        if( n > capacity() )
+        {   extend(n - length);
+            resize(length);
+        }
+    }
+    // ----------------------------------------------------------------------
+    /*!
     Remove all the elements from this vector and free its memory.
     */
     void clear(void)
@@ -531,6 +547,22 @@ public:
     }
     // ----------------------------------------------------------------------
     /*!
+    Make sure the capacity is at least a specified value
+    (existing elements are always preserved).
+
+    \param n
+    is the minimum capacity for this vector.
+    If n <= capacity(), this vector is not changed.
+    */
+    void reserve(size_t n)
+    {   size_t length = size();
+        if( n > capacity() )
+        {   extend(n - length);
+            resize(length);
+        }
+    }
+    // ----------------------------------------------------------------------
+    /*!
     Remove all the elements from this vector and free its memory.
     */
     void clear(void)
@@ -22,6 +22,16 @@ namespace CppAD { namespace local { // BEGIN_CPPAD_LOCAL_NAMESPACE
 File used to define the recorder class.
 */
 
+/// method used by put_con_par to find a previous parameter with the same value
+enum con_par_hash_enum {
+    /// hash table with CPPAD_HASH_TABLE_SIZE entries (the default)
+    fixed_con_par_hash,
+    /// hash table that grows with the number of constant parameters
+    grow_con_par_hash,
+    /// do not check for a previous parameter with the same value
+    no_con_par_hash
+};
+
 /*!
 Class used to store an operation sequence while it is being recorded
 (the operation sequence is copied to the player class for playback).
@@ -67,6 +77,16 @@ private:
     /// Hash table to reduced number of duplicate parameters in all_par_vec_
     pod_vector<addr_t> par_hash_table_;
 
+    /// method used by put_con_par to find duplicate parameters
+    con_par_hash_enum con_par_hash_;
+
+    /// Hash table used when con_par_hash_ is grow_con_par_hash.
+    /// Its size is a power of two and an entry of zero is an empty slot.
+    pod_vector<addr_t> par_grow_table_;
+
+    /// number of entries in par_grow_table_ that are not empty
+    size_t par_grow_used_;
+
     /// Vector containing all the parameters in the recording.
     /// Use pod_vector_maybe because Base may not be plain old data.
     pod_vector_maybe<Base> all_par_vec_;
@@ -88,7 +108,9 @@ public:
     num_var_rec_(0)                          ,
     num_dynamic_ind_(0)                      ,
     num_var_load_rec_(0)                      ,
-    par_hash_table_( CPPAD_HASH_TABLE_SIZE )
+    par_hash_table_( CPPAD_HASH_TABLE_SIZE )  ,
+    con_par_hash_(fixed_con_par_hash)         ,
+    par_grow_used_(0)
     {   record_compare_ = true;
         abort_op_index_ = 0;
         // It does not matter if unitialized hash codes match but this
@@ -111,6 +133,12 @@ public:
     void set_num_dynamic_ind(size_t num_dynamic_ind)
     {   num_dynamic_ind_ = num_dynamic_ind; }
 
+    /// Set method used by put_con_par to find duplicate parameters
+    void set_con_par_hash(con_par_hash_enum con_par_hash);
+
+    /// Reserve memory for the operators, arguments and parameters
+    void reserve(size_t num_op, size_t num_arg, size_t num_par);
+
     /// Get record_compare option
     bool get_record_compare(void) const
     {   return record_compare_; }
@@ -123,6 +151,10 @@ public:
     size_t get_num_dynamic_ind(void) const
     {   return num_dynamic_ind_; }
 
+    /// Get method used by put_con_par to find duplicate parameters
+    con_par_hash_enum get_con_par_hash(void) const
+    {   return con_par_hash_; }
+
     /// Destructor
     ~recorder(void)
     { }
@@ -271,6 +303,9 @@ public:
              + text_vec_.capacity()      * sizeof(char);
     }
 
+private:
+    /// put an entry in par_grow_table_ and grow it when necessary
+    void par_grow_insert(size_t slot, size_t index);
 };
 
 /*!
@@ -551,27 +586,57 @@ addr_t recorder<Base>::put_con_par(const Base &par)
     // ---------------------------------------------------------------------
     // check for a match with a previous parameter
     //
-    // get hash code for this value
-    size_t code  = static_cast<size_t>( hash_code(par) );
-
-    // current index in all_par_vec_ corresponding to this hash code
-    size_t index = static_cast<size_t>( par_hash_table_[code] );
-
-    // check if the old parameter matches the new one
-    if( (0 < index) & (index < all_par_vec_.size()) )
-    {   if( ! dyn_par_is_[index] )
-            if( IdenticalEqualCon(all_par_vec_[index], par) )
-                return static_cast<addr_t>( index );
+    // code: hash code for this value (only used by fixed_con_par_hash)
+    // slot: empty slot for this value (only used by grow_con_par_hash)
+    size_t code = 0;
+    size_t slot = 0;
+    switch( con_par_hash_ )
+    {   case fixed_con_par_hash:
+        {   // get hash code for this value
+            code  = static_cast<size_t>( hash_code(par) );
+
+            // current index in all_par_vec_ corresponding to this hash code
+            size_t index = static_cast<size_t>( par_hash_table_[code] );
+
+            // check if the old parameter matches the new one
+            if( (0 < index) & (index < all_par_vec_.size()) )
+            {   if( ! dyn_par_is_[index] )
+                    if( IdenticalEqualCon(all_par_vec_[index], par) )
+                        return static_cast<addr_t>( index );
+            }
+        }
+        break;
+
+        case grow_con_par_hash:
+        {   // search the entries with the same hash code until an empty slot
+            size_t mask = par_grow_table_.size() - 1;
+            slot        = local_wide_hash_code(par) & mask;
+            size_t index = static_cast<size_t>( par_grow_table_[slot] );
+            while( index != 0 )
+            {   CPPAD_ASSERT_UNKNOWN( ! dyn_par_is_[index] );
+                if( IdenticalEqualCon(all_par_vec_[index], par) )
+                    return static_cast<addr_t>( index );
+                slot  = (slot + 1) & mask;
+                index = static_cast<size_t>( par_grow_table_[slot] );
+            }
+        }
+        break;
+
+        case no_con_par_hash:
+        break;
     }
     // ---------------------------------------------------------------------
     // put paramerter in all_par_vec_ and replace hash entry for this codee
     //
-    index = all_par_vec_.size();
+    size_t index = all_par_vec_.size();
     all_par_vec_.push_back( par );
     dyn_par_is_.push_back(false);
     //
     // change the hash table for this code to point to new value
-    par_hash_table_[code] = static_cast<addr_t>( index );
+    if( con_par_hash_ == fixed_con_par_hash )
+        par_hash_table_[code] = static_cast<addr_t>( index );
+    else if( con_par_hash_ == grow_con_par_hash && index > 0 )
+        par_grow_insert(slot, index);
     //
     // return the parameter index
     CPPAD_ASSERT_KNOWN(
@@ -580,6 +645,111 @@ addr_t recorder<Base>::put_con_par(const Base &par)
     )
     return static_cast<addr_t>( index );
 }
+// ---------------------------------------------------------------------------
+/*!
+Put an entry in par_grow_table_.
+
+\param slot
+is an empty slot in par_grow_table_ where this entry goes.
+
+\param index
+is the index of the constant parameter in all_par_vec_.
+If after this insertion, more than half of the slots are in use,
+the number of slots is doubled.
+*/
+template <class Base>
+void recorder<Base>::par_grow_insert(size_t slot, size_t index)
+{   CPPAD_ASSERT_UNKNOWN( par_grow_table_[slot] == 0 );
+    par_grow_table_[slot] = static_cast<addr_t>( index );
+    ++par_grow_used_;
+    if( 2 * par_grow_used_ <= par_grow_table_.size() )
+        return;
+    //
+    // double the number of slots
+    pod_vector<addr_t> old_table;
+    old_table.swap(par_grow_table_);
+    size_t n_slot = 2 * old_table.size();
+    size_t mask   = n_slot - 1;
+    par_grow_table_.resize(n_slot);
+    for(size_t i = 0; i < n_slot; ++i)
+        par_grow_table_[i] = 0;
+    for(size_t i = 0; i < old_table.size(); ++i)
+    {   size_t old_index = static_cast<size_t>( old_table[i] );
+        if( old_index != 0 )
+        {   slot = local_wide_hash_code( all_par_vec_[old_index] ) & mask;
+            while( par_grow_table_[slot] != 0 )
+                slot = (slot + 1) & mask;
+            par_grow_table_[slot] = old_table[i];
+        }
+    }
+}
+// ---------------------------------------------------------------------------
+/*!
+Set the method used by put_con_par to find a previous constant parameter
+with the same value.
+
+\param con_par_hash
+is the new method.
+If it is grow_con_par_hash, the constant parameters that are already in
+the recording are placed in the growing hash table.
+Only one of the parameters with the same value is placed in the table.
+*/
+template <class Base>
+void recorder<Base>::set_con_par_hash(con_par_hash_enum con_par_hash)
+{   con_par_hash_ = con_par_hash;
+    par_grow_table_.clear();
+    par_grow_used_ = 0;
+    if( con_par_hash != grow_con_par_hash )
+        return;
+    //
+    // initial number of slots is a power of two greater than
+    // two times the number of parameters
+    size_t n_par  = all_par_vec_.size();
+    size_t n_slot = 2;
+    while( n_slot <= 2 * n_par || n_slot < CPPAD_HASH_TABLE_SIZE )
+        n_slot *= 2;
+    par_grow_table_.resize(n_slot);
+    for(size_t i = 0; i < n_slot; ++i)
+        par_grow_table_[i] = 0;
+    //
+    // put the previous constant parameters in the table
+    for(size_t index = 1; index < n_par; ++index) if( ! dyn_par_is_[index] )
+    {   const Base& par = all_par_vec_[index];
+        size_t mask     = par_grow_table_.size() - 1;
+        size_t slot     = local_wide_hash_code(par) & mask;
+        bool   found    = false;
+        while( ! found && par_grow_table_[slot] != 0 )
+        {   size_t other = static_cast<size_t>( par_grow_table_[slot] );
+            found = IdenticalEqualCon(all_par_vec_[other], par);
+            slot  = (slot + 1) & mask;
+        }
+        if( ! found )
+            par_grow_insert(slot, index);
+    }
+}
+// ---------------------------------------------------------------------------
+/*!
+Reserve memory for the recording.
+
+This does not change the recording; it only avoids having to
+reallocate and copy the recording as it grows.
+
+\param num_op
+is the number of operators that memory is reserved for.
+
+\param num_arg
+is the number of operator arguments that memory is reserved for.
+
+\param num_par
+is the number of parameters that memory is reserved for.
+*/
+template <class Base>
+void recorder<Base>::reserve(size_t num_op, size_t num_arg, size_t num_par)
+{   op_vec_.reserve(num_op);
+    arg_vec_.reserve(num_arg);
+    all_par_vec_.reserve(num_par);
+    dyn_par_is_.reserve(num_par);
+}
 // -------------------------- PutArg --------------------------------------
 /*!
 Prototype for putting operation argument indices in the recording.
@@ -118,16 +118,31 @@ void forward_sin_op_dir(
     // rest of this routine is identical for the following cases:
     // forward_sin_op, forward_cos_op, forward_sinh_op, forward_cosh_op
     // (except that there is a sign difference for the hyperbolic case).
-    size_t m = (q-1) * r + 1;
+    // (directions are the inner loops; see forward_mulvv_op_dir)
+    size_t m  = (q-1) * r + 1;
+    Base   bq = Base(double(q));
+    Base   s0 = s[0];
+    Base   c0 = c[0];
+    Base*  sq = s + m;
+    Base*  cq = c + m;
+    const Base* xq = x + m;
     for(size_t ell = 0; ell < r; ell++)
-    {   s[m+ell] =   Base(double(q)) * x[m + ell] * c[0];
-        c[m+ell] = - Base(double(q)) * x[m + ell] * s[0];
-        for(size_t k = 1; k < q; k++)
-        {   s[m+ell] += Base(double(k)) * x[(k-1)*r+1+ell] * c[(q-k-1)*r+1+ell];
-            c[m+ell] -= Base(double(k)) * x[(k-1)*r+1+ell] * s[(q-k-1)*r+1+ell];
+    {   sq[ell] =   bq * xq[ell] * c0;
+        cq[ell] = - bq * xq[ell] * s0;
+    }
+    for(size_t k = 1; k < q; k++)
+    {   Base bk = Base(double(k));
+        const Base* xk = x + (k-1)*r + 1;
+        const Base* sk = s + (q-k-1)*r + 1;
+        const Base* ck = c + (q-k-1)*r + 1;
+        for(size_t ell = 0; ell < r; ell++)
+        {   sq[ell] += bk * xk[ell] * ck[ell];
+            cq[ell] -= bk * xk[ell] * sk[ell];
         }
-        s[m+ell] /= Base(double(q));
-        c[m+ell] /= Base(double(q));
+    }
+    for(size_t ell = 0; ell < r; ell++)
+    {   sq[ell] /= bq;
+        cq[ell] /= bq;
     }
 }
 
@@ -0,0 +1,106 @@
+# ifndef CPPAD_LOCAL_SPARSE_CRS_PATTERN_HPP
+# define CPPAD_LOCAL_SPARSE_CRS_PATTERN_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cppad/utility/vector.hpp>
+# include <cppad/utility/sparse_rc.hpp>
+# include <cppad/local/pod_vector.hpp>
+
+// BEGIN_CPPAD_LOCAL_SPARSE_NAMESPACE
+namespace CppAD { namespace local { namespace sparse {
+/*!
+\file crs_pattern.hpp
+A constant sparsity pattern in compressed row storage format.
+*/
+
+/*!
+Sparsity pattern stored in compressed row format.
+
+The column indices for row i are col(k) for
+row_begin(i) <= k < row_begin(i+1).
+They are in increasing order.
+This is used for sparsity patterns that are computed once
+and then used many times; e.g., the patterns for a checkpoint function.
+*/
+class crs_pattern {
+private:
+    /// number of rows
+    size_t nr_;
+    /// number of columns
+    size_t nc_;
+    /// index in col_ where each row begins (size nr_ + 1)
+    pod_vector<size_t> row_begin_;
+    /// column index for each possibly non-zero element
+    pod_vector<size_t> col_;
+public:
+    /// default constructor (an empty pattern)
+    crs_pattern(void) : nr_(0), nc_(0)
+    {   row_begin_.resize(1);
+        row_begin_[0] = 0;
+    }
+    /// copy constructor
+    crs_pattern(const crs_pattern& other)
+    {   *this = other; }
+    /// assignment operator
+    void operator=(const crs_pattern& other)
+    {   nr_        = other.nr_;
+        nc_        = other.nc_;
+        row_begin_ = other.row_begin_;
+        col_       = other.col_;
+    }
+    /// set this pattern equal to a sparse_rc pattern
+    void set(const sparse_rc< vector<size_t> >& pattern)
+    {   nr_        = pattern.nr();
+        nc_        = pattern.nc();
+        size_t nnz = pattern.nnz();
+        const vector<size_t>& row( pattern.row() );
+        const vector<size_t>& col( pattern.col() );
+        vector<size_t> row_major = pattern.row_major();
+        //
+        row_begin_.resize(nr_ + 1);
+        col_.resize(nnz);
+        for(size_t i = 0; i <= nr_; ++i)
+            row_begin_[i] = 0;
+        for(size_t k = 0; k < nnz; ++k)
+        {   size_t ell = row_major[k];
+            ++row_begin_[ row[ell] + 1 ];
+            col_[k] = col[ell];
+        }
+        for(size_t i = 0; i < nr_; ++i)
+            row_begin_[i + 1] += row_begin_[i];
+        CPPAD_ASSERT_UNKNOWN( row_begin_[nr_] == nnz );
+    }
+    /// number of rows
+    size_t nr(void) const
+    {   return nr_; }
+    /// number of columns
+    size_t nc(void) const
+    {   return nc_; }
+    /// number of possibly non-zero elements
+    size_t nnz(void) const
+    {   return col_.size(); }
+    /// index of the first element in row i (i <= nr)
+    size_t row_begin(size_t i) const
+    {   CPPAD_ASSERT_UNKNOWN( i <= nr_ );
+        return row_begin_[i];
+    }
+    /// column index for element k (k < nnz)
+    size_t col(size_t k) const
+    {   CPPAD_ASSERT_UNKNOWN( k < col_.size() );
+        return col_[k];
+    }
+};
+
+} } } // END_CPPAD_LOCAL_SPARSE_NAMESPACE
+
+# endif
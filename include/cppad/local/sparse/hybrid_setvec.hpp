@@ -0,0 +1,1499 @@
+# ifndef CPPAD_LOCAL_SPARSE_HYBRID_SETVEC_HPP
+# define CPPAD_LOCAL_SPARSE_HYBRID_SETVEC_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+# include <cppad/local/define.hpp>
+# include <cppad/local/is_pod.hpp>
+# include <cppad/local/pod_vector.hpp>
+# include <limits>
+# include <algorithm>
+
+/*
+$begin hybrid_setvec$$
+$spell
+    setvec
+    SetVector
+$$
+
+$section Implement SetVector Using Adaptive Containers for Each Set$$
+
+$head Purpose$$
+The $code sparse::hybrid_setvec$$ class implements the $cref SetVector$$
+concept. Each set is stored using the smallest of the following containers:
+$table
+$icode container$$ $cnext $icode memory$$ (in $code size_t$$ units) $rnext
+array $cnext
+    the number of elements in the set
+$rnext
+runs $cnext
+    two times the number of runs of consecutive elements in the set
+$rnext
+bits $cnext
+    one plus the number of words from the first to the last element
+$tend
+The container for a set is chosen each time the set changes.
+This is similar to the containers used by Roaring bitmaps.
+Like $cref list_setvec$$, sets that are equal because of an
+assignment or a union share memory using a reference count.
+This is useful for sparsity patterns with a large number of columns
+where some rows are dense and other rows are very sparse.
+
+$end
+*/
+
+// BEGIN_CPPAD_LOCAL_SPARSE_NAMESPACE
+namespace CppAD { namespace local { namespace sparse {
+
+/*!
+\file hybrid_setvec.hpp
+Vector of sets of positive integers where each set is stored as
+a sorted array, a vector of runs, or a vector of bits.
+*/
+class hybrid_setvec_const_iterator;
+
+// =========================================================================
+/*!
+Vector of sets of positive integers, each set is stored using the
+container that uses the least memory.
+
+All the public members for this class are also in the
+sparse::pack_setvec and sparse::list_setvec classes.
+This defines the CppAD vector_of_sets concept.
+*/
+class hybrid_setvec {
+    friend class hybrid_setvec_const_iterator;
+private:
+    /// the possible containers for one set
+    enum container_enum { array_container, bits_container, runs_container };
+
+    /// Possible elements in each set are 0, 1, ..., end_ - 1;
+    size_t end_;
+
+    /// number of elements in data_ that are no longer being used.
+    size_t data_not_used_;
+
+    /*!
+    The data for all the sets.
+
+    If the i-th set is not empty, its block starts at s = start_[i] and
+    \li data_[s]     is the reference count for this block
+    \li data_[s + 1] is the container_enum value for this block
+    \li data_[s + 2] is the number of elements in the set
+    \li data_[s + 3] is the number of payload values L
+    \li data_[s + 4], ..., data_[s + 3 + L] are the payload values.
+
+    For an array container, the payload is the elements in increasing order.
+    For a runs container, the payload is pairs (first, last + 1),
+    in increasing order, for each run of consecutive elements.
+    For a bits container, the first payload value is the index of the first
+    word and the other payload values are the words; i.e.,
+    element e is in the set if bit e % n_bit() of word e / n_bit() is one.
+    */
+    pod_vector<size_t> data_;
+
+    /// block for the i-th set is start_[i] (zero for the empty set)
+    pod_vector<size_t> start_;
+
+    /*!
+    Elements that have been posted and not yet added to each set.
+
+    If there are no posts for the i-th set post_[i] is zero. Otherwise
+    \li post_data_[ post_[i] ] is the number of posted elements n
+    \li post_data_[ post_[i] + 1 ] is the capacity for posted elements
+    \li post_data_[ post_[i] + 2 ], ..., post_data_[ post_[i] + 1 + n ]
+    are the posted elements.
+    */
+    pod_vector<size_t> post_;
+
+    /// memory for all the posts
+    pod_vector<size_t> post_data_;
+
+    /// number of sets that have posts
+    size_t n_post_;
+
+    /// temporary runs (first, last + 1) for the result of an operation
+    pod_vector<size_t> temp_runs_;
+
+    /// temporary bits payload for the result of an operation
+    pod_vector<size_t> temp_bits_;
+
+    /// temporary block used for elements that are added to a set
+    pod_vector<size_t> temp_block_;
+
+    /// if true (false) the result of an operation is in temp_bits_
+    /// (temp_runs_).
+    bool result_bits_;
+    // -----------------------------------------------------------------
+    /// number of bits in a word
+    static size_t n_bit(void)
+    {   return size_t( std::numeric_limits<size_t>::digits ); }
+    // -----------------------------------------------------------------
+    /// number of bits that are one in a word
+    static size_t bit_count(size_t word)
+    {   size_t count = 0;
+        while( word != 0 )
+        {   word &= word - 1;
+            ++count;
+        }
+        return count;
+    }
+    // -----------------------------------------------------------------
+    /// index of the lowest bit that is one in a non-zero word
+    static size_t lowest_bit(size_t word)
+    {   CPPAD_ASSERT_UNKNOWN( word != 0 );
+        size_t index = 0;
+        while( (word & 0xff) == 0 )
+        {   word >>= 8;
+            index += 8;
+        }
+        while( (word & 1) == 0 )
+        {   word >>= 1;
+            ++index;
+        }
+        return index;
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Iterates the runs of consecutive elements in one container.
+    */
+    class run_cursor {
+    private:
+        /// container_enum value for this container
+        const size_t  container_;
+        /// the payload for this container
+        const size_t* payload_;
+        /// number of values in the payload
+        const size_t  length_;
+        /// index in payload_ of the next run (array or runs container)
+        size_t        index_;
+    public:
+        /// first element in the current run
+        size_t        first;
+        /// last element in the current run plus one
+        size_t        last;
+        /// true if there are no more runs
+        bool          done;
+        //
+        /// construct a cursor pointing to the first run
+        run_cursor(size_t container, const size_t* payload, size_t length)
+        : container_(container), payload_(payload), length_(length), index_(0)
+        ,  first(0), last(0), done(false)
+        {   next(); }
+        //
+        /// construct a cursor for a non-empty block
+        run_cursor(const size_t* block)
+        : container_(block[1]), payload_(block + 4), length_(block[3])
+        , index_(0), first(0), last(0), done(false)
+        {   next(); }
+        //
+        /// advance to the next run
+        void next(void)
+        {   switch( container_ )
+            {   case array_container:
+                if( index_ == length_ )
+                {   done = true;
+                    return;
+                }
+                first = payload_[index_++];
+                last  = first + 1;
+                while( index_ < length_ && payload_[index_] == last )
+                {   ++last;
+                    ++index_;
+                }
+                return;
+
+                case runs_container:
+                if( index_ == length_ )
+                {   done = true;
+                    return;
+                }
+                first   = payload_[index_];
+                last    = payload_[index_ + 1];
+                index_ += 2;
+                return;
+
+                default:
+                CPPAD_ASSERT_UNKNOWN( container_ == bits_container );
+                break;
+            }
+            // bits container: search starting at the end of the previous run
+            const size_t* word = payload_ + 1;
+            size_t n_word      = length_ - 1;
+            size_t word_lo     = payload_[0];
+            size_t position    = std::max(last, word_lo * n_bit());
+            size_t w           = position / n_bit() - word_lo;
+            if( w >= n_word )
+            {   done = true;
+                return;
+            }
+            // first bit that is one
+            size_t bits = word[w] & ( ~size_t(0) << (position % n_bit()) );
+            while( bits == 0 )
+            {   if( ++w == n_word )
+                {   done = true;
+                    return;
+                }
+                bits = word[w];
+            }
+            first = (word_lo + w) * n_bit() + lowest_bit(bits);
+            //
+            // first bit after first that is zero
+            bits = ~word[w] & ( ~size_t(0) << (first % n_bit()) );
+            while( bits == 0 )
+            {   if( ++w == n_word )
+                {   last = (word_lo + n_word) * n_bit();
+                    return;
+                }
+                bits = ~word[w];
+            }
+            last = (word_lo + w) * n_bit() + lowest_bit(bits);
+        }
+    };
+    // -----------------------------------------------------------------
+    /*!
+    Range of word indices that contain the elements of a non-empty block.
+
+    \param block
+    is the start of the block.
+
+    \param word_lo [out]
+    is the index of the word that contains the first element.
+
+    \param word_hi [out]
+    is the index of the word that contains the last element.
+    */
+    static void word_range(
+        const size_t* block, size_t& word_lo, size_t& word_hi )
+    {   const size_t* payload = block + 4;
+        size_t        length  = block[3];
+        CPPAD_ASSERT_UNKNOWN( length > 0 );
+        switch( block[1] )
+        {   case array_container:
+            word_lo = payload[0] / n_bit();
+            word_hi = payload[length - 1] / n_bit();
+            break;
+
+            case runs_container:
+            word_lo = payload[0] / n_bit();
+            word_hi = (payload[length - 1] - 1) / n_bit();
+            break;
+
+            default:
+            CPPAD_ASSERT_UNKNOWN( block[1] == bits_container );
+            word_lo = payload[0];
+            word_hi = payload[0] + length - 2;
+            break;
+        }
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Set the bits in temp_bits_ for the elements first, ... , last - 1
+    (temp_bits_ must contain all of these elements).
+    */
+    void set_bits(size_t first, size_t last)
+    {   CPPAD_ASSERT_UNKNOWN( first < last );
+        size_t  word_lo = temp_bits_[0];
+        size_t* word    = temp_bits_.data() + 1;
+        size_t  w_first = first / n_bit() - word_lo;
+        size_t  w_last  = (last - 1) / n_bit() - word_lo;
+        size_t  ones    = ~size_t(0);
+        size_t  mask_first = ones << (first % n_bit());
+        size_t  mask_last  = ones >> (n_bit() - 1 - (last - 1) % n_bit());
+        if( w_first == w_last )
+        {   word[w_first] |= mask_first & mask_last;
+            return;
+        }
+        word[w_first] |= mask_first;
+        for(size_t w = w_first + 1; w < w_last; ++w)
+            word[w] = ones;
+        word[w_last] |= mask_last;
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Or the elements in a block into temp_bits_
+    (temp_bits_ must contain all of the elements in the block).
+    */
+    void or_bits(const size_t* block)
+    {   if( block[1] == bits_container )
+        {   size_t        n_word = block[3] - 1;
+            const size_t* word   = block + 5;
+            size_t        offset = block[4] - temp_bits_[0];
+            for(size_t w = 0; w < n_word; ++w)
+                temp_bits_[1 + offset + w] |= word[w];
+            return;
+        }
+        run_cursor cursor(block);
+        while( ! cursor.done )
+        {   set_bits(cursor.first, cursor.last);
+            cursor.next();
+        }
+    }
+    // -----------------------------------------------------------------
+    /// count the number of elements in temp_bits_
+    size_t count_bits(void) const
+    {   size_t count = 0;
+        for(size_t w = 1; w < temp_bits_.size(); ++w)
+            count += bit_count( temp_bits_[w] );
+        return count;
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Compute the union of two non-empty blocks.
+
+    \param left
+    is the start of the left operand block.
+
+    \param right
+    is the start of the right operand block.
+
+    \return
+    is the number of elements in the union. The result is in temp_bits_
+    (temp_runs_) if result_bits_ is true (false).
+    */
+    size_t compute_union(const size_t* left, const size_t* right)
+    {   if( left[1] == bits_container || right[1] == bits_container )
+        {   // one of the operands is dense so the result is dense
+            size_t left_lo, left_hi, right_lo, right_hi;
+            word_range(left,  left_lo,  left_hi);
+            word_range(right, right_lo, right_hi);
+            size_t word_lo = std::min(left_lo, right_lo);
+            size_t word_hi = std::max(left_hi, right_hi);
+            size_t n_word  = word_hi - word_lo + 1;
+            temp_bits_.resize(n_word + 1);
+            temp_bits_[0] = word_lo;
+            for(size_t w = 1; w <= n_word; ++w)
+                temp_bits_[w] = 0;
+            or_bits(left);
+            or_bits(right);
+            result_bits_ = true;
+            return count_bits();
+        }
+        // merge the runs
+        temp_runs_.resize(0);
+        run_cursor cursor_left(left);
+        run_cursor cursor_right(right);
+        size_t count = 0;
+        size_t first = 0;
+        size_t last  = 0;
+        while( ! (cursor_left.done & cursor_right.done) )
+        {   run_cursor* cursor = &cursor_right;
+            if( cursor_right.done )
+                cursor = &cursor_left;
+            else if( ! cursor_left.done )
+            {   if( cursor_left.first < cursor_right.first )
+                    cursor = &cursor_left;
+            }
+            if( last == 0 )
+            {   first = cursor->first;
+                last  = cursor->last;
+            }
+            else if( cursor->first <= last )
+                last = std::max(last, cursor->last);
+            else
+            {   temp_runs_.push_back(first);
+                temp_runs_.push_back(last);
+                count += last - first;
+                first  = cursor->first;
+                last   = cursor->last;
+            }
+            cursor->next();
+        }
+        temp_runs_.push_back(first);
+        temp_runs_.push_back(last);
+        count += last - first;
+        //
+        result_bits_ = false;
+        return count;
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Compute the intersection of two non-empty blocks.
+
+    \param left
+    is the start of the left operand block.
+
+    \param right
+    is the start of the right operand block.
+
+    \return
+    is the number of elements in the intersection. The result is in
+    temp_bits_ (temp_runs_) if result_bits_ is true (false).
+    */
+    size_t compute_intersection(const size_t* left, const size_t* right)
+    {   if( left[1] == bits_container && right[1] == bits_container )
+        {   size_t word_lo = std::max(left[4], right[4]);
+            size_t word_hi = std::min(
+                left[4] + left[3] - 2, right[4] + right[3] - 2
+            );
+            if( word_hi < word_lo )
+                return 0;
+            size_t n_word  = word_hi - word_lo + 1;
+            temp_bits_.resize(n_word + 1);
+            temp_bits_[0] = word_lo;
+            const size_t* word_left  = left  + 5 + (word_lo - left[4]);
+            const size_t* word_right = right + 5 + (word_lo - right[4]);
+            for(size_t w = 0; w < n_word; ++w)
+                temp_bits_[1 + w] = word_left[w] & word_right[w];
+            result_bits_ = true;
+            return count_bits();
+        }
+        // intersect the runs
+        temp_runs_.resize(0);
+        run_cursor cursor_left(left);
+        run_cursor cursor_right(right);
+        size_t count = 0;
+        while( ! (cursor_left.done | cursor_right.done) )
+        {   size_t first = std::max(cursor_left.first, cursor_right.first);
+            size_t last  = std::min(cursor_left.last,  cursor_right.last);
+            if( first < last )
+            {   temp_runs_.push_back(first);
+                temp_runs_.push_back(last);
+                count += last - first;
+            }
+            if( cursor_left.last < cursor_right.last )
+                cursor_left.next();
+            else
+                cursor_right.next();
+        }
+        result_bits_ = false;
+        return count;
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Store the result of an operation as the new value for a set.
+
+    \param target
+    is the index of the set. Its previous value and posts are dropped.
+
+    \param count
+    is the number of elements in the result (must be non-zero).
+    */
+    void store_result(size_t target, size_t count)
+    {   CPPAD_ASSERT_UNKNOWN( count > 0 );
+        //
+        // memory required by each container
+        size_t length_array = count;
+        size_t length_runs, length_bits;
+        if( result_bits_ )
+        {   // trim the words that are zero
+            size_t w_first = 1;
+            while( temp_bits_[w_first] == 0 )
+                ++w_first;
+            size_t w_last = temp_bits_.size() - 1;
+            while( temp_bits_[w_last] == 0 )
+                --w_last;
+            size_t word_lo = temp_bits_[0] + w_first - 1;
+            size_t n_word  = w_last - w_first + 1;
+            if( w_first > 1 )
+            {   for(size_t w = 0; w < n_word; ++w)
+                    temp_bits_[1 + w] = temp_bits_[w_first + w];
+            }
+            temp_bits_[0] = word_lo;
+            temp_bits_.resize(n_word + 1);
+            length_bits = n_word + 1;
+            //
+            // count the runs
+            length_runs = 0;
+            run_cursor cursor(bits_container, temp_bits_.data(), n_word + 1);
+            while( (! cursor.done) & (length_runs <= length_bits) )
+            {   length_runs += 2;
+                cursor.next();
+            }
+        }
+        else
+        {   length_runs    = temp_runs_.size();
+            size_t word_lo = temp_runs_[0] / n_bit();
+            size_t word_hi = (temp_runs_[length_runs - 1] - 1) / n_bit();
+            length_bits    = word_hi - word_lo + 2;
+        }
+        //
+        // choose the container (break ties in favor of array and runs)
+        size_t container = array_container;
+        size_t length    = length_array;
+        if( length_runs < length )
+        {   container = runs_container;
+            length    = length_runs;
+        }
+        if( length_bits < length )
+        {   container = bits_container;
+            length    = length_bits;
+        }
+        //
+        // drop the previous value of target
+        size_t number_lost = drop(target);
+        number_lost       += drop_post(target);
+        //
+        // new block for target
+        size_t start     = data_.extend(4 + length);
+        start_[target]   = start;
+        data_[start]     = 1;
+        data_[start + 1] = container;
+        data_[start + 2] = count;
+        data_[start + 3] = length;
+        size_t* payload  = data_.data() + start + 4;
+        //
+        if( result_bits_ && container == bits_container )
+        {   for(size_t k = 0; k < length; ++k)
+                payload[k] = temp_bits_[k];
+        }
+        else if( (! result_bits_) && container == runs_container )
+        {   for(size_t k = 0; k < length; ++k)
+                payload[k] = temp_runs_[k];
+        }
+        else
+        {   // cursor for the runs in the result
+            const size_t* temp;
+            size_t        temp_container, temp_length;
+            if( result_bits_ )
+            {   temp           = temp_bits_.data();
+                temp_container = bits_container;
+                temp_length    = temp_bits_.size();
+            }
+            else
+            {   temp           = temp_runs_.data();
+                temp_container = runs_container;
+                temp_length    = temp_runs_.size();
+            }
+            run_cursor cursor(temp_container, temp, temp_length);
+            if( container == bits_container )
+            {   // initialize the words as zero
+                size_t word_lo = cursor.first / n_bit();
+                payload[0]     = word_lo;
+                for(size_t k = 1; k < length; ++k)
+                    payload[k] = 0;
+                size_t ones = ~size_t(0);
+                while( ! cursor.done )
+                {   for(size_t e = cursor.first; e < cursor.last; ++e)
+                    {   if( e % n_bit() == 0 && e + n_bit() <= cursor.last )
+                        {   payload[1 + e / n_bit() - word_lo] = ones;
+                            e += n_bit() - 1;
+                        }
+                        else
+                            payload[1 + e / n_bit() - word_lo] |=
+                                size_t(1) << (e % n_bit());
+                    }
+                    cursor.next();
+                }
+            }
+            else
+            {   size_t k = 0;
+                while( ! cursor.done )
+                {   if( container == runs_container )
+                    {   payload[k++] = cursor.first;
+                        payload[k++] = cursor.last;
+                    }
+                    else
+                    {   for(size_t e = cursor.first; e < cursor.last; ++e)
+                            payload[k++] = e;
+                    }
+                    cursor.next();
+                }
+                CPPAD_ASSERT_UNKNOWN( k == length );
+            }
+        }
+        //
+        // adjust data_not_used_
+        data_not_used_ += number_lost;
+        collect_garbage();
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Counts references to a set.
+
+    \param i
+    is the index of the set that we are counting the references to.
+
+    \return
+    if the set is empty, the return value is zero.
+    Otherwise it is the number of sets that share the same block.
+    */
+    size_t reference_count(size_t i) const
+    {   size_t start = start_[i];
+        if( start == 0 )
+            return 0;
+        return data_[start];
+    }
+    // -----------------------------------------------------------------
+    /*!
+    drop a set.
+
+    \param i
+    is the index of the set that will be dropped.
+
+    \return
+    is the number of elements of data_ that will be lost when the set is
+    dropped. This is non-zero when the initial reference count is one.
+    */
+    size_t drop(size_t i)
+    {   size_t start = start_[i];
+        if( start == 0 )
+            return 0;
+        start_[i] = 0;
+        //
+        // decrement reference counter
+        CPPAD_ASSERT_UNKNOWN( data_[start] > 0 );
+        if( --data_[start] > 0 )
+            return 0;
+        //
+        // reference count, container, count, length, plus payload
+        return 4 + data_[start + 3];
+    }
+    // -----------------------------------------------------------------
+    /*!
+    drop the posts for a set.
+
+    \param i
+    is the index of the set that the posts are dropped for.
+
+    \return
+    is zero (the posts do not use data_).
+    */
+    size_t drop_post(size_t i)
+    {   if( post_[i] == 0 )
+            return 0;
+        post_[i] = 0;
+        CPPAD_ASSERT_UNKNOWN( n_post_ > 0 );
+        if( --n_post_ == 0 )
+            post_data_.resize(1);
+        return 0;
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Add the elements in temp_block_ to a set.
+
+    \param i
+    is the index of the set.
+    */
+    void union_temp_block(size_t i)
+    {   size_t count;
+        size_t start = start_[i];
+        if( start == 0 )
+        {   // copy the runs to temp_runs_
+            size_t length = temp_block_[3];
+            temp_runs_.resize(length);
+            for(size_t k = 0; k < length; ++k)
+                temp_runs_[k] = temp_block_[4 + k];
+            result_bits_ = false;
+            count        = temp_block_[2];
+        }
+        else
+        {   count = compute_union( data_.data() + start, temp_block_.data() );
+            if( count == data_[start + 2] )
+                return;
+        }
+        store_result(i, count);
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Checks data structure
+    (effectively const, but modifies and restores values)
+    */
+# ifdef NDEBUG
+    void check_data_structure(void)
+    {   return; }
+# else
+    void check_data_structure(void)
+    {   // number of sets
+        CPPAD_ASSERT_UNKNOWN( post_.size() == start_.size() );
+        size_t n_set = start_.size();
+        if( n_set == 0 )
+        {   CPPAD_ASSERT_UNKNOWN( end_ == 0 );
+            CPPAD_ASSERT_UNKNOWN( data_not_used_ == 0 );
+            CPPAD_ASSERT_UNKNOWN( data_.size() == 0 );
+            CPPAD_ASSERT_UNKNOWN( n_post_ == 0 );
+            return;
+        }
+        // save the reference counters
+        pod_vector<size_t> ref_count(n_set);
+        for(size_t i = 0; i < n_set; i++)
+            ref_count[i] = reference_count(i);
+        //
+        // count the number of entries in data_ that are used by sets
+        size_t data_used_by_sets = 0;
+        size_t n_post            = 0;
+        for(size_t i = 0; i < n_set; i++)
+        {   if( post_[i] != 0 )
+                ++n_post;
+            size_t start = start_[i];
+            if( start > 0 )
+            {   CPPAD_ASSERT_UNKNOWN( data_[start] > 0 );
+                CPPAD_ASSERT_UNKNOWN( data_[start + 1] <= runs_container );
+                CPPAD_ASSERT_UNKNOWN( data_[start + 2] > 0 );
+                CPPAD_ASSERT_UNKNOWN( data_[start + 3] > 0 );
+                //
+                // decrement the reference counter
+                data_[start]--;
+                //
+                // count the entries when find last reference
+                if( data_[start] == 0 )
+                {   // restore reference count
+                    data_[start] = ref_count[i];
+                    //
+                    // check the number of elements
+                    size_t count = 0;
+                    run_cursor cursor( data_.data() + start );
+                    while( ! cursor.done )
+                    {   CPPAD_ASSERT_UNKNOWN( cursor.last <= end_ );
+                        count += cursor.last - cursor.first;
+                        cursor.next();
+                    }
+                    CPPAD_ASSERT_UNKNOWN( count == data_[start + 2] );
+                    //
+                    // number of data_ entries used for this set
+                    data_used_by_sets += 4 + data_[start + 3];
+                }
+            }
+        }
+        CPPAD_ASSERT_UNKNOWN( n_post == n_post_ );
+        CPPAD_ASSERT_UNKNOWN(
+            data_used_by_sets + data_not_used_ == data_.size()
+        );
+        return;
+    }
+# endif
+    // -----------------------------------------------------------------
+    /*!
+    Does garbage collection when indicated.
+
+    This routine should be called when more entries are not being used.
+    If a significant propotion are not being used, the data structure
+    will be compacted.
+    Note that data_[0] never gets used.
+    */
+    void collect_garbage(void)
+    {   if( data_not_used_ < data_.size() / 2 +  100)
+            return;
+        check_data_structure();
+        //
+        // number of sets including empty ones
+        size_t n_set  = start_.size();
+        //
+        // use temporary to hold copy of data_ and start_
+        pod_vector<size_t> data_tmp(1); // data_tmp[0] will not be used
+        data_tmp.reserve( data_.size() - data_not_used_ + 1 );
+        //
+        for(size_t i = 0; i < n_set; i++)
+        {   size_t start    = start_[i];
+            if( start != 0 )
+            {   // check if this set has already been copied
+                if( data_[start] == 0 )
+                {   // starting address in data_tmp has been stored here
+                    start_[i] = data_[start + 1];
+                }
+                else
+                {   size_t block_size = 4 + data_[start + 3];
+                    size_t tmp_start  = data_tmp.extend(block_size);
+                    for(size_t k = 0; k < block_size; ++k)
+                        data_tmp[tmp_start + k] = data_[start + k];
+                    start_[i] = tmp_start;
+                    //
+                    // flag that indicates this set already copied
+                    data_[start] = 0;
+                    //
+                    // store the starting address here
+                    data_[start + 1] = tmp_start;
+                }
+            }
+        }
+        data_.swap(data_tmp);
+        //
+        // all of the elements, except the first, are used
+        data_not_used_ = 1;
+    }
+public:
+    /// declare a const iterator
+    typedef hybrid_setvec_const_iterator const_iterator;
+    // -----------------------------------------------------------------
+    /*!
+    Default constructor (no sets)
+    */
+    hybrid_setvec(void) :
+    end_(0)            ,
+    data_not_used_(0)  ,
+    n_post_(0)         ,
+    result_bits_(false)
+    { }
+    // -----------------------------------------------------------------
+    /// Destructor
+    ~hybrid_setvec(void)
+    {   check_data_structure();
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Using copy constructor is a programing (not user) error
+
+    \param v
+    vector of sets that we are attempting to make a copy of.
+    */
+    hybrid_setvec(const hybrid_setvec& v)
+    {   // Error: Probably a hybrid_setvec argument has been passed by value
+        CPPAD_ASSERT_UNKNOWN(false);
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Assignement operator.
+
+    \param other
+    this hybrid_setvec with be set to a deep copy of other.
+    */
+    void operator=(const hybrid_setvec& other)
+    {   end_           = other.end_;
+        data_not_used_ = other.data_not_used_;
+        data_          = other.data_;
+        start_         = other.start_;
+        post_          = other.post_;
+        post_data_     = other.post_data_;
+        n_post_        = other.n_post_;
+    }
+    // -----------------------------------------------------------------
+    /*!
+    swap (used by move semantics version of ADFun assignment operator)
+
+    \param other
+    this hybrid_setvec with be swapped with other.
+    */
+    void swap(hybrid_setvec& other)
+    {   // size_t objects
+        std::swap(end_             , other.end_);
+        std::swap(data_not_used_   , other.data_not_used_);
+        std::swap(n_post_          , other.n_post_);
+
+        // pod_vectors
+        data_.swap(       other.data_);
+        start_.swap(      other.start_);
+        post_.swap(       other.post_);
+        post_data_.swap(  other.post_data_);
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Start a new vector of sets.
+
+    \param n_set
+    is the number of sets in this vector of sets.
+    \li
+    If n_set is zero, any memory currently allocated for this object
+    is freed.
+    \li
+    If n_set is non-zero, a vector of n_set sets is created and all
+    the sets are initilaized as empty.
+
+    \param end
+    is the maximum element plus one (the minimum element is 0).
+    If n_set is zero, end must also be zero.
+    */
+    void resize(size_t n_set, size_t end)
+    {   check_data_structure();
+
+        if( n_set == 0 )
+        {   CPPAD_ASSERT_UNKNOWN(end == 0 );
+            //
+            // restore object to start after constructor
+            // (no memory allocated for this object)
+            data_.clear();
+            start_.clear();
+            post_.clear();
+            post_data_.clear();
+            temp_runs_.clear();
+            temp_bits_.clear();
+            temp_block_.clear();
+            data_not_used_  = 0;
+            n_post_         = 0;
+            end_            = 0;
+            //
+            return;
+        }
+        end_                   = end;
+        //
+        start_.resize(n_set);
+        post_.resize(n_set);
+        for(size_t i = 0; i < n_set; i++)
+        {   start_[i] = 0;
+            post_[i]  = 0;
+        }
+        //
+        data_.resize(1);     // first element is not used
+        data_not_used_  = 1;
+        post_data_.resize(1);
+        n_post_         = 0;
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Return number of elements in a set.
+
+    \param i
+    is the index of the set we are checking number of the elements of.
+    */
+    size_t number_elements(size_t i) const
+    {   CPPAD_ASSERT_UNKNOWN( post_[i] == 0 );
+        //
+        size_t start = start_[i];
+        if( start == 0 )
+            return 0;
+        return data_[start + 2];
+    }
+    // ------------------------------------------------------------------
+    /*!
+    Post an element for delayed addition to a set.
+
+    \param i
+    is the index for this set in the vector of sets.
+
+    \param element
+    is the value of the element that we are posting.
+    The same element may be posted multiple times.
+
+    \par
+    It is faster to post multiple elements to set i and then call
+    process_post(i) then to add each element individually.
+    It is an error to call any member function,
+    that depends on the value of set i,
+    before processing the posts to set i.
+    */
+    void post_element(size_t i, size_t element)
+    {   CPPAD_ASSERT_UNKNOWN( i < start_.size() );
+        CPPAD_ASSERT_UNKNOWN( element < end_ );
+
+        size_t post = post_[i];
+        if( post == 0 )
+        {   // minimum capacity for an post vector
+            size_t min_capacity = 10;
+            size_t post_new = post_data_.extend(min_capacity + 2);
+            post_data_[post_new]     = 1;            // length
+            post_data_[post_new + 1] = min_capacity; // capacity
+            post_data_[post_new + 2] = element;
+            post_[i]                 = post_new;
+            ++n_post_;
+            return;
+        }
+        size_t length   = post_data_[post];
+        size_t capacity = post_data_[post + 1];
+        if( length == capacity )
+        {   size_t post_new = post_data_.extend( 2 * capacity + 2 );
+            //
+            post_data_[post_new]     = length + 1;
+            post_data_[post_new + 1] = 2 * capacity;
+            //
+            for(size_t j = 0; j < length; j++)
+                post_data_[post_new + 2 + j] = post_data_[post + 2 + j];
+            post_data_[post_new + 2 + length] = element;
+            //
+            post_[i] = post_new;
+        }
+        else
+        {   post_data_[post]              = length + 1;
+            post_data_[post + 2 + length] = element;
+        }
+        return;
+    }
+    // -----------------------------------------------------------------
+    /*!
+    process post entries for a specific set.
+
+    \param i
+    index of the set for which we are processing the post entries.
+
+    \par post_
+    Upon call, post_[i] is location in post_data_ of the elements that get
+    added to the i-th set.  Upon return, post_[i] is zero.
+    */
+    void process_post(size_t i)
+    {   size_t post = post_[i];
+        //
+        // check if there are no elements to process
+        if( post == 0 )
+            return;
+        //
+        // sort the elements that need to be processed
+        size_t  length_post = post_data_[post];
+        size_t* first_post  = post_data_.data() + post + 2;
+        size_t* last_post   = first_post + length_post;
+        std::sort(first_post, last_post);
+        //
+        // runs block with the posted elements
+        temp_block_.resize(4);
+        temp_block_[0] = 1;
+        temp_block_[1] = runs_container;
+        size_t count   = 0;
+        size_t first   = *first_post;
+        size_t last    = first + 1;
+        for(size_t* ptr = first_post + 1; ptr != last_post; ++ptr)
+        {   if( *ptr > last )
+            {   temp_block_.push_back(first);
+                temp_block_.push_back(last);
+                count += last - first;
+                first  = *ptr;
+                last   = first + 1;
+            }
+            else if( *ptr == last )
+                ++last;
+        }
+        temp_block_.push_back(first);
+        temp_block_.push_back(last);
+        count         += last - first;
+        temp_block_[2] = count;
+        temp_block_[3] = temp_block_.size() - 4;
+        //
+        // drop the posts for this set
+        drop_post(i);
+        //
+        union_temp_block(i);
+        return;
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Add one element to a set.
+
+    \param i
+    is the index for this set in the vector of sets.
+
+    \param element
+    is the element we are adding to the set.
+    */
+    void add_element(size_t i, size_t element)
+    {   CPPAD_ASSERT_UNKNOWN( i   < start_.size() );
+        CPPAD_ASSERT_UNKNOWN( element < end_ );
+
+        // check if element is already in the set
+        if( is_element(i, element) )
+            return;
+
+        // check for a bits container that is not shared and has this word
+        size_t start = start_[i];
+        if( start != 0 )
+        {   if( data_[start] == 1 && data_[start + 1] == bits_container )
+            {   size_t w = element / n_bit();
+                size_t word_lo = data_[start + 4];
+                size_t word_hi = word_lo + data_[start + 3] - 2;
+                if( word_lo <= w && w <= word_hi )
+                {   data_[start + 5 + w - word_lo] |=
+                        size_t(1) << (element % n_bit());
+                    ++data_[start + 2];
+                    return;
+                }
+            }
+        }
+        //
+        // runs block with the element
+        temp_block_.resize(6);
+        temp_block_[0] = 1;
+        temp_block_[1] = runs_container;
+        temp_block_[2] = 1;
+        temp_block_[3] = 2;
+        temp_block_[4] = element;
+        temp_block_[5] = element + 1;
+        //
+        union_temp_block(i);
+        return;
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Check if an element is in a set.
+
+    \param i
+    is the index for this set in the vector of sets.
+
+    \param element
+    is the element we are checking to see if it is in the set.
+    */
+    bool is_element(size_t i, size_t element) const
+    {   CPPAD_ASSERT_UNKNOWN( post_[i] == 0 );
+        CPPAD_ASSERT_UNKNOWN( element < end_ );
+        //
+        size_t start = start_[i];
+        if( start == 0 )
+            return false;
+        //
+        size_t        length  = data_[start + 3];
+        const size_t* payload = data_.data() + start + 4;
+        switch( data_[start + 1] )
+        {   case array_container:
+            return std::binary_search(payload, payload + length, element);
+
+            case runs_container:
+            {   // find the last run with first <= element
+                size_t lo = 0;
+                size_t hi = length / 2;
+                while( hi - lo > 1 )
+                {   size_t mid = (lo + hi) / 2;
+                    if( payload[2 * mid] <= element )
+                        lo = mid;
+                    else
+                        hi = mid;
+                }
+                return payload[2*lo] <= element && element < payload[2*lo+1];
+            }
+
+            default:
+            CPPAD_ASSERT_UNKNOWN( data_[start + 1] == bits_container );
+            break;
+        }
+        size_t w       = element / n_bit();
+        size_t word_lo = payload[0];
+        if( w < word_lo || word_lo + length - 2 < w )
+            return false;
+        size_t word = payload[1 + w - word_lo];
+        return ( word >> (element % n_bit()) ) & 1;
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Assign the empty set to one of the sets.
+
+    \param target
+    is the index of the set we are setting to the empty set.
+
+    \par data_not_used_
+    increments this value by number of data_ elements that are lost
+    (unlinked) by this operation.
+    */
+    void clear(size_t target)
+    {   // number of data_ elements used for this set
+        size_t number_lost = drop( target );
+        number_lost       += drop_post( target );
+
+        // adjust data_not_used_
+        data_not_used_ += number_lost;
+        collect_garbage();
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Assign one set equal to another set.
+
+    \param this_target
+    is the index in this hybrid_setvec object of the set being assinged.
+
+    \param other_source
+    is the index in the other hybrid_setvec object of the
+    set that we are using as the value to assign to the target set.
+
+    \param other
+    is the other hybrid_setvec object (which may be the same as this
+    hybrid_setvec object). This must have the same value for end_.
+
+    \par data_not_used_
+    increments this value by number of elements lost.
+    */
+    void assignment(
+        size_t                  this_target  ,
+        size_t                  other_source ,
+        const hybrid_setvec&    other        )
+    {   CPPAD_ASSERT_UNKNOWN( other.post_[ other_source ] == 0 );
+        //
+        CPPAD_ASSERT_UNKNOWN( this_target  <   start_.size()        );
+        CPPAD_ASSERT_UNKNOWN( other_source <   other.start_.size()  );
+        CPPAD_ASSERT_UNKNOWN( end_        == other.end_   );
+
+        // check if we are assigning a set to itself
+        if( (this == &other) & (this_target == other_source) )
+            return;
+
+        // If this and other are the same, use another reference to same block
+        // (increment before drop in case target and source share the block)
+        size_t other_start = other.start_[other_source];
+        if( this == &other && other_start != 0 )
+            data_[other_start]++;
+
+        // number of elements that will be deleted by this operation
+        size_t number_lost = drop(this_target);
+        number_lost       += drop_post(this_target);
+
+        if( this == &other )
+            start_[this_target] = other_start;
+        else if( other_start != 0 )
+        {   // make a copy of the other block in this hybrid_setvec
+            size_t block_size     = 4 + other.data_[other_start + 3];
+            size_t this_start     = data_.extend(block_size);
+            start_[this_target]   = this_start;
+            for(size_t k = 0; k < block_size; ++k)
+                data_[this_start + k] = other.data_[other_start + k];
+            data_[this_start] = 1; // reference count
+        }
+
+        // adjust data_not_used_
+        data_not_used_ += number_lost;
+        collect_garbage();
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Assign a set equal to the union of two other sets.
+
+    \param this_target
+    is the index in this hybrid_setvec object of the set being assinged.
+
+    \param this_left
+    is the index in this hybrid_setvec object of the
+    left operand for the union operation.
+    It is OK for this_target and this_left to be the same value.
+
+    \param other_right
+    is the index in the other hybrid_setvec object of the
+    right operand for the union operation.
+    It is OK for this_target and other_right to be the same value.
+
+    \param other
+    is the other hybrid_setvec object (which may be the same as this
+    hybrid_setvec object).
+    */
+    void binary_union(
+        size_t                  this_target  ,
+        size_t                  this_left    ,
+        size_t                  other_right  ,
+        const hybrid_setvec&    other        )
+    {   CPPAD_ASSERT_UNKNOWN( post_[this_left] == 0 );
+        CPPAD_ASSERT_UNKNOWN( other.post_[ other_right ] == 0 );
+        //
+        CPPAD_ASSERT_UNKNOWN( this_target < start_.size()         );
+        CPPAD_ASSERT_UNKNOWN( this_left   < start_.size()         );
+        CPPAD_ASSERT_UNKNOWN( other_right < other.start_.size()   );
+        CPPAD_ASSERT_UNKNOWN( end_        == other.end_           );
+        //
+        size_t start_left  = start_[this_left];
+        size_t start_right = other.start_[other_right];
+        //
+        // cases where the result is equal to one of the operands
+        if( start_right == 0 ||
+            ( (this == &other) & (start_left == start_right) ) )
+        {   assignment(this_target, this_left, *this);
+            return;
+        }
+        if( start_left == 0 )
+        {   assignment(this_target, other_right, other);
+            return;
+        }
+        size_t count = compute_union(
+            data_.data() + start_left, other.data_.data() + start_right
+        );
+        if( count == data_[start_left + 2] )
+        {   assignment(this_target, this_left, *this);
+            return;
+        }
+        if( count == other.data_[start_right + 2] )
+        {   assignment(this_target, other_right, other);
+            return;
+        }
+        store_result(this_target, count);
+    }
+    // -----------------------------------------------------------------
+    /*!
+    Assign a set equal to the intersection of two other sets.
+
+    \param this_target
+    is the index in this hybrid_setvec object of the set being assinged.
+
+    \param this_left
+    is the index in this hybrid_setvec object of the
+    left operand for the intersection operation.
+    It is OK for this_target and this_left to be the same value.
+
+    \param other_right
+    is the index in the other hybrid_setvec object of the
+    right operand for the intersection operation.
+    It is OK for this_target and other_right to be the same value.
+
+    \param other
+    is the other hybrid_setvec object (which may be the same as this
+    hybrid_setvec object).
+    */
+    void binary_intersection(
+        size_t                  this_target  ,
+        size_t                  this_left    ,
+        size_t                  other_right  ,
+        const hybrid_setvec&    other        )
+    {   CPPAD_ASSERT_UNKNOWN( post_[this_left] == 0 );
+        CPPAD_ASSERT_UNKNOWN( other.post_[ other_right ] == 0 );
+        //
+        CPPAD_ASSERT_UNKNOWN( this_target < start_.size()         );
+        CPPAD_ASSERT_UNKNOWN( this_left   < start_.size()         );
+        CPPAD_ASSERT_UNKNOWN( other_right < other.start_.size()   );
+        CPPAD_ASSERT_UNKNOWN( end_        == other.end_           );
+        //
+        size_t start_left  = start_[this_left];
+        size_t start_right = other.start_[other_right];
+        //
+        if( start_left == 0 || start_right == 0 )
+        {   clear(this_target);
+            return;
+        }
+        if( (this == &other) & (start_left == start_right) )
+        {   assignment(this_target, this_left, *this);
+            return;
+        }
+        size_t count = compute_intersection(
+            data_.data() + start_left, other.data_.data() + start_right
+        );
+        if( count == 0 )
+        {   clear(this_target);
+            return;
+        }
+        if( count == data_[start_left + 2] )
+        {   assignment(this_target, this_left, *this);
+            return;
+        }
+        if( count == other.data_[start_right + 2] )
+        {   assignment(this_target, other_right, other);
+            return;
+        }
+        store_result(this_target, count);
+    }
+    // -----------------------------------------------------------------
+    /*! Fetch n_set for vector of sets object.
+
+    \return
+    Number of from sets for this vector of sets object
+    */
+    size_t n_set(void) const
+    {   return start_.size(); }
+    // -----------------------------------------------------------------
+    /*! Fetch end for this vector of sets object.
+
+    \return
+    is the maximum element value plus one (the minimum element value is 0).
+    */
+    size_t end(void) const
+    {   return end_; }
+    // -----------------------------------------------------------------
+    /*! Amount of memory used by this vector of sets
+
+    \return
+    The amount of memory in units of type unsigned char memory.
+    */
+    size_t memory(void) const
+    {   size_t capacity = data_.capacity() + start_.capacity()
+            + post_.capacity() + post_data_.capacity();
+        return capacity * sizeof(size_t);
+    }
+    /*!
+    Print the vector of sets (used for debugging)
+    */
+    void print(void) const;
+};
+// =========================================================================
+/*!
+cons_iterator for one set of positive integers in a hybrid_setvec object.
+
+All the public member functions for this class are also in the
+sparse::pack_setvec_const_iterator and sparse::list_setvec_const_iterator
+classes. This defines the CppAD vector_of_sets iterator concept.
+
+The location of the set is obtained from the hybrid_setvec object
+each time the iterator is advanced, so other sets in the same object
+can be changed while iterating.
+*/
+class hybrid_setvec_const_iterator {
+private:
+    /// the vector of sets
+    const hybrid_setvec& vec_set_;
+
+    /// index of the set we are iterating
+    const size_t         i_;
+
+    /// index in the payload of the current element (array and runs)
+    size_t               index_;
+
+    /// current element (end_ for no more elements)
+    size_t               value_;
+public:
+    /// construct a const_iterator for a set in a hybrid_setvec object
+    hybrid_setvec_const_iterator (const hybrid_setvec& vec_set, size_t i)
+    :
+    vec_set_( vec_set ) ,
+    i_( i )             ,
+    index_( 0 )         ,
+    value_( vec_set.end_ )
+    {   CPPAD_ASSERT_UNKNOWN( vec_set.post_[i] == 0 );
+        //
+        size_t start = vec_set.start_[i];
+        if( start == 0 )
+            return;
+        const size_t* block = vec_set.data_.data() + start;
+        hybrid_setvec::run_cursor cursor(block);
+        value_ = cursor.first;
+    }
+
+    /// advance to next element in this set
+    hybrid_setvec_const_iterator& operator++(void)
+    {   size_t end = vec_set_.end_;
+        if( value_ == end )
+            return *this;
+        //
+        const size_t* block   = vec_set_.data_.data() + vec_set_.start_[i_];
+        const size_t* payload = block + 4;
+        size_t        length  = block[3];
+        switch( block[1] )
+        {   case hybrid_setvec::array_container:
+            if( ++index_ == length )
+                value_ = end;
+            else
+                value_ = payload[index_];
+            return *this;
+
+            case hybrid_setvec::runs_container:
+            if( ++value_ == payload[index_ + 1] )
+            {   index_ += 2;
+                if( index_ == length )
+                    value_ = end;
+                else
+                    value_ = payload[index_];
+            }
+            return *this;
+
+            default:
+            CPPAD_ASSERT_UNKNOWN( block[1] == hybrid_setvec::bits_container );
+            break;
+        }
+        // bits container
+        size_t n_bit    = hybrid_setvec::n_bit();
+        size_t word_lo  = payload[0];
+        size_t n_word   = length - 1;
+        size_t position = value_ + 1;
+        size_t w        = position / n_bit - word_lo;
+        if( w == n_word )
+        {   value_ = end;
+            return *this;
+        }
+        size_t bits = payload[1 + w] & ( ~size_t(0) << (position % n_bit) );
+        while( bits == 0 )
+        {   if( ++w == n_word )
+            {   value_ = end;
+                return *this;
+            }
+            bits = payload[1 + w];
+        }
+        value_ = (word_lo + w) * n_bit + hybrid_setvec::lowest_bit(bits);
+        return *this;
+    }
+
+    /// obtain value of this element of the set of positive integers
+    /// (end_ for no such element)
+    size_t operator*(void) const
+    {   return value_; }
+};
+// =========================================================================
+/*!
+Print the vector of sets (used for debugging)
+*/
+inline void hybrid_setvec::print(void) const
+{   std::cout << "hybrid_setvec:\n";
+    for(size_t i = 0; i < n_set(); i++)
+    {   std::cout << "set[" << i << "] = {";
+        const_iterator itr(*this, i);
+        while( *itr != end() )
+        {   std::cout << *itr;
+            if( *(++itr) != end() )
+                std::cout << ",";
+        }
+        std::cout << "}\n";
+    }
+    return;
+}
+
+} } } // END_CPPAD_LOCAL_SPARSE_NAMESPACE
+# endif
@@ -380,10 +380,11 @@ $end
             return count;
         //
         // count bits in other units
+        mask = one_;
         for(size_t bit = 0; bit < n_bit_; ++bit)
         {   CPPAD_ASSERT_UNKNOWN( mask >= one_ );
-            size_t k = n_pack_;
-            while(--k)
+            size_t k = n_pack_ - 1;
+            while(k--)
             {   if( data_[i * n_pack_ + k] & mask )
                     ++count;
             }
@@ -0,0 +1,383 @@
+# ifndef CPPAD_LOCAL_SWEEP_ATOM_BATCH_HPP
+# define CPPAD_LOCAL_SWEEP_ATOM_BATCH_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <limits>
+# include <cppad/local/sweep/call_atomic.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*!
+\file atom_batch.hpp
+Pending atomic function calls that are evaluated as one batch.
+*/
+
+/*!
+Pending calls to one atomic_three function that are evaluated as a batch.
+
+The sweeps add a call to the batch, instead of evaluating it, when the
+atomic function has a non-zero batch_size. The pending calls are evaluated
+by one call to forward_batch (reverse_batch) before the first operator
+that depends on them; see flush_op (flush_var).
+
+\tparam Base
+Is the type corresponding to the Taylor coefficients.
+
+\tparam RecBase
+Is the type corresponding to the atomic functions.
+*/
+template <class Base, class RecBase>
+class atom_batch {
+private:
+    /// atomic function for the pending calls (zero if there are none)
+    size_t atom_index_;
+    /// maximum number of calls in a batch for atom_index_
+    size_t max_call_;
+    /// number of arguments for each pending call
+    size_t n_;
+    /// number of results for each pending call
+    size_t m_;
+    /// number of pending calls
+    size_t n_call_;
+    /// forward mode: operator index at which the pending calls must be
+    /// evaluated (maximum size_t value if there are no pending calls)
+    size_t flush_op_;
+    /// reverse mode: one plus the maximum variable index for the arguments
+    /// of the pending calls (zero if there are no pending calls)
+    size_t flush_var_;
+    /// atomic function index for the previous call to batch_size
+    size_t size_index_;
+    /// return value for the previous call to batch_size
+    size_t size_value_;
+    //
+    /// information for the pending calls as a structure of arrays;
+    /// i.e., component j of the argument for call c has index
+    /// j * max_call_ + c (component i of the result has index
+    /// i * max_call_ + c).
+    vector<Base>         par_x_;
+    vector<ad_type_enum> type_x_;
+    vector<Base>         tx_;
+    vector<Base>         ty_;
+    vector<Base>         px_;
+    vector<Base>         py_;
+    pod_vector<size_t>   ix_;
+    pod_vector<size_t>   iy_;
+    //
+    /// the structure of arrays with max_call_ replaced by n_call_
+    /// (only used when n_call_ < max_call_)
+    vector<Base>         c_par_x_;
+    vector<ad_type_enum> c_type_x_;
+    vector<Base>         c_tx_;
+    vector<Base>         c_ty_;
+    vector<Base>         c_px_;
+    vector<Base>         c_py_;
+    // ------------------------------------------------------------------
+    /// copy the first nc calls, with nv components each, from src to dst
+    template <class Vector>
+    void compact(size_t nc, size_t nv, const Vector& src, Vector& dst) const
+    {   dst.resize(nc * nv);
+        for(size_t k = 0; k < nv; ++k)
+        {   for(size_t c = 0; c < nc; ++c)
+                dst[k * nc + c] = src[k * max_call_ + c];
+        }
+    }
+    /*!
+    Determine if the next call to atom_index can be added to the batch.
+
+    \return
+    is true if the pending calls must be evaluated before the next call
+    to atom_index is added.
+    */
+    bool must_flush(size_t atom_index, size_t n, size_t m) const
+    {   if( n_call_ == 0 )
+            return false;
+        bool flush = n_call_ == max_call_ || atom_index != atom_index_;
+        flush     |= n != n_ || m != m_;
+        return flush;
+    }
+    /// start a new batch of calls to the atomic function atom_index
+    void start(size_t atom_index, size_t max_call, size_t n, size_t m)
+    {   CPPAD_ASSERT_UNKNOWN( n_call_ == 0 );
+        atom_index_ = atom_index;
+        max_call_   = max_call;
+        n_          = n;
+        m_          = m;
+        par_x_.resize(max_call * n);
+        type_x_.resize(max_call * n);
+        tx_.resize(max_call * n);
+        ix_.resize(max_call * n);
+        ty_.resize(max_call * m);
+        iy_.resize(max_call * m);
+    }
+public:
+    /// constructor
+    atom_batch(void)
+    : atom_index_(0)
+    , max_call_(0)
+    , n_(0)
+    , m_(0)
+    , n_call_(0)
+    , flush_op_( std::numeric_limits<size_t>::max() )
+    , flush_var_(0)
+    , size_index_(0)
+    , size_value_(0)
+    { }
+    /// maximum number of calls in a batch for this atomic function
+    /// (zero if calls to this function are not batched)
+    size_t batch_size(size_t atom_index)
+    {   if( atom_index != size_index_ )
+        {   size_index_ = atom_index;
+            size_value_ = call_atomic_batch<Base, RecBase>::size(atom_index);
+        }
+        return size_value_;
+    }
+    /// number of pending calls
+    size_t n_call(void) const
+    {   return n_call_; }
+    /// forward mode pending calls must be evaluated before the operator
+    /// with this index
+    size_t flush_op(void) const
+    {   return flush_op_; }
+    /// reverse mode pending calls must be evaluated before the operator
+    /// with a result variable index less than this value
+    size_t flush_var(void) const
+    {   return flush_var_; }
+    // ------------------------------------------------------------------
+    /*!
+    Start adding a zero order forward mode call to the batch.
+
+    \param atom_index [in]
+    is the index, in local::atomic_index, corresponding to this atomic
+    function.
+
+    \param n [in]
+    is the number of arguments for this call.
+
+    \param m [in]
+    is the number of results for this call.
+
+    \param arg_op [in]
+    is the operator index for the last argument of this call.
+
+    \param first_use [in]
+    is the index of the first operator that uses a result of this call.
+
+    \param J [in]
+    number of columns in the taylor matrix.
+
+    \param taylor [in,out]
+    Taylor coefficient matrix. If the pending calls are evaluated,
+    the zero order coefficients for their results are set.
+
+    \return
+    If the return value is false, this call has not been added and it
+    must be evaluated by the caller. Otherwise, the arguments
+    (variable index for the results) of this call must be set using
+    forward_x (forward_result).
+    */
+    bool forward_start(
+        size_t     atom_index  ,
+        size_t     n           ,
+        size_t     m           ,
+        size_t     arg_op      ,
+        size_t     first_use   ,
+        size_t     J           ,
+        Base*      taylor      )
+    {   size_t max_call = batch_size(atom_index);
+        if( max_call == 0 )
+            return false;
+        //
+        // a pending call must be evaluated before the arguments are set
+        if( must_flush(atom_index, n, m) || flush_op_ <= arg_op )
+            forward_flush(J, taylor);
+        if( n_call_ == 0 )
+            start(atom_index, max_call, n, m);
+        //
+        for(size_t i = 0; i < m; ++i)
+            iy_[i * max_call_ + n_call_] = 0;
+        if( first_use < flush_op_ )
+            flush_op_ = first_use;
+        ++n_call_;
+        //
+        return true;
+    }
+    /// set argument j for the last call started
+    void forward_x(
+        size_t j, const Base& parameter_x, ad_type_enum type_x,
+        const Base& taylor_x)
+    {   CPPAD_ASSERT_UNKNOWN( 0 < n_call_ && j < n_ );
+        size_t index    = j * max_call_ + n_call_ - 1;
+        par_x_[index]   = parameter_x;
+        type_x_[index]  = type_x;
+        tx_[index]      = taylor_x;
+    }
+    /// set the variable index for result i of the last call started
+    void forward_result(size_t i, size_t i_var)
+    {   CPPAD_ASSERT_UNKNOWN( 0 < n_call_ && i < m_ );
+        iy_[i * max_call_ + n_call_ - 1] = i_var;
+    }
+    /// evaluate the pending zero order forward mode calls
+    void forward_flush(size_t J, Base* taylor)
+    {   if( n_call_ == 0 )
+            return;
+        size_t n_call = n_call_;
+        ty_.resize(max_call_ * m_);
+        if( n_call == max_call_ )
+        {   call_atomic_batch<Base, RecBase>::forward(
+                atom_index_, n_call, par_x_, type_x_, tx_, ty_
+            );
+        }
+        else
+        {   compact(n_call, n_, par_x_, c_par_x_);
+            compact(n_call, n_, type_x_, c_type_x_);
+            compact(n_call, n_, tx_, c_tx_);
+            c_ty_.resize(n_call * m_);
+            call_atomic_batch<Base, RecBase>::forward(
+                atom_index_, n_call, c_par_x_, c_type_x_, c_tx_, c_ty_
+            );
+            for(size_t i = 0; i < m_; ++i)
+            {   for(size_t c = 0; c < n_call; ++c)
+                    ty_[i * max_call_ + c] = c_ty_[i * n_call + c];
+            }
+        }
+        for(size_t i = 0; i < m_; ++i)
+        {   for(size_t c = 0; c < n_call; ++c)
+            {   size_t i_var = iy_[i * max_call_ + c];
+                if( i_var > 0 )
+                    taylor[i_var * J + 0] = ty_[i * max_call_ + c];
+            }
+        }
+        n_call_   = 0;
+        flush_op_ = std::numeric_limits<size_t>::max();
+    }
+    // ------------------------------------------------------------------
+    /*!
+    Add a first order reverse mode call to the batch.
+
+    \param atom_index [in]
+    is the index, in local::atomic_index, corresponding to this atomic
+    function.
+
+    \param parameter_x [in]
+    parameter values for the arguments to this call.
+
+    \param type_x [in]
+    type for the arguments to this call.
+
+    \param x_index [in]
+    variable index for the arguments to this call
+    (zero for arguments that are parameters).
+
+    \param taylor_x [in]
+    zero order Taylor coefficients for the arguments to this call.
+
+    \param taylor_y [in]
+    zero order Taylor coefficients for the results of this call.
+
+    \param partial_y [in]
+    partials w.r.t. the results of this call.
+
+    \param K [in]
+    number of columns in the partial matrix.
+
+    \param partial [in,out]
+    Partial derivative matrix. If the pending calls are evaluated,
+    their partials w.r.t. the arguments are added to this matrix.
+
+    \return
+    If the return value is false, this call has not been added and it
+    must be evaluated by the caller.
+    */
+    bool reverse_add(
+        size_t                       atom_index  ,
+        const vector<Base>&          parameter_x ,
+        const vector<ad_type_enum>&  type_x      ,
+        const vector<size_t>&        x_index     ,
+        const vector<Base>&          taylor_x    ,
+        const vector<Base>&          taylor_y    ,
+        const vector<Base>&          partial_y   ,
+        size_t                       K           ,
+        Base*                        partial     )
+    {   size_t max_call = batch_size(atom_index);
+        if( max_call == 0 )
+            return false;
+        //
+        size_t n = parameter_x.size();
+        size_t m = taylor_y.size();
+        if( must_flush(atom_index, n, m) )
+            reverse_flush(K, partial);
+        if( n_call_ == 0 )
+        {   start(atom_index, max_call, n, m);
+            py_.resize(max_call * m);
+        }
+        //
+        for(size_t j = 0; j < n; ++j)
+        {   size_t index   = j * max_call_ + n_call_;
+            par_x_[index]  = parameter_x[j];
+            type_x_[index] = type_x[j];
+            tx_[index]     = taylor_x[j];
+            ix_[index]     = x_index[j];
+            if( flush_var_ <= x_index[j] )
+                flush_var_ = x_index[j] + 1;
+        }
+        for(size_t i = 0; i < m; ++i)
+        {   size_t index   = i * max_call_ + n_call_;
+            ty_[index]     = taylor_y[i];
+            py_[index]     = partial_y[i];
+        }
+        ++n_call_;
+        //
+        return true;
+    }
+    /// evaluate the pending first order reverse mode calls
+    void reverse_flush(size_t K, Base* partial)
+    {   if( n_call_ == 0 )
+            return;
+        size_t n_call = n_call_;
+        px_.resize(max_call_ * n_);
+        if( n_call == max_call_ )
+        {   call_atomic_batch<Base, RecBase>::reverse(
+                atom_index_, n_call, par_x_, type_x_, tx_, ty_, px_, py_
+            );
+        }
+        else
+        {   compact(n_call, n_, par_x_, c_par_x_);
+            compact(n_call, n_, type_x_, c_type_x_);
+            compact(n_call, n_, tx_, c_tx_);
+            compact(n_call, m_, ty_, c_ty_);
+            compact(n_call, m_, py_, c_py_);
+            c_px_.resize(n_call * n_);
+            call_atomic_batch<Base, RecBase>::reverse(
+                atom_index_, n_call, c_par_x_, c_type_x_,
+                c_tx_, c_ty_, c_px_, c_py_
+            );
+            for(size_t j = 0; j < n_; ++j)
+            {   for(size_t c = 0; c < n_call; ++c)
+                    px_[j * max_call_ + c] = c_px_[j * n_call + c];
+            }
+        }
+        for(size_t j = 0; j < n_; ++j)
+        {   for(size_t c = 0; c < n_call; ++c)
+            {   size_t j_var = ix_[j * max_call_ + c];
+                if( j_var > 0 )
+                    partial[j_var * K + 0] += px_[j * max_call_ + c];
+            }
+        }
+        n_call_    = 0;
+        flush_var_ = 0;
+    }
+};
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
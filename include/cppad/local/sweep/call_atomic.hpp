@@ -239,6 +239,196 @@ void call_atomic_reverse(
 }
 // ----------------------------------------------------------------------------
 /*!
+Batched callbacks to atomic functions.
+
+\tparam Base
+Is the type corresponding to the Taylor coefficients.
+
+\tparam RecBase
+Is the type corresponding to this atomic function.
+
+\par
+Batching is only used when Base is the same as RecBase.
+For the other cases, size returns zero and forward, reverse are not used.
+*/
+template <class Base, class RecBase>
+struct call_atomic_batch {
+    /// maximum number of calls in a batch for this atomic function
+    static size_t size(size_t atom_index)
+    {   return 0; }
+    /// batched zero order forward mode
+    static void forward(
+        size_t                       atom_index  ,
+        size_t                       n_call      ,
+        const vector<Base>&          parameter_x ,
+        const vector<ad_type_enum>&  type_x      ,
+        const vector<Base>&          taylor_x    ,
+        vector<Base>&                taylor_y    )
+    {   CPPAD_ASSERT_UNKNOWN(false); }
+    /// batched first order reverse mode
+    static void reverse(
+        size_t                       atom_index  ,
+        size_t                       n_call      ,
+        const vector<Base>&          parameter_x ,
+        const vector<ad_type_enum>&  type_x      ,
+        const vector<Base>&          taylor_x    ,
+        const vector<Base>&          taylor_y    ,
+        vector<Base>&                partial_x   ,
+        const vector<Base>&          partial_y   )
+    {   CPPAD_ASSERT_UNKNOWN(false); }
+};
+/// Batched callbacks to atomic functions for the case where Base is RecBase
+template <class Base>
+struct call_atomic_batch<Base, Base> {
+    /*!
+    Maximum number of calls in a batch for this atomic function.
+
+    \param atom_index [in]
+    is the index, in local::atomic_index, corresponding to this atomic
+    function.
+
+    \return
+    is zero if this is not an atomic_three function, or if it has
+    been deleted, or if it does not support batches.
+    */
+    static size_t size(size_t atom_index)
+    {   CPPAD_ASSERT_UNKNOWN( 0 < atom_index );
+        bool         set_null = false;
+        size_t       type     = 0;          // set to avoid warning
+        std::string* name_ptr = CPPAD_NULL;
+        void*        v_ptr    = CPPAD_NULL; // set to avoid warning
+        local::atomic_index<Base>(set_null, atom_index, type, name_ptr, v_ptr);
+        if( type != 3 || v_ptr == CPPAD_NULL )
+            return 0;
+        atomic_three<Base>* afun =
+            reinterpret_cast< atomic_three<Base>* >(v_ptr);
+        return afun->batch_size();
+    }
+    /*!
+    Batched zero order forward mode.
+
+    \param atom_index [in]
+    is the index, in local::atomic_index, corresponding to this atomic
+    function. It must be an atomic_three function.
+
+    \param n_call [in]
+    is the number of calls in this batch.
+
+    \param parameter_x [in]
+    parameter values for the arguments, parameter_x[j * n_call + c]
+    corresponds to component j of the argument for call c.
+
+    \param type_x [in]
+    type for the arguments, using the same index as parameter_x.
+
+    \param taylor_x [in]
+    zero order Taylor coefficient for the arguments,
+    using the same index as parameter_x.
+
+    \param taylor_y [out]
+    zero order Taylor coefficient for the results,
+    taylor_y[i * n_call + c] corresponds to component i of the result
+    for call c.
+    */
+    static void forward(
+        size_t                       atom_index  ,
+        size_t                       n_call      ,
+        const vector<Base>&          parameter_x ,
+        const vector<ad_type_enum>&  type_x      ,
+        const vector<Base>&          taylor_x    ,
+        vector<Base>&                taylor_y    )
+    {   bool         set_null = false;
+        size_t       type     = 0;          // set to avoid warning
+        std::string* name_ptr = CPPAD_NULL;
+        void*        v_ptr    = CPPAD_NULL; // set to avoid warning
+        local::atomic_index<Base>(set_null, atom_index, type, name_ptr, v_ptr);
+        CPPAD_ASSERT_UNKNOWN( type == 3 && v_ptr != CPPAD_NULL );
+        atomic_three<Base>* afun =
+            reinterpret_cast< atomic_three<Base>* >(v_ptr);
+# ifndef NDEBUG
+        bool ok = afun->forward_batch(
+            n_call, parameter_x, type_x, taylor_x, taylor_y
+        );
+        if( ! ok )
+        {   std::string msg;
+            local::atomic_index<Base>(set_null, atom_index, type, &msg, v_ptr);
+            msg += ": atomic forward_batch returned false";
+            CPPAD_ASSERT_KNOWN(false, msg.c_str() );
+        }
+# else
+        afun->forward_batch(n_call, parameter_x, type_x, taylor_x, taylor_y);
+# endif
+    }
+    /*!
+    Batched first order reverse mode.
+
+    \param atom_index [in]
+    is the index, in local::atomic_index, corresponding to this atomic
+    function. It must be an atomic_three function.
+
+    \param n_call [in]
+    is the number of calls in this batch.
+
+    \param parameter_x [in]
+    parameter values for the arguments, parameter_x[j * n_call + c]
+    corresponds to component j of the argument for call c.
+
+    \param type_x [in]
+    type for the arguments, using the same index as parameter_x.
+
+    \param taylor_x [in]
+    zero order Taylor coefficient for the arguments,
+    using the same index as parameter_x.
+
+    \param taylor_y [in]
+    zero order Taylor coefficient for the results,
+    taylor_y[i * n_call + c] corresponds to component i of the result
+    for call c.
+
+    \param partial_x [out]
+    partials w.r.t. the arguments, using the same index as parameter_x.
+
+    \param partial_y [in]
+    partials w.r.t. the results, using the same index as taylor_y.
+    */
+    static void reverse(
+        size_t                       atom_index  ,
+        size_t                       n_call      ,
+        const vector<Base>&          parameter_x ,
+        const vector<ad_type_enum>&  type_x      ,
+        const vector<Base>&          taylor_x    ,
+        const vector<Base>&          taylor_y    ,
+        vector<Base>&                partial_x   ,
+        const vector<Base>&          partial_y   )
+    {   bool         set_null = false;
+        size_t       type     = 0;          // set to avoid warning
+        std::string* name_ptr = CPPAD_NULL;
+        void*        v_ptr    = CPPAD_NULL; // set to avoid warning
+        local::atomic_index<Base>(set_null, atom_index, type, name_ptr, v_ptr);
+        CPPAD_ASSERT_UNKNOWN( type == 3 && v_ptr != CPPAD_NULL );
+        atomic_three<Base>* afun =
+            reinterpret_cast< atomic_three<Base>* >(v_ptr);
+# ifndef NDEBUG
+        bool ok = afun->reverse_batch(
+            n_call, parameter_x, type_x,
+            taylor_x, taylor_y, partial_x, partial_y
+        );
+        if( ! ok )
+        {   std::string msg;
+            local::atomic_index<Base>(set_null, atom_index, type, &msg, v_ptr);
+            msg += ": atomic reverse_batch returned false";
+            CPPAD_ASSERT_KNOWN(false, msg.c_str() );
+        }
+# else
+        afun->reverse_batch(
+            n_call, parameter_x, type_x,
+            taylor_x, taylor_y, partial_x, partial_y
+        );
+# endif
+    }
+};
+// ----------------------------------------------------------------------------
+/*!
 Forward Jacobian sparsity callback to atomic functions.
 
 \tparam Base
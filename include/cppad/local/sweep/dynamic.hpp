@@ -1,7 +1,7 @@
 # ifndef CPPAD_LOCAL_SWEEP_DYNAMIC_HPP
 # define CPPAD_LOCAL_SWEEP_DYNAMIC_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -13,6 +13,8 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 ---------------------------------------------------------------------------- */
 
 # include <cppad/local/play/atom_op_info.hpp>
+# include <queue>
+# include <functional>
 
 // BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
 namespace CppAD { namespace local { namespace sweep {
@@ -32,6 +34,482 @@ dynamic parameter values as during the recording
 */
 # define CPPAD_DYNAMIC_TRACE 0
 
+/*!
+Compute the dynamic parameters created by one operator.
+
+\tparam Base
+The type of the parameters.
+
+\tparam BaseVector
+is a simple vector class with elements of type Base.
+
+\param i_dyn
+is the index of the first dynamic parameter created by this operator.
+
+\param i_arg
+is the index in dyn_par_arg of the first argument for this operator.
+
+\param n_dyn [out]
+is the number of dynamic parameters created by this operator.
+
+\param all_par_vec
+is the vector of all the parameters.
+The dynamic parameters created by this operator are outputs.
+
+\param type_x
+\param taylor_x
+\param taylor_y
+are work space used for atomic function calls.
+
+\param not_used_rec_base
+Specifies RecBase for this call.
+
+\return
+is the number of arguments (in dyn_par_arg) for this operator.
+
+The other arguments are the same as for sweep::dynamic.
+*/
+template <class Base, class BaseVector, class RecBase>
+size_t dynamic_op(
+    size_t                        i_dyn              ,
+    size_t                        i_arg              ,
+    size_t&                       n_dyn              ,
+    pod_vector_maybe<Base>&       all_par_vec        ,
+    const BaseVector&             ind_dynamic        ,
+    const pod_vector<bool>&       dyn_par_is         ,
+    const pod_vector<addr_t>&     dyn_ind2par_ind    ,
+    const pod_vector<opcode_t>&   dyn_par_op         ,
+    const pod_vector<addr_t>&     dyn_par_arg        ,
+    vector<ad_type_enum>&         type_x             ,
+    vector<Base>&                 taylor_x           ,
+    vector<Base>&                 taylor_y           ,
+    const RecBase&                not_used_rec_base  )
+{
+# if CPPAD_DYNAMIC_TRACE
+    const char* cond_exp_name[] = {
+        "CondExpLt",
+        "CondExpLe",
+        "CondExpEq",
+        "CondExpGe",
+        "CondExpGt",
+        "CondExpNe"
+    };
+# endif
+    // used to hold the first two parameter arguments
+    const Base* par[2];
+    for(size_t j = 0; j < 2; ++j)
+        par[j] = CPPAD_NULL;
+    //
+    // number of dynamic parameters created by this operator
+    n_dyn = 1;
+    //
+    // parameter index for this dynamic parameter
+    size_t i_par = size_t( dyn_ind2par_ind[i_dyn] );
+    //
+# if CPPAD_DYNAMIC_TRACE
+    Base old_value = all_par_vec[i_par];
+# endif
+    //
+    // operator for this dynamic parameter
+    op_code_dyn op = op_code_dyn( dyn_par_op[i_dyn] );
+    //
+    // number of arguments for this operator
+    size_t n_arg       = num_arg_dyn(op);
+    //
+    // for unary or binary operators
+    bool unary_or_binary = true;
+    unary_or_binary &= op != atom_dyn;
+    unary_or_binary &= op != cond_exp_dyn;
+    unary_or_binary &= op != dis_dyn;
+    unary_or_binary &= op != ind_dyn;
+    unary_or_binary &= op != result_dyn;
+    if( unary_or_binary )
+    {   CPPAD_ASSERT_UNKNOWN( n_arg == 1 || n_arg == 2 );
+       for(size_t j = 0; j < n_arg; ++j)
+            par[j] = & all_par_vec[ dyn_par_arg[i_arg + j] ];
+    }
+    //
+    switch(op)
+    {
+        // ---------------------------------------------------------------
+        // standard_math_98
+        // acos
+        case acos_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = acos( *par[0] );
+        break;
+
+        // asin
+        case asin_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = asin( *par[0] );
+        break;
+
+        // atan
+        case atan_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = atan( *par[0] );
+        break;
+
+        // cos
+        case cos_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = cos( *par[0] );
+        break;
+
+        // cosh
+        case cosh_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = cosh( *par[0] );
+        break;
+
+        // ind
+        case ind_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 0 );
+        CPPAD_ASSERT_UNKNOWN( i_par == i_dyn + 1 );
+        all_par_vec[i_par] = ind_dynamic[i_dyn];
+        break;
+
+        // exp
+        case exp_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = exp( *par[0] );
+        break;
+
+        // fabs
+        case fabs_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = fabs( *par[0] );
+        break;
+
+        // log
+        case log_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = log( *par[0] );
+        break;
+
+        // sin
+        case sin_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = sin( *par[0] );
+        break;
+
+        // sinh
+        case sinh_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = sinh( *par[0] );
+        break;
+
+        // sqrt
+        case sqrt_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = sqrt( *par[0] );
+        break;
+
+        // tan
+        case tan_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = tan( *par[0] );
+        break;
+
+        // tanh
+        case tanh_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = tanh( *par[0] );
+        break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+        // ---------------------------------------------------------------
+        // asinh
+        case asinh_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = asinh( *par[0] );
+        break;
+
+        // acosh
+        case acosh_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = acosh( *par[0] );
+        break;
+
+        // atanh
+        case atanh_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = atanh( *par[0] );
+        break;
+
+        // expm1
+        case expm1_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = expm1( *par[0] );
+        break;
+
+        // erf
+        case erf_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = erf( *par[0] );
+        break;
+
+        // erfc
+        case erfc_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = erfc( *par[0] );
+        break;
+
+        // log1p
+        case log1p_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = log1p( *par[0] );
+        break;
+# endif
+        // ---------------------------------------------------------------
+        // abs
+        case abs_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = fabs( *par[0] );
+        break;
+
+        // add
+        case add_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
+        all_par_vec[i_par] = *par[0] + *par[1];
+        break;
+
+        // div
+        case div_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
+        all_par_vec[i_par] = *par[0] / *par[1];
+        break;
+
+        // mul
+        case mul_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
+        all_par_vec[i_par] = *par[0] * *par[1];
+        break;
+
+        // pow
+        case pow_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
+        all_par_vec[i_par] = pow( *par[0], *par[1] );
+        break;
+
+        // sign
+        case sign_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
+        all_par_vec[i_par] = sign( *par[0] );
+        break;
+
+        // sub
+        case sub_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
+        all_par_vec[i_par] = *par[0] - *par[1];
+        break;
+
+        // zmul
+        case zmul_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
+        all_par_vec[i_par] = azmul( *par[0],  *par[1] );
+        break;
+
+        // ---------------------------------------------------------------
+        // discrete(index, argument)
+        case dis_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
+        all_par_vec[i_par] = discrete<Base>::eval(
+            size_t(      dyn_par_arg[i_arg + 0] ) , // index
+            all_par_vec[ dyn_par_arg[i_arg + 1] ]   // argument
+        );
+# if CPPAD_DYNAMIC_TRACE
+        std::cout
+        << std::setw(10) << std::left << i_par
+        << std::setw(10) << std::left << old_value
+        << std::setw(10) << std::left << all_par_vec[i_par]
+        << "="
+        << std::setw(10) << std::right << op_name_dyn(op)
+        << "("
+        << std::setw(12) << std::right <<
+            discrete<Base>::name( size_t( dyn_par_arg[i_arg + 0] ) );
+        if( dyn_par_is[ dyn_par_arg[i_arg + 1] ] )
+        {   std::cout << ", i=" << std::setw(10) << std::right
+            << dyn_par_arg[i_arg + 1];
+        }
+        else
+        {   std::cout << ", v=" << std::setw(10) << std::right
+            << all_par_vec[ dyn_par_arg[i_arg + 1] ];
+        }
+        std::cout << ")" << std::endl;
+# endif
+        break;
+
+        // ---------------------------------------------------------------
+        // cond_exp(cop, left, right, if_true, if_false)
+        // (not yet implemented)
+        case cond_exp_dyn:
+        CPPAD_ASSERT_UNKNOWN( n_arg == 5 );
+        all_par_vec[i_par] = CondExpOp(
+            CompareOp(   dyn_par_arg[i_arg + 0] ) , // cop
+            all_par_vec[ dyn_par_arg[i_arg + 1] ] , // left
+            all_par_vec[ dyn_par_arg[i_arg + 2] ] , // right
+            all_par_vec[ dyn_par_arg[i_arg + 3] ] , // if_true
+            all_par_vec[ dyn_par_arg[i_arg + 4] ]   // if_false
+        );
+# if CPPAD_DYNAMIC_TRACE
+        std::cout
+        << std::setw(10) << std::left << i_par
+        << std::setw(10) << std::left << old_value
+        << std::setw(10) << std::left << all_par_vec[i_par]
+        << "="
+        << std::setw(10) << std::right
+        << cond_exp_name[ dyn_par_arg[i_arg + 0] ]
+        << "(";
+        for(size_t i = 1; i < 5; ++i)
+        {   if( dyn_par_is[ dyn_par_arg[i_arg + i] ] )
+            {   std::cout << "i=" << std::setw(10) << std::right
+                << dyn_par_arg[i_arg + i];
+            }
+            else
+            {   std::cout << "v=" << std::setw(10) << std::right
+                << all_par_vec[ dyn_par_arg[i_arg + i] ];
+            }
+            if( i < 4 )
+                std::cout << ",";
+        }
+        std::cout << ")" << std::endl;
+# endif
+        break;
+        // ---------------------------------------------------------------
+        // atomic function results
+        case result_dyn:
+        break;
+
+        // atomic function call
+        case atom_dyn:
+        {   size_t atom_index = size_t( dyn_par_arg[i_arg + 0] );
+            size_t n          = size_t( dyn_par_arg[i_arg + 1] );
+            size_t m          = size_t( dyn_par_arg[i_arg + 2] );
+            n_dyn             = size_t( dyn_par_arg[i_arg + 3] );
+            n_arg             = 5 + n + m;
+            CPPAD_ASSERT_UNKNOWN(
+                size_t( dyn_par_arg[i_arg + 4 + n + m] ) == n_arg
+            );
+            //
+            size_t need_y    = size_t(dynamic_enum);
+            size_t order_low = 0;
+            size_t order_up  = 0;
+            size_t atom_old  = 0; // not used
+            type_x.resize(n);
+            taylor_x.resize(n);
+            taylor_y.resize(m);
+            for(size_t j = 0; j < n; ++j)
+            {   addr_t arg_j = dyn_par_arg[i_arg + 4 + j];
+                taylor_x[j]   = all_par_vec[ arg_j ];
+                if( arg_j == 0 )
+                    type_x[j] = variable_enum;
+                else if ( dyn_par_is[arg_j] )
+                    type_x[j] = dynamic_enum;
+                else
+                    type_x[j] = constant_enum;
+            }
+            call_atomic_forward<Base, RecBase>(
+                taylor_x,
+                type_x,
+                need_y,
+                order_low,
+                order_up,
+                atom_index,
+                atom_old,
+                taylor_x,
+                taylor_y
+            );
+# if CPPAD_DYNAMIC_TRACE
+            // get the name of this atomic function
+            bool         set_null = false;
+            size_t       type     = 0;          // set to avoid warning
+            std::string name;
+            void*        v_ptr    = CPPAD_NULL; // set to avoid warning
+            atomic_index<RecBase>(
+                set_null, atom_index, type, &name, v_ptr
+            );
+            std::cout << "atom_dyn " << name << " arguments\n";
+            for(size_t j = 0; j < n; ++j)
+            {   std::cout << "index = " << j
+                << ", value = " << taylor_x[j] << std::endl;
+            }
+            std::cout << "atom_dyn " << name << " results\n";
+# endif
+# ifndef NDEBUG
+            size_t count_dyn = 0;
+# endif
+            for(size_t i = 0; i < m; ++i)
+            {   i_par = size_t( dyn_par_arg[i_arg + 4 + n + i] );
+                if( dyn_par_is[i_par] )
+                {   CPPAD_ASSERT_UNKNOWN( i_par != 0 );
+                    all_par_vec[i_par] = taylor_y[i];
+# ifndef NDEBUG
+                    ++count_dyn;
+# endif
+# if CPPAD_DYNAMIC_TRACE
+                    std::cout
+                    << std::setw(10) << std::left << i_par
+                    << std::setw(10) << std::left << old_value
+                    << std::setw(10) << std::left << all_par_vec[i_par]
+                    << "= " << name << "_" << i << std::endl;
+# endif
+                }
+            }
+            CPPAD_ASSERT_UNKNOWN( count_dyn == n_dyn );
+# if CPPAD_DYNAMIC_TRACE
+            std::cout << "end atomic dynamic parameter results\n";
+# endif
+        }
+        break;
+
+        // ---------------------------------------------------------------
+        default:
+        std::cerr << "op_code_dyn = " << op_name_dyn(op) << std::endl;
+        CPPAD_ASSERT_UNKNOWN(false);
+        break;
+    }
+# if CPPAD_DYNAMIC_TRACE
+    if(
+        (op != cond_exp_dyn) &
+        (op != dis_dyn )     &
+        (op != atom_dyn )    &
+        (op != result_dyn )  )
+    {
+        std::cout
+        << std::setw(10) << std::left << i_par
+        << std::setw(10) << std::left << old_value
+        << std::setw(10) << std::left << all_par_vec[i_par]
+        << "="
+        << std::setw(10) << std::right << op_name_dyn(op)
+        << "(";
+        if( 0 < n_arg )
+        {   if( dyn_par_is[ dyn_par_arg[i_arg + 0] ] )
+            {   std::cout << "i=" << std::setw(10) << std::right
+                << dyn_par_arg[i_arg + 0];
+            }
+            else
+            {   std::cout << "v=" << std::setw(10) << std::right
+                << all_par_vec[ dyn_par_arg[i_arg + 0] ];
+            }
+        }
+        if( 1 < n_arg )
+        {   if( dyn_par_is[ dyn_par_arg[i_arg + 1] ] )
+            {   std::cout << ", i=" << std::setw(10) << std::right
+                << dyn_par_arg[i_arg + 1];
+            }
+            else
+            {   std::cout << ", v=" << std::setw(10) << std::right
+                << all_par_vec[ dyn_par_arg[i_arg + 1] ];
+            }
+        }
+        std::cout << ")" << std::endl;
+    }
+# endif
+    return n_arg;
+}
+
 /*!
 Compute dynamic parameters.
 
@@ -101,14 +579,6 @@ void dynamic(
     );
 # endif
 # if CPPAD_DYNAMIC_TRACE
-    const char* cond_exp_name[] = {
-        "CondExpLt",
-        "CondExpLe",
-        "CondExpEq",
-        "CondExpGe",
-        "CondExpGt",
-        "CondExpNe"
-    };
     std::cout
     << std::endl
     << std::setw(10) << std::left << "index"
@@ -118,10 +588,6 @@ void dynamic(
     << std::setw(26) << std::right << "dynamic i=, constant v="
     << std::endl;
 # endif
-    // used to hold the first two parameter arguments
-    const Base* par[2];
-    for(size_t j = 0; j < 2; ++j)
-        par[j] = CPPAD_NULL;
     //
     // Initialize index in dyn_par_arg
     size_t i_arg = 0;
@@ -130,416 +596,221 @@ void dynamic(
     size_t i_dyn = 0;
     while(i_dyn < num_dynamic_par)
     {   // number of dynamic parameters created by this operator
-        size_t n_dyn = 1;
-        //
-        // parameter index for this dynamic parameter
-        size_t i_par = size_t( dyn_ind2par_ind[i_dyn] );
-        //
-# if CPPAD_DYNAMIC_TRACE
-        Base old_value = all_par_vec[i_par];
-# endif
-        //
-        // operator for this dynamic parameter
-        op_code_dyn op = op_code_dyn( dyn_par_op[i_dyn] );
-        //
-        // number of arguments for this operator
-        size_t n_arg       = num_arg_dyn(op);
-        //
-        // for unary or binary operators
-        bool unary_or_binary = true;
-        unary_or_binary &= op != atom_dyn;
-        unary_or_binary &= op != cond_exp_dyn;
-        unary_or_binary &= op != dis_dyn;
-        unary_or_binary &= op != ind_dyn;
-        unary_or_binary &= op != result_dyn;
-        if( unary_or_binary )
-        {   CPPAD_ASSERT_UNKNOWN( n_arg == 1 || n_arg == 2 );
-           for(size_t j = 0; j < n_arg; ++j)
-                par[j] = & all_par_vec[ dyn_par_arg[i_arg + j] ];
-        }
+        size_t n_dyn;
         //
-        switch(op)
-        {
-            // ---------------------------------------------------------------
-            // standard_math_98
-            // acos
-            case acos_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = acos( *par[0] );
-            break;
-
-            // asin
-            case asin_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = asin( *par[0] );
-            break;
-
-            // atan
-            case atan_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = atan( *par[0] );
-            break;
-
-            // cos
-            case cos_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = cos( *par[0] );
-            break;
-
-            // cosh
-            case cosh_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = cosh( *par[0] );
-            break;
-
-            // ind
-            case ind_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 0 );
-            CPPAD_ASSERT_UNKNOWN( i_par == i_dyn + 1 );
-            all_par_vec[i_par] = ind_dynamic[i_dyn];
-            break;
-
-            // exp
-            case exp_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = exp( *par[0] );
-            break;
-
-            // fabs
-            case fabs_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = fabs( *par[0] );
-            break;
-
-            // log
-            case log_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = log( *par[0] );
-            break;
-
-            // sin
-            case sin_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = sin( *par[0] );
-            break;
-
-            // sinh
-            case sinh_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = sinh( *par[0] );
-            break;
-
-            // sqrt
-            case sqrt_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = sqrt( *par[0] );
-            break;
-
-            // tan
-            case tan_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = tan( *par[0] );
-            break;
-
-            // tanh
-            case tanh_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = tanh( *par[0] );
-            break;
-
-# if CPPAD_USE_CPLUSPLUS_2011
-            // ---------------------------------------------------------------
-            // asinh
-            case asinh_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = asinh( *par[0] );
-            break;
-
-            // acosh
-            case acosh_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = acosh( *par[0] );
-            break;
+        // compute the dynamic parameters created by this operator
+        size_t n_arg = dynamic_op(
+            i_dyn               ,
+            i_arg               ,
+            n_dyn               ,
+            all_par_vec         ,
+            ind_dynamic         ,
+            dyn_par_is          ,
+            dyn_ind2par_ind     ,
+            dyn_par_op          ,
+            dyn_par_arg         ,
+            type_x              ,
+            taylor_x            ,
+            taylor_y            ,
+            not_used_rec_base
+        );
+        i_arg += n_arg;
+        i_dyn += n_dyn;
+    }
+    CPPAD_ASSERT_UNKNOWN( i_arg == dyn_par_arg.size() )
+    return;
+}
 
-            // atanh
-            case atanh_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = atanh( *par[0] );
-            break;
+/*!
+Evaluate one operator in the dependency cone of the changed
+independent dynamic parameters and mark the operators that use its results.
 
-            // expm1
-            case expm1_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = expm1( *par[0] );
-            break;
+\param i_dyn
+is the index of the first dynamic parameter created by this operator.
 
-            // erf
-            case erf_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = erf( *par[0] );
-            break;
+\param need_op
+On input, need_op[i_dyn] is true. On output, it is false and need_op
+is true for the operators that use the results of this operator.
 
-            // erfc
-            case erfc_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = erfc( *par[0] );
-            break;
+\param need
+If this is not null, the operators that are marked by this call are
+also pushed on the heap *need.
 
-            // log1p
-            case log1p_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = log1p( *par[0] );
-            break;
-# endif
-            // ---------------------------------------------------------------
-            // abs
-            case abs_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = fabs( *par[0] );
-            break;
+\return
+is the index of the first dynamic parameter after the ones created
+by this operator.
 
-            // add
-            case add_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
-            all_par_vec[i_par] = *par[0] + *par[1];
-            break;
+\par
+The other arguments are the same as for dynamic_cone.
+*/
+template <class Base, class BaseVector, class RecBase>
+size_t dynamic_cone_op(
+    size_t                        i_dyn              ,
+    pod_vector_maybe<Base>&       all_par_vec        ,
+    const BaseVector&             ind_dynamic        ,
+    const pod_vector<bool>&       dyn_par_is         ,
+    const pod_vector<addr_t>&     dyn_ind2par_ind    ,
+    const pod_vector<opcode_t>&   dyn_par_op         ,
+    const pod_vector<addr_t>&     dyn_par_arg        ,
+    const pod_vector<addr_t>&     dyn_op2arg         ,
+    const pod_vector<addr_t>&     dyn_use_begin      ,
+    const pod_vector<addr_t>&     dyn_use            ,
+    vector<ad_type_enum>&         type_x             ,
+    vector<Base>&                 taylor_x           ,
+    vector<Base>&                 taylor_y           ,
+    pod_vector<bool>&             need_op            ,
+    std::priority_queue<
+        size_t, std::vector<size_t>, std::greater<size_t>
+    >*                            need               ,
+    const RecBase&                not_used_rec_base  )
+{   CPPAD_ASSERT_UNKNOWN( need_op[i_dyn] );
+    need_op[i_dyn] = false;
+    size_t i_arg   = size_t( dyn_op2arg[i_dyn] );
+    size_t n_dyn;
+    //
+    // recompute the dynamic parameters created by this operator
+    dynamic_op(
+        i_dyn               ,
+        i_arg               ,
+        n_dyn               ,
+        all_par_vec         ,
+        ind_dynamic         ,
+        dyn_par_is          ,
+        dyn_ind2par_ind     ,
+        dyn_par_op          ,
+        dyn_par_arg         ,
+        type_x              ,
+        taylor_x            ,
+        taylor_y            ,
+        not_used_rec_base
+    );
+    //
+    // operators that use the dynamic parameters created by this one
+    for(size_t j_dyn = i_dyn; j_dyn < i_dyn + n_dyn; ++j_dyn)
+    {   size_t i_par = size_t( dyn_ind2par_ind[j_dyn] );
+        size_t begin = size_t( dyn_use_begin[i_par] );
+        size_t end   = size_t( dyn_use_begin[i_par + 1] );
+        for(size_t k = begin; k < end; ++k)
+        {   size_t k_dyn = size_t( dyn_use[k] );
+            CPPAD_ASSERT_UNKNOWN( i_dyn < k_dyn );
+            if( ! need_op[k_dyn] )
+            {   need_op[k_dyn] = true;
+                if( need != CPPAD_NULL )
+                    need->push(k_dyn);
+            }
+        }
+    }
+    return i_dyn + n_dyn;
+}
 
-            // div
-            case div_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
-            all_par_vec[i_par] = *par[0] / *par[1];
-            break;
+/*!
+Compute the dynamic parameters that depend on a subset of the
+independent dynamic parameters.
 
-            // mul
-            case mul_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
-            all_par_vec[i_par] = *par[0] * *par[1];
-            break;
+\tparam Base
+The type of the parameters.
 
-            // pow
-            case pow_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
-            all_par_vec[i_par] = pow( *par[0], *par[1] );
-            break;
+\tparam BaseVector
+is a simple vector class with elements of type Base.
 
-            // sign
-            case sign_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 1 );
-            all_par_vec[i_par] = sign( *par[0] );
-            break;
+\tparam SizeVector
+is a simple vector class with elements of type size_t.
 
-            // sub
-            case sub_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
-            all_par_vec[i_par] = *par[0] - *par[1];
-            break;
+\param ind_dynamic
+new value for the independent dynamic parameter vector.
+Only the elements with index in changed are used.
 
-            // zmul
-            case zmul_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
-            all_par_vec[i_par] = azmul( *par[0],  *par[1] );
-            break;
+\param changed
+is the indices of the independent dynamic parameters that may have changed
+since the previous call to sweep::dynamic or sweep::dynamic_cone.
+Only the dynamic parameters that depend on these indices are recomputed.
 
-            // ---------------------------------------------------------------
-            // discrete(index, argument)
-            case dis_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 2 );
-            all_par_vec[i_par] = discrete<Base>::eval(
-                size_t(      dyn_par_arg[i_arg + 0] ) , // index
-                all_par_vec[ dyn_par_arg[i_arg + 1] ]   // argument
-            );
-# if CPPAD_DYNAMIC_TRACE
-            std::cout
-            << std::setw(10) << std::left << i_par
-            << std::setw(10) << std::left << old_value
-            << std::setw(10) << std::left << all_par_vec[i_par]
-            << "="
-            << std::setw(10) << std::right << op_name_dyn(op)
-            << "("
-            << std::setw(12) << std::right <<
-                discrete<Base>::name( size_t( dyn_par_arg[i_arg + 0] ) );
-            if( dyn_par_is[ dyn_par_arg[i_arg + 1] ] )
-            {   std::cout << ", i=" << std::setw(10) << std::right
-                << dyn_par_arg[i_arg + 1];
-            }
-            else
-            {   std::cout << ", v=" << std::setw(10) << std::right
-                << all_par_vec[ dyn_par_arg[i_arg + 1] ];
-            }
-            std::cout << ")" << std::endl;
-# endif
-            break;
+\param dyn_op2arg
+is a vector with length equal to the number of dynamic parameters.
+If the j-th dynamic parameter is the first one created by an operator,
+dyn_op2arg[j] is the index in dyn_par_arg of the first argument
+for that operator.
 
-            // ---------------------------------------------------------------
-            // cond_exp(cop, left, right, if_true, if_false)
-            // (not yet implemented)
-            case cond_exp_dyn:
-            CPPAD_ASSERT_UNKNOWN( n_arg == 5 );
-            all_par_vec[i_par] = CondExpOp(
-                CompareOp(   dyn_par_arg[i_arg + 0] ) , // cop
-                all_par_vec[ dyn_par_arg[i_arg + 1] ] , // left
-                all_par_vec[ dyn_par_arg[i_arg + 2] ] , // right
-                all_par_vec[ dyn_par_arg[i_arg + 3] ] , // if_true
-                all_par_vec[ dyn_par_arg[i_arg + 4] ]   // if_false
-            );
-# if CPPAD_DYNAMIC_TRACE
-            std::cout
-            << std::setw(10) << std::left << i_par
-            << std::setw(10) << std::left << old_value
-            << std::setw(10) << std::left << all_par_vec[i_par]
-            << "="
-            << std::setw(10) << std::right
-            << cond_exp_name[ dyn_par_arg[i_arg + 0] ]
-            << "(";
-            for(size_t i = 1; i < 5; ++i)
-            {   if( dyn_par_is[ dyn_par_arg[i_arg + i] ] )
-                {   std::cout << "i=" << std::setw(10) << std::right
-                    << dyn_par_arg[i_arg + i];
-                }
-                else
-                {   std::cout << "v=" << std::setw(10) << std::right
-                    << all_par_vec[ dyn_par_arg[i_arg + i] ];
-                }
-                if( i < 4 )
-                    std::cout << ",";
-            }
-            std::cout << ")" << std::endl;
-# endif
-            break;
-            // ---------------------------------------------------------------
-            // atomic function results
-            case result_dyn:
-            break;
+\param dyn_use_begin
+is a vector with length equal to the number of parameters plus one.
 
-            // atomic function call
-            case atom_dyn:
-            {   size_t atom_index = size_t( dyn_par_arg[i_arg + 0] );
-                size_t n          = size_t( dyn_par_arg[i_arg + 1] );
-                size_t m          = size_t( dyn_par_arg[i_arg + 2] );
-                n_dyn             = size_t( dyn_par_arg[i_arg + 3] );
-                n_arg             = 5 + n + m;
-                CPPAD_ASSERT_UNKNOWN(
-                    size_t( dyn_par_arg[i_arg + 4 + n + m] ) == n_arg
-                );
-                //
-                size_t need_y    = size_t(dynamic_enum);
-                size_t order_low = 0;
-                size_t order_up  = 0;
-                size_t atom_old  = 0; // not used
-                type_x.resize(n);
-                taylor_x.resize(n);
-                taylor_y.resize(m);
-                for(size_t j = 0; j < n; ++j)
-                {   addr_t arg_j = dyn_par_arg[i_arg + 4 + j];
-                    taylor_x[j]   = all_par_vec[ arg_j ];
-                    if( arg_j == 0 )
-                        type_x[j] = variable_enum;
-                    else if ( dyn_par_is[arg_j] )
-                        type_x[j] = dynamic_enum;
-                    else
-                        type_x[j] = constant_enum;
-                }
-                call_atomic_forward<Base, RecBase>(
-                    taylor_x,
-                    type_x,
-                    need_y,
-                    order_low,
-                    order_up,
-                    atom_index,
-                    atom_old,
-                    taylor_x,
-                    taylor_y
-                );
-# if CPPAD_DYNAMIC_TRACE
-                // get the name of this atomic function
-                bool         set_null = false;
-                size_t       type     = 0;          // set to avoid warning
-                std::string name;
-                void*        v_ptr    = CPPAD_NULL; // set to avoid warning
-                atomic_index<RecBase>(
-                    set_null, atom_index, type, &name, v_ptr
-                );
-                std::cout << "atom_dyn " << name << " arguments\n";
-                for(size_t j = 0; j < n; ++j)
-                {   std::cout << "index = " << j
-                    << ", value = " << taylor_x[j] << std::endl;
-                }
-                std::cout << "atom_dyn " << name << " results\n";
-# endif
-# ifndef NDEBUG
-                size_t count_dyn = 0;
-# endif
-                for(size_t i = 0; i < m; ++i)
-                {   i_par = size_t( dyn_par_arg[i_arg + 4 + n + i] );
-                    if( dyn_par_is[i_par] )
-                    {   CPPAD_ASSERT_UNKNOWN( i_par != 0 );
-                        all_par_vec[i_par] = taylor_y[i];
-# ifndef NDEBUG
-                        ++count_dyn;
-# endif
-# if CPPAD_DYNAMIC_TRACE
-                        std::cout
-                        << std::setw(10) << std::left << i_par
-                        << std::setw(10) << std::left << old_value
-                        << std::setw(10) << std::left << all_par_vec[i_par]
-                        << "= " << name << "_" << i << std::endl;
-# endif
-                    }
-                }
-                CPPAD_ASSERT_UNKNOWN( count_dyn == n_dyn );
-# if CPPAD_DYNAMIC_TRACE
-                std::cout << "end atomic dynamic parameter results\n";
-# endif
-            }
-            break;
+\param dyn_use
+For each parameter index i, the operators that use the i-th parameter
+as an argument are the operators that create the dynamic parameters
+with index dyn_use[k] for k = dyn_use_begin[i], ... , dyn_use_begin[i+1]-1.
 
-            // ---------------------------------------------------------------
-            default:
-            std::cerr << "op_code_dyn = " << op_name_dyn(op) << std::endl;
-            CPPAD_ASSERT_UNKNOWN(false);
-            break;
-        }
-# if CPPAD_DYNAMIC_TRACE
-        if(
-            (op != cond_exp_dyn) &
-            (op != dis_dyn )     &
-            (op != atom_dyn )    &
-            (op != result_dyn )  )
-        {
-            std::cout
-            << std::setw(10) << std::left << i_par
-            << std::setw(10) << std::left << old_value
-            << std::setw(10) << std::left << all_par_vec[i_par]
-            << "="
-            << std::setw(10) << std::right << op_name_dyn(op)
-            << "(";
-            if( 0 < n_arg )
-            {   if( dyn_par_is[ dyn_par_arg[i_arg + 0] ] )
-                {   std::cout << "i=" << std::setw(10) << std::right
-                    << dyn_par_arg[i_arg + 0];
-                }
-                else
-                {   std::cout << "v=" << std::setw(10) << std::right
-                    << all_par_vec[ dyn_par_arg[i_arg + 0] ];
-                }
-            }
-            if( 1 < n_arg )
-            {   if( dyn_par_is[ dyn_par_arg[i_arg + 1] ] )
-                {   std::cout << ", i=" << std::setw(10) << std::right
-                    << dyn_par_arg[i_arg + 1];
-                }
-                else
-                {   std::cout << ", v=" << std::setw(10) << std::right
-                    << all_par_vec[ dyn_par_arg[i_arg + 1] ];
-                }
-            }
-            std::cout << ")" << std::endl;
+\par
+The other arguments are the same as for sweep::dynamic.
+*/
+template <class Base, class BaseVector, class SizeVector, class RecBase>
+void dynamic_cone(
+    pod_vector_maybe<Base>&       all_par_vec        ,
+    const BaseVector&             ind_dynamic        ,
+    const SizeVector&             changed            ,
+    const pod_vector<bool>&       dyn_par_is         ,
+    const pod_vector<addr_t>&     dyn_ind2par_ind    ,
+    const pod_vector<opcode_t>&   dyn_par_op         ,
+    const pod_vector<addr_t>&     dyn_par_arg        ,
+    const pod_vector<addr_t>&     dyn_op2arg         ,
+    const pod_vector<addr_t>&     dyn_use_begin      ,
+    const pod_vector<addr_t>&     dyn_use            ,
+    const RecBase&                not_used_rec_base  )
+{   CPPAD_ASSERT_UNKNOWN( dyn_op2arg.size() == dyn_par_op.size() );
+    CPPAD_ASSERT_UNKNOWN( dyn_use_begin.size() == dyn_par_is.size() + 1 );
+    //
+    // vectors used in call to atomic fuctions
+    vector<ad_type_enum> type_x;
+    vector<Base>         taylor_x, taylor_y;
+    //
+    // need_op[i_dyn] is true if the operator that creates the dynamic
+    // parameter with index i_dyn is in the cone and not yet evaluated
+    size_t num_dynamic_par = dyn_ind2par_ind.size();
+    pod_vector<bool> need_op(num_dynamic_par);
+    for(size_t i_dyn = 0; i_dyn < num_dynamic_par; ++i_dyn)
+        need_op[i_dyn] = false;
+    //
+    // operators that need to be evaluated, smallest index first
+    // (the arguments for an operator have smaller index than its results)
+    std::priority_queue<
+        size_t, std::vector<size_t>, std::greater<size_t>
+    > need;
+    for(size_t k = 0; k < size_t( changed.size() ); ++k)
+    {   size_t i_dyn = size_t( changed[k] );
+        CPPAD_ASSERT_UNKNOWN( op_code_dyn( dyn_par_op[i_dyn] ) == ind_dyn );
+        if( ! need_op[i_dyn] )
+        {   need_op[i_dyn] = true;
+            need.push(i_dyn);
         }
-# endif
-        i_arg += n_arg;
-        i_dyn += n_dyn;
     }
-    CPPAD_ASSERT_UNKNOWN( i_arg == dyn_par_arg.size() )
+    //
+    // Use the heap while the cone is sparse. Once the operators in need
+    // are a significant fraction of the remaining operators, scanning
+    // need_op is faster than maintaining the heap.
+    size_t i_dyn = num_dynamic_par;
+    while( ! need.empty() )
+    {   i_dyn = need.top();
+        if( 64 * need.size() > num_dynamic_par - i_dyn )
+            break;
+        need.pop();
+        i_dyn = dynamic_cone_op(
+            i_dyn, all_par_vec, ind_dynamic, dyn_par_is, dyn_ind2par_ind,
+            dyn_par_op, dyn_par_arg, dyn_op2arg, dyn_use_begin, dyn_use,
+            type_x, taylor_x, taylor_y, need_op, &need, not_used_rec_base
+        );
+    }
+    //
+    // linear scan starting at the first operator still in need
+    while( i_dyn < num_dynamic_par )
+    {   if( need_op[i_dyn] )
+            i_dyn = dynamic_cone_op(
+                i_dyn, all_par_vec, ind_dynamic, dyn_par_is, dyn_ind2par_ind,
+                dyn_par_op, dyn_par_arg, dyn_op2arg, dyn_use_begin, dyn_use,
+                type_x, taylor_x, taylor_y, need_op, CPPAD_NULL,
+                not_used_rec_base
+            );
+        else
+            ++i_dyn;
+    }
     return;
 }
 
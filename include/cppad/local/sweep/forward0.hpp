@@ -1,7 +1,7 @@
 # ifndef CPPAD_LOCAL_SWEEP_FORWARD0_HPP
 # define CPPAD_LOCAL_SWEEP_FORWARD0_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -14,6 +14,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 
 # include <cppad/local/play/atom_op_info.hpp>
 # include <cppad/local/sweep/call_atomic.hpp>
+# include <cppad/local/sweep/atom_batch.hpp>
 
 // BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
 namespace CppAD { namespace local { namespace sweep {
@@ -189,13 +190,22 @@ void forward0(
     {   size_t i;
 
         // this includes order zero calculation, initialize vector indices
+        // (only for vectors that have store operators, loads from the
+        // other vectors use the recording directly)
         size_t num = play->num_var_vecad_ind_rec();
         if( num > 0 )
         {   vec_ad2isvar.extend(num);
             vec_ad2index.extend(num);
-            for(i = 0; i < num; i++)
-            {   vec_ad2index[i] = play->GetVecInd(i);
-                vec_ad2isvar[i] = false;
+            i = 0;
+            while( i < num )
+            {   size_t i_end = i + play->GetVecInd(i) + 1;
+                if( play->vecad_store(i) )
+                {   for(size_t k = i; k < i_end; ++k)
+                    {   vec_ad2index[k] = play->GetVecInd(k);
+                        vec_ad2isvar[k] = false;
+                    }
+                }
+                i = i_end;
             }
         }
         // includes zero order, so initialize conditional skip flags
@@ -219,6 +229,13 @@ void forward0(
     // information defined by atomic function operators
     size_t atom_index=0, atom_old=0, atom_m=0, atom_n=0, atom_i=0, atom_j=0;
     enum_atom_state atom_state = start_atom; // proper initialization
+    //
+    // calls to atomic functions that are evaluated as a batch
+    // (see atom_batch.hpp)
+    const pod_vector<addr_t>& atom_first_use( play->atom_first_use() );
+    atom_batch<Base, RecBase> atom_pending;
+    size_t atom_call    = 0;     // number of calls that have started
+    bool   atom_batched = false; // is the current call in atom_pending
 
     // length of the parameter vector (used by CppAD assert macros)
     const size_t num_par = play->num_par_rec();
@@ -257,6 +274,10 @@ void forward0(
     std::cout << std::endl;
 # endif
     bool flag; // a temporary flag to use in switch cases
+    size_t skip_case; // which CSkipOp list is skipped (if any)
+    // ranges of skipped operators (see player::cskip_push)
+    pod_vector<addr_t> cskip_pending;
+    //
     bool more_operators = true;
     while(more_operators)
     {
@@ -266,36 +287,34 @@ void forward0(
 
         // check if we are skipping this operation
         while( cskip_op[itr.op_index()] )
-        {   switch(op)
-            {
-                case AFunOp:
-                {   // get information for this atomic function call
-                    CPPAD_ASSERT_UNKNOWN( atom_state == start_atom );
-                    play::atom_op_info<Base>(
-                        op, arg, atom_index, atom_old, atom_m, atom_n
-                    );
-                    //
-                    // skip to the second AFunOp
-                    for(size_t i = 0; i < atom_m + atom_n + 1; ++i)
-                        ++itr;
+        {   if( op == AFunOp )
+            {   // get information for this atomic function call
+                CPPAD_ASSERT_UNKNOWN( atom_state == start_atom );
+                play::atom_op_info<Base>(
+                    op, arg, atom_index, atom_old, atom_m, atom_n
+                );
+                ++atom_call;
+                //
+                // skip to the second AFunOp
+                for(size_t i = 0; i < atom_m + atom_n + 1; ++i)
+                    ++itr;
 # ifndef NDEBUG
-                    itr.op_info(op, arg, i_var);
-                    CPPAD_ASSERT_UNKNOWN( op == AFunOp );
+                itr.op_info(op, arg, i_var);
+                CPPAD_ASSERT_UNKNOWN( op == AFunOp );
 # endif
-                }
-                break;
-
-                case CSkipOp:
-                case CSumOp:
-                itr.correct_before_increment();
-                break;
-
-                default:
-                break;
+                ++itr;
+            }
+            else
+            {   // jump over this block of skipped operators
+                play->cskip_jump(itr, cskip_pending);
             }
-            (++itr).op_info(op, arg, i_var);
+            itr.op_info(op, arg, i_var);
         }
 
+        // evaluate pending atomic calls before their results are used
+        if( atom_pending.flush_op() <= itr.op_index() )
+            atom_pending.forward_flush(J, taylor);
+
         // action to take depends on the case
         switch( op )
         {
@@ -387,9 +406,11 @@ void forward0(
             // -------------------------------------------------
 
             case CSkipOp:
-            forward_cskip_op_0(
+            skip_case = forward_cskip_op_0(
                 i_var, arg, num_par, parameter, J, taylor, cskip_op
             );
+            if( skip_case != 0 )
+                play->cskip_push(itr.op_index(), skip_case, cskip_pending);
             itr.correct_before_increment();
             break;
             // -------------------------------------------------
@@ -826,6 +847,13 @@ void forward0(
             {   atom_state = arg_atom;
                 atom_i     = 0;
                 atom_j     = 0;
+                ++atom_call;
+                //
+                // add this call to the pending batch
+                atom_batched = atom_pending.forward_start(
+                    atom_index, atom_n, atom_m, itr.op_index() + atom_n,
+                    size_t( atom_first_use[atom_call - 1] ), J, taylor
+                );
                 //
                 atom_par_x.resize(atom_n);
                 atom_type_x.resize(atom_n);
@@ -858,11 +886,15 @@ void forward0(
             else
                 atom_type_x[atom_j] = constant_enum;
             atom_par_x[atom_j] = parameter[ arg[0] ];
-            atom_tx[atom_j++]  = parameter[ arg[0] ];
+            atom_tx[atom_j]    = parameter[ arg[0] ];
+            if( atom_batched ) atom_pending.forward_x(
+                atom_j, atom_par_x[atom_j], atom_type_x[atom_j], atom_tx[atom_j]
+            );
+            ++atom_j;
             //
             if( atom_j == atom_n )
             {   // call atomic function for this operation
-                call_atomic_forward<Base, RecBase>(
+                if( ! atom_batched ) call_atomic_forward<Base, RecBase>(
                     atom_par_x, atom_type_x, need_y,
                     order_low, order_up, atom_index, atom_old, atom_tx, atom_ty
                 );
@@ -877,13 +909,20 @@ void forward0(
             CPPAD_ASSERT_UNKNOWN( atom_i == 0 );
             CPPAD_ASSERT_UNKNOWN( atom_j < atom_n );
             //
-            atom_type_x[atom_j] = variable_enum;
-            atom_par_x[atom_j]  = CppAD::numeric_limits<Base>::quiet_NaN();
-            atom_tx[atom_j++]   = taylor[ size_t(arg[0]) * J + 0 ];
+            if( atom_batched ) atom_pending.forward_x(
+                atom_j, CppAD::numeric_limits<Base>::quiet_NaN(),
+                variable_enum, taylor[ size_t(arg[0]) * J + 0 ]
+            );
+            else
+            {   atom_type_x[atom_j] = variable_enum;
+                atom_par_x[atom_j]  = CppAD::numeric_limits<Base>::quiet_NaN();
+                atom_tx[atom_j]     = taylor[ size_t(arg[0]) * J + 0 ];
+            }
+            ++atom_j;
             //
             if( atom_j == atom_n )
             {   // call atomic function for this operation
-                call_atomic_forward<Base, RecBase>(
+                if( ! atom_batched ) call_atomic_forward<Base, RecBase>(
                     atom_par_x, atom_type_x, need_y,
                     order_low, order_up, atom_index, atom_old, atom_tx, atom_ty
                 );
@@ -915,7 +954,10 @@ void forward0(
 # if CPPAD_FORWARD0_TRACE
             atom_iy[atom_i] = i_var;
 # endif
-            taylor[ i_var * J + 0 ] = atom_ty[atom_i++];
+            if( atom_batched )
+                atom_pending.forward_result(atom_i++, i_var);
+            else
+                taylor[ i_var * J + 0 ] = atom_ty[atom_i++];
             if( atom_i == atom_m )
                 atom_state = end_atom;
             break;
@@ -995,6 +1037,7 @@ void forward0(
     }
 # endif
     CPPAD_ASSERT_UNKNOWN( atom_state == start_atom );
+    CPPAD_ASSERT_UNKNOWN( atom_pending.n_call() == 0 );
 
     return;
 }
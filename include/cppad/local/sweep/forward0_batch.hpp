@@ -0,0 +1,448 @@
+# ifndef CPPAD_LOCAL_SWEEP_FORWARD0_BATCH_HPP
+# define CPPAD_LOCAL_SWEEP_FORWARD0_BATCH_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cppad/local/play/player.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*!
+\file sweep/forward0_batch.hpp
+Zero order forward mode for a batch of independent variable values.
+*/
+
+/*
+ ------------------------------------------------------------------------------
+$begin sweep_forward0_batch$$
+$spell
+    Taylor
+    numvar
+    cskip
+    op
+    Pri
+    Vec
+    bool
+    const
+$$
+$section Zero Order Forward Mode for a Batch of Points$$
+
+$head Syntax$$
+$icode%ok% = forward0_batch(%play%, %K%, %batch%)%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_PROTOTYPE%// END_PROTOTYPE%1
+%$$
+
+$head Purpose$$
+The $cref sweep_forward0$$ routine evaluates one point for each pass
+through the operation sequence.
+This routine evaluates $icode K$$ points for each pass.
+Each operator is decoded once and then evaluated at all the points,
+in an inner loop that accesses memory contiguously.
+
+$head Base$$
+The type used during the forward mode computations; i.e., the corresponding
+recording of operations used the type $codei%AD<%Base%>%$$.
+
+$head play$$
+is the operation sequence that is evaluated.
+
+$head K$$
+is the number of points in the batch.
+It must be greater than zero.
+
+$head batch$$
+This is a matrix with $icode%numvar% = %play%->num_var_rec()%$$ rows
+and $icode K$$ columns stored in row major order; i.e.,
+the zero order Taylor coefficient for the variable with index $icode i$$
+at point $icode k$$ is $icode%batch%[%i% * %K% + %k%]%$$.
+This is the same as the $cref/taylor/sweep_forward0/taylor/$$
+argument to $code sweep_forward0$$ with $icode%J% = %K%$$
+and $codei%%taylor% = %batch% + %k%$$.
+
+$subhead Input$$
+The rows corresponding to the independent variables are inputs.
+
+$subhead Output$$
+If $icode ok$$ is true,
+the other rows are the corresponding zero order Taylor coefficients.
+
+$head ok$$
+If $icode ok$$ is false,
+the operation sequence contains an operator that is not supported by
+this routine; i.e.,
+$cref VecAD$$, $cref atomic$$ or $cref PrintFor$$ operators.
+In this case, the rows of $icode batch$$ corresponding to the
+independent variables are not changed,
+the other rows are unspecified, and $cref sweep_forward0$$ should be used.
+
+$head Comparison Operators$$
+Comparison operators are not evaluated by this routine.
+
+$head Conditional Skip$$
+Conditional skip operators are ignored by this routine; i.e.,
+all the operators are evaluated for every point.
+
+$end
+*/
+
+// BEGIN_PROTOTYPE
+template <class Base>
+bool forward0_batch(const player<Base>* play, size_t K, Base* batch)
+// END_PROTOTYPE
+{   CPPAD_ASSERT_UNKNOWN( K >= 1 );
+    //
+    // length of the parameter vector (used by CppAD assert macros)
+    const size_t num_par = play->num_par_rec();
+    //
+    // pointer to the beginning of the parameter vector
+    CPPAD_ASSERT_UNKNOWN( num_par > 0 )
+    const Base* parameter = play->GetPar();
+    //
+    // use p, q, r so discrete function operator is the same as in forward0
+    size_t p = 0;
+    size_t q = 0;
+    size_t r = 1;
+    //
+    // skip the BeginOp at the beginning of the recording
+    play::const_sequential_iterator itr = play->begin();
+    OpCode        op;
+    size_t        i_var;
+    const addr_t* arg;
+    itr.op_info(op, arg, i_var);
+    CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+    //
+    // K is the stride between values for the same point (J in forward0)
+    const size_t J = K;
+    size_t k;
+    bool more_operators = true;
+    while(more_operators)
+    {   (++itr).op_info(op, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( itr.op_index() < play->num_op_rec() );
+        //
+        switch( op )
+        {
+            case AbsOp:
+            for(k = 0; k < K; ++k)
+                forward_abs_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case AddvvOp:
+            for(k = 0; k < K; ++k)
+                forward_addvv_op_0(i_var, arg, parameter, J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case AddpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(k = 0; k < K; ++k)
+                forward_addpv_op_0(i_var, arg, parameter, J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case AcosOp:
+            for(k = 0; k < K; ++k)
+                forward_acos_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+            // -------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case AcoshOp:
+            for(k = 0; k < K; ++k)
+                forward_acosh_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+# endif
+            // -------------------------------------------------
+
+            case AsinOp:
+            for(k = 0; k < K; ++k)
+                forward_asin_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+            // -------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case AsinhOp:
+            for(k = 0; k < K; ++k)
+                forward_asinh_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+# endif
+            // -------------------------------------------------
+
+            case AtanOp:
+            for(k = 0; k < K; ++k)
+                forward_atan_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+            // -------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case AtanhOp:
+            for(k = 0; k < K; ++k)
+                forward_atanh_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+# endif
+            // -------------------------------------------------
+
+            case CExpOp:
+            for(k = 0; k < K; ++k) forward_cond_op_0(
+                i_var, arg, num_par, parameter, J, batch + k
+            );
+            break;
+            // ---------------------------------------------------
+
+            case CosOp:
+            for(k = 0; k < K; ++k)
+                forward_cos_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+            // ---------------------------------------------------
+
+            case CoshOp:
+            for(k = 0; k < K; ++k)
+                forward_cosh_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case CSkipOp:
+            // all the operators are evaluated
+            itr.correct_before_increment();
+            break;
+            // -------------------------------------------------
+
+            case CSumOp:
+            for(k = 0; k < K; ++k) forward_csum_op(
+                0, 0, i_var, arg, num_par, parameter, J, batch + k
+            );
+            itr.correct_before_increment();
+            break;
+            // -------------------------------------------------
+
+            case DisOp:
+            for(k = 0; k < K; ++k)
+                forward_dis_op(p, q, r, i_var, arg, J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case DivvvOp:
+            for(k = 0; k < K; ++k)
+                forward_divvv_op_0(i_var, arg, parameter, J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case DivpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(k = 0; k < K; ++k)
+                forward_divpv_op_0(i_var, arg, parameter, J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case DivvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            for(k = 0; k < K; ++k)
+                forward_divvp_op_0(i_var, arg, parameter, J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case EndOp:
+            CPPAD_ASSERT_NARG_NRES(op, 0, 0);
+            more_operators = false;
+            break;
+            // -------------------------------------------------
+
+            case EqppOp:
+            case EqpvOp:
+            case EqvvOp:
+            case LeppOp:
+            case LepvOp:
+            case LevpOp:
+            case LevvOp:
+            case LtppOp:
+            case LtpvOp:
+            case LtvpOp:
+            case LtvvOp:
+            case NeppOp:
+            case NepvOp:
+            case NevvOp:
+            // comparison operators are not evaluated
+            break;
+            // -------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case ErfOp:
+            case ErfcOp:
+            for(k = 0; k < K; ++k)
+                forward_erf_op_0(op, i_var, arg, parameter, J, batch + k);
+            break;
+# endif
+            // -------------------------------------------------
+
+            case ExpOp:
+            for(k = 0; k < K; ++k)
+                forward_exp_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+            // ---------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case Expm1Op:
+            for(k = 0; k < K; ++k)
+                forward_expm1_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+# endif
+            // ---------------------------------------------------
+
+            case InvOp:
+            CPPAD_ASSERT_NARG_NRES(op, 0, 1);
+            break;
+            // ---------------------------------------------------
+
+            case LogOp:
+            for(k = 0; k < K; ++k)
+                forward_log_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+            // ---------------------------------------------------
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case Log1pOp:
+            for(k = 0; k < K; ++k)
+                forward_log1p_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+# endif
+            // -------------------------------------------------
+
+            case MulpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(k = 0; k < K; ++k)
+                forward_mulpv_op_0(i_var, arg, parameter, J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case MulvvOp:
+            for(k = 0; k < K; ++k)
+                forward_mulvv_op_0(i_var, arg, parameter, J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case ParOp:
+            for(k = 0; k < K; ++k) forward_par_op_0(
+                i_var, arg, num_par, parameter, J, batch + k
+            );
+            break;
+            // -------------------------------------------------
+
+            case PowvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            for(k = 0; k < K; ++k)
+                forward_powvp_op_0(i_var, arg, parameter, J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case PowpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(k = 0; k < K; ++k)
+                forward_powpv_op_0(i_var, arg, parameter, J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case PowvvOp:
+            for(k = 0; k < K; ++k)
+                forward_powvv_op_0(i_var, arg, parameter, J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case SignOp:
+            for(k = 0; k < K; ++k)
+                forward_sign_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case SinOp:
+            for(k = 0; k < K; ++k)
+                forward_sin_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case SinhOp:
+            for(k = 0; k < K; ++k)
+                forward_sinh_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case SqrtOp:
+            for(k = 0; k < K; ++k)
+                forward_sqrt_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case SubvvOp:
+            for(k = 0; k < K; ++k)
+                forward_subvv_op_0(i_var, arg, parameter, J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case SubpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(k = 0; k < K; ++k)
+                forward_subpv_op_0(i_var, arg, parameter, J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case SubvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            for(k = 0; k < K; ++k)
+                forward_subvp_op_0(i_var, arg, parameter, J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case TanOp:
+            for(k = 0; k < K; ++k)
+                forward_tan_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case TanhOp:
+            for(k = 0; k < K; ++k)
+                forward_tanh_op_0(i_var, size_t(arg[0]), J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case ZmulpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            for(k = 0; k < K; ++k)
+                forward_zmulpv_op_0(i_var, arg, parameter, J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case ZmulvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            for(k = 0; k < K; ++k)
+                forward_zmulvp_op_0(i_var, arg, parameter, J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            case ZmulvvOp:
+            for(k = 0; k < K; ++k)
+                forward_zmulvv_op_0(i_var, arg, parameter, J, batch + k);
+            break;
+            // -------------------------------------------------
+
+            default:
+            // VecAD, atomic function, and print operators
+            return false;
+        }
+    }
+    return true;
+}
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
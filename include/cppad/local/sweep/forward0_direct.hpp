@@ -0,0 +1,487 @@
+# ifndef CPPAD_LOCAL_SWEEP_FORWARD0_DIRECT_HPP
+# define CPPAD_LOCAL_SWEEP_FORWARD0_DIRECT_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <cppad/utility/vector.hpp>
+# include <cppad/local/play/player.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*!
+\file sweep/forward0_direct.hpp
+Zero order forward mode using a pre-decoded operation sequence.
+*/
+
+/*
+ ------------------------------------------------------------------------------
+$begin sweep_forward0_direct$$
+$spell
+    Taylor
+    op
+    vec
+    arg
+    cskip
+    num
+    bool
+    const
+    Vec
+$$
+$section Direct Dispatch Zero Order Forward Mode$$
+
+$head Syntax$$
+$codei%local::sweep::forward0_direct<%Base%> %direct%
+%$$
+$icode%direct%.setup(%play%)
+%$$
+$icode%direct%.clear()
+%$$
+$icode%done% = %direct%.setup_done()
+%$$
+$icode%ok% = %direct%.ok()
+%$$
+$icode%has_compare% = %direct%.has_compare()
+%$$
+$icode%direct%.forward0(%play%, %J%, %taylor%)
+%$$
+
+$head Purpose$$
+The $cref sweep_forward0$$ routine decodes each operator,
+checks if it is skipped, and dispatches it through a $code switch$$ statement,
+every time it is called.
+This class decodes the operation sequence once and stores, for each
+operator that computes a value, a pointer to a function that evaluates it,
+the index of its primary result, and the offset of its arguments.
+Subsequent zero order forward sweeps just loop over this table.
+
+$head Base$$
+The type used during the forward mode computations; i.e., the corresponding
+recording of operations used the type $codei%AD<%Base%>%$$.
+
+$head play$$
+This argument has prototype
+$codei%
+    const player<%Base%>* %play%
+%$$
+In the $code setup$$ syntax, it is the operation sequence that is decoded.
+In the $code forward0$$ syntax, it must have the same operation sequence
+as in the previous call to $code setup$$.
+(The parameter values may be different; see $cref new_dynamic$$.)
+
+$head setup$$
+This decodes the operation sequence in $icode play$$.
+Any previously decoded operation sequence is lost.
+
+$head clear$$
+This frees the memory used by the decoded operation sequence
+and sets $icode done$$ and $icode ok$$ to false.
+
+$head done$$
+This return value has prototype
+$codei%
+    bool %done%
+%$$
+It is true if $code setup$$ has been called since the previous $code clear$$
+(or since construction).
+
+$head ok$$
+This return value has prototype
+$codei%
+    bool %ok%
+%$$
+It is true if $code setup$$ has been called (since the previous $code clear$$)
+and the operation sequence can be evaluated using $code forward0$$.
+Operation sequences that contain
+$cref/conditional skip/op_code_var/CSkipOp/$$,
+$cref VecAD$$, $cref atomic$$ or $cref PrintFor$$ operators
+can not be evaluated using this class.
+
+$head has_compare$$
+This return value has prototype
+$codei%
+    bool %has_compare%
+%$$
+It is true if the operation sequence contains comparison operators.
+These operators are not evaluated by $code forward0$$
+and hence should not be used when comparison changes are being counted;
+see $cref compare_change$$.
+
+$head J$$
+Is the number of columns in the coefficient matrix taylor.
+This must be greater than or equal one.
+
+$head taylor$$
+Is the matrix of Taylor coefficients; see
+$cref/taylor/sweep_forward0/taylor/$$ in $code sweep_forward0$$.
+
+$end
+*/
+
+/*!
+Type of the functions used to evaluate one operator during a direct sweep.
+
+\param i_z
+index of the primary result for this operator.
+
+\param arg
+arguments for this operator.
+
+\param num_par
+number of parameters in the recording.
+
+\param parameter
+the parameters in the recording.
+
+\param cap_order
+number of columns in the matrix containing all the Taylor coefficients.
+
+\param taylor
+the Taylor coefficient matrix.
+*/
+# define CPPAD_SWEEP_FORWARD0_DIRECT_ARGS(Base) \
+    size_t        i_z       , \
+    const addr_t* arg       , \
+    size_t        num_par   , \
+    const Base*   parameter , \
+    size_t        cap_order , \
+    Base*         taylor
+
+// wrapper for operators of the form forward_name_op_0(i_z, i_x, J, taylor)
+# define CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(name)                  \
+template <class Base>                                             \
+void forward0_direct_##name(                                      \
+    size_t        i_z       ,                                     \
+    const addr_t* arg       ,                                     \
+    size_t        /* num_par */   ,                               \
+    const Base*   /* parameter */ ,                               \
+    size_t        cap_order ,                                     \
+    Base*         taylor    )                                     \
+{   forward_##name##_op_0(i_z, size_t(arg[0]), cap_order, taylor); }
+
+// wrapper for operators of the form
+// forward_name_op_0(i_z, arg, parameter, J, taylor)
+# define CPPAD_SWEEP_FORWARD0_DIRECT_BINARY(name)                 \
+template <class Base>                                             \
+void forward0_direct_##name(                                      \
+    size_t        i_z       ,                                     \
+    const addr_t* arg       ,                                     \
+    size_t        /* num_par */ ,                                 \
+    const Base*   parameter ,                                     \
+    size_t        cap_order ,                                     \
+    Base*         taylor    )                                     \
+{   forward_##name##_op_0(i_z, arg, parameter, cap_order, taylor); }
+
+// wrapper for operators of the form
+// forward_name_op_0(i_z, arg, num_par, parameter, J, taylor)
+# define CPPAD_SWEEP_FORWARD0_DIRECT_NUM_PAR(name)                \
+template <class Base>                                             \
+void forward0_direct_##name(                                      \
+    CPPAD_SWEEP_FORWARD0_DIRECT_ARGS(Base) )                      \
+{   forward_##name##_op_0(i_z, arg, num_par, parameter, cap_order, taylor); }
+
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(abs)
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(acos)
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(asin)
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(atan)
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(cos)
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(cosh)
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(exp)
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(log)
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(sign)
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(sin)
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(sinh)
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(sqrt)
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(tan)
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(tanh)
+# if CPPAD_USE_CPLUSPLUS_2011
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(acosh)
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(asinh)
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(atanh)
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(expm1)
+CPPAD_SWEEP_FORWARD0_DIRECT_UNARY(log1p)
+# endif
+//
+CPPAD_SWEEP_FORWARD0_DIRECT_BINARY(addpv)
+CPPAD_SWEEP_FORWARD0_DIRECT_BINARY(addvv)
+CPPAD_SWEEP_FORWARD0_DIRECT_BINARY(divpv)
+CPPAD_SWEEP_FORWARD0_DIRECT_BINARY(divvp)
+CPPAD_SWEEP_FORWARD0_DIRECT_BINARY(divvv)
+CPPAD_SWEEP_FORWARD0_DIRECT_BINARY(mulpv)
+CPPAD_SWEEP_FORWARD0_DIRECT_BINARY(mulvv)
+CPPAD_SWEEP_FORWARD0_DIRECT_BINARY(powpv)
+CPPAD_SWEEP_FORWARD0_DIRECT_BINARY(powvp)
+CPPAD_SWEEP_FORWARD0_DIRECT_BINARY(powvv)
+CPPAD_SWEEP_FORWARD0_DIRECT_BINARY(subpv)
+CPPAD_SWEEP_FORWARD0_DIRECT_BINARY(subvp)
+CPPAD_SWEEP_FORWARD0_DIRECT_BINARY(subvv)
+CPPAD_SWEEP_FORWARD0_DIRECT_BINARY(zmulpv)
+CPPAD_SWEEP_FORWARD0_DIRECT_BINARY(zmulvp)
+CPPAD_SWEEP_FORWARD0_DIRECT_BINARY(zmulvv)
+//
+CPPAD_SWEEP_FORWARD0_DIRECT_NUM_PAR(cond)
+CPPAD_SWEEP_FORWARD0_DIRECT_NUM_PAR(par)
+
+# undef CPPAD_SWEEP_FORWARD0_DIRECT_UNARY
+# undef CPPAD_SWEEP_FORWARD0_DIRECT_BINARY
+# undef CPPAD_SWEEP_FORWARD0_DIRECT_NUM_PAR
+
+/// direct sweep wrapper for the CSumOp operator
+template <class Base>
+void forward0_direct_csum( CPPAD_SWEEP_FORWARD0_DIRECT_ARGS(Base) )
+{   forward_csum_op(0, 0, i_z, arg, num_par, parameter, cap_order, taylor); }
+
+/// direct sweep wrapper for the DisOp operator
+template <class Base>
+void forward0_direct_dis( CPPAD_SWEEP_FORWARD0_DIRECT_ARGS(Base) )
+{   forward_dis_op(0, 0, 1, i_z, arg, cap_order, taylor); }
+
+# if CPPAD_USE_CPLUSPLUS_2011
+/// direct sweep wrapper for the ErfOp operator
+template <class Base>
+void forward0_direct_erf( CPPAD_SWEEP_FORWARD0_DIRECT_ARGS(Base) )
+{   forward_erf_op_0(ErfOp, i_z, arg, parameter, cap_order, taylor); }
+
+/// direct sweep wrapper for the ErfcOp operator
+template <class Base>
+void forward0_direct_erfc( CPPAD_SWEEP_FORWARD0_DIRECT_ARGS(Base) )
+{   forward_erf_op_0(ErfcOp, i_z, arg, parameter, cap_order, taylor); }
+# endif
+
+/*!
+Pre-decoded operation sequence used for direct dispatch zero order forward.
+
+\tparam Base
+base type for the operator; i.e., this operation sequence was recorded
+using AD<Base> and computations by this routine are done using type Base.
+*/
+template <class Base>
+class forward0_direct {
+private:
+    /// function that evaluates one operator
+    typedef void (*op_fun_t)( CPPAD_SWEEP_FORWARD0_DIRECT_ARGS(Base) );
+    //
+    /// information for one operator that computes a value
+    struct struct_direct_op {
+        /// function that evaluates this operator
+        op_fun_t fun;
+        /// index of the primary result for this operator
+        size_t   i_z;
+        /// offset of the first argument for this operator in the player
+        size_t   i_arg;
+    };
+    //
+    /// operators that compute values, in order that they are evaluated
+    CppAD::vector<struct_direct_op> op_vec_;
+    //
+    /// has setup been called since the previous clear
+    bool setup_done_;
+    //
+    /// is this operation sequence supported
+    bool ok_;
+    //
+    /// does the operation sequence contain comparison operators
+    bool has_compare_;
+public:
+    /// default constructor
+    forward0_direct(void)
+    : setup_done_(false), ok_(false), has_compare_(false)
+    { }
+    /// free memory and set ok to false
+    void clear(void)
+    {   op_vec_.clear();
+        setup_done_  = false;
+        ok_          = false;
+        has_compare_ = false;
+    }
+    /// has setup been called since the previous clear
+    bool setup_done(void) const
+    {   return setup_done_; }
+    /// can forward0 be used
+    bool ok(void) const
+    {   return ok_; }
+    /// does this operation sequence have comparison operators
+    bool has_compare(void) const
+    {   return has_compare_; }
+    /// swap with another direct sweep object
+    void swap(forward0_direct& other)
+    {   op_vec_.swap(other.op_vec_);
+        std::swap(setup_done_, other.setup_done_);
+        std::swap(ok_, other.ok_);
+        std::swap(has_compare_, other.has_compare_);
+    }
+    // -----------------------------------------------------------------------
+    /*!
+    decode an operation sequence
+
+    \param play
+    is the operation sequence that is decoded.
+    */
+    void setup(const player<Base>* play)
+    {   clear();
+        //
+        // skip the BeginOp at the beginning of the recording
+        play::const_sequential_iterator itr = play->begin();
+        OpCode        op;
+        size_t        i_var;
+        const addr_t* arg;
+        itr.op_info(op, arg, i_var);
+        CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+        //
+        // arguments are stored as offsets from the first argument
+        const addr_t* arg_0 = arg;
+        //
+        setup_done_         = true;
+        ok_                 = true;
+        bool more_operators = true;
+        while( more_operators & ok_ )
+        {   (++itr).op_info(op, arg, i_var);
+            op_fun_t fun = CPPAD_NULL;
+            switch( op )
+            {
+                case AbsOp:    fun = forward0_direct_abs<Base>;    break;
+                case AcosOp:   fun = forward0_direct_acos<Base>;   break;
+                case AddpvOp:  fun = forward0_direct_addpv<Base>;  break;
+                case AddvvOp:  fun = forward0_direct_addvv<Base>;  break;
+                case AsinOp:   fun = forward0_direct_asin<Base>;   break;
+                case AtanOp:   fun = forward0_direct_atan<Base>;   break;
+                case CExpOp:   fun = forward0_direct_cond<Base>;   break;
+                case CosOp:    fun = forward0_direct_cos<Base>;    break;
+                case CoshOp:   fun = forward0_direct_cosh<Base>;   break;
+                case DisOp:    fun = forward0_direct_dis<Base>;    break;
+                case DivpvOp:  fun = forward0_direct_divpv<Base>;  break;
+                case DivvpOp:  fun = forward0_direct_divvp<Base>;  break;
+                case DivvvOp:  fun = forward0_direct_divvv<Base>;  break;
+                case ExpOp:    fun = forward0_direct_exp<Base>;    break;
+                case LogOp:    fun = forward0_direct_log<Base>;    break;
+                case MulpvOp:  fun = forward0_direct_mulpv<Base>;  break;
+                case MulvvOp:  fun = forward0_direct_mulvv<Base>;  break;
+                case ParOp:    fun = forward0_direct_par<Base>;    break;
+                case PowpvOp:  fun = forward0_direct_powpv<Base>;  break;
+                case PowvpOp:  fun = forward0_direct_powvp<Base>;  break;
+                case PowvvOp:  fun = forward0_direct_powvv<Base>;  break;
+                case SignOp:   fun = forward0_direct_sign<Base>;   break;
+                case SinOp:    fun = forward0_direct_sin<Base>;    break;
+                case SinhOp:   fun = forward0_direct_sinh<Base>;   break;
+                case SqrtOp:   fun = forward0_direct_sqrt<Base>;   break;
+                case SubpvOp:  fun = forward0_direct_subpv<Base>;  break;
+                case SubvpOp:  fun = forward0_direct_subvp<Base>;  break;
+                case SubvvOp:  fun = forward0_direct_subvv<Base>;  break;
+                case TanOp:    fun = forward0_direct_tan<Base>;    break;
+                case TanhOp:   fun = forward0_direct_tanh<Base>;   break;
+                case ZmulpvOp: fun = forward0_direct_zmulpv<Base>; break;
+                case ZmulvpOp: fun = forward0_direct_zmulvp<Base>; break;
+                case ZmulvvOp: fun = forward0_direct_zmulvv<Base>; break;
+# if CPPAD_USE_CPLUSPLUS_2011
+                case AcoshOp:  fun = forward0_direct_acosh<Base>;  break;
+                case AsinhOp:  fun = forward0_direct_asinh<Base>;  break;
+                case AtanhOp:  fun = forward0_direct_atanh<Base>;  break;
+                case ErfOp:    fun = forward0_direct_erf<Base>;    break;
+                case ErfcOp:   fun = forward0_direct_erfc<Base>;   break;
+                case Expm1Op:  fun = forward0_direct_expm1<Base>;  break;
+                case Log1pOp:  fun = forward0_direct_log1p<Base>;  break;
+# endif
+                // -------------------------------------------------------
+                case CSumOp:
+                fun = forward0_direct_csum<Base>;
+                itr.correct_before_increment();
+                break;
+                // -------------------------------------------------------
+
+                case EqppOp:
+                case EqpvOp:
+                case EqvvOp:
+                case LeppOp:
+                case LepvOp:
+                case LevpOp:
+                case LevvOp:
+                case LtppOp:
+                case LtpvOp:
+                case LtvpOp:
+                case LtvvOp:
+                case NeppOp:
+                case NepvOp:
+                case NevvOp:
+                has_compare_ = true;
+                break;
+                // -------------------------------------------------------
+
+                case InvOp:
+                // values for independent variables are set by caller
+                break;
+                // -------------------------------------------------------
+
+                case EndOp:
+                more_operators = false;
+                break;
+                // -------------------------------------------------------
+
+                default:
+                // CSkipOp, VecAD, atomic function, and print operators
+                ok_ = false;
+                break;
+            }
+            if( fun != CPPAD_NULL )
+            {   struct_direct_op info;
+                info.fun   = fun;
+                info.i_z   = i_var;
+                info.i_arg = size_t(arg - arg_0);
+                op_vec_.push_back(info);
+            }
+        }
+        if( ! ok_ )
+            op_vec_.clear();
+    }
+    // -----------------------------------------------------------------------
+    /*!
+    zero order forward sweep using the decoded operation sequence
+
+    \param play
+    operation sequence with the same operators as in the previous setup.
+
+    \param J
+    number of columns in the Taylor coefficient matrix.
+
+    \param taylor
+    On input, the zero order coefficients for the independent variables.
+    On output, the zero order coefficients for all the variables.
+    */
+    void forward0(const player<Base>* play, size_t J, Base* taylor) const
+    {   CPPAD_ASSERT_UNKNOWN( ok_ );
+        CPPAD_ASSERT_UNKNOWN( J >= 1 );
+        //
+        // first argument in the recording
+        play::const_sequential_iterator itr = play->begin();
+        OpCode        op;
+        size_t        i_var;
+        const addr_t* arg_0;
+        itr.op_info(op, arg_0, i_var);
+        CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+        //
+        const size_t num_par   = play->num_par_rec();
+        const Base*  parameter = play->GetPar();
+        //
+        size_t                  n_op = op_vec_.size();
+        const struct_direct_op* info = op_vec_.data();
+        for(size_t i = 0; i < n_op; ++i)
+        {   info[i].fun(
+                info[i].i_z, arg_0 + info[i].i_arg, num_par, parameter,
+                J, taylor
+            );
+        }
+    }
+};
+
+# undef CPPAD_SWEEP_FORWARD0_DIRECT_ARGS
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
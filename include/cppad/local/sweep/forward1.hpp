@@ -207,13 +207,22 @@ void forward1(
     {   size_t i;
 
         // this includes order zero calculation, initialize vector indices
+        // (only for vectors that have store operators, loads from the
+        // other vectors use the recording directly)
         size_t num = play->num_var_vecad_ind_rec();
         if( num > 0 )
         {   vec_ad2isvar.extend(num);
             vec_ad2index.extend(num);
-            for(i = 0; i < num; i++)
-            {   vec_ad2index[i] = play->GetVecInd(i);
-                vec_ad2isvar[i] = false;
+            i = 0;
+            while( i < num )
+            {   size_t i_end = i + play->GetVecInd(i) + 1;
+                if( play->vecad_store(i) )
+                {   for(size_t k = i; k < i_end; ++k)
+                    {   vec_ad2index[k] = play->GetVecInd(k);
+                        vec_ad2isvar[k] = false;
+                    }
+                }
+                i = i_end;
             }
         }
         // includes zero order, so initialize conditional skip flags
@@ -281,6 +290,10 @@ void forward1(
 # endif
     //
     bool flag; // a temporary flag to use in switch cases
+    size_t skip_case; // which CSkipOp list is skipped (if any)
+    // ranges of skipped operators (see player::cskip_push)
+    pod_vector<addr_t> cskip_pending;
+    //
     bool more_operators = true;
     while(more_operators)
     {
@@ -290,34 +303,27 @@ void forward1(
 
         // check if we are skipping this operation
         while( cskip_op[itr.op_index()] )
-        {   switch(op)
-            {
-                case AFunOp:
-                {   // get information for this atomic function call
-                    CPPAD_ASSERT_UNKNOWN( atom_state == start_atom );
-                    play::atom_op_info<Base>(
-                        op, arg, atom_index, atom_old, atom_m, atom_n
-                    );
-                    //
-                    // skip to the second AFunOp
-                    for(i = 0; i < atom_m + atom_n + 1; ++i)
-                        ++itr;
+        {   if( op == AFunOp )
+            {   // get information for this atomic function call
+                CPPAD_ASSERT_UNKNOWN( atom_state == start_atom );
+                play::atom_op_info<Base>(
+                    op, arg, atom_index, atom_old, atom_m, atom_n
+                );
+                //
+                // skip to the second AFunOp
+                for(i = 0; i < atom_m + atom_n + 1; ++i)
+                    ++itr;
 # ifndef NDEBUG
-                    itr.op_info(op, arg, i_var);
-                    CPPAD_ASSERT_UNKNOWN( op == AFunOp );
+                itr.op_info(op, arg, i_var);
+                CPPAD_ASSERT_UNKNOWN( op == AFunOp );
 # endif
-                }
-                break;
-
-                case CSkipOp:
-                case CSumOp:
-                itr.correct_before_increment();
-                break;
-
-                default:
-                break;
+                ++itr;
             }
-            (++itr).op_info(op, arg, i_var);
+            else
+            {   // jump over this block of skipped operators
+                play->cskip_jump(itr, cskip_pending);
+            }
+            itr.op_info(op, arg, i_var);
         }
 
         // action depends on the operator
@@ -410,10 +416,18 @@ void forward1(
 
             case CSkipOp:
             if( p == 0 )
-            {   forward_cskip_op_0(
+            {   skip_case = forward_cskip_op_0(
                     i_var, arg, num_par, parameter, J, taylor, cskip_op
                 );
             }
+            else
+            {   // cskip_op was set by a previous zero order sweep
+                skip_case = forward_cskip_op_case(
+                    i_var, arg, num_par, parameter, J, taylor
+                );
+            }
+            if( skip_case != 0 )
+                play->cskip_push(itr.op_index(), skip_case, cskip_pending);
             itr.correct_before_increment();
             break;
             // -------------------------------------------------
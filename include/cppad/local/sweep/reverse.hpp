@@ -1,7 +1,7 @@
 # ifndef CPPAD_LOCAL_SWEEP_REVERSE_HPP
 # define CPPAD_LOCAL_SWEEP_REVERSE_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -14,6 +14,7 @@ in the Eclipse Public License, Version 2.0 are satisfied:
 
 
 # include <cppad/local/play/atom_op_info.hpp>
+# include <cppad/local/sweep/atom_batch.hpp>
 
 // BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
 namespace CppAD { namespace local { namespace sweep {
@@ -209,6 +210,10 @@ void reverse(
     // information defined by atomic forward
     size_t atom_index=0, atom_old=0, atom_m=0, atom_n=0, atom_i=0, atom_j=0;
     enum_atom_state atom_state = end_atom; // proper initialization
+    //
+    // first order calls to atomic functions that are evaluated as a batch
+    // (see atom_batch.hpp)
+    atom_batch<Base, RecBase> atom_pending;
 
     // temporary indices
     size_t j, ell;
@@ -254,6 +259,11 @@ void reverse(
             (--play_itr).op_info(op, arg, i_var);
             i_op = play_itr.op_index();
         }
+        //
+        // evaluate pending atomic calls before the partials for their
+        // argument variables are used
+        if( i_var < atom_pending.flush_var() )
+            atom_pending.reverse_flush(K, Partial);
 # if CPPAD_REVERSE_TRACE
         size_t       i_tmp  = i_var;
         const Base*  Z_tmp  = Taylor + i_var * J;
@@ -681,22 +691,36 @@ void reverse(
                 CPPAD_ASSERT_UNKNOWN( atom_j == 0  );
                 atom_state = end_atom;
                 //
-                // call atomic function for this operation
-                call_atomic_reverse<Base, RecBase>(
+                // add this first order call to the pending batch
+                flag = d == 0 && atom_pending.reverse_add(
+                    atom_index,
                     atom_par_x,
                     atom_type_x,
-                    atom_k,
-                    atom_index,
-                    atom_old,
+                    atom_ix,
                     atom_tx,
                     atom_ty,
-                    atom_px,
-                    atom_py
+                    atom_py,
+                    K,
+                    Partial
                 );
-                for(j = 0; j < atom_n; j++) if( atom_ix[j] > 0 )
-                {   for(ell = 0; ell < atom_k1; ell++)
-                        Partial[atom_ix[j] * K + ell] +=
-                            atom_px[j * atom_k1 + ell];
+                if( ! flag )
+                {   // call atomic function for this operation
+                    call_atomic_reverse<Base, RecBase>(
+                        atom_par_x,
+                        atom_type_x,
+                        atom_k,
+                        atom_index,
+                        atom_old,
+                        atom_tx,
+                        atom_ty,
+                        atom_px,
+                        atom_py
+                    );
+                    for(j = 0; j < atom_n; j++) if( atom_ix[j] > 0 )
+                    {   for(ell = 0; ell < atom_k1; ell++)
+                            Partial[atom_ix[j] * K + ell] +=
+                                atom_px[j * atom_k1 + ell];
+                    }
                 }
             }
             break;
@@ -808,6 +832,8 @@ void reverse(
             CPPAD_ASSERT_UNKNOWN(false);
         }
     }
+    // pending calls that do not have variable arguments
+    atom_pending.reverse_flush(K, Partial);
 # if CPPAD_REVERSE_TRACE
     std::cout << std::endl;
 # endif
@@ -0,0 +1,1216 @@
+# ifndef CPPAD_LOCAL_SWEEP_REVERSE_BUDGET_HPP
+# define CPPAD_LOCAL_SWEEP_REVERSE_BUDGET_HPP
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+
+# include <algorithm>
+# include <cppad/local/play/player.hpp>
+
+// BEGIN_CPPAD_LOCAL_SWEEP_NAMESPACE
+namespace CppAD { namespace local { namespace sweep {
+/*!
+\file sweep/reverse_budget.hpp
+First order reverse mode using a bounded amount of memory.
+*/
+
+/*
+ ------------------------------------------------------------------------------
+$begin sweep_reverse_budget$$
+$spell
+    Taylor
+    numvar
+    op
+    Pri
+    Vec
+    bool
+    const
+    dw
+    taddr
+    cskip
+$$
+$section First Order Reverse Mode Using a Bounded Amount of Memory$$
+
+$head Syntax$$
+$icode%ok% = reverse_budget(
+    %play%, %max_bytes%, %n%, %x%, %m%, %dep_taddr%, %w%, %dw%
+)%$$
+
+$head Prototype$$
+$srcthisfile%
+    0%// BEGIN_PROTOTYPE%// END_PROTOTYPE%1
+%$$
+
+$head Purpose$$
+The $cref sweep_forward0$$ and $code sweep::reverse$$ routines
+store the value, and partial derivative, for every variable in the
+operation sequence.
+This routine computes the same derivative
+using a number of bytes that can be much smaller.
+
+$head Method$$
+The operators are split into contiguous segments.
+A variable is a $icode checkpoint$$ if it is a dependent variable,
+or if it is used by an operator in a later segment than the one
+that created it.
+The forward sweep evaluates one segment at a time and only keeps the
+values of the checkpoint variables.
+The reverse sweep processes the segments in reverse order.
+For each segment, it recomputes the values of the segment's variables
+from the checkpoint values, and then computes their partials
+(accumulating the partials for checkpoint variables in earlier segments).
+The values and partials for the variables in one segment,
+and for all the checkpoint variables, are stored at the same time.
+The segment size is halved until this memory is less than or equal
+$icode max_bytes$$ or halving no longer reduces the memory.
+
+$head Base$$
+The type used during the forward mode computations; i.e., the corresponding
+recording of operations used the type $codei%AD<%Base%>%$$.
+
+$head play$$
+is the operation sequence that is differentiated.
+
+$head max_bytes$$
+is the requested bound on the number of bytes allocated by this routine.
+
+$head n$$
+is the number of independent variables.
+The independent variable indices are $codei%1%, ... , %n%$$.
+
+$head x$$
+is a vector of length $icode n$$ containing the value of the
+independent variables.
+
+$head m$$
+is the number of dependent variables.
+
+$head dep_taddr$$
+is a vector of length $icode m$$ containing the variable index
+for each of the dependent variables.
+
+$head w$$
+is a vector of length $icode m$$ containing the weights for the
+dependent variables.
+
+$head dw$$
+is a vector of length $icode n$$.
+If $icode ok$$ is true, the input value of its elements do not matter and
+upon return it contains the derivative of
+$latex w^\R{T} F(x)$$ with respect to $icode x$$.
+
+$head ok$$
+If $icode ok$$ is false,
+the operation sequence contains an operator that is not supported by
+this routine; i.e., a $cref VecAD$$ or $cref atomic$$ operator.
+In this case, $icode dw$$ is not changed.
+
+$head Comparison Operators$$
+Comparison operators are not evaluated by this routine.
+
+$head Conditional Skip$$
+Conditional skip operators are ignored by this routine; i.e.,
+all the operators are evaluated.
+
+$head Print Operators$$
+Print operators are ignored by this routine.
+
+$end
+*/
+
+/*!
+Number of bytes that thread_alloc uses for an allocation.
+
+\param n_byte
+is the number of bytes requested (a pod_vector with no elements
+does not allocate any memory).
+*/
+inline size_t reverse_budget_capacity(size_t n_byte)
+{   if( n_byte == 0 )
+        return 0;
+    return thread_alloc::capacity_for(n_byte);
+}
+
+/*!
+Advance a sequential iterator to the next operator.
+
+\param itr [in,out]
+is the iterator that is advanced. This includes the correction for
+CSumOp and CSkipOp operators.
+*/
+inline void reverse_budget_next(play::const_sequential_iterator& itr)
+{   OpCode        op;
+    const addr_t* arg;
+    size_t        i_var;
+    itr.op_info(op, arg, i_var);
+    if( op == CSumOp || op == CSkipOp )
+        itr.correct_before_increment();
+    ++itr;
+}
+
+/*!
+Back up a sequential iterator to the previous operator.
+
+\param itr [in,out]
+is the iterator that is backed up. This includes the correction for
+CSumOp and CSkipOp operators.
+*/
+inline void reverse_budget_previous(play::const_sequential_iterator& itr)
+{   OpCode        op;
+    const addr_t* arg;
+    size_t        i_var;
+    (--itr).op_info(op, arg, i_var);
+    if( op == CSumOp || op == CSkipOp )
+        itr.correct_after_decrement(arg);
+}
+
+/*!
+Split the operation sequence into segments and determine checkpoints.
+
+\param play
+is the operation sequence.
+
+\param L
+is the maximum number of variables in a segment. A segment can have
+more variables when one operator has more than L results.
+
+\param m
+is the number of dependent variables.
+
+\param dep_taddr
+is the variable index for each of the dependent variables.
+
+\param seg_op [out]
+has size num_seg + 1. For s < num_seg, seg_op[s] is the index of the
+first operator in segment s. The value seg_op[num_seg] is the
+number of operators.
+
+\param seg_var [out]
+has size num_seg + 1. For s < num_seg, seg_var[s] is the index of the
+first variable in segment s. The value seg_var[num_seg] is the
+number of variables.
+
+\param ext [out]
+is the sorted vector of checkpoint variable indices.
+
+\param n_window [out]
+is the maximum number of variables in a segment.
+
+\param n_arg [out]
+is the maximum number of arguments for an operator.
+
+\return
+is false if the operation sequence has an operator that is not supported.
+*/
+template <class Base>
+bool reverse_budget_segment(
+    const player<Base>* play      ,
+    size_t              L         ,
+    size_t              m         ,
+    const size_t*       dep_taddr ,
+    pod_vector<size_t>& seg_op    ,
+    pod_vector<size_t>& seg_var   ,
+    pod_vector<addr_t>& ext       ,
+    size_t&             n_window  ,
+    size_t&             n_arg     )
+{   CPPAD_ASSERT_UNKNOWN( L > 0 );
+    //
+    seg_op.resize(0);
+    seg_var.resize(0);
+    ext.resize(0);
+    n_window = 1;
+    n_arg    = 0;
+    //
+    // the first segment starts with the BeginOp
+    seg_op.push_back(0);
+    seg_var.push_back(0);
+    size_t v_begin  = 0;
+    //
+    // number of elements at the beginning of ext that are sorted and unique
+    size_t n_sorted = 0;
+    //
+    pod_vector<bool> is_variable;
+    play::const_sequential_iterator itr = play->begin();
+    OpCode        op;
+    size_t        i_var;
+    const addr_t* arg;
+    itr.op_info(op, arg, i_var);
+    CPPAD_ASSERT_UNKNOWN( op == BeginOp );
+    while( op != EndOp )
+    {   reverse_budget_next(itr);
+        itr.op_info(op, arg, i_var);
+        // arguments that are not used by reverse_budget_forward
+        bool ignore = false;
+        switch( op )
+        {   case CSkipOp:
+            case PriOp:
+            case EqppOp:
+            case EqpvOp:
+            case EqvvOp:
+            case LeppOp:
+            case LepvOp:
+            case LevpOp:
+            case LevvOp:
+            case LtppOp:
+            case LtpvOp:
+            case LtvpOp:
+            case LtvvOp:
+            case NeppOp:
+            case NepvOp:
+            case NevvOp:
+            ignore = true;
+            break;
+
+            case AFunOp:
+            case FunapOp:
+            case FunavOp:
+            case FunrpOp:
+            case FunrvOp:
+            case LdpOp:
+            case LdvOp:
+            case StppOp:
+            case StpvOp:
+            case StvpOp:
+            case StvvOp:
+            return false;
+
+            default:
+            break;
+        }
+        // start a new segment if this operator's results would make
+        // the current one larger than L (and the current one is not empty)
+        size_t n_res     = NumRes(op);
+        bool   new_seg   = n_res > 0 && i_var + 1 - v_begin > L;
+        new_seg         &= i_var + 1 - n_res > v_begin;
+        if( new_seg )
+        {   // sort the new checkpoints and merge them with the previous ones
+            addr_t* data = ext.data();
+            std::sort(data + n_sorted, data + ext.size());
+            std::inplace_merge(data, data + n_sorted, data + ext.size());
+            n_sorted = size_t( std::unique(data, data + ext.size()) - data );
+            ext.resize(n_sorted);
+            //
+            v_begin = i_var + 1 - n_res;
+            seg_op.push_back( itr.op_index() );
+            seg_var.push_back( v_begin );
+        }
+        n_window = std::max(n_window, i_var + 1 - v_begin);
+        //
+        if( ! ignore )
+        {   arg_is_variable(op, arg, is_variable);
+            n_arg = std::max(n_arg, is_variable.size() + 1);
+            for(size_t j = 0; j < is_variable.size(); ++j)
+            {   if( is_variable[j] && size_t(arg[j]) < v_begin )
+                    ext.push_back( arg[j] );
+            }
+        }
+    }
+    CPPAD_ASSERT_UNKNOWN( itr.op_index() + 1 == play->num_op_rec() );
+    //
+    // dependent variables are checkpoints
+    for(size_t i = 0; i < m; ++i)
+        ext.push_back( addr_t( dep_taddr[i] ) );
+    addr_t* data = ext.data();
+    std::sort(data + n_sorted, data + ext.size());
+    std::inplace_merge(data, data + n_sorted, data + ext.size());
+    ext.resize( size_t( std::unique(data, data + ext.size()) - data ) );
+    //
+    seg_op.push_back( play->num_op_rec() );
+    seg_var.push_back( play->num_var_rec() );
+    //
+    return true;
+}
+
+/*!
+Copy of the arguments for an operator with variable indices mapped to the
+compact storage used by reverse_budget.
+
+\param op
+is the operator.
+
+\param arg
+is the argument vector for this operator.
+
+\param v_begin
+is the index of the first variable in the current segment.
+Variables with index greater than or equal v_begin are in the current segment
+and are stored at index n_ext + (variable index - v_begin).
+Variables with index less than v_begin are checkpoints
+and are stored at their index in ext.
+
+\param ext
+is the sorted vector of checkpoint variable indices.
+
+\param is_variable
+work space used to determine which arguments are variables.
+
+\param arg_local [out]
+work space that holds the mapped arguments
+(its size must be large enough for the arguments to this operator).
+
+\return
+is arg_local.data().
+*/
+inline const addr_t* reverse_budget_arg(
+    OpCode                    op           ,
+    const addr_t*             arg          ,
+    size_t                    v_begin      ,
+    const pod_vector<addr_t>& ext          ,
+    pod_vector<bool>&         is_variable  ,
+    pod_vector<addr_t>&       arg_local    )
+{   size_t n_ext = ext.size();
+    arg_is_variable(op, arg, is_variable);
+    size_t num_arg = is_variable.size();
+    //
+    // CSumOp has the number of arguments stored after its arguments
+    if( op == CSumOp )
+        ++num_arg;
+    CPPAD_ASSERT_UNKNOWN( num_arg <= arg_local.size() );
+    for(size_t j = 0; j < num_arg; ++j)
+    {   addr_t a = arg[j];
+        if( j < is_variable.size() && is_variable[j] )
+        {   if( size_t(a) >= v_begin )
+                a = addr_t( n_ext + size_t(a) - v_begin );
+            else
+            {   const addr_t* ptr = std::lower_bound(
+                    ext.data(), ext.data() + n_ext, a
+                );
+                CPPAD_ASSERT_UNKNOWN( ptr < ext.data() + n_ext );
+                CPPAD_ASSERT_UNKNOWN( *ptr == a );
+                a = addr_t( ptr - ext.data() );
+            }
+        }
+        arg_local[j] = a;
+    }
+    return arg_local.data();
+}
+
+/*!
+Zero order forward mode for one segment.
+
+\param play
+is the operation sequence.
+
+\param itr [in,out]
+On input it points to the first operator in the segment.
+Upon return it points to the last operator in the segment.
+
+\param op_end
+is the index of the first operator after the segment.
+
+\param v_begin
+is the index of the first variable in the segment.
+
+\param ext
+is the sorted vector of checkpoint variable indices.
+
+\param x
+is the value of the independent variables.
+
+\param is_variable
+work space used to determine which arguments are variables.
+
+\param arg_local
+work space used to map the arguments for each operator.
+
+\param taylor [in,out]
+On input, the first ext.size() elements are the values of the checkpoints
+in previous segments. Upon return, the next elements are the values of the
+variables in this segment.
+*/
+template <class Base>
+void reverse_budget_forward(
+    const player<Base>*               play        ,
+    play::const_sequential_iterator&  itr         ,
+    size_t                            op_end      ,
+    size_t                            v_begin     ,
+    const pod_vector<addr_t>&         ext         ,
+    const Base*                       x           ,
+    pod_vector<bool>&                 is_variable ,
+    pod_vector<addr_t>&               arg_local   ,
+    Base*                             taylor      )
+{   //
+    // length of the parameter vector (used by CppAD assert macros)
+    const size_t num_par = play->num_par_rec();
+    //
+    // pointer to the beginning of the parameter vector
+    CPPAD_ASSERT_UNKNOWN( num_par > 0 )
+    const Base* parameter = play->GetPar();
+    //
+    // use p, q, r so discrete function operator is the same as in forward0
+    size_t p = 0;
+    size_t q = 0;
+    size_t r = 1;
+    //
+    // one value per variable
+    const size_t J = 1;
+    //
+    // index in taylor of the first variable in this segment
+    const size_t n_ext = ext.size();
+    //
+    OpCode        op;
+    size_t        i_var;
+    const addr_t* arg;
+    itr.op_info(op, arg, i_var);
+    while( true )
+    {   // index of the result for this operator in taylor
+        size_t i_z = n_ext + i_var - v_begin;
+        switch( op )
+        {
+            case BeginOp:
+            case CSkipOp:
+            case PriOp:
+            case EndOp:
+            case EqppOp:
+            case EqpvOp:
+            case EqvvOp:
+            case LeppOp:
+            case LepvOp:
+            case LevpOp:
+            case LevvOp:
+            case LtppOp:
+            case LtpvOp:
+            case LtvpOp:
+            case LtvvOp:
+            case NeppOp:
+            case NepvOp:
+            case NevvOp:
+            break;
+            // -------------------------------------------------
+
+            case InvOp:
+            CPPAD_ASSERT_UNKNOWN( 0 < i_var );
+            taylor[i_z] = x[i_var - 1];
+            break;
+            // -------------------------------------------------
+
+            default:
+            arg = reverse_budget_arg(
+                op, arg, v_begin, ext, is_variable, arg_local
+            );
+            break;
+        }
+        switch( op )
+        {
+            case AbsOp:
+            forward_abs_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+
+            case AddvvOp:
+            forward_addvv_op_0(i_z, arg, parameter, J, taylor);
+            break;
+
+            case AddpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            forward_addpv_op_0(i_z, arg, parameter, J, taylor);
+            break;
+
+            case AcosOp:
+            forward_acos_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case AcoshOp:
+            forward_acosh_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+# endif
+
+            case AsinOp:
+            forward_asin_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case AsinhOp:
+            forward_asinh_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+# endif
+
+            case AtanOp:
+            forward_atan_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case AtanhOp:
+            forward_atanh_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+# endif
+
+            case CExpOp:
+            forward_cond_op_0(i_z, arg, num_par, parameter, J, taylor);
+            break;
+
+            case CosOp:
+            forward_cos_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+
+            case CoshOp:
+            forward_cosh_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+
+            case CSumOp:
+            forward_csum_op(0, 0, i_z, arg, num_par, parameter, J, taylor);
+            break;
+
+            case DisOp:
+            forward_dis_op(p, q, r, i_z, arg, J, taylor);
+            break;
+
+            case DivvvOp:
+            forward_divvv_op_0(i_z, arg, parameter, J, taylor);
+            break;
+
+            case DivpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            forward_divpv_op_0(i_z, arg, parameter, J, taylor);
+            break;
+
+            case DivvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            forward_divvp_op_0(i_z, arg, parameter, J, taylor);
+            break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case ErfOp:
+            case ErfcOp:
+            forward_erf_op_0(op, i_z, arg, parameter, J, taylor);
+            break;
+# endif
+
+            case ExpOp:
+            forward_exp_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case Expm1Op:
+            forward_expm1_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+# endif
+
+            case LogOp:
+            forward_log_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case Log1pOp:
+            forward_log1p_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+# endif
+
+            case MulpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            forward_mulpv_op_0(i_z, arg, parameter, J, taylor);
+            break;
+
+            case MulvvOp:
+            forward_mulvv_op_0(i_z, arg, parameter, J, taylor);
+            break;
+
+            case ParOp:
+            forward_par_op_0(i_z, arg, num_par, parameter, J, taylor);
+            break;
+
+            case PowvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            forward_powvp_op_0(i_z, arg, parameter, J, taylor);
+            break;
+
+            case PowpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            forward_powpv_op_0(i_z, arg, parameter, J, taylor);
+            break;
+
+            case PowvvOp:
+            forward_powvv_op_0(i_z, arg, parameter, J, taylor);
+            break;
+
+            case SignOp:
+            forward_sign_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+
+            case SinOp:
+            forward_sin_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+
+            case SinhOp:
+            forward_sinh_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+
+            case SqrtOp:
+            forward_sqrt_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+
+            case SubvvOp:
+            forward_subvv_op_0(i_z, arg, parameter, J, taylor);
+            break;
+
+            case SubpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            forward_subpv_op_0(i_z, arg, parameter, J, taylor);
+            break;
+
+            case SubvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            forward_subvp_op_0(i_z, arg, parameter, J, taylor);
+            break;
+
+            case TanOp:
+            forward_tan_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+
+            case TanhOp:
+            forward_tanh_op_0(i_z, size_t(arg[0]), J, taylor);
+            break;
+
+            case ZmulpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            forward_zmulpv_op_0(i_z, arg, parameter, J, taylor);
+            break;
+
+            case ZmulvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            forward_zmulvp_op_0(i_z, arg, parameter, J, taylor);
+            break;
+
+            case ZmulvvOp:
+            forward_zmulvv_op_0(i_z, arg, parameter, J, taylor);
+            break;
+
+            default:
+            // operators that do not compute a value (see switch above)
+            CPPAD_ASSERT_UNKNOWN(
+                NumRes(op) == 0 || op == BeginOp || op == InvOp
+            );
+            break;
+        }
+        if( itr.op_index() + 1 == op_end )
+            return;
+        reverse_budget_next(itr);
+        itr.op_info(op, arg, i_var);
+    }
+}
+
+/*!
+First order reverse mode for one segment.
+
+\param play
+is the operation sequence.
+
+\param itr [in,out]
+On input it points to the last operator in the segment.
+Upon return it points to the first operator in the segment.
+
+\param op_begin
+is the index of the first operator in the segment.
+
+\param v_begin
+is the index of the first variable in the segment.
+
+\param ext
+is the sorted vector of checkpoint variable indices.
+
+\param is_variable
+work space used to determine which arguments are variables.
+
+\param arg_local
+work space used to map the arguments for each operator.
+
+\param taylor
+is the value of the checkpoints and the variables in this segment;
+see reverse_budget_forward.
+
+\param partial [in,out]
+has the same layout as taylor. On input, it contains the partials for
+the variables in this segment. Upon return, the partials for the
+arguments of the operators in this segment have been added to it.
+*/
+template <class Base>
+void reverse_budget_reverse(
+    const player<Base>*               play        ,
+    play::const_sequential_iterator&  itr         ,
+    size_t                            op_begin    ,
+    size_t                            v_begin     ,
+    const pod_vector<addr_t>&         ext         ,
+    pod_vector<bool>&                 is_variable ,
+    pod_vector<addr_t>&               arg_local   ,
+    const Base*                       taylor      ,
+    Base*                             partial     )
+{   //
+    // length of the parameter vector (used by CppAD assert macros)
+    const size_t num_par = play->num_par_rec();
+    //
+    // pointer to the beginning of the parameter vector
+    CPPAD_ASSERT_UNKNOWN( num_par > 0 )
+    const Base* parameter = play->GetPar();
+    //
+    // first order reverse mode
+    const size_t d = 0;
+    const size_t J = 1;
+    const size_t K = 1;
+    //
+    // index in taylor of the first variable in this segment
+    const size_t n_ext = ext.size();
+    //
+    OpCode        op;
+    size_t        i_var;
+    const addr_t* arg;
+    itr.op_info(op, arg, i_var);
+    while( true )
+    {   // index of the result for this operator in taylor and partial
+        size_t i_z = n_ext + i_var - v_begin;
+        switch( op )
+        {
+            case BeginOp:
+            case CSkipOp:
+            case DisOp:
+            case PriOp:
+            case EndOp:
+            case InvOp:
+            case ParOp:
+            case EqppOp:
+            case EqpvOp:
+            case EqvvOp:
+            case LeppOp:
+            case LepvOp:
+            case LevpOp:
+            case LevvOp:
+            case LtppOp:
+            case LtpvOp:
+            case LtvpOp:
+            case LtvvOp:
+            case NeppOp:
+            case NepvOp:
+            case NevvOp:
+            break;
+
+            default:
+            arg = reverse_budget_arg(
+                op, arg, v_begin, ext, is_variable, arg_local
+            );
+            break;
+        }
+        switch( op )
+        {
+            case AbsOp:
+            reverse_abs_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+
+            case AcosOp:
+            reverse_acos_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case AcoshOp:
+            reverse_acosh_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+# endif
+
+            case AddvvOp:
+            reverse_addvv_op(
+                d, i_z, arg, parameter, J, taylor, K, partial
+            );
+            break;
+
+            case AddpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            reverse_addpv_op(
+                d, i_z, arg, parameter, J, taylor, K, partial
+            );
+            break;
+
+            case AsinOp:
+            reverse_asin_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case AsinhOp:
+            reverse_asinh_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+# endif
+
+            case AtanOp:
+            reverse_atan_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case AtanhOp:
+            reverse_atanh_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+# endif
+
+            case CSumOp:
+            reverse_csum_op(
+                d, i_z, arg, K, partial
+            );
+            break;
+
+            case CExpOp:
+            reverse_cond_op(
+                d, i_z, arg, num_par, parameter, J, taylor, K, partial
+            );
+            break;
+
+            case CosOp:
+            reverse_cos_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+
+            case CoshOp:
+            reverse_cosh_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+
+            case DivvvOp:
+            reverse_divvv_op(
+                d, i_z, arg, parameter, J, taylor, K, partial
+            );
+            break;
+
+            case DivpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            reverse_divpv_op(
+                d, i_z, arg, parameter, J, taylor, K, partial
+            );
+            break;
+
+            case DivvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            reverse_divvp_op(
+                d, i_z, arg, parameter, J, taylor, K, partial
+            );
+            break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case ErfOp:
+            case ErfcOp:
+            reverse_erf_op(
+                op, d, i_z, arg, parameter, J, taylor, K, partial
+            );
+            break;
+# endif
+
+            case ExpOp:
+            reverse_exp_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case Expm1Op:
+            reverse_expm1_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+# endif
+
+            case LogOp:
+            reverse_log_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+
+# if CPPAD_USE_CPLUSPLUS_2011
+            case Log1pOp:
+            reverse_log1p_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+# endif
+
+            case MulpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            reverse_mulpv_op(
+                d, i_z, arg, parameter, J, taylor, K, partial
+            );
+            break;
+
+            case MulvvOp:
+            reverse_mulvv_op(
+                d, i_z, arg, parameter, J, taylor, K, partial
+            );
+            break;
+
+            case PowvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            reverse_powvp_op(
+                d, i_z, arg, parameter, J, taylor, K, partial
+            );
+            break;
+
+            case PowpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            reverse_powpv_op(
+                d, i_z, arg, parameter, J, taylor, K, partial
+            );
+            break;
+
+            case PowvvOp:
+            reverse_powvv_op(
+                d, i_z, arg, parameter, J, taylor, K, partial
+            );
+            break;
+
+            case SignOp:
+            reverse_sign_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+
+            case SinOp:
+            reverse_sin_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+
+            case SinhOp:
+            reverse_sinh_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+
+            case SqrtOp:
+            reverse_sqrt_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+
+            case SubvvOp:
+            reverse_subvv_op(
+                d, i_z, arg, parameter, J, taylor, K, partial
+            );
+            break;
+
+            case SubpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            reverse_subpv_op(
+                d, i_z, arg, parameter, J, taylor, K, partial
+            );
+            break;
+
+            case SubvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            reverse_subvp_op(
+                d, i_z, arg, parameter, J, taylor, K, partial
+            );
+            break;
+
+            case TanOp:
+            reverse_tan_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+
+            case TanhOp:
+            reverse_tanh_op(
+                d, i_z, size_t(arg[0]), J, taylor, K, partial
+            );
+            break;
+
+            case ZmulpvOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[0]) < num_par );
+            reverse_zmulpv_op(
+                d, i_z, arg, parameter, J, taylor, K, partial
+            );
+            break;
+
+            case ZmulvpOp:
+            CPPAD_ASSERT_UNKNOWN( size_t(arg[1]) < num_par );
+            reverse_zmulvp_op(
+                d, i_z, arg, parameter, J, taylor, K, partial
+            );
+            break;
+
+            case ZmulvvOp:
+            reverse_zmulvv_op(
+                d, i_z, arg, parameter, J, taylor, K, partial
+            );
+            break;
+
+            default:
+            // operators with a zero derivative or no result
+            break;
+        }
+        if( itr.op_index() == op_begin )
+            return;
+        reverse_budget_previous(itr);
+        itr.op_info(op, arg, i_var);
+    }
+}
+
+// BEGIN_PROTOTYPE
+template <class Base>
+bool reverse_budget(
+    const player<Base>* play      ,
+    size_t              max_bytes ,
+    size_t              n         ,
+    const Base*         x         ,
+    size_t              m         ,
+    const size_t*       dep_taddr ,
+    const Base*         w         ,
+    Base*               dw        )
+// END_PROTOTYPE
+{   size_t num_var = play->num_var_rec();
+    //
+    // segments and checkpoints for the current segment size
+    pod_vector<size_t> seg_op, seg_var;
+    pod_vector<addr_t> ext;
+    size_t n_window, n_arg;
+    //
+    // Halve the maximum segment size L until the memory is less than or
+    // equal max_bytes, or halving L does not reduce the memory.
+    size_t L          = num_var;
+    size_t best_L     = 0;
+    size_t best_bytes = 0;
+    while( true )
+    {   if( ! reverse_budget_segment(
+            play, L, m, dep_taddr, seg_op, seg_var, ext, n_window, n_arg
+        ) ) return false;
+        size_t n_base = ext.size() + n_window;
+        size_t bytes  =
+            2 * reverse_budget_capacity( n_base * sizeof(Base) )
+            + reverse_budget_capacity( ext.size() * sizeof(addr_t) )
+            + 2 * reverse_budget_capacity( seg_op.size() * sizeof(size_t) )
+            + reverse_budget_capacity( n_arg * sizeof(addr_t) )
+            + reverse_budget_capacity( n_arg * sizeof(bool) );
+        if( best_L != 0 && best_bytes <= bytes )
+            break;
+        best_L     = L;
+        best_bytes = bytes;
+        if( bytes <= max_bytes || L == 1 )
+            break;
+        L = L / 2;
+    }
+    if( L != best_L )
+    {   // free the memory for the previous L before recomputing for best_L
+        seg_op.clear();
+        seg_var.clear();
+        ext.clear();
+        reverse_budget_segment(
+            play, best_L, m, dep_taddr, seg_op, seg_var, ext, n_window, n_arg
+        );
+    }
+    // the capacity of ext can be larger than its size; e.g.,
+    // it contained duplicates before they were removed
+    {   pod_vector<addr_t> ext_copy;
+        ext_copy.resize( ext.size() );
+        for(size_t k = 0; k < ext.size(); ++k)
+            ext_copy[k] = ext[k];
+        ext.clear();
+        ext.swap(ext_copy);
+    }
+    size_t n_ext = ext.size();
+    size_t n_seg = seg_op.size() - 1;
+    //
+    // values and partials for the checkpoints and one segment
+    pod_vector_maybe<Base> taylor(n_ext + n_window);
+    pod_vector_maybe<Base> partial(n_ext + n_window);
+    //
+    // work space used to map operator arguments
+    pod_vector<bool>   is_variable;
+    pod_vector<addr_t> arg_local(n_arg);
+    is_variable.resize(n_arg);
+    //
+    // forward sweep saving the value of the checkpoints
+    play::const_sequential_iterator itr = play->begin();
+    for(size_t s = 0; s < n_seg; ++s)
+    {   size_t v_begin = seg_var[s];
+        reverse_budget_forward(
+            play, itr, seg_op[s+1], v_begin, ext, x,
+            is_variable, arg_local, taylor.data()
+        );
+        const addr_t* lower = std::lower_bound(
+            ext.data(), ext.data() + n_ext, addr_t(v_begin)
+        );
+        for(size_t k = size_t(lower - ext.data()); k < n_ext; ++k)
+        {   size_t i_var = size_t( ext[k] );
+            if( i_var >= seg_var[s+1] )
+                break;
+            taylor[k] = taylor[n_ext + i_var - v_begin];
+        }
+        if( s + 1 < n_seg )
+            reverse_budget_next(itr);
+    }
+    //
+    // partial for the checkpoints
+    for(size_t k = 0; k < n_ext; ++k)
+        partial[k] = Base(0.0);
+    for(size_t i = 0; i < m; ++i)
+    {   const addr_t* ptr = std::lower_bound(
+            ext.data(), ext.data() + n_ext, addr_t( dep_taddr[i] )
+        );
+        CPPAD_ASSERT_UNKNOWN( *ptr == addr_t( dep_taddr[i] ) );
+        partial[ size_t(ptr - ext.data()) ] += w[i];
+    }
+    //
+    // reverse sweep recomputing the values for each segment
+    for(size_t s = n_seg; s > 0; --s)
+    {   size_t v_begin = seg_var[s-1];
+        size_t v_end   = seg_var[s];
+        //
+        // back up to the beginning of this segment
+        while( itr.op_index() > seg_op[s-1] )
+            reverse_budget_previous(itr);
+        //
+        // values for this segment
+        CPPAD_ASSERT_UNKNOWN( itr.op_index() == seg_op[s-1] );
+        reverse_budget_forward(
+            play, itr, seg_op[s], v_begin, ext, x,
+            is_variable, arg_local, taylor.data()
+        );
+        //
+        // partials for this segment
+        for(size_t i_var = v_begin; i_var < v_end; ++i_var)
+            partial[n_ext + i_var - v_begin] = Base(0.0);
+        const addr_t* lower = std::lower_bound(
+            ext.data(), ext.data() + n_ext, addr_t(v_begin)
+        );
+        for(size_t k = size_t(lower - ext.data()); k < n_ext; ++k)
+        {   size_t i_var = size_t( ext[k] );
+            if( i_var >= v_end )
+                break;
+            partial[n_ext + i_var - v_begin] = partial[k];
+        }
+        reverse_budget_reverse(
+            play, itr, seg_op[s-1], v_begin, ext,
+            is_variable, arg_local, taylor.data(), partial.data()
+        );
+        CPPAD_ASSERT_UNKNOWN( itr.op_index() == seg_op[s-1] );
+        //
+        // partials for the independent variables in this segment
+        for(size_t j = 0; j < n; ++j)
+        {   size_t i_var = j + 1;
+            if( v_begin <= i_var && i_var < v_end )
+                dw[j] = partial[n_ext + i_var - v_begin];
+        }
+        if( s > 1 )
+            reverse_budget_previous(itr);
+    }
+    return true;
+}
+
+} } } // END_CPPAD_LOCAL_SWEEP_NAMESPACE
+
+# endif
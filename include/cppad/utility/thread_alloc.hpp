@@ -1,7 +1,7 @@
 # ifndef CPPAD_UTILITY_THREAD_ALLOC_HPP
 # define CPPAD_UTILITY_THREAD_ALLOC_HPP
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -129,6 +129,17 @@ private:
         static const capacity_t capacity;
         return &capacity;
     }
+    /// Index in capacity_info()->value of the capacity for a request
+    static size_t capacity_index(size_t min_bytes)
+    {   size_t num_cap             = capacity_info()->number;
+        const size_t* capacity_vec = capacity_info()->value;
+        size_t c_index             = 0;
+        while( capacity_vec[c_index] < min_bytes )
+        {   ++c_index;
+            CPPAD_ASSERT_UNKNOWN(c_index < num_cap );
+        }
+        return c_index;
+    }
     // ---------------------------------------------------------------------
     /// Structure of information for each thread
     struct thread_alloc_info {
@@ -685,7 +696,9 @@ $section Get At Least A Specified Amount of Memory$$
 
 
 $head Syntax$$
-$icode%v_ptr% = thread_alloc::get_memory(%min_bytes%, %cap_bytes%)%$$
+$icode%v_ptr% = thread_alloc::get_memory(%min_bytes%, %cap_bytes%)
+%$$
+$icode%cap_bytes% = thread_alloc::capacity_for(%min_bytes%)%$$
 
 $head Purpose$$
 Use $cref thread_alloc$$ to obtain a minimum number of bytes of memory
@@ -714,6 +727,13 @@ $codei%
     %min_bytes% <= %cap_bytes%
 %$$
 
+$head capacity_for$$
+The return value of $code capacity_for$$ is the value of
+$icode cap_bytes$$ for a call to $code get_memory$$ with the same
+$icode min_bytes$$; i.e., it is the number of bytes that would be used
+for the allocation.
+No memory is allocated by this call.
+
 $head v_ptr$$
 The return value $icode v_ptr$$ has prototype
 $codei%
@@ -743,6 +763,22 @@ $cref thread_alloc.cpp$$
 
 $end
 */
+    /*!
+    Number of bytes that get_memory uses for a request.
+
+    \param min_bytes [in]
+    The minimum number of bytes of memory to be obtained for use.
+
+    \return
+    The value of cap_bytes for a call to get_memory with the same min_bytes.
+    */
+    static size_t capacity_for(size_t min_bytes)
+    {   CPPAD_ASSERT_KNOWN(
+            min_bytes < std::numeric_limits<size_t>::max() / 2 ,
+            "capacity_for(min_bytes): min_bytes is too large"
+        );
+        return capacity_info()->value[ capacity_index(min_bytes) ];
+    }
     /*!
     Use thread_alloc to get a specified amount of memory.
 
@@ -776,13 +812,8 @@ $end
         using std::endl;
 
         // determine the capacity for this request
-        size_t c_index   = 0;
-        const size_t* capacity_vec = capacity_info()->value;
-        while( capacity_vec[c_index] < min_bytes )
-        {   ++c_index;
-            CPPAD_ASSERT_UNKNOWN(c_index < num_cap );
-        }
-        cap_bytes = capacity_vec[c_index];
+        size_t c_index = capacity_index(min_bytes);
+        cap_bytes      = capacity_info()->value[c_index];
 
         // determine the thread, capacity, and info for this thread
         size_t thread            = thread_num();
@@ -0,0 +1,269 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin speed_atomic_batch.cpp$$
+$spell
+    cppad
+    CppAD
+    nc
+    mul
+$$
+
+$section Speed Test of Batches of Atomic Function Calls$$
+
+$head Syntax$$
+$codei%speed_atomic_batch %nc%$$
+
+$head Purpose$$
+This program compares the time for zero order forward and
+first order reverse mode when the calls to an $cref atomic_three$$ function
+are evaluated one at a time and as $cref/batches/atomic_three_batch/$$.
+
+$head nc$$
+is the number of calls to the atomic function in the recording.
+The default value for $icode nc$$ is $code 10000$$.
+
+$head Function$$
+The atomic function is the $code 3x3$$ matrix multiply kernel
+$latex C = A B$$
+(see $cref atomic_three_mat_mul.cpp$$ for a general matrix multiply).
+The independent variables are $icode nc$$ matrices $latex A_k$$
+and one matrix $latex B$$.
+The function is the sum of the elements of $latex A_k B$$
+for $latex k = 0 , \ldots , nc-1$$.
+
+$head Output$$
+For batch sizes 0 (no batches), 16, 256, and 4096,
+this program prints the seconds for each call to
+$codei%%f%.Forward(0, %x%)%$$ and $codei%%f%.Reverse(1, %w%)%$$.
+This program returns a non-zero status if the results
+are different for the different batch sizes.
+
+$head Implementation$$
+$srccode%cpp% */
+# include <cppad/cppad.hpp>
+# include <cstdlib>
+# include <cstdio>
+
+namespace {
+    typedef CppAD::vector<double>               d_vector;
+    typedef CppAD::vector<CppAD::ad_type_enum>  t_vector;
+
+    // C = A * B where A, B, and C are 3x3 row major matrices,
+    // x = (A, B) and y = C.
+    class atomic_mat_mul_3x3 : public CppAD::atomic_three<double> {
+    public:
+        // maximum number of calls in a batch
+        size_t max_call;
+        //
+        atomic_mat_mul_3x3(void)
+        : CppAD::atomic_three<double>("mat_mul_3x3"), max_call(0)
+        { }
+    private:
+        virtual bool for_type(
+            const d_vector& parameter_x, const t_vector& type_x,
+            t_vector& type_y)
+        {   CppAD::ad_type_enum type = CppAD::constant_enum;
+            for(size_t j = 0; j < 18; ++j)
+                type = std::max(type, type_x[j]);
+            for(size_t i = 0; i < 9; ++i)
+                type_y[i] = type;
+            return true;
+        }
+        virtual bool forward(
+            const d_vector& parameter_x, const t_vector& type_x,
+            size_t need_y, size_t order_low, size_t order_up,
+            const d_vector& taylor_x, d_vector& taylor_y)
+        {   if( order_up != 0 )
+                return false;
+            const double* a = taylor_x.data();
+            const double* b = a + 9;
+            for(size_t i = 0; i < 3; ++i)
+            {   for(size_t j = 0; j < 3; ++j)
+                {   double sum = 0.0;
+                    for(size_t k = 0; k < 3; ++k)
+                        sum += a[i * 3 + k] * b[k * 3 + j];
+                    taylor_y[i * 3 + j] = sum;
+                }
+            }
+            return true;
+        }
+        virtual bool reverse(
+            const d_vector& parameter_x, const t_vector& type_x,
+            size_t order_up, const d_vector& taylor_x,
+            const d_vector& taylor_y, d_vector& partial_x,
+            const d_vector& partial_y)
+        {   if( order_up != 0 )
+                return false;
+            const double* a  = taylor_x.data();
+            const double* b  = a + 9;
+            double*       pa = partial_x.data();
+            double*       pb = pa + 9;
+            for(size_t j = 0; j < 18; ++j)
+                partial_x[j] = 0.0;
+            for(size_t i = 0; i < 3; ++i)
+            {   for(size_t j = 0; j < 3; ++j)
+                {   double pc = partial_y[i * 3 + j];
+                    for(size_t k = 0; k < 3; ++k)
+                    {   pa[i * 3 + k] += pc * b[k * 3 + j];
+                        pb[k * 3 + j] += pc * a[i * 3 + k];
+                    }
+                }
+            }
+            return true;
+        }
+        virtual size_t batch_size(void)
+        {   return max_call; }
+        // component j of x for call c is taylor_x[j * n_call + c]
+        virtual bool forward_batch(
+            size_t n_call, const d_vector& parameter_x,
+            const t_vector& type_x, const d_vector& taylor_x,
+            d_vector& taylor_y)
+        {   const double* a = taylor_x.data();
+            const double* b = a + 9 * n_call;
+            double*       y = taylor_y.data();
+            for(size_t i = 0; i < 3; ++i)
+            {   for(size_t j = 0; j < 3; ++j)
+                {   double* y_ij = y + (i * 3 + j) * n_call;
+                    for(size_t c = 0; c < n_call; ++c)
+                        y_ij[c] = 0.0;
+                    for(size_t k = 0; k < 3; ++k)
+                    {   const double* a_ik = a + (i * 3 + k) * n_call;
+                        const double* b_kj = b + (k * 3 + j) * n_call;
+                        for(size_t c = 0; c < n_call; ++c)
+                            y_ij[c] += a_ik[c] * b_kj[c];
+                    }
+                }
+            }
+            return true;
+        }
+        virtual bool reverse_batch(
+            size_t n_call, const d_vector& parameter_x,
+            const t_vector& type_x, const d_vector& taylor_x,
+            const d_vector& taylor_y, d_vector& partial_x,
+            const d_vector& partial_y)
+        {   const double* a  = taylor_x.data();
+            const double* b  = a + 9 * n_call;
+            double*       pa = partial_x.data();
+            double*       pb = pa + 9 * n_call;
+            const double* py = partial_y.data();
+            for(size_t c = 0; c < 18 * n_call; ++c)
+                pa[c] = 0.0;
+            for(size_t i = 0; i < 3; ++i)
+            {   for(size_t j = 0; j < 3; ++j)
+                {   const double* pc = py + (i * 3 + j) * n_call;
+                    for(size_t k = 0; k < 3; ++k)
+                    {   double*       pa_ik = pa + (i * 3 + k) * n_call;
+                        double*       pb_kj = pb + (k * 3 + j) * n_call;
+                        const double* a_ik  = a  + (i * 3 + k) * n_call;
+                        const double* b_kj  = b  + (k * 3 + j) * n_call;
+                        for(size_t c = 0; c < n_call; ++c)
+                        {   pa_ik[c] += pc[c] * b_kj[c];
+                            pb_kj[c] += pc[c] * a_ik[c];
+                        }
+                    }
+                }
+            }
+            return true;
+        }
+    };
+
+    // seconds per call to Forward(0, x) (Reverse(1, w) if reverse is true)
+    double time_sweep(
+        CppAD::ADFun<double>& f, const d_vector& x, bool reverse)
+    {   d_vector w(1), y(1), dw( f.Domain() );
+        w[0] = 1.0;
+        f.Forward(0, x);
+        size_t repeat = 1;
+        double time   = 0.0;
+        while( time < 0.5 )
+        {   double start = CppAD::elapsed_seconds();
+            for(size_t r = 0; r < repeat; ++r)
+            {   if( reverse )
+                    dw = f.Reverse(1, w);
+                else
+                    y = f.Forward(0, x);
+            }
+            time    = CppAD::elapsed_seconds() - start;
+            repeat *= 2;
+        }
+        return time / double(repeat / 2);
+    }
+}
+
+int main(int argc, char* argv[])
+{   using CppAD::AD;
+    size_t nc = 10000;
+    if( argc > 1 )
+        nc = size_t( std::atof( argv[1] ) );
+    //
+    // record the function
+    atomic_mat_mul_3x3 afun;
+    size_t n = 9 * nc + 9;
+    CppAD::vector< AD<double> > ax(n), au(18), av(9), ac(9 * nc), ay(1);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j % 7 + 1) / 7.0;
+    CppAD::Independent(ax);
+    for(size_t j = 0; j < 9; ++j)
+        au[9 + j] = ax[9 * nc + j];
+    for(size_t k = 0; k < nc; ++k)
+    {   for(size_t j = 0; j < 9; ++j)
+            au[j] = ax[9 * k + j];
+        afun(au, av);
+        for(size_t i = 0; i < 9; ++i)
+            ac[9 * k + i] = av[i];
+    }
+    AD<double> asum = 0.0;
+    for(size_t i = 0; i < 9 * nc; ++i)
+        asum += ac[i];
+    ay[0] = asum;
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    d_vector x(n), y(1), w(1), dw(n), y_check(1), dw_check(n);
+    for(size_t j = 0; j < n; ++j)
+        x[j] = double(j % 5 + 1) / 5.0;
+    w[0] = 1.0;
+    //
+    bool ok = true;
+    size_t max_call[] = { 0, 16, 256, 4096 };
+    for(size_t ell = 0; ell < 4; ++ell)
+    {   afun.max_call = max_call[ell];
+        double time_forward = time_sweep(f, x, false);
+        double time_reverse = time_sweep(f, x, true);
+        std::printf(
+            "nc = %8lu, max_call = %6lu, time_forward = %10.3e, "
+            "time_reverse = %10.3e\n",
+            (unsigned long) nc, (unsigned long) max_call[ell],
+            time_forward, time_reverse
+        );
+        //
+        // check the results
+        y  = f.Forward(0, x);
+        dw = f.Reverse(1, w);
+        if( ell == 0 )
+        {   y_check  = y;
+            dw_check = dw;
+        }
+        ok &= CppAD::NearEqual(y[0], y_check[0], 1e-10, 1e-10);
+        for(size_t j = 0; j < n; ++j)
+            ok &= CppAD::NearEqual(dw[j], dw_check[j], 1e-10, 1e-10);
+    }
+    if( ! ok )
+    {   std::printf("speed_atomic_batch: Error\n");
+        return 1;
+    }
+    std::printf("speed_atomic_batch: OK\n");
+    return 0;
+}
+/* %$$
+$end
+*/
@@ -0,0 +1,214 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin speed_chkpoint_sparsity.cpp$$
+$spell
+    chkpoint
+    cppad
+    CppAD
+    nc
+    jac
+    hes
+    bool
+$$
+
+$section Speed Test of Sparsity Patterns for Checkpoint Functions$$
+
+$head Syntax$$
+$codei%speed_chkpoint_sparsity %nc%$$
+
+$head Purpose$$
+A $cref chkpoint_two$$ function computes the sparsity patterns for
+its function $latex g(x)$$ once, when it is constructed,
+and each call in a recording uses these patterns by composing them with
+the patterns for its arguments (results).
+This program compares the time for
+$cref for_jac_sparsity$$, $cref rev_jac_sparsity$$,
+$cref for_hes_sparsity$$, and $cref rev_hes_sparsity$$
+with the time when each call derives its pattern using the
+$cref/jac_sparsity/atomic_three_jac_sparsity/$$ and
+$cref/hes_sparsity/atomic_three_hes_sparsity/$$ virtual functions.
+
+$head nc$$
+is the number of calls to the checkpoint function in the recording.
+The default value for $icode nc$$ is $code 10000$$.
+
+$head Function$$
+The checkpoint function $latex g : \B{R}^8 \rightarrow \B{R}^8$$ is
+$latex \[
+    g_i (x) = x_i x_{(i+1) \% 8} + \sin( x_{(i+7) \% 8} )
+\] $$
+The independent variables are $latex x \in \B{R}^{nc + 7}$$.
+Call $icode k$$ uses $latex ( x_k , \ldots , x_{k+7} )$$ as its argument
+and the dependent variable $latex y_k$$ is the sum of its results.
+
+$head Output$$
+For each internal sparsity representation,
+$code bool$$ and $code set$$, and for the checkpoint patterns
+($code fixed$$) and per call patterns ($code call$$),
+this program prints the seconds for each of the sparsity calculations.
+This program returns a non-zero status if the
+patterns are different.
+
+$head Implementation$$
+$srccode%cpp% */
+# include <cppad/cppad.hpp>
+# include <cstdlib>
+# include <cstdio>
+
+namespace {
+    using CppAD::AD;
+    typedef CppAD::vector<size_t>         SizeVector;
+    typedef CppAD::sparse_rc<SizeVector>  sparsity;
+    typedef CppAD::local::sparse::crs_pattern crs_pattern;
+
+    // checkpoint function that derives its patterns for each call
+    class chkpoint_call : public CppAD::chkpoint_two<double> {
+    public:
+        chkpoint_call(const CppAD::ADFun<double>& g, bool internal_bool)
+        : CppAD::chkpoint_two<double>(
+            g, "chkpoint_call", internal_bool, true, false, false
+        )
+        { }
+    private:
+        virtual const crs_pattern* fixed_jac_sparsity(void)
+        {   return CPPAD_NULL; }
+        virtual const crs_pattern* fixed_hes_sparsity(void)
+        {   return CPPAD_NULL; }
+    };
+
+    // record the function that calls the checkpoint function nc times
+    void record(
+        size_t nc, CppAD::atomic_three<double>& chk, CppAD::ADFun<double>& f)
+    {   size_t n = nc + 7;
+        CppAD::vector< AD<double> > ax(n), au(8), av(8), ay(nc);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = double(j + 1) / double(n);
+        CppAD::Independent(ax);
+        for(size_t k = 0; k < nc; ++k)
+        {   for(size_t j = 0; j < 8; ++j)
+                au[j] = ax[k + j];
+            chk(au, av);
+            ay[k] = 0.0;
+            for(size_t i = 0; i < 8; ++i)
+                ay[k] += av[i];
+        }
+        f.Dependent(ax, ay);
+    }
+
+    // are two sparsity patterns equal
+    bool equal(const sparsity& a, const sparsity& b)
+    {   if( a.nnz() != b.nnz() )
+            return false;
+        SizeVector a_order = a.row_major();
+        SizeVector b_order = b.row_major();
+        bool ok = true;
+        for(size_t k = 0; k < a.nnz(); ++k)
+        {   ok &= a.row()[ a_order[k] ] == b.row()[ b_order[k] ];
+            ok &= a.col()[ a_order[k] ] == b.col()[ b_order[k] ];
+        }
+        return ok;
+    }
+}
+
+int main(int argc, char* argv[])
+{   size_t nc = 10000;
+    if( argc > 1 )
+        nc = size_t( std::atof( argv[1] ) );
+    size_t n = nc + 7;
+    //
+    // g(x)
+    CppAD::vector< AD<double> > ax(8), ay(8);
+    for(size_t j = 0; j < 8; ++j)
+        ax[j] = double(j + 1);
+    CppAD::Independent(ax);
+    for(size_t i = 0; i < 8; ++i)
+        ay[i] = ax[i] * ax[(i + 1) % 8] + sin( ax[(i + 7) % 8] );
+    CppAD::ADFun<double> g(ax, ay);
+    //
+    // pattern for the identity matrices
+    sparsity identity_n(n, n, n), identity_m(nc, nc, nc);
+    for(size_t k = 0; k < n; ++k)
+        identity_n.set(k, k, k);
+    for(size_t k = 0; k < nc; ++k)
+        identity_m.set(k, k, k);
+    //
+    // select all the domain and range components
+    CppAD::vector<bool> select_domain(n), select_range(nc);
+    for(size_t j = 0; j < n; ++j)
+        select_domain[j] = true;
+    for(size_t i = 0; i < nc; ++i)
+        select_range[i] = true;
+    //
+    const char* set_name[] = { "bool", "set" };
+    const char* use_name[] = { "fixed", "call" };
+    bool ok = true;
+    for(size_t k_set = 0; k_set < 2; ++k_set)
+    {   bool internal_bool = k_set == 0;
+        sparsity check[4];
+        for(size_t k_use = 0; k_use < 2; ++k_use)
+        {   CppAD::chkpoint_two<double> chk_fixed(
+                g, "chk_fixed", internal_bool, true, false, false
+            );
+            chkpoint_call chk_call(g, internal_bool);
+            CppAD::ADFun<double> f;
+            if( k_use == 0 )
+                record(nc, chk_fixed, f);
+            else
+                record(nc, chk_call, f);
+            //
+            bool transpose  = false;
+            bool dependency = false;
+            sparsity pattern[4];
+            double time[5];
+            time[0] = CppAD::elapsed_seconds();
+            f.for_jac_sparsity(
+                identity_n, transpose, dependency, internal_bool, pattern[0]
+            );
+            time[1] = CppAD::elapsed_seconds();
+            f.rev_hes_sparsity(
+                select_range, transpose, internal_bool, pattern[1]
+            );
+            time[2] = CppAD::elapsed_seconds();
+            f.rev_jac_sparsity(
+                identity_m, transpose, dependency, internal_bool, pattern[2]
+            );
+            time[3] = CppAD::elapsed_seconds();
+            f.for_hes_sparsity(
+                select_domain, select_range, internal_bool, pattern[3]
+            );
+            time[4] = CppAD::elapsed_seconds();
+            std::printf(
+                "nc = %6lu, set = %4s, use = %5s, for_jac = %8.4f, "
+                "rev_hes = %8.4f, rev_jac = %8.4f, for_hes = %8.4f\n",
+                (unsigned long) nc, set_name[k_set], use_name[k_use],
+                time[1] - time[0], time[2] - time[1],
+                time[3] - time[2], time[4] - time[3]
+            );
+            for(size_t k = 0; k < 4; ++k)
+            {   if( k_use == 0 )
+                    check[k] = pattern[k];
+                else
+                    ok &= equal(pattern[k], check[k]);
+            }
+        }
+    }
+    if( ! ok )
+    {   std::printf("speed_chkpoint_sparsity: Error\n");
+        return 1;
+    }
+    std::printf("speed_chkpoint_sparsity: OK\n");
+    return 0;
+}
+/* %$$
+$end
+*/
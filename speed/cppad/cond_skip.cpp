@@ -0,0 +1,166 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin speed_cond_skip.cpp$$
+$spell
+    cppad
+    CppAD
+    CondExp
+    nc
+    op
+    seq
+$$
+
+$section Speed Test of Conditional Skipping$$
+
+$head Syntax$$
+$codei%speed_cond_skip %nc% %n_op%$$
+
+$head Purpose$$
+This program compares the time for zero and first order forward mode
+when the tape is optimized with and without the
+$cref/no_conditional_skip/optimize/options/no_conditional_skip/$$ option.
+With conditional skipping, the operators for the branch of each
+$cref CondExp$$ that is not used are skipped in blocks.
+
+$head nc$$
+is the number of conditional expressions in the recording.
+The default value for $icode nc$$ is $code 10000$$.
+
+$head n_op$$
+is the number of iterations in each branch of a conditional expression
+(each iteration is two operators).
+The default value for $icode n_op$$ is $code 10$$.
+
+$head Function$$
+The independent variables are $latex x \in \B{R}^{nc}$$.
+For each $icode i$$, two functions of $latex x_i$$ are computed,
+one after the other,
+using $icode n_op$$ iterations of
+$latex t = t * .5 + 1$$ and $latex t = t * .25 - 1$$.
+The first is used when $latex x_i < 0$$ and the second otherwise.
+Thus the operators that are skipped for each conditional expression
+are contiguous in the tape.
+The function value is the sum of the $icode nc$$ results.
+
+$head Output$$
+For each value of the $code no_conditional_skip$$ option,
+and each value of $cref compact_op_seq$$,
+this program prints the number of operators in the tape and the
+seconds for each call to
+$codei%%f%.Forward(0, %x%)%$$ and $codei%%f%.Forward(1, %dx%)%$$.
+It returns a non-zero status if the results are different
+for the different options.
+
+$head Implementation$$
+$srccode%cpp% */
+# include <cppad/cppad.hpp>
+# include <cstdlib>
+# include <cstdio>
+
+namespace {
+    typedef CppAD::vector<double> d_vector;
+
+    // seconds per call to Forward(0, x) (Forward(1, dx) if first is true)
+    double time_forward(
+        CppAD::ADFun<double>& f, const d_vector& x, bool first)
+    {   d_vector y(1), dx(x.size()), dy(1);
+        for(size_t j = 0; j < x.size(); ++j)
+            dx[j] = 1.0;
+        f.Forward(0, x);
+        size_t repeat = 1;
+        double time   = 0.0;
+        while( time < 0.5 )
+        {   double start = CppAD::elapsed_seconds();
+            for(size_t r = 0; r < repeat; ++r)
+            {   if( first )
+                    dy = f.Forward(1, dx);
+                else
+                    y = f.Forward(0, x);
+            }
+            time    = CppAD::elapsed_seconds() - start;
+            repeat *= 2;
+        }
+        return time / double(repeat / 2);
+    }
+}
+
+int main(int argc, char* argv[])
+{   using CppAD::AD;
+    size_t nc   = 10000;
+    size_t n_op = 10;
+    if( argc > 1 )
+        nc = size_t( std::atof( argv[1] ) );
+    if( argc > 2 )
+        n_op = size_t( std::atof( argv[2] ) );
+    //
+    // record the function
+    CppAD::vector< AD<double> > ax(nc), ay(1);
+    for(size_t j = 0; j < nc; ++j)
+        ax[j] = 0.0;
+    CppAD::Independent(ax);
+    AD<double> azero = 0.0;
+    AD<double> asum  = 0.0;
+    for(size_t i = 0; i < nc; ++i)
+    {   AD<double> aleft  = ax[i];
+        AD<double> aright = ax[i];
+        for(size_t k = 0; k < n_op; ++k)
+            aleft  = aleft * 0.5 + 1.0;
+        for(size_t k = 0; k < n_op; ++k)
+            aright = aright * 0.25 - 1.0;
+        asum += CppAD::CondExpLt(ax[i], azero, aleft, aright);
+    }
+    ay[0] = asum;
+    CppAD::ADFun<double> g(ax, ay);
+    //
+    d_vector x(nc), dx(nc), y(1), dy(1), y_check(1), dy_check(1);
+    for(size_t j = 0; j < nc; ++j)
+    {   x[j]  = double( int(j % 3) - 1 ) / 4.0;
+        dx[j] = 1.0;
+    }
+    //
+    bool ok = true;
+    const char* option[] = { "no_conditional_skip", "" };
+    for(size_t ell = 0; ell < 4; ++ell)
+    {   CppAD::ADFun<double> f;
+        f = g;
+        f.optimize( option[ell % 2] );
+        f.compact_op_seq( ell >= 2 );
+        double time_zero  = time_forward(f, x, false);
+        double time_first = time_forward(f, x, true);
+        std::printf(
+            "nc = %6lu, skip = %d, compact = %d, size_op = %8lu, "
+            "forward(0) = %10.3e, forward(1) = %10.3e\n",
+            (unsigned long) nc, int(ell % 2), int(ell >= 2),
+            (unsigned long) f.size_op(), time_zero, time_first
+        );
+        //
+        // check the results
+        y  = f.Forward(0, x);
+        dy = f.Forward(1, dx);
+        if( ell == 0 )
+        {   y_check  = y;
+            dy_check = dy;
+        }
+        ok &= CppAD::NearEqual(y[0], y_check[0], 1e-10, 1e-10);
+        ok &= CppAD::NearEqual(dy[0], dy_check[0], 1e-10, 1e-10);
+    }
+    if( ! ok )
+    {   std::printf("speed_cond_skip: Error\n");
+        return 1;
+    }
+    std::printf("speed_cond_skip: OK\n");
+    return 0;
+}
+/* %$$
+$end
+*/
@@ -34,6 +34,7 @@ $srccode%cpp% */
 # include <cppad/cppad.hpp>
 # include <cppad/speed/det_by_minor.hpp>
 # include <cppad/speed/uniform_01.hpp>
+# include <sstream>
 
 // Note that CppAD uses global_option["memory"] at the main program level
 # include <map>
@@ -50,7 +51,9 @@ bool link_det_minor(
 
     // --------------------------------------------------------------------
     // check global options
-    const char* valid[] = { "memory", "onetape", "optimize"};
+    const char* valid[] = {
+        "memory", "onetape", "optimize", "direct", "jit", "binary", "compact"
+    };
     size_t n_valid = sizeof(valid) / sizeof(valid[0]);
     typedef std::map<std::string, bool>::iterator iterator;
     //
@@ -91,6 +94,23 @@ bool link_det_minor(
     size_t abort_op_index = 0;
     bool record_compare   = false;
 
+    // binary version of the operation sequence (used by the binary option)
+    std::string binary_tape;
+    if( global_option["binary"] && ! global_option["onetape"] )
+    {   // the operation sequence does not depend on the matrix
+        CppAD::uniform_01(n, matrix);
+        for(size_t i = 0; i < n; i++)
+            a_A[i] = matrix[i];
+        Independent(a_A, abort_op_index, record_compare);
+        a_detA[0] = a_det(a_A);
+        f.Dependent(a_A, a_detA);
+        if( global_option["optimize"] )
+            f.optimize(optimize_options);
+        std::ostringstream os;
+        f.to_binary(os);
+        binary_tape = os.str();
+    }
+
     // ---------------------------------------------------------------------
     if( ! global_option["onetape"] ) while(repeat--)
     {
@@ -99,21 +119,37 @@ bool link_det_minor(
         for(size_t i = 0; i < n; i++)
             a_A[i] = matrix[i];
 
-        // declare independent variables
-        Independent(a_A, abort_op_index, record_compare);
+        if( global_option["binary"] )
+        {   // load the operation sequence instead of recording it
+            std::istringstream is(binary_tape);
+            f.from_binary(is);
+        }
+        else
+        {   // declare independent variables
+            Independent(a_A, abort_op_index, record_compare);
 
-        // AD computation of the determinant
-        a_detA[0] = a_det(a_A);
+            // AD computation of the determinant
+            a_detA[0] = a_det(a_A);
 
-        // create function object f : A -> detA
-        f.Dependent(a_A, a_detA);
+            // create function object f : A -> detA
+            f.Dependent(a_A, a_detA);
 
-        if( global_option["optimize"] )
-            f.optimize(optimize_options);
+            if( global_option["optimize"] )
+                f.optimize(optimize_options);
+        }
 
         // skip comparison operators
         f.compare_change_count(0);
 
+        // zero order forward dispatch method
+        f.forward_direct( global_option["direct"] );
+
+        // compile zero order forward and first order reverse
+        f.jit( global_option["jit"] );
+
+        // compact encoding of the operation sequence
+        f.compact_op_seq( global_option["compact"] );
+
         // evaluate the determinant at the new matrix value
         f.Forward(0, matrix);
 
@@ -139,9 +175,25 @@ bool link_det_minor(
         if( global_option["optimize"] )
             f.optimize(optimize_options);
 
+        if( global_option["binary"] )
+        {   // replace f by a copy that has been saved and loaded
+            std::stringstream stream;
+            f.to_binary(stream);
+            f.from_binary(stream);
+        }
+
         // skip comparison operators
         f.compare_change_count(0);
 
+        // zero order forward dispatch method
+        f.forward_direct( global_option["direct"] );
+
+        // compile zero order forward and first order reverse
+        f.jit( global_option["jit"] );
+
+        // compact encoding of the operation sequence
+        f.compact_op_seq( global_option["compact"] );
+
         // ------------------------------------------------------
         while(repeat--)
         {   // get the next matrix
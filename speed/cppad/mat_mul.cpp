@@ -57,7 +57,9 @@ bool link_mat_mul(
 
     // --------------------------------------------------------------------
     // check global options
-    const char* valid[] = { "memory", "onetape", "optimize", "atomic"};
+    const char* valid[] = {
+        "memory", "onetape", "optimize", "atomic", "direct", "jit", "compact"
+    };
     size_t n_valid = sizeof(valid) / sizeof(valid[0]);
     typedef std::map<std::string, bool>::iterator iterator;
     //
@@ -135,6 +137,15 @@ bool link_mat_mul(
         // skip comparison operators
         f.compare_change_count(0);
 
+        // zero order forward dispatch method
+        f.forward_direct( global_option["direct"] );
+
+        // compile zero order forward and first order reverse
+        f.jit( global_option["jit"] );
+
+        // compact encoding of the operation sequence
+        f.compact_op_seq( global_option["compact"] );
+
         // evaluate and return gradient using reverse mode
         z  = f.Forward(0, x);
         dz = f.Reverse(1, w);
@@ -172,6 +183,15 @@ bool link_mat_mul(
         // skip comparison operators
         f.compare_change_count(0);
 
+        // zero order forward dispatch method
+        f.forward_direct( global_option["direct"] );
+
+        // compile zero order forward and first order reverse
+        f.jit( global_option["jit"] );
+
+        // compact encoding of the operation sequence
+        f.compact_op_seq( global_option["compact"] );
+
         while(repeat--)
         {   // get a next matrix
             CppAD::uniform_01(n, x);
@@ -0,0 +1,155 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin speed_new_dynamic.cpp$$
+$spell
+    cppad
+    CppAD
+    nd
+$$
+
+$section Speed Test of Changing Some of the Dynamic Parameters$$
+
+$head Syntax$$
+$codei%speed_new_dynamic %nd%$$
+
+$head Purpose$$
+This program compares the time for
+$codei%
+    %f%.new_dynamic(%dynamic%)
+    %f%.new_dynamic(%dynamic%, %changed%)
+%$$
+where $icode changed$$ contains a fraction of the independent
+dynamic parameter indices; see $cref new_dynamic$$.
+
+$head nd$$
+is the number of independent dynamic parameters.
+The default value for $icode nd$$ is $code 10000$$.
+
+$head Function$$
+Each independent dynamic parameter is the start of a chain of
+ten dependent dynamic parameters.
+The last parameter in each chain also depends on the previous chain,
+so that a change in one independent dynamic parameter affects
+two chains.
+The function is the sum of the one independent variable times
+the last parameter in each chain.
+
+$head Output$$
+For the fractions 0.001, 0.01, 0.1 and 1,
+this program prints the number of changed indices,
+and the seconds for each call to $code new_dynamic$$ without and with
+$icode changed$$.
+This program returns a non-zero status if the function values
+are different when $icode changed$$ is used.
+
+$head Implementation$$
+$srccode%cpp% */
+# include <cppad/cppad.hpp>
+# include <cstdlib>
+# include <cstdio>
+
+namespace {
+    typedef CppAD::vector<double>  d_vector;
+    typedef CppAD::vector<size_t>  s_vector;
+
+    // time per call to new_dynamic
+    double time_new_dynamic(
+        CppAD::ADFun<double>& f         ,
+        d_vector&             dynamic   ,
+        const s_vector*       changed   )
+    {   size_t repeat = 1;
+        double time   = 0.0;
+        while( time < 0.5 )
+        {   double start = CppAD::elapsed_seconds();
+            for(size_t r = 0; r < repeat; ++r)
+            {   if( changed == CPPAD_NULL )
+                    f.new_dynamic(dynamic);
+                else
+                    f.new_dynamic(dynamic, *changed);
+            }
+            time    = CppAD::elapsed_seconds() - start;
+            repeat *= 2;
+        }
+        return time / double(repeat / 2);
+    }
+}
+
+int main(int argc, char* argv[])
+{   using CppAD::AD;
+    size_t nd = 10000;
+    if( argc > 1 )
+        nd = size_t( std::atof( argv[1] ) );
+    //
+    // record the function
+    CppAD::vector< AD<double> > ax(1), ay(1), adynamic(nd);
+    ax[0] = 1.0;
+    for(size_t j = 0; j < nd; ++j)
+        adynamic[j] = double(j + 1) / double(nd);
+    size_t abort_op_index = 0;
+    bool   record_compare = false;
+    CppAD::Independent(ax, abort_op_index, record_compare, adynamic);
+    AD<double> asum  = 0.0;
+    AD<double> alast = 0.0;
+    for(size_t j = 0; j < nd; ++j)
+    {   AD<double> achain = adynamic[j];
+        for(size_t k = 0; k < 9; ++k)
+            achain = sin( achain ) + 0.5;
+        achain += alast;
+        asum   += ax[0] * achain;
+        alast   = adynamic[j];
+    }
+    ay[0] = asum;
+    CppAD::ADFun<double> f(ax, ay), g;
+    g = f;
+    //
+    d_vector x(1), dynamic(nd), yf(1), yg(1);
+    x[0] = 1.0;
+    for(size_t j = 0; j < nd; ++j)
+        dynamic[j] = double(j + 1) / double(nd);
+    //
+    bool ok = true;
+    double fraction[] = { 0.001, 0.01, 0.1, 1.0 };
+    for(size_t ell = 0; ell < 4; ++ell)
+    {   size_t n_changed = size_t( fraction[ell] * double(nd) );
+        if( n_changed == 0 )
+            n_changed = 1;
+        s_vector changed(n_changed);
+        for(size_t k = 0; k < n_changed; ++k)
+        {   changed[k]             = (k * nd) / n_changed;
+            dynamic[ changed[k] ] += 0.5;
+        }
+        //
+        double time_all     = time_new_dynamic(g, dynamic, CPPAD_NULL);
+        double time_changed = time_new_dynamic(f, dynamic, &changed);
+        std::printf(
+            "nd = %8lu, n_changed = %8lu, time_all = %10.3e, "
+            "time_changed = %10.3e\n",
+            (unsigned long) nd, (unsigned long) n_changed,
+            time_all, time_changed
+        );
+        //
+        // check the function values
+        yf  = f.Forward(0, x);
+        yg  = g.Forward(0, x);
+        ok &= CppAD::NearEqual(yf[0], yg[0], 1e-10, 1e-10);
+    }
+    if( ! ok )
+    {   std::printf("speed_new_dynamic: Error\n");
+        return 1;
+    }
+    std::printf("speed_new_dynamic: OK\n");
+    return 0;
+}
+/* %$$
+$end
+*/
@@ -0,0 +1,136 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin speed_optimize.cpp$$
+$spell
+    cppad
+    CppAD
+    num_op
+    op
+    Optimizer
+$$
+
+$section Speed Test of the CppAD Optimizer$$
+
+$head Syntax$$
+$codei%speed_optimize %min_op% %max_op%$$
+
+$head Purpose$$
+This program reports the number of operators per second
+processed by $cref optimize$$,
+with and without the
+$cref/grow_hash_table/optimize/options/grow_hash_table/$$ option.
+
+$head min_op$$
+is the number of operators in the first tape that is optimized.
+The default value for $icode min_op$$ is $code 1000000$$.
+
+$head max_op$$
+The number of operators is multiplied by ten until it is greater
+than $icode max_op$$.
+The default value for $icode max_op$$ is $icode min_op$$.
+
+$head Tape$$
+The tape sums products of the form $codei%sin(%x%[%i%]) * %x%[%j%]%$$
+where each pair $icode%(%i%, %j%)%$$ is used about ten times.
+Hence most of the products are equal to a previous product
+and the number of different products grows with the size of the tape.
+
+$head Output$$
+For each tape size and option, this program prints
+the number of operators $icode num_op$$ in the tape,
+the number of operators after the optimization,
+and the number of operators processed per second.
+It returns a non-zero status if the optimized and original tapes
+do not give the same function value.
+
+$head Implementation$$
+$srccode%cpp% */
+# include <cppad/cppad.hpp>
+# include <algorithm>
+# include <cstdlib>
+# include <cstdio>
+
+namespace {
+    // tape with approximately num_op operators
+    void record(size_t num_op, CppAD::ADFun<double>& f)
+    {   using CppAD::AD;
+        size_t n = 1000;
+        CppAD::vector< AD<double> > ax(n), ay(1);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = double(j + 1) / double(n);
+        CppAD::Independent(ax);
+        //
+        // each term uses one sin, one multiply, and one add operator
+        // each pair is used about ten times
+        size_t n_term  = num_op / 3;
+        size_t n_pair  = std::max( std::min(n_term / 10, n * n), size_t(1) );
+        AD<double> sum = 0.0;
+        for(size_t k = 0; k < n_term; ++k)
+        {   size_t p = (k * 7919) % n_pair;
+            size_t i = p % n;
+            size_t j = (p / n + i) % n;
+            sum     += sin( ax[i] ) * ax[j];
+        }
+        ay[0] = sum;
+        f.Dependent(ax, ay);
+    }
+}
+
+int main(int argc, char* argv[])
+{   size_t min_op = 1000000;
+    if( argc > 1 )
+        min_op = size_t( std::atof( argv[1] ) );
+    size_t max_op = min_op;
+    if( argc > 2 )
+        max_op = size_t( std::atof( argv[2] ) );
+    //
+    const char* option[] = { "", "grow_hash_table" };
+    bool ok = true;
+    for(size_t num_op = min_op; num_op <= max_op; num_op *= 10)
+    {   for(size_t k = 0; k < 2; ++k)
+        {   CppAD::ADFun<double> f, g;
+            record(num_op, f);
+            record(num_op, g);
+            size_t size_op = f.size_op();
+            //
+            double start = CppAD::elapsed_seconds();
+            f.optimize( option[k] );
+            double time  = CppAD::elapsed_seconds() - start;
+            //
+            std::printf(
+                "num_op = %10lu, optimized = %10lu, rate = %10.0f, "
+                "option = %s\n",
+                (unsigned long) size_op,
+                (unsigned long) f.size_op(),
+                double(size_op) / time,
+                option[k]
+            );
+            //
+            CppAD::vector<double> x( f.Domain() ), yf(1), yg(1);
+            for(size_t j = 0; j < f.Domain(); ++j)
+                x[j] = double(j + 1) / double( f.Domain() );
+            yf  = f.Forward(0, x);
+            yg  = g.Forward(0, x);
+            ok &= CppAD::NearEqual(yf[0], yg[0], 1e-10, 1e-10);
+        }
+    }
+    if( ! ok )
+    {   std::printf("speed_optimize: Error\n");
+        return 1;
+    }
+    std::printf("speed_optimize: OK\n");
+    return 0;
+}
+/* %$$
+$end
+*/
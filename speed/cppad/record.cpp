@@ -0,0 +1,142 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin speed_record.cpp$$
+$spell
+    cppad
+    CppAD
+    num_op
+    op
+    num_par
+$$
+
+$section Speed Test of Recording an Operation Sequence$$
+
+$head Syntax$$
+$codei%speed_record %min_op% %max_op%$$
+
+$head Purpose$$
+This program reports the number of operators per second
+that are recorded using different $cref record_option$$ settings.
+
+$head min_op$$
+is the number of operators in the first recording.
+The default value for $icode min_op$$ is $code 1000000$$.
+
+$head max_op$$
+The number of operators is multiplied by ten until it is greater
+than $icode max_op$$.
+The default value for $icode max_op$$ is $icode min_op$$.
+
+$head Recording$$
+The recording sums products of the form $codei%%c% * %x%[%j%]%$$
+where the constant $icode c$$ is different for each term.
+Hence most of the constants are not equal to a previous constant
+and the number of parameters grows with the size of the recording.
+
+$head Output$$
+For each recording size and option, this program prints
+the number of operators $icode num_op$$ in the recording,
+the number of parameters $icode num_par$$ in the recording,
+and the number of operators recorded per second.
+The $icode reserve$$ column is one (zero) if
+$cref/record_reserve/record_option/record_reserve/$$ was (was not) used.
+The $icode method$$ column is the
+$cref/record_par_hash/record_option/record_par_hash/$$ method.
+This program returns a non-zero status if the different recordings
+do not give the same function value.
+
+$head Implementation$$
+$srccode%cpp% */
+# include <cppad/cppad.hpp>
+# include <cstdlib>
+# include <cstdio>
+
+namespace {
+    // record approximately num_op operators and return the time it took
+    double record(
+        size_t                num_op   ,
+        bool                  reserve  ,
+        const char*           method   ,
+        CppAD::ADFun<double>& f        )
+    {   using CppAD::AD;
+        size_t n = 1000;
+        CppAD::vector< AD<double> > ax(n), ay(1);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = double(j + 1) / double(n);
+        //
+        double start = CppAD::elapsed_seconds();
+        CppAD::Independent(ax);
+        //
+        // each term uses one multiply and one add operator
+        size_t n_term = num_op / 2;
+        if( reserve )
+            AD<double>::record_reserve(num_op + n + 3, n_term + 1);
+        AD<double>::record_par_hash(method);
+        //
+        AD<double> sum = 0.0;
+        for(size_t k = 0; k < n_term; ++k)
+        {   double c = 1.0 + double(k) / double(n_term);
+            sum     += c * ax[k % n];
+        }
+        ay[0] = sum;
+        f.Dependent(ax, ay);
+        return CppAD::elapsed_seconds() - start;
+    }
+}
+
+int main(int argc, char* argv[])
+{   size_t min_op = 1000000;
+    if( argc > 1 )
+        min_op = size_t( std::atof( argv[1] ) );
+    size_t max_op = min_op;
+    if( argc > 2 )
+        max_op = size_t( std::atof( argv[2] ) );
+    //
+    const char* method[] =
+        { "fixed_hash_table", "grow_hash_table", "no_hash_table" };
+    bool ok = true;
+    for(size_t num_op = min_op; num_op <= max_op; num_op *= 10)
+    {   CppAD::vector<double> x(1000), y(1), check(1);
+        for(size_t j = 0; j < x.size(); ++j)
+            x[j] = double(j + 2) / double( x.size() );
+        for(size_t k = 0; k < 6; ++k)
+        {   bool reserve = k % 2 == 1;
+            CppAD::ADFun<double> f;
+            double time = record(num_op, reserve, method[k / 2], f);
+            //
+            std::printf(
+                "num_op = %10lu, num_par = %10lu, rate = %10.0f, "
+                "reserve = %d, method = %s\n",
+                (unsigned long) f.size_op(),
+                (unsigned long) f.size_par(),
+                double( f.size_op() ) / time,
+                int(reserve),
+                method[k / 2]
+            );
+            //
+            y = f.Forward(0, x);
+            if( k == 0 )
+                check[0] = y[0];
+            ok &= CppAD::NearEqual(y[0], check[0], 1e-10, 1e-10);
+        }
+    }
+    if( ! ok )
+    {   std::printf("speed_record: Error\n");
+        return 1;
+    }
+    std::printf("speed_record: OK\n");
+    return 0;
+}
+/* %$$
+$end
+*/
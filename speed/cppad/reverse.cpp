@@ -0,0 +1,167 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin speed_reverse.cpp$$
+$spell
+    cppad
+    CppAD
+    nv
+$$
+
+$section Speed Test of Repeated Reverse Mode Calls$$
+
+$head Syntax$$
+$codei%speed_reverse %nv%$$
+
+$head Purpose$$
+This program measures the time for each call to
+$codei%
+    %dw% = %f%.Reverse(%q%, %w%)
+%$$
+when it is called repeatedly for the same function object $icode f$$
+(for example, to compute many gradients).
+The memory for the partial derivatives is kept by $icode f$$
+between these calls; see $cref/memory/reverse_any/Memory/$$.
+This is compared with the time for the first call
+after this memory has been freed.
+
+$head nv$$
+is the number of variables in the recording
+(to within a few variables).
+The default value for $icode nv$$ is $code 1000000$$.
+
+$head Function$$
+The function is the sum of $code sin(x[j]) * x[j+1]$$ for
+$icode%j% = 0 , %...% , %n%-2%$$
+where $icode n$$ is about $icode%nv%/5%$$.
+
+$head Output$$
+For $icode%q% = 1%$$, $icode%q% = 2%$$, and for alternating between
+$icode%q% = 1%$$ and $icode%q% = 2%$$,
+this program prints the seconds for the first call after
+the memory is freed, and for each repeated call.
+This program returns a non-zero status if the repeated calls
+give different derivatives than the first calls.
+
+$head Implementation$$
+$srccode%cpp% */
+# include <cppad/cppad.hpp>
+# include <cstdlib>
+# include <cstdio>
+
+namespace {
+    typedef CppAD::vector<double>  d_vector;
+
+    // q for the k-th call; the case q == 0 alternates between one and two
+    size_t order(size_t q, size_t k)
+    {   if( q != 0 )
+            return q;
+        return 1 + k % 2;
+    }
+
+    // seconds per call to Reverse, repeat is the number of calls
+    // (first is true if the memory is freed before each call)
+    double time_reverse(
+        CppAD::ADFun<double>& f       ,
+        size_t                q       ,
+        const d_vector*       w       ,
+        bool                  first   ,
+        d_vector*             dw      )
+    {   CppAD::ADFun<double> g;
+        size_t repeat = 0;
+        double time   = 0.0;
+        while( time < 0.5 )
+        {   size_t k = order(q, repeat);
+            if( first )
+            {   // the copy does not have the memory for the partials
+                g = f;
+                double start = CppAD::elapsed_seconds();
+                dw[k-1]      = g.Reverse(k, w[k-1]);
+                time        += CppAD::elapsed_seconds() - start;
+            }
+            else
+            {   double start = CppAD::elapsed_seconds();
+                dw[k-1]      = f.Reverse(k, w[k-1]);
+                time        += CppAD::elapsed_seconds() - start;
+            }
+            ++repeat;
+        }
+        return time / double(repeat);
+    }
+}
+
+int main(int argc, char* argv[])
+{   using CppAD::AD;
+    size_t nv = 1000000;
+    if( argc > 1 )
+        nv = size_t( std::atof( argv[1] ) );
+    size_t n = nv / 5 + 2;
+    //
+    // record the function
+    CppAD::vector< AD<double> > ax(n), ay(1);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = double(j + 1) / double(n);
+    CppAD::Independent(ax);
+    AD<double> asum = 0.0;
+    for(size_t j = 0; j < n - 1; ++j)
+        asum += sin( ax[j] ) * ax[j+1];
+    ay[0] = asum;
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    // zero and first order Taylor coefficients
+    d_vector x(n), dx(n);
+    for(size_t j = 0; j < n; ++j)
+    {   x[j]  = double(j + 2) / double(n);
+        dx[j] = 1.0;
+    }
+    f.Forward(0, x);
+    f.Forward(1, dx);
+    //
+    // weights for q = 1 and q = 2
+    d_vector w[2];
+    w[0].resize(1);
+    w[1].resize(2);
+    w[0][0] = 1.0;
+    w[1][0] = 1.0;
+    w[1][1] = 0.0;
+    //
+    bool ok = true;
+    size_t      q_list[] = { 1, 2, 0 };
+    const char* name[]   = { "q = 1", "q = 2", "alternate" };
+    for(size_t ell = 0; ell < 3; ++ell)
+    {   size_t   q = q_list[ell];
+        d_vector dw_first[2], dw_repeat[2];
+        double time_first  = time_reverse(f, q, w, true,  dw_first);
+        double time_repeat = time_reverse(f, q, w, false, dw_repeat);
+        std::printf(
+            "nv = %8lu, %-9s, time_first = %10.3e, time_repeat = %10.3e\n",
+            (unsigned long) f.size_var(), name[ell], time_first, time_repeat
+        );
+        //
+        // check the derivatives for the orders that were computed
+        for(size_t k = 0; k < 2; ++k)
+        if( dw_first[k].size() != 0 && dw_repeat[k].size() != 0 )
+        {   ok &= dw_first[k].size() == dw_repeat[k].size();
+            for(size_t i = 0; i < dw_first[k].size() && ok; ++i)
+                ok &= dw_first[k][i] == dw_repeat[k][i];
+        }
+    }
+    if( ! ok )
+    {   std::printf("speed_reverse: Error\n");
+        return 1;
+    }
+    std::printf("speed_reverse: OK\n");
+    return 0;
+}
+/* %$$
+$end
+*/
@@ -245,6 +245,10 @@ namespace {
                 coloring = "colpack";
             if( global_option["symmetric"] )
                 coloring += ".symmetric";
+            else if( global_option["star"] )
+                coloring += ".star";
+            else if( global_option["acyclic"] )
+                coloring += ".acyclic";
             else
                 coloring += ".general";
             //
@@ -303,7 +307,7 @@ bool link_sparse_hessian(
     // check global options
     const char* valid[] = {
         "memory", "onetape", "optimize", "hes2jac", "subgraph",
-        "boolsparsity", "revsparsity", "symmetric"
+        "boolsparsity", "revsparsity", "symmetric", "star", "acyclic"
 # if CPPAD_HAS_COLPACK
         , "colpack"
 # else
@@ -332,6 +336,14 @@ bool link_sparse_hessian(
     {   if( ! global_option["hes2jac"] )
             return false;
     }
+    if( global_option["star"] || global_option["acyclic"] )
+    {   if( global_option["hes2jac"] || global_option["colpack"] )
+            return false;
+        if( global_option["symmetric"] )
+            return false;
+        if( global_option["star"] && global_option["acyclic"] )
+            return false;
+    }
 # if ! CPPAD_HAS_COLPACK
     if( global_option["colpack"] )
         return false;
@@ -171,13 +171,15 @@ bool link_sparse_jacobian(
     if( global_option["colpack"] )
         coloring = "colpack";
 # endif
-    //
-    // maximum number of colors at once
     //
     // do not even record comparison operators
     size_t abort_op_index = 0;
     bool record_compare   = false;
     //
+    // maximum number of colors at once; i.e., number of directions
+    // in each multiple direction forward sweep (this is larger than the
+    // number of colors for all the sizes used by the speed tests
+    // so each Jacobian is computed using one forward sweep)
     size_t group_max = 25;
     // ------------------------------------------------------
     if( ! global_option["onetape"] ) while(repeat--)
@@ -0,0 +1,199 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin speed_sparsity_set.cpp$$
+$spell
+    cppad
+    CppAD
+    jac
+    hes
+    nnz
+    bool
+$$
+
+$section Speed and Memory Test of the Sparsity Set Representations$$
+
+$head Syntax$$
+$codei%speed_sparsity_set %min_n% %max_n%$$
+
+$head Purpose$$
+This program compares the time and memory used by
+$cref for_jac_sparsity$$ and $cref rev_hes_sparsity$$
+for the different representations of the internal sparsity patterns:
+$table
+$icode set$$ $cnext Meaning $rnext
+$code bool$$ $cnext $icode internal_bool$$ is true $rnext
+$code list$$ $cnext
+    $icode internal_bool$$ is false and $cref hybrid_sparsity$$ is false
+$rnext
+$code hybrid$$ $cnext
+    $icode internal_bool$$ is false and $cref hybrid_sparsity$$ is true
+$tend
+
+$head min_n$$
+is the number of independent variables in the first function.
+The default value for $icode min_n$$ is $code 10000$$.
+
+$head max_n$$
+The number of independent variables is multiplied by ten
+until it is greater than $icode max_n$$.
+The default value for $icode max_n$$ is $icode min_n$$.
+
+$head Function$$
+The function has three types of variables:
+$list number$$
+A running sum of the independent variables in order.
+The sparsity pattern for these variables consists of one run.
+$lnext
+A running sum of the independent variables in a random order.
+The sparsity pattern for these variables is dense.
+$lnext
+Products of two independent variables chosen at random.
+The sparsity pattern for these variables is very sparse.
+$lend
+The dependent variables are the last value of each running sum
+and one out of every ten of the products.
+
+$head Output$$
+For each function size and representation, this program prints
+the number of independent variables $icode n$$,
+the number of non-zeros in the Jacobian and Hessian sparsity patterns,
+the seconds used by $code for_jac_sparsity$$ and $code rev_hes_sparsity$$,
+and the memory (in megabytes) used to store the
+forward Jacobian sparsity pattern for all the variables.
+The $code bool$$ representation is skipped when it would use more than
+one gigabyte.
+This program returns a non-zero status if the different representations
+do not give the same sparsity patterns.
+
+$head Implementation$$
+$srccode%cpp% */
+# include <cppad/cppad.hpp>
+# include <cstdlib>
+# include <cstdio>
+
+namespace {
+    typedef CppAD::vector<size_t>         SizeVector;
+    typedef CppAD::sparse_rc<SizeVector> sparsity;
+
+    // create the function
+    void record(size_t n, CppAD::ADFun<double>& f)
+    {   using CppAD::AD;
+        CppAD::vector< AD<double> > ax(n), ay(2 + n / 10);
+        for(size_t j = 0; j < n; ++j)
+            ax[j] = double(j + 1) / double(n);
+        CppAD::Independent(ax);
+        //
+        AD<double> sum_run    = 0.0;
+        AD<double> sum_random = 0.0;
+        size_t seed = 1;
+        for(size_t k = 0; k < n; ++k)
+        {   seed = (seed * 1103515245 + 12345) % 2147483648UL;
+            size_t i = (seed / 16) % n;
+            size_t j = (i + seed / (16 * n) + 1) % n;
+            sum_run    += ax[k];
+            sum_random += ax[i];
+            AD<double> product = ax[i] * ax[j];
+            if( k % 10 == 0 )
+                ay[2 + k / 10] = product;
+        }
+        ay[0] = sum_run;
+        ay[1] = sum_random;
+        f.Dependent(ax, ay);
+    }
+}
+
+int main(int argc, char* argv[])
+{   size_t min_n = 10000;
+    if( argc > 1 )
+        min_n = size_t( std::atof( argv[1] ) );
+    size_t max_n = min_n;
+    if( argc > 2 )
+        max_n = size_t( std::atof( argv[2] ) );
+    //
+    const char* set_name[] = { "bool", "list", "hybrid" };
+    bool ok = true;
+    for(size_t n = min_n; n <= max_n; n *= 10)
+    {   CppAD::ADFun<double> f;
+        record(n, f);
+        size_t m = f.Range();
+        //
+        // pattern for the identity matrix
+        sparsity identity(n, n, n);
+        for(size_t k = 0; k < n; ++k)
+            identity.set(k, k, k);
+        //
+        // all the components of the range
+        CppAD::vector<bool> select_range(m);
+        for(size_t i = 0; i < m; ++i)
+            select_range[i] = true;
+        //
+        size_t check_jac = 0, check_hes = 0;
+        for(size_t k = 0; k < 3; ++k)
+        {   bool internal_bool = k == 0;
+            f.hybrid_sparsity( k == 2 );
+            //
+            // skip bool representation when it uses more than 1GB
+            if( internal_bool )
+            {   double megabyte = double( f.size_var() ) * double(n) / 8e6;
+                if( megabyte > 1e3 )
+                {   std::printf(
+                        "n = %8lu, set = %6s, skipped (%.0f megabytes)\n",
+                        (unsigned long) n, set_name[k], megabyte
+                    );
+                    continue;
+                }
+            }
+            bool transpose  = false;
+            bool dependency = false;
+            sparsity jac, hes;
+            //
+            double start   = CppAD::elapsed_seconds();
+            f.for_jac_sparsity(
+                identity, transpose, dependency, internal_bool, jac
+            );
+            double time_jac = CppAD::elapsed_seconds() - start;
+            size_t memory   = f.size_forward_bool() + f.size_forward_set();
+            //
+            start           = CppAD::elapsed_seconds();
+            f.rev_hes_sparsity(select_range, transpose, internal_bool, hes);
+            double time_hes = CppAD::elapsed_seconds() - start;
+            //
+            std::printf(
+                "n = %8lu, set = %6s, nnz_jac = %9lu, nnz_hes = %9lu, "
+                "time_jac = %8.3f, time_hes = %8.3f, megabyte = %9.2f\n",
+                (unsigned long) n, set_name[k],
+                (unsigned long) jac.nnz(), (unsigned long) hes.nnz(),
+                time_jac, time_hes, double(memory) / 1e6
+            );
+            if( check_jac == 0 )
+            {   check_jac = jac.nnz();
+                check_hes = hes.nnz();
+            }
+            ok &= jac.nnz() == check_jac;
+            ok &= hes.nnz() == check_hes;
+            //
+            // free the forward Jacobian sparsity patterns
+            f.size_forward_bool(0);
+            f.size_forward_set(0);
+        }
+    }
+    if( ! ok )
+    {   std::printf("speed_sparsity_set: Error\n");
+        return 1;
+    }
+    std::printf("speed_sparsity_set: OK\n");
+    return 0;
+}
+/* %$$
+$end
+*/
@@ -0,0 +1,179 @@
+/* --------------------------------------------------------------------------
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
+
+CppAD is distributed under the terms of the
+             Eclipse Public License Version 2.0.
+
+This Source Code may also be made available under the following
+Secondary License when the conditions for such availability set forth
+in the Eclipse Public License, Version 2.0 are satisfied:
+      GNU General Public License, Version 2.0 or later.
+---------------------------------------------------------------------------- */
+/*
+$begin speed_table_interp.cpp$$
+$spell
+    cppad
+    CppAD
+    interp
+    nt
+    nc
+    VecAD
+$$
+
+$section Speed Test of Table Interpolation Using VecAD$$
+
+$head Syntax$$
+$codei%speed_table_interp %nt% %nc%$$
+
+$head Purpose$$
+A $cref VecAD$$ vector that does not have any store operations
+in a recording is a constant table.
+Loads from such a vector use the recording directly
+and zero order forward mode does not need to initialize its elements.
+This program compares the time for
+$codei%%f%.Forward(0, %x%)%$$, $codei%%f%.Forward(1, %dx%)%$$,
+and $codei%%f%.Reverse(1, %w%)%$$
+when the table is constant
+with the time when there is a store operation for the table.
+
+$head nt$$
+is the number of elements in the table.
+The default value for $icode nt$$ is $code 1000$$.
+
+$head nc$$
+is the number of independent variables and the number of
+interpolations in the recording.
+The default value for $icode nc$$ is $code 1000$$.
+
+$head Function$$
+The table contains the values of $latex g(t) = t^2$$
+at $latex t = 0 , \ldots , nt-1$$.
+For each independent variable $latex x_j \in [0, 1)$$,
+the value of $latex g$$ at $latex t = x_j (nt - 2)$$ is approximated
+using linear interpolation in the table.
+The function value is the sum of the $icode nc$$ approximations.
+
+$head Output$$
+For the constant table case ($code constant$$) and
+the case with a store operation ($code store$$),
+this program prints the seconds for each call to the functions above.
+It returns a non-zero status if the results are different
+for the two cases.
+
+$head Implementation$$
+$srccode%cpp% */
+# include <cppad/cppad.hpp>
+# include <cstdlib>
+# include <cstdio>
+
+namespace {
+    using CppAD::AD;
+    typedef CppAD::vector<double> d_vector;
+
+    // record the function; if store is true, store the first element of
+    // the table as a variable so that the table is not constant
+    void record(size_t nt, size_t nc, bool store, CppAD::ADFun<double>& f)
+    {   CppAD::vector< AD<double> > ax(nc), ay(1);
+        for(size_t j = 0; j < nc; ++j)
+            ax[j] = 0.0;
+        CppAD::Independent(ax);
+        //
+        // table of values for g(t) and the corresponding t
+        CppAD::VecAD<double> table(nt), grid(nt);
+        for(size_t k = 0; k < nt; ++k)
+        {   AD<double> ak = double(k);
+            table[ak] = double(k) * double(k);
+            grid[ak]  = double(k);
+        }
+        if( store )
+        {   AD<double> azero = 0.0;
+            table[azero] = ax[0] - ax[0];
+        }
+        //
+        AD<double> asum = 0.0;
+        for(size_t j = 0; j < nc; ++j)
+        {   AD<double> at    = ax[j] * double(nt - 2);
+            AD<double> aleft = table[at];
+            AD<double> aright = table[at + 1.0];
+            asum += aleft + (aright - aleft) * (at - grid[at]);
+        }
+        ay[0] = asum;
+        f.Dependent(ax, ay);
+    }
+
+    // seconds per call to Forward(0, x), Forward(1, dx), or Reverse(1, w)
+    double time_sweep(CppAD::ADFun<double>& f, const d_vector& x, size_t k)
+    {   size_t n = x.size();
+        d_vector y(1), dx(n), dy(1), w(1), dw(n);
+        for(size_t j = 0; j < n; ++j)
+            dx[j] = 1.0;
+        w[0] = 1.0;
+        f.Forward(0, x);
+        size_t repeat = 1;
+        double time   = 0.0;
+        while( time < 0.5 )
+        {   double start = CppAD::elapsed_seconds();
+            for(size_t r = 0; r < repeat; ++r)
+            {   if( k == 0 )
+                    y = f.Forward(0, x);
+                else if( k == 1 )
+                    dy = f.Forward(1, dx);
+                else
+                    dw = f.Reverse(1, w);
+            }
+            time    = CppAD::elapsed_seconds() - start;
+            repeat *= 2;
+        }
+        return time / double(repeat / 2);
+    }
+}
+
+int main(int argc, char* argv[])
+{   size_t nt = 1000;
+    size_t nc = 1000;
+    if( argc > 1 )
+        nt = size_t( std::atof( argv[1] ) );
+    if( argc > 2 )
+        nc = size_t( std::atof( argv[2] ) );
+    //
+    d_vector x(nc), w(1), dw(nc), y_check(1), dw_check(nc);
+    for(size_t j = 0; j < nc; ++j)
+        x[j] = double( (j * 7) % nc ) / double(nc);
+    w[0] = 1.0;
+    //
+    bool ok = true;
+    const char* case_name[] = { "constant", "store" };
+    for(size_t k_case = 0; k_case < 2; ++k_case)
+    {   CppAD::ADFun<double> f;
+        record(nt, nc, k_case == 1, f);
+        double time_zero    = time_sweep(f, x, 0);
+        double time_first   = time_sweep(f, x, 1);
+        double time_reverse = time_sweep(f, x, 2);
+        std::printf(
+            "nt = %6lu, nc = %6lu, table = %8s, forward(0) = %10.3e, "
+            "forward(1) = %10.3e, reverse(1) = %10.3e\n",
+            (unsigned long) nt, (unsigned long) nc, case_name[k_case],
+            time_zero, time_first, time_reverse
+        );
+        //
+        // check the results
+        d_vector y = f.Forward(0, x);
+        dw         = f.Reverse(1, w);
+        if( k_case == 0 )
+        {   y_check  = y;
+            dw_check = dw;
+        }
+        ok &= CppAD::NearEqual(y[0], y_check[0], 1e-10, 1e-10);
+        for(size_t j = 0; j < nc; ++j)
+            ok &= CppAD::NearEqual(dw[j], dw_check[j], 1e-10, 1e-10);
+    }
+    if( ! ok )
+    {   std::printf("speed_table_interp: Error\n");
+        return 1;
+    }
+    std::printf("speed_table_interp: OK\n");
+    return 0;
+}
+/* %$$
+$end
+*/
@@ -81,6 +81,7 @@ $spell
     lu
     Jacobian
     cppadcg
+    jit
 $$
 
 
@@ -239,6 +240,53 @@ The CppAD $cref/sparse_jacobian/link_sparse_jacobian/$$
 test is implemented for this option.
 In addition, the CppAD $cref/sparse_hessian/link_sparse_hessian/$$
 test is implemented for this option when $code hes2jac$$ is present.
+The $cref/subgraph_jac/thread_test.cpp/subgraph_jac/$$
+multi-threading test times the subgraph Jacobian calculation
+with its rows partitioned between different numbers of threads.
+
+$subhead direct$$
+If this option is present,
+$cref speed_cppad$$ will use
+$cref/direct dispatch/forward_direct/$$ for zero order forward mode.
+The CppAD $cref/det_minor/link_det_minor/$$ and
+$cref/mat_mul/link_mat_mul/$$ tests are implemented for this option.
+Note that this option is usually slower unless it is combined with the
+$code onetape$$ option.
+
+$subhead jit$$
+If this option is present,
+$cref speed_cppad$$ will $cref/compile/jit/$$ the operation sequence
+to native code for zero order forward and first order reverse mode.
+The CppAD $cref/det_minor/link_det_minor/$$ and
+$cref/mat_mul/link_mat_mul/$$ tests are implemented for this option.
+Note that this option is much slower unless it is combined with the
+$code onetape$$ option.
+
+$subhead binary$$
+If this option is present,
+$cref speed_cppad$$ will save the operation sequence using the
+$cref/binary format/binary_tape/$$.
+If $code onetape$$ is not present,
+the operation sequence is recorded once and then loaded from the
+binary format, instead of being recorded, for each repetition.
+Comparing with the same test without this option shows the time to
+load a function versus the time to record it.
+If $code onetape$$ is present, the operation sequence is
+saved and loaded once before the repetitions.
+The CppAD $cref/det_minor/link_det_minor/$$ test is implemented
+for this option.
+
+$subhead compact$$
+If this option is present,
+$cref speed_cppad$$ will store the operation sequence using the
+$cref/compact encoding/compact_op_seq/$$.
+The CppAD $cref/det_minor/link_det_minor/$$ and
+$cref/mat_mul/link_mat_mul/$$ tests are implemented for this option.
+Comparing with the same test without this option shows the
+change in playback speed.
+If $code onetape$$ is also present,
+the memory allocated at the end of the test
+(which includes the operation sequence) shows the change in memory.
 
 $head Sparsity Options$$
 The following options only apply to the
@@ -281,6 +329,25 @@ The CppAD
 $cref/sparse_hessian/link_sparse_hessian/$$ test
 is implemented for this option.
 
+$subhead star$$
+If this option is present, CppAD will use the
+$cref/cppad.star/sparse_hes/coloring/cppad.star/$$ coloring method
+for computing sparse Hessians.
+The CppAD
+$cref/sparse_hessian/link_sparse_hessian/$$ test
+is implemented for this option when
+$code hes2jac$$, $code colpack$$, and $code symmetric$$ are not present.
+
+$subhead acyclic$$
+If this option is present, CppAD will use the
+$cref/cppad.acyclic/sparse_hes/coloring/cppad.acyclic/$$ coloring method
+for computing sparse Hessians.
+The CppAD
+$cref/sparse_hessian/link_sparse_hessian/$$ test
+is implemented for this option when
+$code hes2jac$$, $code colpack$$, $code symmetric$$, and $code star$$
+are not present.
+
 $head Correctness Results$$
 One, but not both, of the following two output lines
 $codei%
@@ -411,11 +478,17 @@ namespace {
         "atomic",
         "hes2jac",
         "subgraph",
+        "direct",
+        "jit",
+        "binary",
+        "compact",
         "boolsparsity",
         "revsparsity",
         "subsparsity",
         "colpack",
-        "symmetric"
+        "symmetric",
+        "star",
+        "acyclic"
     };
     size_t num_option = sizeof(option_list) / sizeof( option_list[0] );
     // ----------------------------------------------------------------
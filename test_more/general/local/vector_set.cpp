@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -234,6 +234,106 @@ bool test_post(void)
     return ok;
 }
 
+// compare the results of a sequence of operations with pack_setvec
+// (the sets are dense, sparse, and consist of runs)
+template<class SetVector>
+bool test_compare(void)
+{   bool ok = true;
+    typedef CppAD::local::sparse::pack_setvec check_type;
+    //
+    SetVector  vec_set, other;
+    check_type check_set, check_other;
+    size_t n_set = 12;
+    size_t end   = 300;
+    vec_set.resize(n_set, end);
+    other.resize(n_set, end);
+    check_set.resize(n_set, end);
+    check_other.resize(n_set, end);
+    //
+    // set[0] is sparse, set[1] is dense, set[2] has runs
+    for(size_t j = 0; j < end; ++j)
+    {   if( j % 37 == 5 )
+        {   vec_set.add_element(0, j);
+            check_set.add_element(0, j);
+        }
+        if( j % 3 != 0 && j > 20 )
+        {   vec_set.post_element(1, j);
+            check_set.post_element(1, j);
+        }
+        if( (j / 40) % 2 == 1 )
+        {   vec_set.post_element(2, j);
+            check_set.post_element(2, j);
+        }
+    }
+    vec_set.process_post(1);
+    check_set.process_post(1);
+    vec_set.process_post(2);
+    check_set.process_post(2);
+    //
+    // other[i] = set[i]
+    for(size_t i = 0; i < 3; ++i)
+    {   other.assignment(i, i, vec_set);
+        check_other.assignment(i, i, check_set);
+    }
+    //
+    // sequence of operations
+    size_t seed = 1;
+    for(size_t k = 0; k < 400; ++k)
+    {   seed = (seed * 1103515245 + 12345) % 2147483648UL;
+        size_t target = (seed / 7)  % n_set;
+        size_t left   = (seed / 11) % n_set;
+        size_t right  = (seed / 13) % n_set;
+        size_t j      = (seed / 17) % end;
+        switch( (seed / 3) % 6 )
+        {   case 0:
+            vec_set.binary_union(target, left, right, vec_set);
+            check_set.binary_union(target, left, right, check_set);
+            break;
+
+            case 1:
+            vec_set.binary_union(target, left, right, other);
+            check_set.binary_union(target, left, right, check_other);
+            break;
+
+            case 2:
+            vec_set.binary_intersection(target, left, right, vec_set);
+            check_set.binary_intersection(target, left, right, check_set);
+            break;
+
+            case 3:
+            vec_set.add_element(target, j);
+            check_set.add_element(target, j);
+            break;
+
+            case 4:
+            vec_set.assignment(target, left, vec_set);
+            check_set.assignment(target, left, check_set);
+            break;
+
+            default:
+            if( k % 10 == 0 )
+            {   vec_set.clear(target);
+                check_set.clear(target);
+            }
+            break;
+        }
+        // check all the sets
+        for(size_t i = 0; i < n_set; ++i)
+        {   typename SetVector::const_iterator itr(vec_set, i);
+            check_type::const_iterator check_itr(check_set, i);
+            ok &= vec_set.number_elements(i) == check_set.number_elements(i);
+            while( *check_itr != end )
+            {   ok &= *itr == *check_itr;
+                ok &= vec_set.is_element(i, *itr);
+                ++itr;
+                ++check_itr;
+            }
+            ok &= *itr == end;
+        }
+    }
+    return ok;
+}
+
 } // END empty namespace
 
 bool vector_set(void)
@@ -242,18 +342,25 @@ bool vector_set(void)
     ok     &= test_no_other<CppAD::local::sparse::pack_setvec>();
     ok     &= test_no_other<CppAD::local::sparse::list_setvec>();
     ok     &= test_no_other<CppAD::local::sparse::svec_setvec>();
+    ok     &= test_no_other<CppAD::local::sparse::hybrid_setvec>();
     //
     ok     &= test_yes_other<CppAD::local::sparse::pack_setvec>();
     ok     &= test_yes_other<CppAD::local::sparse::list_setvec>();
     ok     &= test_yes_other<CppAD::local::sparse::svec_setvec>();
+    ok     &= test_yes_other<CppAD::local::sparse::hybrid_setvec>();
     //
     ok     &= test_intersection<CppAD::local::sparse::pack_setvec>();
     ok     &= test_intersection<CppAD::local::sparse::list_setvec>();
     ok     &= test_intersection<CppAD::local::sparse::svec_setvec>();
+    ok     &= test_intersection<CppAD::local::sparse::hybrid_setvec>();
     //
     ok     &= test_post<CppAD::local::sparse::pack_setvec>();
     ok     &= test_post<CppAD::local::sparse::list_setvec>();
     ok     &= test_post<CppAD::local::sparse::svec_setvec>();
+    ok     &= test_post<CppAD::local::sparse::hybrid_setvec>();
+    //
+    ok     &= test_compare<CppAD::local::sparse::list_setvec>();
+    ok     &= test_compare<CppAD::local::sparse::hybrid_setvec>();
     //
     return ok;
 }
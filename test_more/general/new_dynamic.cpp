@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -737,6 +737,73 @@ bool dynamic_discrete(void)
     return ok;
 }
 // ----------------------------------------------------------------------------
+// compare new_dynamic with changed indices to new_dynamic for all indices
+bool dynamic_changed(void)
+{   bool ok = true;
+    using CppAD::AD;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // checkpoint version of g(x) = x[0] * x[1];
+    ADvector ax(2), ay(1);
+    ax[0] = 2.0;
+    ax[1] = 3.0;
+    CppAD::checkpoint<double> atom_g("g_algo", g_algo, ax, ay);
+
+    // independent dynamic parameters
+    size_t nd = 6;
+    ADvector adynamic(nd);
+    for(size_t j = 0; j < nd; ++j)
+        adynamic[j] = double(j + 1);
+
+    // record a function with a chain of dynamic parameter operations
+    ax.resize(1);
+    ax[0] = 1.0;
+    size_t abort_op_index = 0;
+    bool   record_compare = true;
+    Independent(ax, abort_op_index, record_compare, adynamic);
+    ADvector au(2), aw(1);
+    au[0] = adynamic[0] + adynamic[1];
+    au[1] = exp( adynamic[2] / 10.0 );
+    atom_g(au, aw);
+    AD<double> asum = 0.0;
+    for(size_t j = 3; j < nd; ++j)
+        asum += adynamic[j] * adynamic[j-1];
+    AD<double> acond = CppAD::CondExpLt(
+        adynamic[4], AD<double>(5.0), aw[0], asum
+    );
+    ay.resize(4);
+    ay[0] = ax[0] * aw[0];
+    ay[1] = ax[0] + asum;
+    ay[2] = ax[0] * acond;
+    ay[3] = ax[0] * n_digits( adynamic[5] * 10.0 );
+    CppAD::ADFun<double> f(ax, ay), g;
+    g = f;
+
+    // change a few of the dynamic parameters at a time
+    CPPAD_TESTVECTOR(double) x(1), dynamic(nd), yf(4), yg(4);
+    // (one change uses the dependency cone, two uses a full sweep)
+    CPPAD_TESTVECTOR(size_t) changed;
+    for(size_t j = 0; j < nd; ++j)
+        dynamic[j] = double(j + 1);
+    x[0] = 2.0;
+    for(size_t k = 0; k < 4 * nd; ++k)
+    {   changed.resize(1 + k % 2);
+        changed[0] = k % nd;
+        dynamic[ changed[0] ] += 1.5;
+        if( changed.size() == 2 )
+        {   changed[1] = (3 * k + 1) % nd;
+            dynamic[ changed[1] ] -= 0.5;
+        }
+        f.new_dynamic(dynamic, changed);
+        g.new_dynamic(dynamic);
+        yf = f.Forward(0, x);
+        yg = g.Forward(0, x);
+        for(size_t i = 0; i < 4; ++i)
+            ok &= CppAD::NearEqual(yf[i], yg[i], eps99, eps99);
+    }
+    return ok;
+}
+// ----------------------------------------------------------------------------
 bool dynamic_optimize(void)
 {   bool ok = true;
     using CppAD::AD;
@@ -838,6 +905,7 @@ bool new_dynamic(void)
     ok     &= dynamic_atomic();
     ok     &= dynamic_discrete();
     ok     &= dynamic_optimize();
+    ok     &= dynamic_changed();
     //
     return ok;
 }
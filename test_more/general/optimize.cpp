@@ -1835,6 +1835,78 @@ namespace {
         return ok;
     }
     //
+    // Test skipping long blocks of operators that contain an atomic call
+    bool cond_exp_skip_block(void)
+    {   bool ok = true;
+        using CppAD::AD;
+        using CppAD::NearEqual;
+        double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+        using CppAD::vector;
+
+        // Create a checkpoint version of the function i_algo
+        vector< AD<double> > au(1), av(1);
+        au[0] = 1.0;
+        CppAD::checkpoint<double> i_check("i_check", i_algo, au, av);
+
+        // independent variable vector
+        size_t nc = 5;
+        vector< AD<double> > ax(nc), ay(1);
+        for(size_t i = 0; i < nc; ++i)
+            ax[i] = double(i + 1);
+        Independent(ax);
+
+        // each branch has more operators than are stepped over one at a time
+        AD<double> zero = 0.0;
+        AD<double> asum = 0.0;
+        for(size_t i = 0; i < nc; ++i)
+        {   AD<double> aleft  = ax[i];
+            AD<double> aright = ax[i];
+            for(size_t k = 0; k < 10; ++k)
+                aleft = aleft * 0.5 + 1.0;
+            au[0] = aleft;
+            i_check(au, av);
+            aleft = av[0];
+            for(size_t k = 0; k < 10; ++k)
+                aleft = aleft * 0.5 + 1.0;
+            for(size_t k = 0; k < 20; ++k)
+                aright = aright * 0.25 - ax[(i + 1) % nc];
+            asum += CondExpLt(ax[i], zero, aleft, aright);
+        }
+        ay[0] = asum;
+
+        // create function object f : ax -> ay
+        CppAD::ADFun<double> f(ax, ay), g;
+
+        // values of x for which different branches are skipped
+        vector<double> x(nc), dx(nc), y_before(1), dy_before(1);
+        vector<double> y_after(1), dy_after(1);
+        for(size_t i = 0; i < nc; ++i)
+        {   x[i]  = double( int(i % 3) - 1 ) / 4.0 + 0.125;
+            dx[i] = double(i + 1);
+        }
+        y_before  = f.Forward(0, x);
+        dy_before = f.Forward(1, dx);
+        if( conditional_skip_ )
+            f.optimize();
+        else
+            f.optimize("no_conditional_skip");
+        //
+        for(size_t compact = 0; compact < 2; ++compact)
+        {   g = f;
+            g.compact_op_seq( compact == 1 );
+            y_after  = g.Forward(0, x);
+            dy_after = g.Forward(1, dx);
+            ok &= NearEqual(y_before[0], y_after[0], eps99, eps99);
+            ok &= NearEqual(dy_before[0], dy_after[0], eps99, eps99);
+            if( conditional_skip_ )
+                ok &= g.number_skip() > 0;
+            else
+                ok &= g.number_skip() == 0;
+        }
+
+        return ok;
+    }
+    //
     // Test bug where conditional dependence did not pass through
     // atomic functions
     bool cond_exp_atomic_dependence(void)
@@ -2120,6 +2192,57 @@ namespace {
         return ok;
     }
 
+    // -----------------------------------------------------------------------
+    // check the grow_hash_table option
+    bool grow_hash_table(void)
+    {   bool ok = true;
+        using CppAD::AD;
+        using CppAD::vector;
+        //
+        double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+        //
+        // number of independent variables
+        size_t n = 200;
+        //
+        // f(x) = sum_i x[i] * x[j] + x[j] * x[i] + x[i] * x[j]
+        // where j = (i + 1) % n and the terms are in different parts
+        // of the operation sequence.
+        vector< AD<double> > ax(n), ay(1);
+        for(size_t i = 0; i < n; ++i)
+            ax[i] = double(i + 1);
+        CppAD::Independent(ax);
+        AD<double> asum = 0.0;
+        for(size_t k = 0; k < 3; ++k)
+        {   for(size_t i = 0; i < n; ++i)
+            {   size_t j = (i + 1) % n;
+                if( k == 1 )
+                    asum += ax[j] * ax[i];
+                else
+                    asum += ax[i] * ax[j];
+            }
+        }
+        ay[0] = asum;
+        CppAD::ADFun<double> f(ax, ay), g;
+        g = f;
+        //
+        // value of x where we are computing the function
+        vector<double> x(n), y_before(1), y_after(1);
+        for(size_t i = 0; i < n; ++i)
+            x[i] = 1.0 / double(i + 1);
+        y_before = f.Forward(0, x);
+        //
+        // all of the duplicate products are removed with either option
+        f.optimize("grow_hash_table");
+        g.optimize();
+        ok &= f.size_var() == g.size_var();
+        ok &= f.size_var() == 1 + n + n + 1;
+        //
+        y_after  = f.Forward(0, x);
+        ok &= CppAD::NearEqual(y_before[0], y_after[0], eps99, eps99);
+        //
+        return ok;
+    }
+
     // -----------------------------------------------------------------------
     // Test case with print operator in optimized f
     bool check_print_for(void)
@@ -2309,6 +2432,8 @@ bool optimize(void)
         ok     &= discrete_function();
         // check conditional skip of an atomic function
         ok     &= cond_exp_skip_atomic();
+        // check skipping blocks of operators that contain an atomic call
+        ok     &= cond_exp_skip_block();
         // check conditional dependence through atomic function
         ok     &= cond_exp_atomic_dependence();
         // check reverse mode conditional skipping
@@ -2326,6 +2451,7 @@ bool optimize(void)
 
     // not using conditional_skip or atomic functions
     ok &= only_check_variables_when_hash_codes_match();
+    ok &= grow_hash_table();
     // -----------------------------------------------------------------------
     //
     CppAD::user_atomic<double>::clear();
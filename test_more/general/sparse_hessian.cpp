@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-17 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -99,6 +99,70 @@ bool rc_tridiagonal(void)
 }
 
 
+// compare the star and acyclic colorings with the symmetric coloring
+bool star_acyclic_random(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps99 = 99.0 * std::numeric_limits<double>::epsilon();
+
+    // function with products of random pairs of components of x
+    size_t n = 30;
+    size_t m = 40;
+    CPPAD_TESTVECTOR(AD<double>) a_x(n), a_y(m);
+    CPPAD_TESTVECTOR(double) x(n), w(m);
+    for(size_t j = 0; j < n; j++)
+        a_x[j] = x[j] = double(j + 1) / double(n);
+    CppAD::Independent(a_x);
+    size_t seed = 1;
+    for(size_t i = 0; i < m; i++)
+    {   seed = (seed * 1103515245 + 12345) % 2147483648UL;
+        size_t j1 = (seed / 16) % n;
+        size_t j2 = (seed / (16 * n)) % n;
+        a_y[i] = a_x[j1] * a_x[j2] * a_x[i % n];
+        w[i]   = double(i + 1);
+    }
+    CppAD::ADFun<double> f(a_x, a_y);
+
+    // sparsity pattern for the Hessian
+    typedef CppAD::vector< std::set<size_t> > SetVector;
+    SetVector p_r(n);
+    for(size_t j = 0; j < n; j++)
+        p_r[j].insert(j);
+    f.ForSparseJac(n, p_r);
+    SetVector p_s(1);
+    for(size_t i = 0; i < m; i++)
+        p_s[0].insert(i);
+    SetVector p_h = f.RevSparseHes(n, p_s);
+
+    // all the entries in the sparsity pattern
+    CPPAD_TESTVECTOR(size_t) r, c;
+    for(size_t i = 0; i < n; i++)
+    {   std::set<size_t>::const_iterator itr;
+        for(itr = p_h[i].begin(); itr != p_h[i].end(); itr++)
+        {   r.push_back(i);
+            c.push_back(*itr);
+        }
+    }
+    size_t K = r.size();
+
+    // compute the Hessian using the different colorings
+    const char* color_method[] = {
+        "cppad.symmetric", "cppad.star", "cppad.acyclic"
+    };
+    CPPAD_TESTVECTOR(double) hes[3];
+    for(size_t ell = 0; ell < 3; ell++)
+    {   CppAD::sparse_hessian_work work;
+        work.color_method = color_method[ell];
+        hes[ell].resize(K);
+        f.SparseHessian(x, w, p_h, r, c, hes[ell], work);
+        for(size_t k = 0; k < K; k++)
+            ok &= NearEqual(hes[0][k], hes[ell][k], eps99, eps99);
+    }
+    return ok;
+}
+
+
 template <class BaseVector, class BoolVector>
 bool bool_case()
 {   bool ok = true;
@@ -238,6 +302,7 @@ bool sparse_hessian(void)
 {   bool ok = true;
 
     ok &= rc_tridiagonal();
+    ok &= star_acyclic_random();
     // ---------------------------------------------------------------
     // vector of bool cases
     ok &= bool_case< CppAD::vector  <double>, CppAD::vectorBool   >();
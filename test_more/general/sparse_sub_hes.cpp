@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-18 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -216,9 +216,13 @@ bool sparse_sub_hes(void)
 {   bool ok = true;
     ok &= test_set("cppad.symmetric");
     ok &= test_set("cppad.general");
+    ok &= test_set("cppad.star");
+    ok &= test_set("cppad.acyclic");
     //
     ok &= test_bool("cppad.symmetric");
     ok &= test_bool("cppad.general");
+    ok &= test_bool("cppad.star");
+    ok &= test_bool("cppad.acyclic");
     return ok;
 }
 // END C++
@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-18 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -56,10 +56,50 @@ bool test_subgraph_subset(void)
     return ok;
 }
 
+// conditional expression with variable left, right, if_true and if_false
+bool test_subgraph_cond_exp(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::vector;
+    typedef vector<double> d_vector;
+    typedef vector<size_t> s_vector;
+    //
+    size_t n = 4;
+    d_vector x(n);
+    vector< AD<double> > ax(n), ay(1);
+    for(size_t j = 0; j < n; ++j)
+        ax[j] = x[j] = double(j + 1);
+    CppAD::Independent(ax);
+    ay[0] = CppAD::CondExpLt(ax[0], ax[1], ax[2] * ax[2], ax[3] * ax[3]);
+    CppAD::ADFun<double> f(ax, ay);
+    //
+    CppAD::sparse_rc<s_vector> pattern(1, n, n);
+    for(size_t j = 0; j < n; ++j)
+        pattern.set(j, 0, j);
+    //
+    // x[0] < x[1] so y = x[2] * x[2]
+    CppAD::sparse_rcv<s_vector, d_vector> subset( pattern );
+    f.subgraph_jac_rev(x, subset);
+    const d_vector& val = subset.val();
+    ok &= val[0] == 0.0;
+    ok &= val[1] == 0.0;
+    ok &= val[2] == 2.0 * x[2];
+    ok &= val[3] == 0.0;
+    //
+    // x[0] > x[1] so y = x[3] * x[3]
+    x[0] = 3.0;
+    f.subgraph_jac_rev(x, subset);
+    ok &= val[2] == 0.0;
+    ok &= val[3] == 2.0 * x[3];
+    //
+    return ok;
+}
+
 } // END_EMPTY_NAMESPACE
 
 bool subgraph_2(void)
 {   bool ok = true;
     ok &= test_subgraph_subset();
+    ok &= test_subgraph_cond_exp();
     return ok;
 }
@@ -1,5 +1,5 @@
 /* --------------------------------------------------------------------------
-CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-19 Bradley M. Bell
+CppAD: C++ Algorithmic Differentiation: Copyright (C) 2003-20 Bradley M. Bell
 
 CppAD is distributed under the terms of the
              Eclipse Public License Version 2.0.
@@ -294,6 +294,67 @@ bool SecondOrderReverse(void)
     return ok;
 }
 
+// check loads from a vector with and without store operators
+bool table_load(void)
+{   bool ok = true;
+    using CppAD::AD;
+    using CppAD::NearEqual;
+    double eps = 10. * CppAD::numeric_limits<double>::epsilon();
+
+    // independent variables
+    size_t n = 2;
+    CPPAD_TESTVECTOR(AD<double>) ax(n), ay(1);
+    ax[0] = 2.0;
+    ax[1] = 3.0;
+    CppAD::Independent(ax);
+
+    // table that does not have any store operators
+    size_t nt = 5;
+    CppAD::VecAD<double> table(nt), other(nt);
+    for(size_t k = 0; k < nt; ++k)
+    {   AD<double> ak = double(k);
+        table[ak] = double(k * k);
+        other[ak] = double(k);
+    }
+    // vector that has a store operator
+    AD<double> azero = 0.0;
+    other[azero] = ax[1];
+
+    // y = table[x0] * x1 + table[1] + other[x0] * x1
+    AD<double> aone = 1.0;
+    ay[0] = table[ ax[0] ] * ax[1] + table[aone] + other[ ax[0] ] * ax[1];
+    CppAD::ADFun<double> f(ax, ay);
+
+    CPPAD_TESTVECTOR(double) x(n), y(1), dx(n), dy(1), w(1), dw(n);
+    w[0] = 1.0;
+    for(size_t compact = 0; compact < 2; ++compact)
+    {   f.compact_op_seq( compact == 1 );
+        for(size_t k = 0; k < 2; ++k)
+        {   // k == 0 loads a parameter and k == 1 loads a variable from other
+            x[0] = double( 3 * (1 - k) );
+            x[1] = 4.0;
+            y    = f.Forward(0, x);
+            double t = x[0] * x[0];
+            if( k == 0 )
+                ok &= NearEqual(y[0], t * x[1] + 1.0 + x[0] * x[1], eps, eps);
+            else
+                ok &= NearEqual(y[0], t * x[1] + 1.0 + x[1] * x[1], eps, eps);
+            //
+            dx[0] = 0.0;
+            dx[1] = 1.0;
+            dy    = f.Forward(1, dx);
+            dw    = f.Reverse(1, w);
+            double check = t + x[0];
+            if( k == 1 )
+                check = t + 2.0 * x[1];
+            ok &= NearEqual(dy[0], check, eps, eps);
+            ok &= NearEqual(dw[1], check, eps, eps);
+            ok &= dw[0] == 0.0;
+        }
+    }
+    return ok;
+}
+
 } // END empty namespace
 
 bool VecAD(void)
@@ -302,5 +363,6 @@ bool VecAD(void)
     ok &= VecADTestOne();
     ok &= VecADTestTwo();
     ok &= SecondOrderReverse();
+    ok &= table_load();
     return ok;
 }